@@ -38,12 +38,27 @@
 
 #include <rtems.h>
 #include <rtems/chain.h>
+#include <rtems/counter.h>
 #include <rtems/score/assert.h>
 
 #include <bsp/irq-generic.h>
 
 #define BSP_INTERRUPT_SERVER_MANAGEMENT_VECTOR BSP_INTERRUPT_VECTOR_COUNT
 
+/*
+ * Entries for valid interrupt vectors are allocated by
+ * bsp_interrupt_server_install_helper() and carry the handler statistics.
+ */
+typedef struct {
+  rtems_interrupt_server_entry base;
+  rtems_counter_ticks trigger;
+  uint32_t count;
+  uint64_t latency_max;
+  uint64_t latency_total;
+  uint64_t run_time_max;
+  uint64_t run_time_total;
+} bsp_interrupt_server_vector_entry;
+
 static rtems_interrupt_server_control bsp_interrupt_server_default;
 
 static rtems_chain_control bsp_interrupt_server_chain =
@@ -81,22 +96,47 @@ static void bsp_interrupt_server_trigger(void *arg)
   rtems_interrupt_lock_context lock_context;
   rtems_interrupt_server_entry *e = arg;
   rtems_interrupt_server_control *s = e->server;
+  bool was_empty;
 
   if (bsp_interrupt_is_valid_vector(e->vector)) {
     bsp_interrupt_vector_disable(e->vector);
+    ((bsp_interrupt_server_vector_entry *) e)->trigger = rtems_counter_read();
+
+    /*
+     * Service the interrupt by the worker of the processor which took the
+     * interrupt.  The interrupt vector stays disabled until the entry was
+     * serviced, so an entry is never serviced by two workers at a time.
+     */
+    if (s->workers != NULL) {
+      rtems_interrupt_server_control *w;
+
+      w = s->workers[rtems_scheduler_get_processor()];
+
+      if (w != NULL) {
+        s = w;
+      }
+    }
   }
 
   rtems_interrupt_lock_acquire(&s->lock, &lock_context);
 
   if (rtems_chain_is_node_off_chain(&e->node)) {
+    was_empty = rtems_chain_is_empty(&s->entries);
     rtems_chain_append_unprotected(&s->entries, &e->node);
   } else {
+    was_empty = false;
     ++s->errors;
   }
 
   rtems_interrupt_lock_release(&s->lock, &lock_context);
 
-  rtems_event_system_send(s->server, RTEMS_EVENT_SYSTEM_SERVER);
+  /*
+   * The server task services all pending entries before it waits for the next
+   * event, so only the first entry of a burst has to wake it up.
+   */
+  if (was_empty) {
+    rtems_event_system_send(s->server, RTEMS_EVENT_SYSTEM_SERVER);
+  }
 }
 
 typedef struct {
@@ -171,7 +211,7 @@ static void bsp_interrupt_server_install_helper(void *arg)
 
   e = bsp_interrupt_server_query_entry(hd->vector, &trigger_options);
   if (e == NULL) {
-    e = calloc(1, sizeof(*e));
+    e = calloc(1, sizeof(bsp_interrupt_server_vector_entry));
     if (e != NULL) {
       e->server = hd->server;
       e->vector = hd->vector;
@@ -229,19 +269,27 @@ static void bsp_interrupt_server_install_helper(void *arg)
   rtems_event_transient_send(hd->task);
 }
 
+static void bsp_interrupt_server_synchronize_workers(
+  rtems_interrupt_server_control *s
+);
+
 static void bsp_interrupt_server_remove_helper(void *arg)
 {
   bsp_interrupt_server_helper_data *hd = arg;
   rtems_status_code sc;
   rtems_interrupt_server_entry *e;
+  rtems_interrupt_server_action *c;
   rtems_option trigger_options;
+  bool remove_last;
+
+  c = NULL;
+  remove_last = false;
 
   bsp_interrupt_lock();
 
   e = bsp_interrupt_server_query_entry(hd->vector, &trigger_options);
   if (e != NULL) {
     rtems_interrupt_server_action **link = &e->actions;
-    rtems_interrupt_server_action *c;
 
     while ((c = *link) != NULL) {
       if (c->handler == hd->handler && c->arg == hd->arg) {
@@ -252,7 +300,7 @@ static void bsp_interrupt_server_remove_helper(void *arg)
     }
 
     if (c != NULL) {
-      bool remove_last = e->actions->next == NULL;
+      remove_last = e->actions->next == NULL;
 
       if (remove_last) {
         rtems_interrupt_handler_remove(
@@ -263,12 +311,6 @@ static void bsp_interrupt_server_remove_helper(void *arg)
       }
 
       *link = c->next;
-      free(c);
-
-      if (remove_last) {
-        free(e);
-      }
-
       sc = RTEMS_SUCCESSFUL;
     } else {
       sc = RTEMS_UNSATISFIED;
@@ -279,6 +321,17 @@ static void bsp_interrupt_server_remove_helper(void *arg)
 
   bsp_interrupt_unlock();
 
+  if (c != NULL) {
+    /* A worker may still service the entry, wait until it is done */
+    bsp_interrupt_server_synchronize_workers(e->server);
+
+    free(c);
+
+    if (remove_last) {
+      free(e);
+    }
+  }
+
   hd->sc = sc;
   rtems_event_transient_send(hd->task);
 }
@@ -316,6 +369,42 @@ static rtems_status_code bsp_interrupt_server_call_helper(
   return hd.sc;
 }
 
+static void bsp_interrupt_server_entry_synchronize_helper(void *arg)
+{
+  bsp_interrupt_server_helper_data *hd = arg;
+
+  rtems_event_transient_send(hd->task);
+}
+
+static void bsp_interrupt_server_synchronize_workers(
+  rtems_interrupt_server_control *s
+)
+{
+  uint32_t cpu_max;
+  uint32_t cpu_index;
+
+  if (s->workers == NULL) {
+    return;
+  }
+
+  cpu_max = rtems_scheduler_get_processor_maximum();
+
+  for (cpu_index = 0; cpu_index < cpu_max; ++cpu_index) {
+    rtems_interrupt_server_control *w = s->workers[cpu_index];
+
+    if (w != NULL) {
+      bsp_interrupt_server_call_helper(
+        w,
+        BSP_INTERRUPT_SERVER_MANAGEMENT_VECTOR,
+        0,
+        NULL,
+        NULL,
+        bsp_interrupt_server_entry_synchronize_helper
+      );
+    }
+  }
+}
+
 static rtems_interrupt_server_entry *bsp_interrupt_server_get_entry(
   rtems_interrupt_server_control *s
 )
@@ -338,6 +427,36 @@ static rtems_interrupt_server_entry *bsp_interrupt_server_get_entry(
   return e;
 }
 
+static void bsp_interrupt_server_update_statistics(
+  rtems_interrupt_server_entry *e,
+  rtems_counter_ticks begin
+)
+{
+  bsp_interrupt_server_vector_entry *ve;
+  uint64_t latency;
+  uint64_t run_time;
+
+  ve = (bsp_interrupt_server_vector_entry *) e;
+  latency = rtems_counter_ticks_to_nanoseconds(
+    rtems_counter_difference(begin, ve->trigger)
+  );
+  run_time = rtems_counter_ticks_to_nanoseconds(
+    rtems_counter_difference(rtems_counter_read(), begin)
+  );
+
+  ++ve->count;
+  ve->latency_total += latency;
+  ve->run_time_total += run_time;
+
+  if (latency > ve->latency_max) {
+    ve->latency_max = latency;
+  }
+
+  if (run_time > ve->run_time_max) {
+    ve->run_time_max = run_time;
+  }
+}
+
 static void bsp_interrupt_server_task(rtems_task_argument arg)
 {
   rtems_interrupt_server_control *s = (rtems_interrupt_server_control *) arg;
@@ -356,6 +475,7 @@ static void bsp_interrupt_server_task(rtems_task_argument arg)
     while ((e = bsp_interrupt_server_get_entry(s)) != NULL) {
       rtems_interrupt_server_action *action = e->actions;
       rtems_vector_number vector = e->vector;
+      rtems_counter_ticks begin = rtems_counter_read();
 
       do {
         rtems_interrupt_server_action *current = action;
@@ -363,7 +483,12 @@ static void bsp_interrupt_server_task(rtems_task_argument arg)
         (*current->handler)(current->arg);
       } while (action != NULL);
 
+      /*
+       * Management entries may be gone at this point, so access the entry
+       * only for valid interrupt vectors.
+       */
       if (bsp_interrupt_is_valid_vector(vector)) {
+        bsp_interrupt_server_update_statistics(e, begin);
         bsp_interrupt_vector_enable(vector);
       }
     }
@@ -490,6 +615,65 @@ rtems_status_code rtems_interrupt_server_handler_iterate(
   );
 }
 
+static void bsp_interrupt_server_get_statistics_helper(void *arg)
+{
+  bsp_interrupt_server_helper_data *hd = arg;
+  rtems_interrupt_server_statistics *statistics = hd->arg;
+  rtems_status_code sc;
+  rtems_interrupt_server_entry *e;
+  rtems_option trigger_options;
+
+  bsp_interrupt_lock();
+
+  e = bsp_interrupt_server_query_entry(hd->vector, &trigger_options);
+  if (e != NULL) {
+    const bsp_interrupt_server_vector_entry *ve;
+
+    ve = (const bsp_interrupt_server_vector_entry *) e;
+    statistics->count = ve->count;
+    statistics->latency_max = ve->latency_max;
+    statistics->latency_total = ve->latency_total;
+    statistics->run_time_max = ve->run_time_max;
+    statistics->run_time_total = ve->run_time_total;
+    sc = RTEMS_SUCCESSFUL;
+  } else {
+    sc = RTEMS_UNSATISFIED;
+  }
+
+  bsp_interrupt_unlock();
+
+  hd->sc = sc;
+  rtems_event_transient_send(hd->task);
+}
+
+rtems_status_code rtems_interrupt_server_handler_get_statistics(
+  uint32_t server_index,
+  rtems_vector_number vector,
+  rtems_interrupt_server_statistics *statistics
+)
+{
+  rtems_status_code sc;
+  rtems_interrupt_server_control *s;
+
+  s = bsp_interrupt_server_get_context(server_index, &sc);
+  if (s == NULL) {
+    return sc;
+  }
+
+  if (!bsp_interrupt_is_valid_vector(vector)) {
+    return RTEMS_INVALID_ID;
+  }
+
+  return bsp_interrupt_server_call_helper(
+    s,
+    vector,
+    0,
+    NULL,
+    statistics,
+    bsp_interrupt_server_get_statistics_helper
+  );
+}
+
 /*
  * The default server is statically allocated.  Just clear the structure so
  * that it can be re-initialized.
@@ -510,6 +694,40 @@ static void bsp_interrupt_server_destroy_secondary(
 }
 #endif
 
+static void bsp_interrupt_server_set_processor(
+  rtems_id task,
+  rtems_task_priority priority,
+  uint32_t cpu_index
+)
+{
+#if defined(RTEMS_SMP)
+  rtems_status_code sc;
+  rtems_id scheduler;
+  cpu_set_t cpu;
+
+  sc = rtems_scheduler_ident_by_processor(cpu_index, &scheduler);
+
+  /*
+   * If a scheduler exists for the processor, then move it to this scheduler
+   * and try to set the affinity to the processor, otherwise keep the scheduler
+   * of the executing thread.
+   */
+  if (sc == RTEMS_SUCCESSFUL) {
+    sc = rtems_task_set_scheduler(task, scheduler, priority);
+    _Assert(sc == RTEMS_SUCCESSFUL);
+
+    /* Set the task to processor affinity on a best-effort basis */
+    CPU_ZERO(&cpu);
+    CPU_SET(cpu_index, &cpu);
+    (void) rtems_task_set_affinity(task, sizeof(cpu), &cpu);
+  }
+#else
+  (void) task;
+  (void) priority;
+  (void) cpu_index;
+#endif
+}
+
 static rtems_status_code bsp_interrupt_server_create(
   rtems_interrupt_server_control *s,
   rtems_task_priority priority,
@@ -520,10 +738,6 @@ static rtems_status_code bsp_interrupt_server_create(
 )
 {
   rtems_status_code sc;
-#if defined(RTEMS_SMP)
-  rtems_id scheduler;
-  cpu_set_t cpu;
-#endif
 
   sc = rtems_task_create(
     rtems_build_name('I', 'R', 'Q', 'S'),
@@ -540,27 +754,7 @@ static rtems_status_code bsp_interrupt_server_create(
 
   rtems_interrupt_lock_initialize(&s->lock, "Interrupt Server");
   rtems_chain_initialize_empty(&s->entries);
-
-#if defined(RTEMS_SMP)
-  sc = rtems_scheduler_ident_by_processor(cpu_index, &scheduler);
-
-  /*
-   * If a scheduler exists for the processor, then move it to this scheduler
-   * and try to set the affinity to the processor, otherwise keep the scheduler
-   * of the executing thread.
-   */
-  if (sc == RTEMS_SUCCESSFUL) {
-    sc = rtems_task_set_scheduler(s->server, scheduler, priority);
-    _Assert(sc == RTEMS_SUCCESSFUL);
-
-    /* Set the task to processor affinity on a best-effort basis */
-    CPU_ZERO(&cpu);
-    CPU_SET(cpu_index, &cpu);
-    (void) rtems_task_set_affinity(s->server, sizeof(cpu), &cpu);
-  }
-#else
-  (void) cpu_index;
-#endif
+  bsp_interrupt_server_set_processor(s->server, priority, cpu_index);
 
   rtems_chain_append_unprotected(&bsp_interrupt_server_chain, &s->node);
 
@@ -653,6 +847,136 @@ done:
   return sc;
 }
 
+static void bsp_interrupt_server_worker_exit_helper(void *arg)
+{
+  bsp_interrupt_server_helper_data *hd = arg;
+  rtems_status_code sc;
+
+  rtems_interrupt_lock_destroy(&hd->server->lock);
+
+  sc = rtems_event_transient_send(hd->task);
+  _Assert(sc == RTEMS_SUCCESSFUL);
+  (void) sc;
+
+  rtems_task_exit();
+}
+
+static void bsp_interrupt_server_delete_workers(
+  rtems_interrupt_server_control *s,
+  bool started
+)
+{
+  uint32_t cpu_max;
+  uint32_t cpu_index;
+
+  cpu_max = rtems_scheduler_get_processor_maximum();
+
+  for (cpu_index = 0; cpu_index < cpu_max; ++cpu_index) {
+    rtems_interrupt_server_control *w = s->workers[cpu_index];
+
+    if (w == NULL) {
+      continue;
+    }
+
+    if (started) {
+      bsp_interrupt_server_call_helper(
+        w,
+        BSP_INTERRUPT_SERVER_MANAGEMENT_VECTOR,
+        0,
+        NULL,
+        NULL,
+        bsp_interrupt_server_worker_exit_helper
+      );
+    } else if (w->server != 0) {
+      rtems_interrupt_lock_destroy(&w->lock);
+      (void) rtems_task_delete(w->server);
+    }
+
+    free(w);
+  }
+
+  free(s->workers);
+  s->workers = NULL;
+}
+
+static rtems_status_code bsp_interrupt_server_create_workers(
+  rtems_interrupt_server_control *s,
+  const rtems_interrupt_server_config *config
+)
+{
+  rtems_status_code sc;
+  uint32_t cpu_max;
+  uint32_t cpu_index;
+
+  cpu_max = rtems_scheduler_get_processor_maximum();
+  s->workers = calloc(cpu_max, sizeof(*s->workers));
+  if (s->workers == NULL) {
+    return RTEMS_NO_MEMORY;
+  }
+
+  sc = RTEMS_SUCCESSFUL;
+
+  for (cpu_index = 0; cpu_index < cpu_max; ++cpu_index) {
+    rtems_interrupt_server_control *w;
+
+    if (
+      cpu_index >= 8 * config->worker_processors_size
+        || !CPU_ISSET_S(
+          cpu_index,
+          config->worker_processors_size,
+          config->worker_processors
+        )
+    ) {
+      continue;
+    }
+
+    w = calloc(1, sizeof(*w));
+    if (w == NULL) {
+      sc = RTEMS_NO_MEMORY;
+      break;
+    }
+
+    s->workers[cpu_index] = w;
+
+    sc = rtems_task_create(
+      config->name,
+      config->priority,
+      config->storage_size,
+      config->modes,
+      config->attributes,
+      &w->server
+    );
+    if (sc != RTEMS_SUCCESSFUL) {
+      break;
+    }
+
+    rtems_interrupt_lock_initialize(&w->lock, "Interrupt Server Worker");
+    rtems_chain_initialize_empty(&w->entries);
+    w->index = s->index;
+    bsp_interrupt_server_set_processor(w->server, config->priority, cpu_index);
+  }
+
+  if (sc != RTEMS_SUCCESSFUL) {
+    bsp_interrupt_server_delete_workers(s, false);
+    return sc;
+  }
+
+  for (cpu_index = 0; cpu_index < cpu_max; ++cpu_index) {
+    rtems_interrupt_server_control *w = s->workers[cpu_index];
+
+    if (w != NULL) {
+      sc = rtems_task_start(
+        w->server,
+        bsp_interrupt_server_task,
+        (rtems_task_argument) w
+      );
+      _Assert(sc == RTEMS_SUCCESSFUL);
+    }
+  }
+
+  return RTEMS_SUCCESSFUL;
+}
+
 rtems_status_code rtems_interrupt_server_create(
   rtems_interrupt_server_control      *s,
   const rtems_interrupt_server_config *config,
@@ -660,6 +984,7 @@ rtems_status_code rtems_interrupt_server_create(
 )
 {
   rtems_status_code sc;
+  rtems_id server;
 
   sc = rtems_task_create(
     config->name,
@@ -667,17 +992,28 @@ rtems_status_code rtems_interrupt_server_create(
     config->storage_size,
     config->modes,
     config->attributes,
-    &s->server
+    &server
   );
   if (sc != RTEMS_SUCCESSFUL) {
     return sc;
   }
 
+  s->server = server;
+  s->workers = NULL;
+  s->index = rtems_object_id_get_index(s->server)
+    + rtems_scheduler_get_processor_maximum();
+
+  if (config->worker_processors != NULL) {
+    sc = bsp_interrupt_server_create_workers(s, config);
+    if (sc != RTEMS_SUCCESSFUL) {
+      (void) rtems_task_delete(server);
+      return sc;
+    }
+  }
+
   rtems_interrupt_lock_initialize(&s->lock, "Interrupt Server");
   rtems_chain_initialize_empty(&s->entries);
   s->destroy = config->destroy;
-  s->index = rtems_object_id_get_index(s->server)
-    + rtems_scheduler_get_processor_maximum();
   *server_index = s->index;
 
   bsp_interrupt_lock();
@@ -705,6 +1041,10 @@ static void bsp_interrupt_server_destroy_helper(void *arg)
   rtems_chain_extract_unprotected(&s->node);
   bsp_interrupt_unlock();
 
+  if (s->workers != NULL) {
+    bsp_interrupt_server_delete_workers(s, true);
+  }
+
   rtems_interrupt_lock_destroy(&s->lock);
 
   if (s->destroy != NULL) {
@@ -814,13 +1154,6 @@ rtems_status_code rtems_interrupt_server_entry_move(
   return RTEMS_SUCCESSFUL;
 }
 
-static void bsp_interrupt_server_entry_synchronize_helper(void *arg)
-{
-  bsp_interrupt_server_helper_data *hd = arg;
-
-  rtems_event_transient_send(hd->task);
-}
-
 void rtems_interrupt_server_entry_destroy(
   rtems_interrupt_server_entry *entry
 )
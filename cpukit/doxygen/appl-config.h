@@ -2471,6 +2471,30 @@
  */
 #define CONFIGURE_IMFS_MEMFILE_BYTES_PER_BLOCK
 
+/* Generated from spec:/acfg/if/pipe-buffer-size */
+
+/**
+ * @brief This configuration option is an integer define.
+ *
+ * @anchor CONFIGURE_PIPE_BUFFER_SIZE
+ *
+ * The value of this configuration option defines the buffer size in bytes of
+ * each pipe and FIFO.
+ *
+ * @par Default Value
+ * The default value is PIPE_BUF.
+ *
+ * @par Constraints
+ * The value of the configuration option shall be greater than or equal to
+ * PIPE_BUF.
+ *
+ * @par Notes
+ * The buffer is allocated when a pipe is opened for the first time and
+ * consists of segments of at most 4096 bytes.  A larger buffer reduces the
+ * count of context switches between writers and readers of a pipe.
+ */
+#define CONFIGURE_PIPE_BUFFER_SIZE
+
 /* Generated from spec:/acfg/if/use-devfs-as-base-filesystem */
 
 /**
@@ -3962,6 +3986,37 @@
  */
 #define CONFIGURE_MAXIMUM_POSIX_KEY_VALUE_PAIRS
 
+/* Generated from spec:/acfg/if/posix-keys-direct-maximum */
+
+/**
+ * @brief This configuration option is an integer define.
+ *
+ * @anchor CONFIGURE_POSIX_KEYS_DIRECT_MAXIMUM
+ *
+ * The value of this configuration option defines the count of POSIX API Keys
+ * with a value slot in each thread control block.
+ *
+ * @par Default Value
+ * The default value is 0.
+ *
+ * @par Constraints
+ * The value of the configuration option shall be greater than or equal to
+ * zero.
+ *
+ * @par Notes
+ * @parblock
+ * The values of the keys with an object index less than or equal to the value
+ * of this configuration option are stored in an array of the thread control
+ * block.  For these keys, pthread_getspecific() and pthread_setspecific() use
+ * no lock and need no key value pair.  The values of other keys are stored in
+ * key value pairs, see @ref CONFIGURE_MAXIMUM_POSIX_KEY_VALUE_PAIRS.
+ *
+ * Each thread control block grows by the value of this configuration option
+ * times the size of a pointer.
+ * @endparblock
+ */
+#define CONFIGURE_POSIX_KEYS_DIRECT_MAXIMUM
+
 /* Generated from spec:/acfg/if/max-posix-message-queues */
 
 /**
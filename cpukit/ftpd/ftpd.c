@@ -243,6 +243,7 @@
 #include <syslog.h>
 
 #include <sys/types.h>
+#include <sys/mman.h>
 #include <sys/socket.h>
 #include <arpa/ftp.h>
 #include <netinet/in.h>
@@ -280,6 +281,26 @@ static struct rtems_ftpd_configuration *ftpd_config;
 /* this is not prototyped in strict ansi mode */
 FILE *fdopen (int fildes, const char *mode);
 
+typedef ssize_t (*WriteProc)(int, void const*, size_t);
+
+/*
+ * TransferIO structure.
+ *
+ * With large transfer buffers, each session has a transfer I/O task.  It
+ * reads or writes the file using one transfer buffer while the session task
+ * sends or receives the data of the other transfer buffer.
+ */
+typedef struct
+{
+  rtems_binary_semaphore start;  /* Posted to start the file I/O */
+  rtems_binary_semaphore done;   /* Posted when the file I/O is done */
+  WriteProc              wrt;    /* Write procedure or 0 to read */
+  int                    fd;     /* File descriptor */
+  char                   *buf;   /* Buffer to read or write */
+  size_t                 size;   /* Count of bytes to read or write */
+  ssize_t                result; /* Result of the file I/O */
+} FTPD_TransferIO_t;
+
 /*SessionInfo structure.
  *
  * The following structure is allocated for each session.
@@ -300,6 +321,9 @@ typedef struct
   char                *user;       /* user name (0 if not supplied) */
   char                user_buf[256]; /* user name buffer */
   bool                auth;        /* true if user/pass was valid, false if not or not supplied */
+  char                *xfer_buf[2]; /* Transfer buffers or 0 */
+  rtems_id            xfer_tid;    /* Transfer I/O task id */
+  FTPD_TransferIO_t   xfer_io;     /* Transfer I/O request */
 } FTPD_SessionInfo_t;
 
 
@@ -388,6 +412,114 @@ can_write(void)
  */
 
 
+/*
+ * transfer_io_task
+ *
+ * Transfer I/O task of a session.  Performs the file I/O requests of the
+ * session task.
+ *
+ * Input parameters:
+ *   arg - pointer to the TransferIO structure of the session
+ *
+ * Output parameters:
+ *   NONE
+ *
+ */
+static void
+transfer_io_task(rtems_task_argument arg)
+{
+  FTPD_TransferIO_t *io = (FTPD_TransferIO_t *)arg;
+
+  while(1)
+  {
+    rtems_binary_semaphore_wait(&io->start);
+    if (io->wrt != NULL)
+      io->result = (*io->wrt)(io->fd, io->buf, io->size);
+    else
+      io->result = read(io->fd, io->buf, io->size);
+    rtems_binary_semaphore_post(&io->done);
+  }
+}
+
+/*
+ * transfer_done
+ *
+ * Delete the transfer I/O task and free the transfer buffers of a session.
+ *
+ * Input parameters:
+ *   info - corresponding SessionInfo structure
+ *
+ * Output parameters:
+ *   NONE
+ *
+ */
+static void
+transfer_done(FTPD_SessionInfo_t *info)
+{
+  if (info->xfer_tid != 0)
+    rtems_task_delete(info->xfer_tid);
+  if (info->xfer_buf[0] != NULL)
+  {
+    rtems_binary_semaphore_destroy(&info->xfer_io.start);
+    rtems_binary_semaphore_destroy(&info->xfer_io.done);
+    free(info->xfer_buf[0]);
+  }
+  info->xfer_tid = 0;
+  info->xfer_buf[0] = info->xfer_buf[1] = NULL;
+}
+
+/*
+ * transfer_init
+ *
+ * Allocate the transfer buffers and start the transfer I/O task of a
+ * session if large transfer buffers are configured.
+ *
+ * Input parameters:
+ *   info     - corresponding SessionInfo structure
+ *   priority - priority the transfer I/O task is started with
+ *   id       - last character of the task name
+ *
+ * Output parameters:
+ *   returns RTEMS_SUCCESSFUL on success.
+ *
+ */
+static rtems_status_code
+transfer_init(FTPD_SessionInfo_t *info, rtems_task_priority priority, char id)
+{
+  size_t            size = ftpd_config->transfer_size;
+  rtems_status_code sc;
+
+  info->xfer_tid = 0;
+  info->xfer_buf[0] = info->xfer_buf[1] = NULL;
+
+  if (size == 0)
+    return RTEMS_SUCCESSFUL;
+
+  info->xfer_buf[0] = malloc(2 * size);
+  if (info->xfer_buf[0] == NULL)
+    return RTEMS_NO_MEMORY;
+  info->xfer_buf[1] = info->xfer_buf[0] + size;
+
+  rtems_binary_semaphore_init(&info->xfer_io.start, "FTPD");
+  rtems_binary_semaphore_init(&info->xfer_io.done, "FTPD");
+
+  sc = rtems_task_create(rtems_build_name('F', 'T', 'X', id),
+    priority, FTPD_STACKSIZE,
+    RTEMS_PREEMPT | RTEMS_NO_TIMESLICE |
+    RTEMS_NO_ASR | RTEMS_INTERRUPT_LEVEL(0),
+    RTEMS_FLOATING_POINT | RTEMS_LOCAL,
+    &info->xfer_tid);
+  if (sc == RTEMS_SUCCESSFUL)
+    sc = rtems_task_start(
+      info->xfer_tid, transfer_io_task, (rtems_task_argument)&info->xfer_io);
+  else
+    info->xfer_tid = 0;
+
+  if (sc != RTEMS_SUCCESSFUL)
+    transfer_done(info);
+  return sc;
+}
+
 /*
  * task_pool_done
  *
@@ -405,7 +537,10 @@ task_pool_done(int count)
 {
   int i;
   for(i = 0; i < count; ++i)
+  {
     rtems_task_delete(task_pool.info[i].tid);
+    transfer_done(&task_pool.info[i]);
+  }
   free(task_pool.info);
   free(task_pool.queue);
   rtems_mutex_destroy(&task_pool.mutex);
@@ -457,6 +592,14 @@ task_pool_init(int count, rtems_task_priority priority)
   for(i = 0; i < count; ++i)
   {
     FTPD_SessionInfo_t *info = &task_pool.info[i];
+    sc = transfer_init(info, priority, id);
+    if (sc != RTEMS_SUCCESSFUL)
+    {
+      task_pool_done(i);
+      syslog(LOG_ERR, "ftpd: Could not initialize FTPD transfer: %s",
+        rtems_status_text(sc));
+      return 0;
+    }
     sc = rtems_task_create(rtems_build_name('F', 'T', 'P', id),
       priority, FTPD_STACKSIZE,
       RTEMS_PREEMPT | RTEMS_NO_TIMESLICE |
@@ -468,10 +611,13 @@ task_pool_init(int count, rtems_task_priority priority)
       sc = rtems_task_start(
         info->tid, session, (rtems_task_argument)info);
       if (sc != RTEMS_SUCCESSFUL)
-        task_pool_done(i);
+        task_pool_done(i + 1);
     }
     else
-      task_pool_done(i + 1);
+    {
+      transfer_done(info);
+      task_pool_done(i);
+    }
     if (sc != RTEMS_SUCCESSFUL)
     {
       syslog(LOG_ERR, "ftpd: Could not create/start FTPD session: %s",
@@ -774,6 +920,201 @@ send_mode_reply(FTPD_SessionInfo_t *info)
     send_reply(info, 150, "Opening ASCII mode data connection.");
 }
 
+/*
+ * transfer_io_start
+ *
+ * Start a file I/O request of the transfer I/O task.
+ *
+ * Input parameters:
+ *   info - corresponding SessionInfo structure
+ *   wrt  - write procedure or 0 to read
+ *   fd   - file descriptor
+ *   buf  - transfer buffer
+ *   size - count of bytes to read or write
+ *
+ * Output parameters:
+ *   NONE
+ *
+ */
+static void
+transfer_io_start(FTPD_SessionInfo_t *info, WriteProc wrt, int fd,
+  char *buf, size_t size)
+{
+  FTPD_TransferIO_t *io = &info->xfer_io;
+
+  io->wrt = wrt;
+  io->fd = fd;
+  io->buf = buf;
+  io->size = size;
+  rtems_binary_semaphore_post(&io->start);
+}
+
+/*
+ * transfer_io_wait
+ *
+ * Wait for the completion of the file I/O request started before.
+ *
+ * Input parameters:
+ *   info - corresponding SessionInfo structure
+ *
+ * Output parameters:
+ *   returns result of read() or write procedure.
+ *
+ */
+static ssize_t
+transfer_io_wait(FTPD_SessionInfo_t *info)
+{
+  rtems_binary_semaphore_wait(&info->xfer_io.done);
+  return info->xfer_io.result;
+}
+
+/*
+ * transfer_retrieve
+ *
+ * Send the file in binary mode using the transfer buffers.  The next chunk
+ * is read by the transfer I/O task while the current chunk is sent.
+ *
+ * Input parameters:
+ *   info - corresponding SessionInfo structure
+ *   s    - data socket
+ *   fd   - file descriptor
+ *
+ * Output parameters:
+ *   returns 0 at end of file, or -1 on error.
+ *
+ */
+static int
+transfer_retrieve(FTPD_SessionInfo_t *info, int s, int fd)
+{
+  size_t  size = ftpd_config->transfer_size;
+  ssize_t n;
+  int     k = 0;
+
+  transfer_io_start(info, NULL, fd, info->xfer_buf[k], size);
+  while ((n = transfer_io_wait(info)) > 0)
+  {
+    transfer_io_start(info, NULL, fd, info->xfer_buf[k ^ 1], size);
+    if (send(s, info->xfer_buf[k], n, 0) != n)
+    {
+      transfer_io_wait(info);
+      return -1;
+    }
+    k ^= 1;
+  }
+  return n < 0 ? -1 : 0;
+}
+
+/*
+ * recv_all
+ *
+ * Receive data until the buffer is full or the connection is closed.
+ *
+ * Input parameters:
+ *   s    - data socket
+ *   buf  - receive buffer
+ *   size - size of the receive buffer
+ *
+ * Output parameters:
+ *   returns count of received bytes, or result of recv() if no data was
+ *   received.
+ *
+ */
+static ssize_t
+recv_all(int s, char *buf, size_t size)
+{
+  size_t  count = 0;
+  ssize_t n = 0;
+
+  while (count < size && (n = recv(s, buf + count, size - count, 0)) > 0)
+    count += n;
+  return count > 0 ? (ssize_t)count : n;
+}
+
+/*
+ * transfer_store
+ *
+ * Receive the file in binary mode using the transfer buffers.  The previous
+ * chunk is written by the transfer I/O task while the next chunk is
+ * received.
+ *
+ * Input parameters:
+ *   info - corresponding SessionInfo structure
+ *   s    - data socket
+ *   fd   - file descriptor
+ *   wrt  - write procedure
+ *
+ * Output parameters:
+ *   returns 1 on success, 0 on write error.
+ *
+ */
+static int
+transfer_store(FTPD_SessionInfo_t *info, int s, int fd, WriteProc wrt)
+{
+  size_t  size = ftpd_config->transfer_size;
+  ssize_t n;
+  ssize_t pending = 0;
+  int     k = 0;
+
+  do
+  {
+    n = recv_all(s, info->xfer_buf[k], size);
+    if (pending > 0 && transfer_io_wait(info) != pending)
+      return 0;
+    pending = 0;
+    if (n > 0)
+    {
+      transfer_io_start(info, wrt, fd, info->xfer_buf[k], n);
+      pending = n;
+      k ^= 1;
+    }
+  }
+  while (n > 0);
+  return 1;
+}
+
+/*
+ * send_mapped_file
+ *
+ * Send the file from a shared mapping.  Files kept in memory, for example
+ * IMFS linear files, are sent directly from the file data without a copy
+ * to a transfer buffer.  This is only used if transfer buffers are
+ * configured.
+ *
+ * Input parameters:
+ *   s    - data socket
+ *   fd   - file descriptor
+ *   size - file size
+ *   n    - pointer to the transfer result
+ *
+ * Output parameters:
+ *   returns 1 if the file was mapped and sets *n to 0 on success or -1 on
+ *   send error, returns 0 if the file cannot be mapped.
+ *
+ */
+static int
+send_mapped_file(int s, int fd, size_t size, int *n)
+{
+  char    *map;
+  char    *p;
+  size_t  len = size;
+  ssize_t sent;
+
+  if (size == 0)
+    return 0;
+
+  /* RTEMS rejects mappings without write access */
+  map = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  if (map == MAP_FAILED)
+    return 0;
+
+  for (p = map; size > 0 && (sent = send(s, p, size, 0)) > 0; p += sent)
+    size -= sent;
+  munmap(map, len);
+
+  *n = size == 0 ? 0 : -1;
+  return 1;
+}
+
 /*
  * command_retrieve
  *
@@ -794,6 +1135,7 @@ command_retrieve(FTPD_SessionInfo_t  *info, char const *filename)
   int                 fd = -1;
   char                buf[FTPD_DATASIZE];
   struct stat         stat_buf;
+  size_t              size = 0;
   int                 res = 0;
 
   if(!can_read() || !info->auth)
@@ -808,12 +1150,17 @@ command_retrieve(FTPD_SessionInfo_t  *info, char const *filename)
     return;
   }
 
-  if (fstat(fd, &stat_buf) == 0 && S_ISDIR(stat_buf.st_mode))
+  if (fstat(fd, &stat_buf) == 0)
   {
-    if (-1 != fd)
-      close(fd);
-    send_reply(info, 550, "Is a directory.");
-    return;
+    if (S_ISDIR(stat_buf.st_mode))
+    {
+      if (-1 != fd)
+        close(fd);
+      send_reply(info, 550, "Is a directory.");
+      return;
+    }
+    if (S_ISREG(stat_buf.st_mode))
+      size = stat_buf.st_size;
   }
 
   send_mode_reply(info);
@@ -826,11 +1173,19 @@ command_retrieve(FTPD_SessionInfo_t  *info, char const *filename)
 
     if(info->xfer_mode == TYPE_I)
     {
-      while ((n = read(fd, buf, FTPD_DATASIZE)) > 0)
+      if (info->xfer_buf[0] != NULL)
       {
-        if(send(s, buf, n, 0) != n)
-          break;
-        yield();
+        if (!send_mapped_file(s, fd, size, &n))
+          n = transfer_retrieve(info, s, fd);
+      }
+      else
+      {
+        while ((n = read(fd, buf, FTPD_DATASIZE)) > 0)
+        {
+          if(send(s, buf, n, 0) != n)
+            break;
+          yield();
+        }
       }
     }
     else if (info->xfer_mode == TYPE_A)
@@ -939,7 +1294,6 @@ command_store(FTPD_SessionInfo_t *info, char const *filename)
   int                    res = 1;
   int                    bare_lfs = 0;
   int                    null = 0;
-  typedef ssize_t (*WriteProc)(int, void const*, size_t);
   WriteProc              wrt = &write;
 
   if(!can_write() || !info->auth)
@@ -1051,7 +1405,11 @@ command_store(FTPD_SessionInfo_t *info, char const *filename)
       return;
     }
 
-    if(info->xfer_mode == TYPE_I)
+    if(info->xfer_mode == TYPE_I && info->xfer_buf[0] != NULL)
+    {
+      res = transfer_store(info, s, fd, wrt);
+    }
+    else if(info->xfer_mode == TYPE_I)
     {
       while ((n = recv(s, buf, FTPD_DATASIZE, 0)) > 0)
       {
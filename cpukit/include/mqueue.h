@@ -222,6 +222,76 @@ int mq_getattr(
   struct mq_attr *mqstat
 );
 
+/**
+ * @brief Obtains an empty message buffer of the message queue on loan.
+ *
+ * The message buffer can hold a message of the mq_msgsize attribute.  It may
+ * be filled and sent with mq_send_buffer_np() without a copy of the message,
+ * or given back with mq_release_buffer_np().  If no message buffer is
+ * available and O_NONBLOCK is not set, then the calling thread blocks until
+ * a message buffer is available or the absolute timeout specified by
+ * @a abstime expires.  A NULL @a abstime waits potentially forever.
+ *
+ * All message buffers on loan shall be given back before the last message
+ * queue descriptor is closed.
+ *
+ * @retval 0 Successful operation.
+ * @retval -1 An error occurred.  The errno is set to EBADF, EAGAIN, EFAULT,
+ *   or ETIMEDOUT.
+ */
+int mq_obtain_buffer_np(
+  mqd_t                  mqdes,
+  void                 **msg_ptr,
+  const struct timespec *abstime
+);
+
+/**
+ * @brief Sends the message in the message buffer on loan.
+ *
+ * This is mq_send() without a copy of the message, unless a thread waits in
+ * mq_receive() to receive it into its own buffer.  After a successful call,
+ * the message buffer is no longer on loan to the caller.
+ *
+ * @retval 0 Successful operation.
+ * @retval -1 An error occurred.  The errno is set to EBADF, EFAULT, EINVAL,
+ *   or EMSGSIZE.
+ */
+int mq_send_buffer_np(
+  mqd_t         mqdes,
+  void         *msg_ptr,
+  size_t        msg_len,
+  unsigned int  msg_prio
+);
+
+/**
+ * @brief Receives a message buffer on loan.
+ *
+ * This is mq_timedreceive() without a copy of the message.  The message
+ * buffer stays on loan to the caller until it is given back with
+ * mq_release_buffer_np() or sent again with mq_send_buffer_np().  A NULL
+ * @a abstime waits potentially forever.
+ *
+ * @return The length of the received message, or -1 if an error occurred.
+ *   The errno is set to EBADF, EAGAIN, EFAULT, or ETIMEDOUT.
+ */
+ssize_t mq_receive_buffer_np(
+  mqd_t                  mqdes,
+  void                 **msg_ptr,
+  unsigned int          *msg_prio,
+  const struct timespec *abstime
+);
+
+/**
+ * @brief Gives a message buffer on loan back to the message queue.
+ *
+ * @retval 0 Successful operation.
+ * @retval -1 An error occurred.  The errno is set to EBADF or EFAULT.
+ */
+int mq_release_buffer_np(
+  mqd_t  mqdes,
+  void  *msg_ptr
+);
+
 /** @} */
 
 #ifdef __cplusplus
@@ -44,8 +44,11 @@
 #ifdef CONFIGURE_INIT
 
 #include <rtems/confdefs/bsp.h>
+#include <rtems/pipe.h>
 #include <rtems/sysinit.h>
 
+#include <limits.h>
+
 #ifdef CONFIGURE_FILESYSTEM_ALL
   #define CONFIGURE_FILESYSTEM_DOSFS
   #define CONFIGURE_FILESYSTEM_FTPFS
@@ -173,6 +176,16 @@ const rtems_jffs2_config jffs2_config = {
 extern "C" {
 #endif
 
+#ifndef CONFIGURE_PIPE_BUFFER_SIZE
+  #define CONFIGURE_PIPE_BUFFER_SIZE PIPE_BUF
+#endif
+
+#if CONFIGURE_PIPE_BUFFER_SIZE < PIPE_BUF
+  #error "CONFIGURE_PIPE_BUFFER_SIZE shall be greater than or equal to PIPE_BUF"
+#endif
+
+const size_t rtems_pipe_buffer_size = CONFIGURE_PIPE_BUFFER_SIZE;
+
 #ifndef CONFIGURE_APPLICATION_DISABLE_FILESYSTEM
 
 #ifndef CONFIGURE_IMFS_MEMFILE_BYTES_PER_BLOCK
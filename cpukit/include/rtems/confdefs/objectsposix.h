@@ -75,7 +75,9 @@
   #warning "If CONFIGURE_MAXIMUM_POSIX_KEYS is zero, then CONFIGURE_MAXIMUM_POSIX_KEY_VALUE_PAIRS should be zero as well"
 #endif
 
-#if CONFIGURE_MAXIMUM_POSIX_KEYS > 0 || CONFIGURE_MAXIMUM_POSIX_KEY_VALUE_PAIRS > 0
+#if CONFIGURE_MAXIMUM_POSIX_KEYS > 0 \
+  || CONFIGURE_MAXIMUM_POSIX_KEY_VALUE_PAIRS > 0 \
+  || CONFIGURE_POSIX_KEYS_DIRECT_MAXIMUM > 0
   #include <rtems/posix/key.h>
 #endif
 
@@ -118,6 +120,11 @@ extern "C" {
     CONFIGURE_MAXIMUM_POSIX_KEY_VALUE_PAIRS;
 #endif
 
+#if CONFIGURE_POSIX_KEYS_DIRECT_MAXIMUM > 0
+  const uint32_t _POSIX_Keys_Direct_maximum =
+    CONFIGURE_POSIX_KEYS_DIRECT_MAXIMUM;
+#endif
+
 #if CONFIGURE_MAXIMUM_POSIX_MESSAGE_QUEUES > 0
   POSIX_MESSAGE_QUEUE_INFORMATION_DEFINE(
     CONFIGURE_MAXIMUM_POSIX_MESSAGE_QUEUES
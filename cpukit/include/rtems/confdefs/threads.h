@@ -77,6 +77,10 @@
   #include <rtems/posix/pthread.h>
 #endif
 
+#ifndef CONFIGURE_POSIX_KEYS_DIRECT_MAXIMUM
+  #define CONFIGURE_POSIX_KEYS_DIRECT_MAXIMUM 0
+#endif
+
 #if !defined(CONFIGURE_IDLE_TASK_INITIALIZES_APPLICATION) \
   && CONFIGURE_MAXIMUM_TASKS == 0 \
   && CONFIGURE_MAXIMUM_POSIX_THREADS == 0
@@ -171,6 +175,9 @@ struct Thread_Configured_control {
     !defined(_REENT_THREAD_LOCAL)
     struct _reent Newlib;
   #endif
+  #if CONFIGURE_POSIX_KEYS_DIRECT_MAXIMUM > 0
+    void *Keys_direct_values[ CONFIGURE_POSIX_KEYS_DIRECT_MAXIMUM ];
+  #endif
 };
 
 const Thread_Control_add_on _Thread_Control_add_ons[] = {
@@ -212,6 +219,15 @@ const Thread_Control_add_on _Thread_Control_add_ons[] = {
       offsetof( Thread_Configured_control, API_POSIX )
     }
   #endif
+  #if CONFIGURE_POSIX_KEYS_DIRECT_MAXIMUM > 0
+    , {
+      offsetof(
+        Thread_Configured_control,
+        Control.Keys.Direct_values
+      ),
+      offsetof( Thread_Configured_control, Keys_direct_values )
+    }
+  #endif
 };
 
 const size_t _Thread_Control_add_on_count =
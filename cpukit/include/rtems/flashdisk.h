@@ -124,6 +124,13 @@ extern "C" {
  * file system. The driver may also suffer from problems if
  * power is lost.
  *
+ * A run of consecutive blocks in a request is written to consecutive
+ * erased pages of a segment and the page descriptors of the run are
+ * written together. If the driver provides the multi-page handlers a run
+ * of pages is read or written with one handler call. When segments have
+ * the same number of available pages the least erased segment is used
+ * first.
+ *
  * There are some flash disk specific IO control request types.
  * To use open the device and issue the ioctl() call.
  *
@@ -155,6 +162,7 @@ extern "C" {
 #define RTEMS_FDISK_IOCTL_MONITORING   _IO('B', 131)
 #define RTEMS_FDISK_IOCTL_INFO_LEVEL   _IO('B', 132)
 #define RTEMS_FDISK_IOCTL_PRINT_STATUS _IO('B', 133)
+#define RTEMS_FDISK_IOCTL_ERASE_COUNTS _IO('B', 134)
 
 /**
  * @brief Flash Disk Monitoring Data allows a user to obtain
@@ -178,8 +186,31 @@ typedef struct rtems_fdisk_monitor_data
   uint32_t pages_used;
   uint32_t pages_bad;
   uint32_t info_level;
+  uint32_t compactions;            /**< Compaction passes on the write path. */
+  uint32_t background_compactions; /**< Compactions by the background task. */
+  uint32_t background_erases;      /**< Erases by the background task. */
+  uint32_t multi_page_reads;       /**< Reads by the read pages handler. */
+  uint32_t multi_page_writes;      /**< Writes by the write pages handler. */
+  uint64_t compact_stall_time;     /**< Nanoseconds writes spent compacting
+                                        and erasing. */
 } rtems_fdisk_monitor_data;
 
+/**
+ * @brief Flash Disk Erase Counts allows a user to obtain the number of
+ * times each segment has been erased since the driver was initialised.
+ * The segments are reported in device order. Use the
+ * RTEMS_FDISK_IOCTL_ERASE_COUNTS IO control to fill this structure.
+ */
+typedef struct rtems_fdisk_erase_counts
+{
+  uint32_t* counts;        /**< The per segment erase counts. Can be NULL. */
+  uint32_t  counts_size;   /**< The number of entries in the counts array. */
+  uint32_t  segment_count; /**< The number of segments in the disk. */
+  uint32_t  min;           /**< The least erase count of a segment. */
+  uint32_t  max;           /**< The most erase count of a segment. */
+  uint32_t  total;         /**< The total number of segment erases. */
+} rtems_fdisk_erase_counts;
+
 /**
  * @brief Flash Segment Descriptor holds, number of continuous segments in the
  * device of this type, the base segment number in the device, the address
@@ -348,6 +379,57 @@ typedef struct rtems_fdisk_driver_handlers
   int (*erase_device) (const struct rtems_fdisk_device_desc* dd,
                        uint32_t                              device);
 
+  /**
+   * Read a run of contiguous pages from the device into a buffer per
+   * page in one operation. Return an errno error number if the device
+   * cannot be read. This lets a driver use the burst read mode of a
+   * device. The handler is optional and can be NULL. The driver then
+   * reads the pages one at a time with the read handler.
+   *
+   * @param sd The segment descriptor.
+   * @param device The device to read data from.
+   * @param segment The segment within the device to read.
+   * @param offset The offset in the segment of the first page.
+   * @param buffers The buffers to read the pages into, one per page.
+   * @param page_size The size of a page.
+   * @param count The number of pages to read.
+   * @retval 0 No error.
+   * @retval EIO The read did not complete.
+   */
+  int (*read_pages) (const rtems_fdisk_segment_desc* sd,
+                     uint32_t                        device,
+                     uint32_t                        segment,
+                     uint32_t                        offset,
+                     void* const*                    buffers,
+                     uint32_t                        page_size,
+                     uint32_t                        count);
+
+  /**
+   * Write a run of contiguous pages to the device from a buffer per
+   * page in one operation. Return an errno error number if the device
+   * cannot be written to. This lets a driver use the buffered or burst
+   * program mode of a device. The handler is optional and can be NULL.
+   * The driver then writes the pages one at a time with the write
+   * handler.
+   *
+   * @param sd The segment descriptor.
+   * @param device The device to write data to.
+   * @param segment The segment within the device to write to.
+   * @param offset The offset in the segment of the first page.
+   * @param buffers The buffers to write the pages from, one per page.
+   * @param page_size The size of a page.
+   * @param count The number of pages to write.
+   * @retval 0 No error.
+   * @retval EIO The write did not complete or verify.
+   */
+  int (*write_pages) (const rtems_fdisk_segment_desc* sd,
+                      uint32_t                        device,
+                      uint32_t                        segment,
+                      uint32_t                        offset,
+                      const void* const*              buffers,
+                      uint32_t                        page_size,
+                      uint32_t                        count);
+
 } rtems_fdisk_driver_handlers;
 
 /**
@@ -421,6 +503,13 @@ typedef struct rtems_flashdisk_config
    */
   uint32_t                       avail_compact_segs;
   uint32_t                       info_level;     /**< Default info level. */
+
+  /**
+   * The priority of the background task. The task is created if the
+   * RTEMS_FDISK_BACKGROUND_ERASE or RTEMS_FDISK_BACKGROUND_COMPACT flag is
+   * set. If this is 0 RTEMS_FDISK_BACKGROUND_PRIORITY_DEFAULT is used.
+   */
+  rtems_task_priority            background_priority;
 } rtems_flashdisk_config;
 
 /*
@@ -428,12 +517,16 @@ typedef struct rtems_flashdisk_config
  */
 
 /**
- * Leave the erasing of used segment to the background handler.
+ * Leave the erasing of used segment to the background task. A write
+ * that runs short of available segments still erases the queued segments.
  */
 #define RTEMS_FDISK_BACKGROUND_ERASE (1 << 0)
 
 /**
- * Leave the compacting of of used segment to the background handler.
+ * Leave the compacting of of used segment to the background task. The
+ * task compacts once the available segment count falls to the compacting
+ * segment count plus the available compacting segment count. A write
+ * still compacts once the available compacting segment count is reached.
  */
 #define RTEMS_FDISK_BACKGROUND_COMPACT (1 << 1)
 
@@ -450,6 +543,11 @@ typedef struct rtems_flashdisk_config
  */
 #define RTEMS_FDISK_BLANK_CHECK_BEFORE_WRITE (1 << 3)
 
+/**
+ * The default priority of the background task.
+ */
+#define RTEMS_FDISK_BACKGROUND_PRIORITY_DEFAULT 200
+
 /**
  * Flash disk device driver initialization. Place in a table as the
  * initialisation entry and remainder of the entries are the
@@ -84,6 +84,21 @@ struct rtems_ftpd_configuration
    rtems_shell_login_check_t login;            /* Login check or 0 to ignore
                                                   user/passwd. */
    bool                    verbose;            /* Say hello! */
+   size_t                  transfer_size;      /* Size of the two binary
+                                                  transfer buffers of each
+                                                  session or 0 to transfer
+                                                  with one FTPD_DATASIZE
+                                                  buffer on the stack.  If
+                                                  non-zero, files which
+                                                  support shared mappings,
+                                                  e.g. IMFS linear files,
+                                                  are sent directly from the
+                                                  mapping.  Each session
+                                                  also gets a transfer I/O
+                                                  task with a stack of
+                                                  FTPD_STACKSIZE bytes, so
+                                                  configure one more task
+                                                  per session */
 };
 
 rtems_status_code rtems_ftpd_start(
@@ -0,0 +1,213 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/**
+ * @file
+ *
+ * @ingroup RTEMSHashService
+ *
+ * @brief This header file provides the interfaces of the hash service.
+ */
+
+/*
+ * Copyright (C) 2026 On-Line Applications Research Corporation (OAR)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef _RTEMS_HASHSERVICE_H
+#define _RTEMS_HASHSERVICE_H
+
+#include <rtems/chain.h>
+#include <rtems/thread.h>
+#include <rtems/rtems/tasks.h>
+
+#include <sha512.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup RTEMSHashService Hash Service
+ *
+ * @ingroup RTEMSAPIClassic
+ *
+ * @brief The hash service computes SHA-256 and SHA-512 digests of files and
+ *   buffers in a service task.
+ *
+ * Requests are processed in FIFO order.  Files are read and hashed in chunks
+ * of the configured chunk size, so that for example the verification of boot
+ * images overlaps with the initialization done by other tasks.
+ *
+ * @{
+ */
+
+/**
+ * @brief The hash algorithms supported by the hash service.
+ */
+typedef enum {
+  RTEMS_HASH_SHA256,
+  RTEMS_HASH_SHA512
+} rtems_hash_algorithm;
+
+/**
+ * @brief A hash request.
+ *
+ * Use rtems_hash_request_initialize_buffer() or
+ * rtems_hash_request_initialize_file() to initialize a request.  The members
+ * shall not be accessed while the request is submitted.
+ */
+typedef struct {
+  rtems_chain_node        node;
+  rtems_hash_algorithm    algorithm;
+  const char             *path;
+  const void             *buffer;
+  size_t                  size;
+  int                     status;
+  size_t                  digest_size;
+  unsigned char           digest[SHA512_DIGEST_LENGTH];
+  rtems_binary_semaphore  done;
+} rtems_hash_request;
+
+/**
+ * @brief The hash service context.
+ */
+typedef struct {
+  rtems_id                  task;
+  rtems_mutex               mutex;
+  rtems_chain_control       todo;
+  rtems_counting_semaphore  pending;
+  rtems_binary_semaphore    stopped;
+  unsigned char            *chunk;
+  size_t                    chunk_size;
+} rtems_hash_service;
+
+/**
+ * @brief Initializes a request to hash a buffer.
+ *
+ * @param[out] request The request to initialize.
+ * @param algorithm The hash algorithm.
+ * @param buffer The buffer to hash.  It shall be valid until the request is
+ *   done.
+ * @param size The size in bytes of the buffer.
+ */
+void rtems_hash_request_initialize_buffer(
+  rtems_hash_request   *request,
+  rtems_hash_algorithm  algorithm,
+  const void           *buffer,
+  size_t                size
+);
+
+/**
+ * @brief Initializes a request to hash the content of a file.
+ *
+ * @param[out] request The request to initialize.
+ * @param algorithm The hash algorithm.
+ * @param path The path of the file.  It shall be valid until the request is
+ *   done.
+ */
+void rtems_hash_request_initialize_file(
+  rtems_hash_request   *request,
+  rtems_hash_algorithm  algorithm,
+  const char           *path
+);
+
+/**
+ * @brief Waits until the request is done.
+ *
+ * The digest of the request is valid if the request was successful.  The
+ * request may be submitted again or destroyed afterwards.
+ *
+ * @param request The submitted request.
+ *
+ * @retval 0 Successful operation.
+ * @retval errno The error number of the failed file operation.
+ */
+int rtems_hash_request_wait(rtems_hash_request *request);
+
+/**
+ * @brief Destroys a request which is not submitted.
+ *
+ * @param request The request to destroy.
+ */
+void rtems_hash_request_destroy(rtems_hash_request *request);
+
+/**
+ * @brief The default stack size of the hash service task.
+ *
+ * The SHA-512 context and the file operations of the service task fit into
+ * this stack size.  File systems with deep call chains may need more.
+ */
+#define RTEMS_HASH_SERVICE_DEFAULT_STACK_SIZE (2 * RTEMS_MINIMUM_STACK_SIZE)
+
+/**
+ * @brief Starts a hash service task.
+ *
+ * @param[out] service The hash service context.
+ * @param priority The priority of the service task.
+ * @param stack_size The stack size in bytes of the service task, for example
+ *   RTEMS_HASH_SERVICE_DEFAULT_STACK_SIZE.
+ * @param chunk_size The size in bytes of the chunks used to read files.
+ *
+ * @retval 0 Successful operation.
+ * @retval EINVAL The chunk size is zero or the priority is invalid.
+ * @retval EAGAIN There is no inactive task object available.
+ * @retval ENOMEM There is not enough memory for the chunk or the task stack.
+ */
+int rtems_hash_service_start(
+  rtems_hash_service  *service,
+  rtems_task_priority  priority,
+  size_t               stack_size,
+  size_t               chunk_size
+);
+
+/**
+ * @brief Submits a request to the hash service.
+ *
+ * The request is processed by the service task after all previously
+ * submitted requests.  Use rtems_hash_request_wait() to get the result.
+ *
+ * @param service The started hash service.
+ * @param request The initialized request which is not submitted.
+ */
+void rtems_hash_service_submit(
+  rtems_hash_service *service,
+  rtems_hash_request *request
+);
+
+/**
+ * @brief Stops the hash service task.
+ *
+ * All requests submitted before the call are processed before the service
+ * task ends.  The resources of the service are freed.
+ *
+ * @param service The started hash service.
+ */
+void rtems_hash_service_stop(rtems_hash_service *service);
+
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _RTEMS_HASHSERVICE_H */
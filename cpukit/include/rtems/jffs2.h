@@ -598,6 +598,37 @@ typedef struct {
    * The compressor is optional and this pointer may be @c NULL.
    */
   rtems_jffs2_compressor_control *compressor_control;
+
+  /**
+   * @brief Count of free flash blocks the background garbage collection task
+   * tries to keep available.
+   *
+   * If this value is positive, then a background garbage collection task is
+   * created for the file system instance during mount.  It wakes up on the
+   * garbage collection triggers of the file system and periodically.  It
+   * carries out garbage collection passes and erases until the count of free
+   * blocks reaches this value or there is not enough dirty space left to
+   * reclaim a block.  It yields to foreground writes as long as the count of
+   * free blocks is above the garbage collection trigger level of the file
+   * system, so that writers do not have to carry out garbage collection
+   * inline.
+   *
+   * Each mounted file system instance with a background garbage collection
+   * task needs one task in the application configuration.
+   *
+   * If this value is zero, then no background garbage collection task is
+   * created.
+   */
+  uint32_t gc_target_free_blocks;
+
+  /**
+   * @brief Priority of the background garbage collection task.
+   *
+   * If this value is zero, then @ref RTEMS_JFFS2_GC_TASK_PRIORITY_DEFAULT is
+   * used.  The priority should be lower than the priority of the tasks
+   * writing to the file system.
+   */
+  rtems_task_priority gc_task_priority;
 } rtems_jffs2_mount_data;
 
 /**
@@ -734,6 +765,90 @@ typedef struct {
  */
 #define RTEMS_JFFS2_FORCE_GARBAGE_COLLECTION _IO('F', 3)
 
+/**
+ * @brief JFFS2 filesystem instance garbage collection statistics.
+ *
+ * Times are in nanoseconds.
+ *
+ * @see RTEMS_JFFS2_GET_GC_STATS.
+ */
+typedef struct {
+  /**
+   * @brief Count of garbage collection passes carried out by the background
+   * garbage collection task.
+   */
+  uint32_t background_passes;
+
+  /**
+   * @brief Count of garbage collection passes carried out inline on behalf of
+   * a writer which ran short of free space.
+   */
+  uint32_t foreground_passes;
+
+  /**
+   * @brief Count of flash block erases carried out by the background garbage
+   * collection task.
+   */
+  uint32_t background_erases;
+
+  /**
+   * @brief Count of flash block erases carried out by all other tasks.
+   */
+  uint32_t foreground_erases;
+
+  /**
+   * @brief Time spent in background garbage collection passes.
+   */
+  uint64_t background_time;
+
+  /**
+   * @brief Time spent in inline garbage collection passes.
+   */
+  uint64_t foreground_time;
+
+  /**
+   * @brief Count of file writes.
+   */
+  uint32_t writes;
+
+  /**
+   * @brief Count of file writes which stalled in an inline garbage collection
+   * pass or erase.
+   */
+  uint32_t write_stalls;
+
+  /**
+   * @brief Total time of the file writes which stalled.
+   */
+  uint64_t write_stall_time;
+
+  /**
+   * @brief Maximum time of a file write.
+   */
+  uint64_t write_time_max;
+} rtems_jffs2_gc_stats;
+
+/**
+ * @brief IO control to get the JFFS2 filesystem instance garbage collection
+ * statistics.
+ *
+ * @see rtems_jffs2_gc_stats.
+ */
+#define RTEMS_JFFS2_GET_GC_STATS _IOR('F', 4, rtems_jffs2_gc_stats)
+
+/**
+ * @brief IO control to reset the JFFS2 filesystem instance garbage collection
+ * statistics.
+ */
+#define RTEMS_JFFS2_RESET_GC_STATS _IO('F', 5)
+
+/**
+ * @brief Default background garbage collection task priority.
+ *
+ * @see rtems_jffs2_mount_data::gc_target_free_blocks.
+ */
+#define RTEMS_JFFS2_GC_TASK_PRIORITY_DEFAULT 200
+
 /**
  * Default delayed-write servicing task priority.
  */
@@ -1921,6 +1921,23 @@ rtems_status_code rtems_termios_bufsize (
   size_t raw_output    /* raw output buffer size */
 );
 
+/**
+ * @brief Selects the daemon tasks of task-driven Termios devices.
+ *
+ * By default, each device in TERMIOS_TASK_DRIVEN mode has a receive and a
+ * transmit daemon task.  If shared daemons are enabled, then the devices
+ * opened afterwards are served by one daemon task shared by all devices.  The
+ * shared daemon task is created on demand.  This saves the stack space and
+ * context switches of the per-device tasks on systems with many serial
+ * devices.
+ *
+ * @param shared Indicates if devices opened afterwards use the shared daemon
+ *   task.
+ *
+ * @retval RTEMS_SUCCESSFUL Successful operation.
+ */
+rtems_status_code rtems_termios_set_shared_daemon( bool shared );
+
 /**
  * @brief The status code returned by all Termios input processing (iproc)
  * functions and input signal (isig) handlers.
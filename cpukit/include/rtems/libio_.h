@@ -463,6 +463,17 @@ void rtems_libio_free(
   rtems_libio_t *iop
 );
 
+/**
+ * @brief Counts the free file descriptors.
+ *
+ * The free file descriptors are in the global free list or in the free list
+ * caches of the processors.  The count is a snapshot which may be out of date
+ * if file descriptors are allocated or freed concurrently.
+ *
+ * @return Returns the count of free file descriptors.
+ */
+uint32_t rtems_libio_count_free( void );
+
 /*
  *  File System Routine Prototypes
  */
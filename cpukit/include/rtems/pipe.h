@@ -53,9 +53,19 @@
 extern "C" {
 #endif
 
+/**
+ * @brief The maximum size of a pipe buffer segment in bytes.
+ *
+ * The pipe buffer is a ring of equally sized segments.  This avoids large
+ * contiguous allocations for large pipe buffers.
+ */
+#define PIPE_SEGMENT_SIZE 4096
+
 /* Control block to manage each pipe */
 typedef struct pipe_control {
-  char *Buffer;
+  char **Segments;
+  unsigned int SegmentSize;
+  unsigned int SegmentCount;
   unsigned int Size;
   unsigned int Start;
   unsigned int Length;
@@ -63,8 +73,11 @@ typedef struct pipe_control {
   unsigned int Writers;
   unsigned int waitingReaders;
   unsigned int waitingWriters;
+  unsigned int writeThreshold;    /* free space to wake up writers */
   unsigned int readerCounter;     /* incremental counters */
   unsigned int writerCounter;     /* for differentiation of successive opens */
+  bool spliceOut;                 /* a splice reads the buffer unlocked */
+  bool spliceIn;                  /* a splice fills the buffer unlocked */
   rtems_mutex Mutex;
   rtems_condition_variable readBarrier;   /* wait queues */
   rtems_condition_variable writeBarrier;
@@ -73,6 +86,44 @@ typedef struct pipe_control {
 #endif
 } pipe_control_t;
 
+/**
+ * @brief Arguments of the pipe splice IO controls.
+ */
+typedef struct {
+  /**
+   * @brief The file descriptor to transfer data from or to.
+   */
+  int fd;
+
+  /**
+   * @brief The maximum count of bytes to transfer.
+   */
+  size_t count;
+
+  /**
+   * @brief The count of transferred bytes.
+   */
+  size_t transferred;
+} pipe_splice_args;
+
+/**
+ * @brief Moves data from the pipe to the file descriptor of the arguments.
+ */
+#define PIPE_SPLICE_OUT _IOWR('|', 1, pipe_splice_args)
+
+/**
+ * @brief Moves data from the file descriptor of the arguments to the pipe.
+ */
+#define PIPE_SPLICE_IN _IOWR('|', 2, pipe_splice_args)
+
+/**
+ * @brief The configured pipe buffer size in bytes.
+ *
+ * It is defined by the application configuration option
+ * CONFIGURE_PIPE_BUFFER_SIZE.
+ */
+extern const size_t rtems_pipe_buffer_size;
+
 /**
  * @brief Release a pipe.
  *
@@ -135,6 +186,32 @@ extern int pipe_ioctl(
   rtems_libio_t   *iop
 );
 
+/**
+ * @brief Moves data between a pipe and a file descriptor.
+ *
+ * Exactly one of the file descriptors shall refer to a pipe or FIFO.  The data
+ * is transferred directly between the pipe buffer and the read or write
+ * handler of the other file descriptor without an intermediate user buffer.
+ * The pipe is not locked while the other file descriptor is accessed, so a
+ * blocking peer does not block the other end of the pipe.  In the meantime,
+ * other readers of the pipe wait for a transfer out of the pipe and other
+ * writers wait for a transfer into the pipe.  Like
+ * read() on a pipe, this call blocks until the transfer can start unless the
+ * pipe is in non-blocking mode, and it may transfer less than requested.
+ *
+ * @param fd_in The file descriptor to read from.
+ *
+ * @param fd_out The file descriptor to write to.
+ *
+ * @param count The maximum count of bytes to transfer.
+ *
+ * @retval -1 An error occurred.  The errno is set to indicate the error.
+ *
+ * @return Returns the count of transferred bytes.  Zero indicates the end of
+ *   the data.
+ */
+ssize_t rtems_pipe_splice( int fd_in, int fd_out, size_t count );
+
 /** @} */
 
 #ifdef __cplusplus
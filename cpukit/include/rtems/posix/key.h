@@ -107,6 +107,15 @@ extern POSIX_Keys_Key_value_pair _POSIX_Keys_Key_value_pairs[];
  */
 extern const uint32_t _POSIX_Keys_Key_value_pair_maximum;
 
+/**
+ * @brief The count of POSIX keys with a value slot in each thread.
+ *
+ * The values of keys with an object index less than or equal to this count are
+ * stored in Thread_Keys_information::Direct_values.  This value is provided via
+ * <rtems/confdefs.h> in case direct POSIX key values are configured.
+ */
+extern const uint32_t _POSIX_Keys_Direct_maximum;
+
 /**
  * @brief The data structure used to manage a POSIX key.
  */
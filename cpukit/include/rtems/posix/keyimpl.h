@@ -41,6 +41,7 @@
 #include <rtems/score/freechainimpl.h>
 #include <rtems/score/objectimpl.h>
 #include <rtems/score/percpu.h>
+#include <rtems/score/wkspace.h>
 
 #ifndef _RTEMS_POSIX_KEYIMPL_H
 #define _RTEMS_POSIX_KEYIMPL_H
@@ -94,6 +95,37 @@ static inline POSIX_Keys_Control *_POSIX_Keys_Get( pthread_key_t key )
     _Objects_Get_no_protection( (Objects_Id) key, &_POSIX_Keys_Information );
 }
 
+/**
+ * @brief Gets the direct value index of the key.
+ *
+ * @param key is the key identifier.
+ *
+ * @return Returns the index of the key value in
+ *   Thread_Keys_information::Direct_values.  The key has a direct value, if
+ *   and only if the index is less than _POSIX_Keys_Direct_maximum.
+ */
+static inline uint32_t _POSIX_Keys_Get_direct_index( pthread_key_t key )
+{
+  return (uint32_t) _Objects_Get_index( (Objects_Id) key ) - 1U;
+}
+
+/**
+ * @brief Gets the key identifier associated with the direct value index.
+ *
+ * @param index is the direct value index.
+ *
+ * @return Returns the key identifier.
+ */
+static inline pthread_key_t _POSIX_Keys_Get_direct_key( uint32_t index )
+{
+  return (pthread_key_t) _Objects_Build_id(
+    OBJECTS_POSIX_API,
+    OBJECTS_POSIX_KEYS,
+    _Objects_Local_node,
+    ( index + 1 )
+  );
+}
+
 static inline void _POSIX_Keys_Key_value_acquire(
   Thread_Control   *the_thread,
   ISR_lock_Context *lock_context
@@ -112,12 +144,41 @@ static inline void _POSIX_Keys_Key_value_release(
 
 POSIX_Keys_Key_value_pair * _POSIX_Keys_Key_value_allocate( void );
 
+/**
+ * @brief Checks if the key value pair belongs to the statically configured
+ *   key value pairs.
+ *
+ * @param key_value_pair is the key value pair to check.
+ *
+ * @retval true The key value pair belongs to the configured key value pairs.
+ * @retval false Otherwise, the key value pair was allocated from a workspace
+ *   slab.
+ */
+static inline bool _POSIX_Keys_Is_configured_key_value_pair(
+  const POSIX_Keys_Key_value_pair *key_value_pair
+)
+{
+  uintptr_t offset;
+
+  offset = (uintptr_t) key_value_pair
+    - (uintptr_t) &_POSIX_Keys_Key_value_pairs[ 0 ];
+
+  return offset < _Objects_Maximum_per_allocation(
+      _POSIX_Keys_Key_value_pair_maximum
+    ) * sizeof( *key_value_pair );
+}
+
 static inline void _POSIX_Keys_Key_value_free(
   POSIX_Keys_Key_value_pair *key_value_pair
 )
 {
   _Chain_Extract_unprotected( &key_value_pair->Key_node );
-  _Freechain_Put( &_POSIX_Keys_Keypool, key_value_pair );
+
+  if ( _POSIX_Keys_Is_configured_key_value_pair( key_value_pair ) ) {
+    _Freechain_Push( &_POSIX_Keys_Keypool, key_value_pair );
+  } else {
+    _Workspace_Slab_free( key_value_pair, sizeof( *key_value_pair ) );
+  }
 }
 
 static inline bool _POSIX_Keys_Key_value_equal(
@@ -241,6 +241,112 @@ int rtems_print_printer_task(
  */
 void rtems_printer_task_drain(rtems_printer_task_context *context);
 
+/**
+ * @brief Configuration of the deferred printk log.
+ */
+typedef struct {
+  /**
+   * @brief The ring buffer size in bytes of each processor.
+   *
+   * It must be a power of two and at least 256.
+   */
+  size_t              buffer_size;
+
+  /**
+   * @brief The priority of the log task.
+   */
+  rtems_task_priority task_priority;
+
+  /**
+   * @brief The stack size of the log task.
+   *
+   * If zero, then RTEMS_MINIMUM_STACK_SIZE is used.
+   */
+  size_t              task_stack_size;
+
+  /**
+   * @brief The character output function.
+   *
+   * If NULL, then rtems_putc() is used.  The function is called with thread
+   * dispatching disabled and from the fatal extension, so it shall not block.
+   */
+  void              (*output_char)(char c);
+} rtems_printk_log_config;
+
+/**
+ * @brief Starts the deferred printk log.
+ *
+ * Each processor gets a ring buffer of the configured size.  Messages logged
+ * via rtems_printk_log() or rtems_vprintk_log() are formatted by the printk()
+ * formatter into a record on the stack of the caller and copied into the ring
+ * buffer of the current processor.  The producer side uses no locks, it only
+ * disables interrupts on the current processor for the copy.  The log task
+ * outputs the records of all processors in timestamp order.  A record is
+ * prefixed with its uptime and processor index if it starts a new line.  If a
+ * ring buffer is full, then the record is dropped and the loss counter of the
+ * processor is incremented.  The log task reports lost records.
+ *
+ * A fatal extension outputs the records pending at the time of a fatal error
+ * synchronously.
+ *
+ * The log may be started only once.
+ *
+ * @param[in] config The log configuration.
+ *
+ * @retval 0 Successful operation.
+ * @retval EINVAL Invalid configuration parameters.
+ * @retval EBUSY The log is already started.
+ * @retval ENOMEM Not enough resources.
+ */
+int rtems_printk_log_start(const rtems_printk_log_config *config);
+
+/**
+ * @brief Logs a message in printk() format.
+ *
+ * This function may be called from interrupt context.  Messages longer than
+ * 128 characters are truncated.  If the log is not started, then the message
+ * is output via vprintk().
+ *
+ * @param[in] fmt The format string.
+ * @param[in] ap The arguments.
+ *
+ * @return The count of characters produced by the format, or zero if the
+ *   message was dropped.
+ */
+int rtems_vprintk_log(const char *fmt, va_list ap);
+
+/**
+ * @brief Logs a message in printk() format.
+ *
+ * @see rtems_vprintk_log().
+ */
+RTEMS_PRINTFLIKE(1, 2) int rtems_printk_log(const char *fmt, ...);
+
+/**
+ * @brief Initializes the printer to print via rtems_vprintk_log().
+ *
+ * @param[in] printer Pointer to the printer structure.
+ */
+void rtems_print_printer_printk_log(rtems_printer *printer);
+
+/**
+ * @brief Waits until all records logged before the call are output.
+ *
+ * This function must be called from task context.  It returns immediately if
+ * the log is not started.
+ */
+void rtems_printk_log_drain(void);
+
+/**
+ * @brief Gets the count of records dropped by the processor since the start
+ * of the log.
+ *
+ * @param[in] cpu_index The processor index.
+ *
+ * @return The count of records dropped by the processor.
+ */
+uint32_t rtems_printk_log_get_lost(uint32_t cpu_index);
+
 /** @} */
 
 #ifdef __cplusplus
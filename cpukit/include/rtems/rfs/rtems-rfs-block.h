@@ -74,6 +74,62 @@
     rtems_rfs_buffer_mark_dirty (_h); \
   } while (0)
 
+/**
+ * The size of an extent held in an extent block. An extent is the logical
+ * block number of the first block in the extent, the block number of the
+ * first block on the media and the number of blocks in the extent.
+ */
+#define RTEMS_RFS_BLOCK_EXTENT_SIZE (3 * sizeof (rtems_rfs_block_no))
+
+/**
+ * The number of extents held directly in the inode's block slots. Each extent
+ * uses two slots, the block number and the block count. The logical block
+ * number is implied as the map has no holes.
+ */
+#define RTEMS_RFS_BLOCK_INODE_EXTENTS (2)
+
+/**
+ * The inode block slot that holds the number of extents in the map.
+ */
+#define RTEMS_RFS_BLOCK_EXTENT_COUNT_SLOT (RTEMS_RFS_INODE_BLOCKS - 1)
+
+/**
+ * The number of extent blocks or tables of extent blocks an inode can
+ * reference.
+ */
+#define RTEMS_RFS_BLOCK_EXTENT_BLOCKS (RTEMS_RFS_INODE_BLOCKS - 1)
+
+/**
+ * The number of extents that fit in a block.
+ *
+ * @param[in] _fs is a pointer to the file system.
+ */
+#define rtems_rfs_block_extents_per_block(_fs) \
+  (rtems_rfs_fs_block_size (_fs) / RTEMS_RFS_BLOCK_EXTENT_SIZE)
+
+/**
+ * An extent is a run of contiguous blocks on the media mapped to contiguous
+ * logical blocks in the map.
+ */
+typedef struct rtems_rfs_block_extent_s
+{
+  /**
+   * The logical block number of the first block in the extent.
+   */
+  rtems_rfs_block_no bno;
+
+  /**
+   * The block number on the media of the first block in the extent.
+   */
+  rtems_rfs_block_no block;
+
+  /**
+   * The number of blocks in the extent. A count of 0 is an invalid extent.
+   */
+  uint32_t count;
+
+} rtems_rfs_block_extent;
+
 /**
  * A block map manges the block lists that originate from an inode. The inode
  * contains a number of block numbers. A block map takes those block numbers
@@ -107,6 +163,17 @@
  *  @li 335,544,320 bytes for a 1024 byte block size,
  *  @li 2,684,354,560 bytes for a 2048 byte block size, and
  *  @li 21,474,836,480 bytes for a 4096 byte block size.
+ *
+ * If the inode is flagged as using extents the map is a list of extents
+ * rather than a table of block numbers. Up to two extents are held in the
+ * inode slots as block number and count pairs. Once there are more extents
+ * the inode slots point to extent blocks holding the logical block number,
+ * block number and count of each extent. When the inode slots are all used
+ * the slots point to tables of extent blocks. The last inode slot holds the
+ * number of extents. Finding a block is a binary search of the extents, and
+ * the extent last found is cached so sequential access does not touch the
+ * extent blocks. Adjacent blocks are merged into the last extent so a file
+ * written in one pass is usually a single extent.
  */
 typedef struct rtems_rfs_block_map_s
 {
@@ -153,7 +220,28 @@ typedef struct rtems_rfs_block_map_s
   uint32_t blocks[RTEMS_RFS_INODE_BLOCKS];
 
   /**
-   * Singly Buffer handle.
+   * Does the map hold extents rather than block numbers ?
+   */
+  bool extents;
+
+  /**
+   * The number of extents in the map if the map holds extents.
+   */
+  uint32_t extent_count;
+
+  /**
+   * The last extent found. Used to find blocks without searching the
+   * extents. The extent is not valid if the count is 0.
+   */
+  rtems_rfs_block_extent extent;
+
+  /**
+   * The index of the last extent found.
+   */
+  uint32_t extent_index;
+
+  /**
+   * Singly Buffer handle. The extent blocks are accessed using this handle.
    */
   rtems_rfs_buffer_handle singly_buffer;
 
@@ -212,6 +300,11 @@ typedef struct rtems_rfs_block_map_s
  */
 #define rtems_rfs_block_map_block_offset(_m) ((_m)->bpos.boff)
 
+/**
+ * Does the map hold extents ?
+ */
+#define rtems_rfs_block_map_has_extents(_m) ((_m)->extents)
+
 /**
  * Set the size offset for the map. The map is tagged as dirty.
  *
@@ -208,6 +208,20 @@ int rtems_rfs_buffer_handle_request (rtems_rfs_file_system*   fs,
 int rtems_rfs_buffer_handle_release (rtems_rfs_file_system*   fs,
                                      rtems_rfs_buffer_handle* handle);
 
+/**
+ * Release a buffer holding file data. File data is not logged by the journal
+ * so a modified buffer is released to the cache. Without a journal this is
+ * the same as rtems_rfs_buffer_handle_release.
+ *
+ * @param[in] fs is the file system data.
+ * @param[in] handle is the handle the requested buffer is attached to.
+ *
+ * @retval 0 Successful operation.
+ * @retval error_code An error occurred.
+ */
+int rtems_rfs_buffer_handle_release_data (rtems_rfs_file_system*   fs,
+                                          rtems_rfs_buffer_handle* handle);
+
 /**
  * Open a handle.
  *
@@ -269,7 +283,8 @@ int rtems_rfs_buffer_open (const char* name, rtems_rfs_file_system* fs);
 int rtems_rfs_buffer_close (rtems_rfs_file_system* fs);
 
 /**
- * Sync all buffers to the media.
+ * Sync all buffers to the media. The journal's running transaction is
+ * committed first.
  *
  * @param[in] fs is the file system data.
  *
@@ -278,6 +293,17 @@ int rtems_rfs_buffer_close (rtems_rfs_file_system* fs);
  */
 int rtems_rfs_buffer_sync (rtems_rfs_file_system* fs);
 
+/**
+ * Write the modified buffers released to the cache to the media. The
+ * journal's running transaction is not committed.
+ *
+ * @param[in] fs is the file system data.
+ *
+ * @retval 0 Successful operation.
+ * @retval error_code An error occurred.
+ */
+int rtems_rfs_buffer_flush (rtems_rfs_file_system* fs);
+
 /**
  * Set the block size of the device.
  *
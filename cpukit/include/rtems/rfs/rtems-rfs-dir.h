@@ -71,6 +71,32 @@
  */
 #define RTEMS_RFS_DIR_ENTRY_EMPTY (0xffff)
 
+/**
+ * A directory with the index flag set in its inode holds a tree of index
+ * blocks ordered by the hash of the entry names. Logical block 0 is the root
+ * of the tree. An index block starts with an empty directory entry header so
+ * code scanning the blocks of the directory for entries skips it. The ino
+ * field is 0 and the hash field holds the count of index entries and the
+ * number of levels of index blocks below the block. An index entry is the
+ * lowest hash held below it and the logical block number of the child. The
+ * children of the lowest index blocks are blocks of directory entries and all
+ * entries with the same hash are held in the same block.
+ */
+#define RTEMS_RFS_DIR_INDEX_COUNT      (4)  /**< The count of index entries
+                                             * offset. The count is 16bits. */
+#define RTEMS_RFS_DIR_INDEX_LEVELS     (6)  /**< The offset of the number of
+                                             * index levels below the
+                                             * block. The levels is 16bits. */
+#define RTEMS_RFS_DIR_INDEX_ENTRIES    (12) /**< The offset of the first index
+                                             * entry. */
+#define RTEMS_RFS_DIR_INDEX_ENTRY_SIZE (8)  /**< The size of an index entry,
+                                             * the hash then the block. */
+
+/**
+ * The maximum number of levels of index blocks including the root.
+ */
+#define RTEMS_RFS_DIR_INDEX_MAX_LEVELS (3)
+
 /**
  * Return the hash of the entry.
  *
@@ -164,6 +190,10 @@ int rtems_rfs_dir_lookup_ino (rtems_rfs_file_system*  fs,
  * @param[in] length is the length of the name excluding a terminating 0.
  * @param[in] ino is the ino of the entry.
  *
+ * @note Adding an entry to an indexed directory can move entries to other
+ *       blocks of the directory so a read of the directory in progress may
+ *       return an entry twice or miss it.
+ *
  * @retval 0 Successful operation.
  * @retval error_code An error occurred.
  */
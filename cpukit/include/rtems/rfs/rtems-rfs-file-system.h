@@ -41,6 +41,7 @@
 #define _RTEMS_RFS_FILE_SYSTEM_H_
 
 #include <rtems/rfs/rtems-rfs-group.h>
+#include <rtems/rfs/rtems-rfs-journal.h>
 
 /**
  * Superblock offsets and values.
@@ -56,6 +57,26 @@
 #define RTEMS_RFS_SB_OFFSET_GROUP_BLOCKS    (RTEMS_RFS_SB_OFFSET_GROUPS          + 4)
 #define RTEMS_RFS_SB_OFFSET_GROUP_INODES    (RTEMS_RFS_SB_OFFSET_GROUP_BLOCKS    + 4)
 #define RTEMS_RFS_SB_OFFSET_INODE_SIZE      (RTEMS_RFS_SB_OFFSET_GROUP_INODES    + 4)
+#define RTEMS_RFS_SB_OFFSET_FEATURES        (RTEMS_RFS_SB_OFFSET_INODE_SIZE      + 4)
+#define RTEMS_RFS_SB_OFFSET_JOURNAL_START   (RTEMS_RFS_SB_OFFSET_FEATURES        + 4)
+#define RTEMS_RFS_SB_OFFSET_JOURNAL_BLOCKS  (RTEMS_RFS_SB_OFFSET_JOURNAL_START   + 4)
+
+/**
+ * RFS Features. The features are held in the superblock and are set when the
+ * file system is formatted. A superblock written before features were added
+ * has all ones in the features field and this is read as no features. A file
+ * system with a feature this code does not support is not opened.
+ */
+#define RTEMS_RFS_FEATURE_EXTENTS  (1 << 0) /**< Maps of new inodes hold
+                                             * extents. */
+#define RTEMS_RFS_FEATURE_DIR_INDEX (1 << 1) /**< Directories larger than a
+                                              * block are indexed by the
+                                              * hash of the names. */
+#define RTEMS_RFS_FEATURE_JOURNAL  (1 << 2) /**< Metadata changes are
+                                             * written to a journal. */
+#define RTEMS_RFS_FEATURES_SUPPORTED \
+  (RTEMS_RFS_FEATURE_EXTENTS | RTEMS_RFS_FEATURE_DIR_INDEX | \
+   RTEMS_RFS_FEATURE_JOURNAL)
 
 /**
  * RFS Version Number.
@@ -170,6 +191,11 @@ struct _rtems_rfs_file_system
   size_t size;
 #endif
 
+  /**
+   * The features the file system was formatted with.
+   */
+  uint32_t features;
+
   /**
    * Inode count.
    */
@@ -272,6 +298,11 @@ struct _rtems_rfs_file_system
    */
   rtems_chain_control file_shares;
 
+  /**
+   * The metadata journal.
+   */
+  rtems_rfs_journal journal;
+
   /**
    * Pointer to user data supplied when opening.
    */
@@ -284,6 +315,34 @@ struct _rtems_rfs_file_system
  * @param[in] _fs is a pointer to the file system.
  */
 #define rtems_rfs_fs_flags(_f) ((_f)->flags)
+/**
+ * Return the features.
+ *
+ * @param[in] _fs is a pointer to the file system.
+ */
+#define rtems_rfs_fs_features(_f) ((_f)->features)
+
+/**
+ * Are new block maps created holding extents ?
+ *
+ * @param[in] _fs is a pointer to the file system.
+ */
+#define rtems_rfs_fs_extents(_f) ((_f)->features & RTEMS_RFS_FEATURE_EXTENTS)
+
+/**
+ * Are directories indexed when they grow past a block ?
+ *
+ * @param[in] _fs is a pointer to the file system.
+ */
+#define rtems_rfs_fs_dir_index(_f) ((_f)->features & RTEMS_RFS_FEATURE_DIR_INDEX)
+
+/**
+ * Was the file system formatted with a metadata journal ?
+ *
+ * @param[in] _fs is a pointer to the file system.
+ */
+#define rtems_rfs_fs_journal(_f) ((_f)->features & RTEMS_RFS_FEATURE_JOURNAL)
+
 /**
  * Should bitmap buffers be released when finished ?
  *
@@ -91,6 +91,14 @@
 #define RTEMS_RFS_S_SYMLINK \
   RTEMS_RFS_S_IFLNK | RTEMS_RFS_S_IRWXU | RTEMS_RFS_S_IRWXG | RTEMS_RFS_S_IRWXO
 
+/**
+ * The RFS inode flags.
+ */
+#define RTEMS_RFS_INODE_FLAG_EXTENTS (1 << 0) /**< The block map holds
+                                               * extents. */
+#define RTEMS_RFS_INODE_FLAG_DIR_INDEX (1 << 1) /**< The directory is
+                                                 * indexed. */
+
 /**
  * The inode number or ino.
  */
@@ -134,7 +142,7 @@ typedef struct _rtems_rfs_inode
   uint32_t owner;
 
   /**
-   * Reserved.
+   * The inode flags.
    */
   uint16_t flags;
 
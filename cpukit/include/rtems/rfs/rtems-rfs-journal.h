@@ -0,0 +1,423 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/**
+ * @file
+ *
+ * @brief RTEMS File System Metadata Journal
+ *
+ * @ingroup rtems_rfs
+ *
+ * RTEMS File System Metadata Journal
+ *
+ * The journal is a write ahead log of the metadata blocks. Modified metadata
+ * buffers are held by the file system in a transaction and are not released
+ * to the cache until the transaction has been committed to the journal. A
+ * transaction is made from the changes of a number of file system requests
+ * and committed as a group when it has grown to the commit size, when it is
+ * older than the commit interval at the end of a request or when the file
+ * system is synced. When mounted the committed transactions are replayed to
+ * their home locations.
+ *
+ * The journal is a contiguous area of blocks in the first group allocated
+ * when the file system is formatted. The first block is the journal header
+ * and a transaction is a descriptor block holding the home block numbers, a
+ * copy of each block and a commit block holding a checksum of the
+ * descriptor and the copies. Transactions are written one after the other
+ * around the journal. When there is no space for a transaction the home
+ * locations are synced and the header moved to the last transaction. The
+ * last transaction is kept because it holds the only copy of the blocks
+ * still held by a handle.
+ *
+ * File data blocks are not logged. A transaction that frees blocks is
+ * committed before file data is written so a freed block is not overwritten
+ * while the file system on the media still uses it. Freeing a block with a
+ * copy in the journal adds a revoke record to the descriptor so the copy is
+ * not replayed over the data.
+ */
+
+/*
+ * Copyright (C) 2026 On-Line Applications Research Corporation (OAR)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#if !defined (_RTEMS_RFS_JOURNAL_H_)
+#define _RTEMS_RFS_JOURNAL_H_
+
+#include <rtems/rfs/rtems-rfs-file-system-fwd.h>
+#include <rtems/rfs/rtems-rfs-buffer.h>
+
+/**
+ * Journal block magic numbers.
+ */
+#define RTEMS_RFS_JOURNAL_MAGIC        (0x52464a48) /**< Journal header. */
+#define RTEMS_RFS_JOURNAL_DESC_MAGIC   (0x52464a44) /**< Descriptor. */
+#define RTEMS_RFS_JOURNAL_COMMIT_MAGIC (0x52464a43) /**< Commit. */
+
+/**
+ * Journal header offsets. The sequence is the sequence number of the first
+ * transaction in the journal and the tail is its offset from the header.
+ */
+#define RTEMS_RFS_JOURNAL_OFFSET_MAGIC    (0)
+#define RTEMS_RFS_JOURNAL_OFFSET_SEQUENCE (4)
+#define RTEMS_RFS_JOURNAL_OFFSET_TAIL     (8)
+
+/**
+ * Descriptor and commit block offsets. The descriptor's home block numbers
+ * start at the blocks offset and are followed by the revoked block numbers.
+ * The commit block's checksum covers the descriptor block and the copies of
+ * the blocks.
+ */
+#define RTEMS_RFS_JOURNAL_OFFSET_COUNT    (8)
+#define RTEMS_RFS_JOURNAL_OFFSET_CHECKSUM (12)
+#define RTEMS_RFS_JOURNAL_OFFSET_REVOKES  (12)
+#define RTEMS_RFS_JOURNAL_OFFSET_BLOCKS   (16)
+
+/**
+ * The minimum number of blocks in a journal. The header, the last
+ * transaction and a new transaction have to fit.
+ */
+#define RTEMS_RFS_JOURNAL_MIN_BLOCKS (64)
+
+/**
+ * The default number of modified blocks in a transaction before it is
+ * committed at the end of a request.
+ */
+#define RTEMS_RFS_JOURNAL_COMMIT_BLOCKS (16)
+
+/**
+ * The default age in milliseconds of a transaction before it is committed at
+ * the end of a request.
+ */
+#define RTEMS_RFS_JOURNAL_COMMIT_INTERVAL (100)
+
+/**
+ * A block modified in the running transaction.
+ */
+typedef struct _rtems_rfs_journal_entry
+{
+  /**
+   * The home block number.
+   */
+  rtems_rfs_buffer_block block;
+
+  /**
+   * The block was held by a handle when the previous transaction was
+   * committed. The copy in the journal is the only copy of the changes so the
+   * block is logged again and written when it is released.
+   */
+  bool carried;
+} rtems_rfs_journal_entry;
+
+/**
+ * The journal's statistics.
+ */
+typedef struct _rtems_rfs_journal_stats
+{
+  uint32_t commits;         /**< Transactions committed. */
+  uint32_t blocks;          /**< Blocks written to the journal. */
+  uint32_t checkpoints;     /**< Times the journal was synced and reset. */
+  uint32_t forced;          /**< Commits forced by a full transaction. */
+  uint32_t revokes;         /**< Revoke records written. */
+  uint32_t replayed;        /**< Transactions replayed when mounted. */
+  uint32_t replayed_blocks; /**< Blocks replayed when mounted. */
+} rtems_rfs_journal_stats;
+
+/**
+ * The journal control data held in the file system data.
+ */
+typedef struct _rtems_rfs_journal
+{
+  /**
+   * The block number of the journal header.
+   */
+  rtems_rfs_buffer_block start;
+
+  /**
+   * The number of blocks in the journal including the header.
+   */
+  uint32_t blocks;
+
+  /**
+   * The sequence number of the running transaction.
+   */
+  uint32_t sequence;
+
+  /**
+   * The offset from the start of the journal the next transaction is written
+   * at if it fits.
+   */
+  uint32_t head;
+
+  /**
+   * The offset of the first transaction replayed when mounted.
+   */
+  uint32_t tail;
+
+  /**
+   * The offset of the last committed transaction.
+   */
+  uint32_t last;
+
+  /**
+   * The number of blocks in the last committed transaction.
+   */
+  uint32_t last_count;
+
+  /**
+   * Number of blocks still held after the last transaction was committed.
+   * The last transaction is kept when the journal is synced if not 0.
+   */
+  uint32_t last_carried;
+
+  /**
+   * The buffers released modified in the running transaction.
+   */
+  rtems_chain_control transaction;
+
+  /**
+   * Number of buffers held on the transaction list.
+   */
+  uint32_t transaction_count;
+
+  /**
+   * The blocks modified in the running transaction. The journal is not
+   * active if this is NULL.
+   */
+  rtems_rfs_journal_entry* entries;
+
+  /**
+   * Number of entries in the running transaction.
+   */
+  uint32_t count;
+
+  /**
+   * Number of carried entries in the running transaction.
+   */
+  uint32_t carried;
+
+  /**
+   * The blocks revoked in the running transaction.
+   */
+  rtems_rfs_buffer_block* revokes;
+
+  /**
+   * Number of revoked blocks in the running transaction.
+   */
+  uint32_t revoked;
+
+  /**
+   * The blocks with a copy in the journal since the tail. A block freed with
+   * a copy in the journal is revoked.
+   */
+  rtems_rfs_buffer_block* logged;
+
+  /**
+   * Number of logged blocks.
+   */
+  uint32_t logged_count;
+
+  /**
+   * Number of blocks freed in the running transaction.
+   */
+  uint32_t freed;
+
+  /**
+   * The maximum number of entries and revoked blocks in a transaction. A
+   * descriptor must fit in a block and three transactions in the journal.
+   */
+  uint32_t max_entries;
+
+  /**
+   * The number of modified blocks a transaction is committed at.
+   */
+  uint32_t commit_blocks;
+
+  /**
+   * The age in ticks a transaction is committed at.
+   */
+  rtems_interval commit_interval;
+
+  /**
+   * The tick count the running transaction started.
+   */
+  rtems_interval started;
+
+  /**
+   * Statistics.
+   */
+  rtems_rfs_journal_stats stats;
+} rtems_rfs_journal;
+
+/**
+ * Is the journal active ?
+ */
+#define rtems_rfs_journal_active(_f) ((_f)->journal.entries != NULL)
+
+/**
+ * Write an empty journal. Called when formatting the file system.
+ *
+ * @param[in] fs is the file system data.
+ *
+ * @retval 0 Successful operation.
+ * @retval error_code An error occurred.
+ */
+int rtems_rfs_journal_format (rtems_rfs_file_system* fs);
+
+/**
+ * Open the journal and replay any committed transactions. Called when
+ * mounting the file system before any metadata is read.
+ *
+ * @param[in] fs is the file system data.
+ *
+ * @retval 0 Successful operation.
+ * @retval error_code An error occurred.
+ */
+int rtems_rfs_journal_open (rtems_rfs_file_system* fs);
+
+/**
+ * Commit the running transaction, sync the home locations and close the
+ * journal. The journal is empty when the file system is next mounted.
+ *
+ * @param[in] fs is the file system data.
+ *
+ * @retval 0 Successful operation.
+ * @retval error_code An error occurred.
+ */
+int rtems_rfs_journal_close (rtems_rfs_file_system* fs);
+
+/**
+ * Set the size in blocks and the age in milliseconds a transaction is
+ * committed at. A value of 0 leaves the setting unchanged.
+ *
+ * @param[in] fs is the file system data.
+ * @param[in] blocks is the number of modified blocks.
+ * @param[in] interval is the age in milliseconds.
+ */
+void rtems_rfs_journal_set_commit (rtems_rfs_file_system* fs,
+                                   uint32_t               blocks,
+                                   uint32_t               interval);
+
+/**
+ * Add a buffer released modified to the running transaction. The file system
+ * holds the buffer until the transaction is committed. If the transaction is
+ * full it is committed first.
+ *
+ * @param[in] fs is the file system data.
+ * @param[in] buffer is the buffer to add.
+ *
+ * @retval 0 Successful operation.
+ * @retval error_code An error occurred.
+ */
+int rtems_rfs_journal_add (rtems_rfs_file_system* fs,
+                           rtems_rfs_buffer*      buffer);
+
+/**
+ * Mark a block still held by another handle as modified in the running
+ * transaction. The block is logged from the held buffer.
+ *
+ * @param[in] fs is the file system data.
+ * @param[in] block is the block number.
+ *
+ * @retval 0 Successful operation.
+ * @retval error_code An error occurred.
+ */
+int rtems_rfs_journal_mark (rtems_rfs_file_system* fs,
+                            rtems_rfs_buffer_block block);
+
+/**
+ * Is the block modified in the running transaction ?
+ *
+ * @param[in] fs is the file system data.
+ * @param[in] block is the block number.
+ *
+ * @retval true The block is part of the running transaction.
+ * @retval false The block is not part of the running transaction.
+ */
+bool rtems_rfs_journal_logged (rtems_rfs_file_system* fs,
+                               rtems_rfs_buffer_block block);
+
+/**
+ * Remove a buffer from the running transaction's list of buffers. The block
+ * stays part of the transaction.
+ *
+ * @param[in] fs is the file system data.
+ * @param[in] block is the block number.
+ *
+ * @retval buffer The buffer if held by the transaction.
+ * @retval NULL The buffer is not held by the transaction.
+ */
+rtems_rfs_buffer* rtems_rfs_journal_scan (rtems_rfs_file_system* fs,
+                                          rtems_rfs_buffer_block block);
+
+/**
+ * A block has been freed. If the block is part of the running transaction it
+ * is removed and if a copy of the block is in the journal the block is
+ * revoked.
+ *
+ * @param[in] fs is the file system data.
+ * @param[in] block is the block number.
+ *
+ * @retval 0 Successful operation.
+ * @retval error_code An error occurred.
+ */
+int rtems_rfs_journal_free (rtems_rfs_file_system* fs,
+                            rtems_rfs_buffer_block block);
+
+/**
+ * A block is to be written as file data. If the block is part of the running
+ * transaction it is removed. The transaction is committed if the block was
+ * part of it or the transaction has freed blocks.
+ *
+ * @param[in] fs is the file system data.
+ * @param[in] block is the block number.
+ *
+ * @retval 0 Successful operation.
+ * @retval error_code An error occurred.
+ */
+int rtems_rfs_journal_revoke (rtems_rfs_file_system* fs,
+                              rtems_rfs_buffer_block block);
+
+/**
+ * The end of a file system request. Commit the running transaction if it is
+ * large enough or old enough.
+ *
+ * @param[in] fs is the file system data.
+ *
+ * @retval 0 Successful operation.
+ * @retval error_code An error occurred.
+ */
+int rtems_rfs_journal_release (rtems_rfs_file_system* fs);
+
+/**
+ * Commit the running transaction to the journal and release the buffers to
+ * the cache.
+ *
+ * @param[in] fs is the file system data.
+ *
+ * @retval 0 Successful operation.
+ * @retval error_code An error occurred.
+ */
+int rtems_rfs_journal_commit (rtems_rfs_file_system* fs);
+
+#endif
@@ -84,6 +84,32 @@ typedef struct _rtems_rfs_format_config
    */
   bool initialise_inodes;
 
+  /**
+   * Block maps hold extents rather than tables of block numbers. The extents
+   * feature is set in the superblock, so versions of RFS which check the
+   * features and do not support extents refuse to open the file system. RFS
+   * versions older than the features field do not check it and must not be
+   * used with a file system formatted with extents.
+   */
+  bool extents;
+
+  /**
+   * Directories are indexed by the hash of the entry names when they grow
+   * past a block. Versions of RFS which check the features and do not
+   * support directory indexes refuse to open the file system. Older versions
+   * do not check the features and must not be used with it.
+   */
+  bool dir_index;
+
+  /**
+   * The number of blocks in the metadata journal. The journal is allocated in
+   * the first group and has at least RTEMS_RFS_JOURNAL_MIN_BLOCKS blocks. Set
+   * to 0 for no journal. Versions of RFS which check the features and do not
+   * support the journal refuse to open the file system. Older versions do not
+   * check the features and must not be used with it.
+   */
+  size_t journal_blocks;
+
   /**
    * Is the format verbose.
    */
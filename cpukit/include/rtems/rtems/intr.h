@@ -2111,6 +2111,15 @@ typedef struct rtems_interrupt_server_control {
    */
   Chain_Node node;
 
+  /**
+   * @brief This member references the table of per-processor workers indexed
+   *   by the processor index or is NULL.
+   *
+   * A worker is an interrupt server control which is not registered.  An
+   * entry for NULL indicates that the processor has no worker.
+   */
+  struct rtems_interrupt_server_control **workers;
+
   /**
    * @brief This member is the optional handler to destroy the interrupt server
    *   control.
@@ -2174,6 +2183,25 @@ typedef struct {
    * deleted, see also rtems_interrupt_server_delete().
    */
   void ( *destroy )( rtems_interrupt_server_control * );
+
+  /**
+   * @brief This member is the size of the processor set referenced by
+   *   rtems_interrupt_server_config::worker_processors in bytes.
+   */
+  size_t worker_processors_size;
+
+  /**
+   * @brief This member references the optional processor set of the
+   *   per-processor workers.
+   *
+   * If the set is present, then one worker task is created for each processor
+   * of the set.  Interrupts taken by a processor with a worker are serviced by
+   * this worker.  Interrupts taken by other processors, requests, and server
+   * management operations are serviced by the interrupt server task.  The
+   * workers have the name, priority, stack size, modes, and attributes of the
+   * interrupt server task.
+   */
+  const cpu_set_t *worker_processors;
 } rtems_interrupt_server_config;
 
 /* Generated from spec:/rtems/intr/if/server-initialize */
@@ -2705,6 +2733,97 @@ rtems_status_code rtems_interrupt_server_handler_iterate(
   void                               *arg
 );
 
+/* Generated from spec:/rtems/intr/if/server-statistics */
+
+/**
+ * @ingroup RTEMSAPIClassicIntr
+ *
+ * @brief This structure provides the statistics of the interrupt handlers
+ *   installed at an interrupt vector and interrupt server.
+ */
+typedef struct {
+  /**
+   * @brief This member is the count of interrupts serviced.
+   */
+  uint32_t count;
+
+  /**
+   * @brief This member is the maximum time in nanoseconds between the
+   *   interrupt and the start of the handler processing.
+   */
+  uint64_t latency_max;
+
+  /**
+   * @brief This member is the accumulated time in nanoseconds between the
+   *   interrupts and the start of the handler processing.
+   */
+  uint64_t latency_total;
+
+  /**
+   * @brief This member is the maximum run time in nanoseconds of the handlers.
+   */
+  uint64_t run_time_max;
+
+  /**
+   * @brief This member is the accumulated run time in nanoseconds of the
+   *   handlers.
+   */
+  uint64_t run_time_total;
+} rtems_interrupt_server_statistics;
+
+/* Generated from spec:/rtems/intr/if/server-handler-get-statistics */
+
+/**
+ * @ingroup RTEMSAPIClassicIntr
+ *
+ * @brief Gets the statistics of the interrupt handlers installed at the
+ *   interrupt vector and interrupt server.
+ *
+ * @param server_index is the index of the interrupt server.
+ *
+ * @param vector is the interrupt vector number.
+ *
+ * @param[out] statistics is the pointer to an
+ *   rtems_interrupt_server_statistics object.  When the directive call is
+ *   successful, the statistics will be stored in this object.
+ *
+ * The statistics are maintained by the interrupt server task or worker which
+ * services the interrupt.  They are obtained in the same way as
+ * rtems_interrupt_server_handler_iterate() visits the handlers.
+ *
+ * @retval ::RTEMS_SUCCESSFUL The requested operation was successful.
+ *
+ * @retval ::RTEMS_INVALID_ID There was no interrupt server associated with the
+ *   index specified by ``server_index``.
+ *
+ * @retval ::RTEMS_INVALID_ID There was no interrupt vector associated with the
+ *   number specified by ``vector``.
+ *
+ * @retval ::RTEMS_UNSATISFIED There was no handler installed at the interrupt
+ *   vector and interrupt server.
+ *
+ * @par Notes
+ * The directive is intended for system information and diagnostics.
+ *
+ * @par Constraints
+ * @parblock
+ * The following constraints apply to this directive:
+ *
+ * * The directive may be called from within device driver initialization
+ *   context.
+ *
+ * * The directive may be called from within task context.
+ *
+ * * The directive may obtain and release the object allocator mutex.  This may
+ *   cause the calling task to be preempted.
+ * @endparblock
+ */
+rtems_status_code rtems_interrupt_server_handler_get_statistics(
+  uint32_t                           server_index,
+  rtems_vector_number                vector,
+  rtems_interrupt_server_statistics *statistics
+);
+
 /* Generated from spec:/rtems/intr/if/server-action */
 
 /**
@@ -64,6 +64,8 @@
 #include <rtems/rtems/types.h>
 #include <rtems/score/coremsgbuffer.h>
 
+struct iovec;
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -479,12 +481,20 @@ rtems_status_code rtems_message_queue_ident(
  * @retval ::RTEMS_ILLEGAL_ON_REMOTE_OBJECT The message queue resided on a
  *   remote node.
  *
+ * @retval ::RTEMS_RESOURCE_IN_USE A message buffer of the message queue was on
+ *   loan.
+ *
  * @par Notes
  * @parblock
  * When the message queue is deleted, any messages in the queue are returned to
  * the free message buffer pool.  Any information stored in those messages is
  * lost.  The message buffers allocated for the message queue are reclaimed.
  *
+ * A message queue cannot be deleted while one of its message buffers is on
+ * loan.  Message buffers on loan shall be sent with
+ * rtems_message_queue_send_buffer() or given back with
+ * rtems_message_queue_release_buffer() before the message queue is deleted.
+ *
  * The QCB for the deleted message queue is reclaimed by RTEMS.
  *
  * When a global message queue is deleted, the message queue identifier must be
@@ -895,6 +905,407 @@ rtems_status_code rtems_message_queue_get_number_pending(
  */
 rtems_status_code rtems_message_queue_flush( rtems_id id, uint32_t *count );
 
+/* Generated from spec:/rtems/message/if/send-many */
+
+/**
+ * @ingroup RTEMSAPIClassicMessage
+ *
+ * @brief Puts a batch of messages at the rear of the queue.
+ *
+ * @param id is the queue identifier.
+ *
+ * @param messages is the begin address of an I/O vector.  Each element
+ *   defines the begin address and the size in bytes of one message.
+ *
+ * @param count is the count of messages in the I/O vector.
+ *
+ * @param[out] sent is the pointer to an uint32_t object.  When the directive
+ *   call returns, the count of messages sent will be stored in this object.
+ *
+ * This directive sends the messages of the I/O vector in order to the queue
+ * specified by ``id`` in the same way as rtems_message_queue_send() would do
+ * for each message, however, the queue is accessed under a single lock
+ * acquisition.  Tasks waiting to receive a message are unblocked together
+ * after the batch, so each waiting task is woken up at most once.  The
+ * batch stops at the first message which cannot be sent.
+ *
+ * @retval ::RTEMS_SUCCESSFUL The requested operation was successful.
+ *
+ * @retval ::RTEMS_INVALID_ID There was no queue associated with the identifier
+ *   specified by ``id``.
+ *
+ * @retval ::RTEMS_ILLEGAL_ON_REMOTE_OBJECT The queue resided on a remote node.
+ *
+ * @retval ::RTEMS_INVALID_ADDRESS The ``messages`` parameter was NULL.
+ *
+ * @retval ::RTEMS_INVALID_ADDRESS The ``sent`` parameter was NULL.
+ *
+ * @retval ::RTEMS_INVALID_NUMBER The ``count`` parameter was zero.
+ *
+ * @retval ::RTEMS_INVALID_SIZE The size of a message exceeded the maximum
+ *   message size of the queue as defined by rtems_message_queue_create() or
+ *   rtems_message_queue_construct().
+ *
+ * @retval ::RTEMS_TOO_MANY The maximum number of pending messages was
+ *   exceeded.
+ *
+ * @par Constraints
+ * @parblock
+ * The following constraints apply to this directive:
+ *
+ * * The directive may be called from within interrupt context.
+ *
+ * * The directive may be called from within device driver initialization
+ *   context.
+ *
+ * * The directive may be called from within task context.
+ *
+ * * The directive may unblock tasks.  This may cause the calling task to be
+ *   preempted.
+ * @endparblock
+ */
+rtems_status_code rtems_message_queue_send_many(
+  rtems_id            id,
+  const struct iovec *messages,
+  uint32_t            count,
+  uint32_t           *sent
+);
+
+/* Generated from spec:/rtems/message/if/receive-many */
+
+/**
+ * @ingroup RTEMSAPIClassicMessage
+ *
+ * @brief Receives a batch of messages from the queue.
+ *
+ * @param id is the queue identifier.
+ *
+ * @param[in, out] messages is the begin address of an I/O vector.  Each
+ *   element defines the begin address of a buffer to receive one message.  The
+ *   buffer shall be large enough to receive a message of the maximum length of
+ *   the queue.  When a message is received, the length of the element will be
+ *   set to the size in bytes of the message.
+ *
+ * @param count is the count of buffers in the I/O vector.
+ *
+ * @param[out] received is the pointer to an uint32_t object.  When the
+ *   directive call returns, the count of messages received will be stored in
+ *   this object.
+ *
+ * @param option_set is the option set.
+ *
+ * @param timeout is the timeout in clock ticks if the #RTEMS_WAIT option is
+ *   set.  Use #RTEMS_NO_TIMEOUT to wait potentially forever.
+ *
+ * This directive receives up to ``count`` messages from the queue specified
+ * by ``id`` under a single lock acquisition.  If the queue is empty, then the
+ * calling task can wait for the first message according to the
+ * #RTEMS_WAIT and #RTEMS_NO_WAIT options in the same way as
+ * rtems_message_queue_receive().  After the first message arrived, the
+ * messages sent with it in the same batch are received without further
+ * blocking.  Tasks waiting to send a message are unblocked together after the
+ * batch.
+ *
+ * @retval ::RTEMS_SUCCESSFUL The requested operation was successful.
+ *
+ * @retval ::RTEMS_INVALID_ID There was no queue associated with the identifier
+ *   specified by ``id``.
+ *
+ * @retval ::RTEMS_ILLEGAL_ON_REMOTE_OBJECT The queue resided on a remote node.
+ *
+ * @retval ::RTEMS_INVALID_ADDRESS The ``messages`` parameter was NULL.
+ *
+ * @retval ::RTEMS_INVALID_ADDRESS The ``received`` parameter was NULL.
+ *
+ * @retval ::RTEMS_INVALID_NUMBER The ``count`` parameter was zero.
+ *
+ * @retval ::RTEMS_UNSATISFIED The queue was empty.
+ *
+ * @retval ::RTEMS_TIMEOUT The timeout happened while the calling task was
+ *   waiting to receive a message
+ *
+ * @retval ::RTEMS_OBJECT_WAS_DELETED The queue was deleted while the calling
+ *   task was waiting to receive a message.
+ *
+ * @par Constraints
+ * @parblock
+ * The following constraints apply to this directive:
+ *
+ * * When the #RTEMS_NO_WAIT option is set, the directive may be called from
+ *   within interrupt context.
+ *
+ * * The directive may be called from within task context.
+ *
+ * * When the request cannot be immediately satisfied and the #RTEMS_WAIT
+ *   option is set, the calling task blocks at some point during the directive
+ *   call.
+ *
+ * * The timeout functionality of the directive requires a clock tick.
+ * @endparblock
+ */
+rtems_status_code rtems_message_queue_receive_many(
+  rtems_id        id,
+  struct iovec   *messages,
+  uint32_t        count,
+  uint32_t       *received,
+  rtems_option    option_set,
+  rtems_interval  timeout
+);
+
+/* Generated from spec:/rtems/message/if/obtain-buffer */
+
+/**
+ * @ingroup RTEMSAPIClassicMessage
+ *
+ * @brief Obtains an empty message buffer of the queue on loan.
+ *
+ * @param id is the queue identifier.
+ *
+ * @param[out] buffer is the pointer to a void pointer object.  When the
+ *   directive call is successful, the begin address of the message buffer on
+ *   loan will be stored in this object.
+ *
+ * @param option_set is the option set.
+ *
+ * @param timeout is the timeout in clock ticks if the #RTEMS_WAIT option is
+ *   set.  Use #RTEMS_NO_TIMEOUT to wait potentially forever.
+ *
+ * This directive takes a message buffer from the storage area of the queue
+ * specified by ``id``.  The message buffer can hold a message of the maximum
+ * length of the queue.  The calling task may fill it and submit it with
+ * rtems_message_queue_send_buffer() without a copy of the message, or give it
+ * back with rtems_message_queue_release_buffer().  A message buffer on loan is
+ * not available for other messages of the queue.
+ *
+ * If no message buffer is available, then the calling task can **wait** or
+ * **try to obtain** according to the mutually exclusive #RTEMS_WAIT and
+ * #RTEMS_NO_WAIT options.  Waiting tasks are enqueued according to the task
+ * wait queue discipline of the queue.
+ *
+ * @retval ::RTEMS_SUCCESSFUL The requested operation was successful.
+ *
+ * @retval ::RTEMS_INVALID_ADDRESS The ``buffer`` parameter was NULL.
+ *
+ * @retval ::RTEMS_INVALID_ID There was no queue associated with the identifier
+ *   specified by ``id``.
+ *
+ * @retval ::RTEMS_ILLEGAL_ON_REMOTE_OBJECT The queue resided on a remote node.
+ *
+ * @retval ::RTEMS_TOO_MANY No message buffer was available.
+ *
+ * @retval ::RTEMS_TIMEOUT The timeout happened while the calling task was
+ *   waiting to obtain a message buffer.
+ *
+ * @retval ::RTEMS_OBJECT_WAS_DELETED The queue was deleted while the calling
+ *   task was waiting to obtain a message buffer.
+ *
+ * @par Notes
+ * A queue cannot be deleted while one of its message buffers is on loan, see
+ * rtems_message_queue_delete().
+ *
+ * @par Constraints
+ * @parblock
+ * The following constraints apply to this directive:
+ *
+ * * When the #RTEMS_NO_WAIT option is set, the directive may be called from
+ *   within interrupt context.
+ *
+ * * The directive may be called from within task context.
+ *
+ * * When the request cannot be immediately satisfied and the #RTEMS_WAIT
+ *   option is set, the calling task blocks at some point during the directive
+ *   call.
+ *
+ * * The timeout functionality of the directive requires a clock tick.
+ * @endparblock
+ */
+rtems_status_code rtems_message_queue_obtain_buffer(
+  rtems_id       id,
+  void         **buffer,
+  rtems_option   option_set,
+  rtems_interval timeout
+);
+
+/* Generated from spec:/rtems/message/if/send-buffer */
+
+/**
+ * @ingroup RTEMSAPIClassicMessage
+ *
+ * @brief Puts the message buffer on loan at the rear of the queue.
+ *
+ * @param id is the queue identifier.
+ *
+ * @param buffer is the begin address of the message buffer on loan.
+ *
+ * @param size is the size in bytes of the message in the buffer.
+ *
+ * This directive sends the message contained in the message buffer on loan
+ * to the queue specified by ``id`` in the same way as
+ * rtems_message_queue_send().  The message is not copied, unless a task waits
+ * in rtems_message_queue_receive() to receive it into its own buffer.  If a
+ * task waits in rtems_message_queue_receive_buffer(), then the message buffer
+ * is handed over to this task.  After a successful directive call, the message
+ * buffer is no longer on loan to the calling task.
+ *
+ * @retval ::RTEMS_SUCCESSFUL The requested operation was successful.
+ *
+ * @retval ::RTEMS_INVALID_ID There was no queue associated with the identifier
+ *   specified by ``id``.
+ *
+ * @retval ::RTEMS_ILLEGAL_ON_REMOTE_OBJECT The queue resided on a remote node.
+ *
+ * @retval ::RTEMS_INVALID_ADDRESS The ``buffer`` parameter was not the begin
+ *   address of a message buffer of the queue or the message buffer was not on
+ *   loan.
+ *
+ * @retval ::RTEMS_INVALID_SIZE The size of the message exceeded the maximum
+ *   message size of the queue as defined by rtems_message_queue_create() or
+ *   rtems_message_queue_construct().
+ *
+ * @par Constraints
+ * @parblock
+ * The following constraints apply to this directive:
+ *
+ * * The directive may be called from within interrupt context.
+ *
+ * * The directive may be called from within device driver initialization
+ *   context.
+ *
+ * * The directive may be called from within task context.
+ *
+ * * The directive may unblock a task.  This may cause the calling task to be
+ *   preempted.
+ * @endparblock
+ */
+rtems_status_code rtems_message_queue_send_buffer(
+  rtems_id id,
+  void    *buffer,
+  size_t   size
+);
+
+/* Generated from spec:/rtems/message/if/receive-buffer */
+
+/**
+ * @ingroup RTEMSAPIClassicMessage
+ *
+ * @brief Receives a message buffer from the queue on loan.
+ *
+ * @param id is the queue identifier.
+ *
+ * @param[out] buffer is the pointer to a void pointer object.  When the
+ *   directive call is successful, the begin address of the message buffer on
+ *   loan which contains the received message will be stored in this object.
+ *
+ * @param[out] size is the pointer to a size_t object.  When the directive call
+ *   is successful, the size in bytes of the received messages will be stored
+ *   in this object.
+ *
+ * @param option_set is the option set.
+ *
+ * @param timeout is the timeout in clock ticks if the #RTEMS_WAIT option is
+ *   set.  Use #RTEMS_NO_TIMEOUT to wait potentially forever.
+ *
+ * This directive receives a message from the queue specified by ``id`` in the
+ * same way as rtems_message_queue_receive(), however, the message is not
+ * copied.  The message buffer stays on loan to the calling task until it is
+ * given back with rtems_message_queue_release_buffer() or submitted again
+ * with rtems_message_queue_send_buffer().
+ *
+ * @retval ::RTEMS_SUCCESSFUL The requested operation was successful.
+ *
+ * @retval ::RTEMS_INVALID_ID There was no queue associated with the identifier
+ *   specified by ``id``.
+ *
+ * @retval ::RTEMS_ILLEGAL_ON_REMOTE_OBJECT The queue resided on a remote node.
+ *
+ * @retval ::RTEMS_INVALID_ADDRESS The ``buffer`` parameter was NULL.
+ *
+ * @retval ::RTEMS_INVALID_ADDRESS The ``size`` parameter was NULL.
+ *
+ * @retval ::RTEMS_UNSATISFIED The queue was empty.
+ *
+ * @retval ::RTEMS_TIMEOUT The timeout happened while the calling task was
+ *   waiting to receive a message
+ *
+ * @retval ::RTEMS_OBJECT_WAS_DELETED The queue was deleted while the calling
+ *   task was waiting to receive a message.
+ *
+ * @par Notes
+ * A queue cannot be deleted while one of its message buffers is on loan, see
+ * rtems_message_queue_delete().
+ *
+ * @par Constraints
+ * @parblock
+ * The following constraints apply to this directive:
+ *
+ * * When the #RTEMS_NO_WAIT option is set, the directive may be called from
+ *   within interrupt context.
+ *
+ * * The directive may be called from within task context.
+ *
+ * * When the request cannot be immediately satisfied and the #RTEMS_WAIT
+ *   option is set, the calling task blocks at some point during the directive
+ *   call.
+ *
+ * * The timeout functionality of the directive requires a clock tick.
+ * @endparblock
+ */
+rtems_status_code rtems_message_queue_receive_buffer(
+  rtems_id       id,
+  void         **buffer,
+  size_t        *size,
+  rtems_option   option_set,
+  rtems_interval timeout
+);
+
+/* Generated from spec:/rtems/message/if/release-buffer */
+
+/**
+ * @ingroup RTEMSAPIClassicMessage
+ *
+ * @brief Gives a message buffer on loan back to the queue.
+ *
+ * @param id is the queue identifier.
+ *
+ * @param buffer is the begin address of the message buffer on loan.
+ *
+ * This directive gives the message buffer on loan back to the queue specified
+ * by ``id``.  The message buffer is handed over to a task waiting to send a
+ * message or to obtain a message buffer, otherwise it becomes available for
+ * other messages of the queue.  Releasing a message buffer which is not on
+ * loan to the calling task results in undefined behaviour.
+ *
+ * @retval ::RTEMS_SUCCESSFUL The requested operation was successful.
+ *
+ * @retval ::RTEMS_INVALID_ID There was no queue associated with the identifier
+ *   specified by ``id``.
+ *
+ * @retval ::RTEMS_ILLEGAL_ON_REMOTE_OBJECT The queue resided on a remote node.
+ *
+ * @retval ::RTEMS_INVALID_ADDRESS The ``buffer`` parameter was not the begin
+ *   address of a message buffer of the queue or the message buffer was not on
+ *   loan.
+ *
+ * @par Constraints
+ * @parblock
+ * The following constraints apply to this directive:
+ *
+ * * The directive may be called from within interrupt context.
+ *
+ * * The directive may be called from within device driver initialization
+ *   context.
+ *
+ * * The directive may be called from within task context.
+ *
+ * * The directive may unblock a task.  This may cause the calling task to be
+ *   preempted.
+ * @endparblock
+ */
+rtems_status_code rtems_message_queue_release_buffer(
+  rtems_id  id,
+  void     *buffer
+);
+
 /* Generated from spec:/rtems/message/if/buffer */
 
 /**
@@ -52,6 +52,9 @@
  *
  * You can have more than one cache for a single file all looking at different
  * parts of the file.
+ *
+ * If the file is mapped into memory the cache references the data in the
+ * mapping and there is no copy into the cache buffer.
  */
 
 #if !defined (_RTEMS_RTL_OBJ_CACHE_H_)
@@ -71,13 +74,16 @@ extern "C" {
  */
 typedef struct rtems_rtl_obj_cache
 {
-  int      fd;        /**< The file descriptor of the data in the cache. */
-  size_t   file_size; /**< The size of the file. */
-  off_t    offset;    /**< The base offset of the buffer. */
-  size_t   size;      /**< The size of the cache. */
-  size_t   level;     /**< The amount of data in the cache. A file can be
-                       * smaller than the cache file. */
-  uint8_t* buffer;    /**< The buffer */
+  int            fd;        /**< The file descriptor of the data in the
+                             *   cache. */
+  size_t         file_size; /**< The size of the file. */
+  off_t          offset;    /**< The base offset of the buffer. */
+  size_t         size;      /**< The size of the cache. */
+  size_t         level;     /**< The amount of data in the cache. A file can
+                             *   be smaller than the cache file. */
+  uint8_t*       buffer;    /**< The buffer */
+  const uint8_t* map;       /**< The file's memory map, NULL if the file is
+                             *   not mapped. */
 } rtems_rtl_obj_cache;
 
 /**
@@ -105,6 +111,21 @@ void rtems_rtl_obj_cache_close (rtems_rtl_obj_cache* cache);
  */
 void rtems_rtl_obj_cache_flush (rtems_rtl_obj_cache* cache);
 
+/**
+ * Use the memory map of a file. Reads of the file reference the data in the
+ * map until the cache is flushed. The map must be valid until the cache is
+ * flushed.
+ *
+ * @param cache The cache.
+ * @param fd The file descriptor of the mapped file.
+ * @param map The base of the memory map of the file.
+ * @param size The size of the file.
+ */
+void rtems_rtl_obj_cache_map (rtems_rtl_obj_cache* cache,
+                              int                  fd,
+                              const void*          map,
+                              size_t               size);
+
 /**
  * Read data by reference. The length contains the amount of data that should
  * be available in the cache and referenced by the buffer handle. It must be
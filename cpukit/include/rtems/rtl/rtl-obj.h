@@ -126,6 +126,8 @@ typedef struct rtems_rtl_loader_table
 #define RTEMS_RTL_OBJ_SECT_DTOR       (1 << 17) /**< Section contains destructors. */
 #define RTEMS_RTL_OBJ_SECT_LOCD       (1 << 18) /**< Section has been located. */
 #define RTEMS_RTL_OBJ_SECT_ARCH_ALLOC (1 << 19) /**< Section use arch allocator. */
+#define RTEMS_RTL_OBJ_SECT_MAPPED     (1 << 20) /**< Section is used in place in
+                                                 *   the file's memory map. */
 
 /**
  * Section types mask.
@@ -254,6 +256,9 @@ struct rtems_rtl_obj
   size_t              tramp_relocs; /**< Number of slots reserved for
                                      *   relocs. The remainder are for
                                      *   unresolved symbols. */
+  void*               map_base;     /**< The memory map of the object file,
+                                     *   NULL if the file is not mapped. */
+  size_t              map_size;     /**< The size of the memory map. */
   struct link_map*    linkmap;      /**< For GDB. */
   void*               loader;       /**< The file details specific to a
                                      *   loader. */
@@ -436,6 +441,17 @@ static inline size_t rtems_rtl_obj_trampolines (const rtems_rtl_obj* obj)
     0 : rtems_rtl_obj_tramp_avail_space (obj) / obj->tramp_size;
 }
 
+/**
+ * Allocate trampoline memory. The allocation can be called concurrently by
+ * the relocation workers.
+ *
+ * @param obj The object file's descriptor.
+ * @param size The size of the trampoline.
+ * @retval NULL There is no trampoline memory available.
+ * @retval void* The trampoline's memory.
+ */
+void* rtems_rtl_obj_tramp_alloc (rtems_rtl_obj* obj, size_t size);
+
 /**
  * Does the section require architecture specific allocations?
  *
@@ -447,6 +463,17 @@ static inline bool rtems_rtl_obj_sect_is_arch_alloc (rtems_rtl_obj_sect* sect)
   return (sect->flags & RTEMS_RTL_OBJ_SECT_ARCH_ALLOC) != 0;
 }
 
+/**
+ * Is the section used in place in the memory map of the object file?
+ *
+ * @param sect The section.
+ * @retval bool Returns @true if the section is mapped.
+ */
+static inline bool rtems_rtl_obj_sect_is_mapped (const rtems_rtl_obj_sect* sect)
+{
+  return (sect->flags & RTEMS_RTL_OBJ_SECT_MAPPED) != 0;
+}
+
 /**
  * Allocate an object structure on the heap.
  *
@@ -773,14 +800,17 @@ bool rtems_rtl_obj_relocate (rtems_rtl_obj*             obj,
 void rtems_rtl_obj_synchronize_cache (rtems_rtl_obj* obj);
 
 /**
- * Relocate an object file's unresolved reference.
+ * Relocate an object file's unresolved reference. The caller tracks the
+ * dependency on the object file defining the symbol.
  *
  * @param rec The unresolved relocation record.
+ * @param sect The relocation record's target section.
  * @param sym The unresolved relocation's referenced symbol.
  * @retval true The object file record was relocated.
  * @retval false The relocation failed. The RTL error is set.
  */
 bool rtems_rtl_obj_relocate_unresolved (rtems_rtl_unresolv_reloc* reloc,
+                                        rtems_rtl_obj_sect*       sect,
                                         rtems_rtl_obj_sym*        sym);
 
 /**
@@ -799,6 +829,16 @@ bool rtems_rtl_obj_load_symbols (rtems_rtl_obj*             obj,
                                  rtems_rtl_obj_sect_handler handler,
                                  void*                      data);
 
+/**
+ * Use the text and const sections in place if the object file is mapped into
+ * memory. A section is used in place if it is loaded, is not the target of a
+ * relocation section and its alignment is met in the map. The mapped
+ * sections are not allocated or loaded. Call before allocating the sections.
+ *
+ * @param obj The object file's descriptor.
+ */
+void rtems_rtl_obj_map_sections (rtems_rtl_obj* obj);
+
 /**
  * Allocate the sections. If a handler is provided (not NULL) it is called for
  * all section.
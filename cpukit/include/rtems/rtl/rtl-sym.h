@@ -47,32 +47,48 @@ extern "C" {
  */
 typedef struct rtems_rtl_obj_sym
 {
-  rtems_chain_node node;    /**< The node's link in the chain. */
   const char*      name;    /**< The symbol's name. */
   void*            value;   /**< The value of the symbol. */
   uint32_t         data;    /**< Format specific data. */
 } rtems_rtl_obj_sym;
 
 /**
- * Table of symbols stored in a hash table.
+ * A slot in the global symbol table. The slot holds the full hash of the
+ * symbol's name so a lookup only compares the names of symbols with the same
+ * hash and a resize does not need to access the names.
+ */
+typedef struct rtems_rtl_symbol_slot
+{
+  uint32_t           hash;    /**< The hash of the symbol's name. */
+  rtems_rtl_obj_sym* symbol;  /**< The symbol, NULL if the slot is empty. */
+} rtems_rtl_symbol_slot;
+
+/**
+ * Table of symbols stored in an open addressed hash table with linear
+ * probing. The number of slots is a power of two. The table grows when it is
+ * more than three quarters full and shrinks when symbols are erased.
  */
 typedef struct rtems_rtl_symbols
 {
-  rtems_chain_control* buckets;
-  size_t               nbuckets;
+  rtems_rtl_symbol_slot* slots;       /**< The table of slots. */
+  size_t                 nslots;      /**< The number of slots. */
+  size_t                 min_nslots;  /**< The initial number of slots. */
+  size_t                 count;       /**< The number of symbols. */
+  unsigned int           shift;       /**< The hash to home slot shift. */
 } rtems_rtl_symbols;
 
 /**
- * Open a symbol table with the specified number of buckets.
+ * Open a symbol table with the specified initial number of slots. The number
+ * is rounded up to a power of two.
  *
  * @param symbols The symbol table to open.
- * @param buckets The number of buckets in the hash table.
+ * @param slots The initial number of slots in the hash table.
  * @retval true The symbol is open.
  * @retval false The symbol table could not created. The RTL
  *               error has the error.
  */
 bool rtems_rtl_symbol_table_open (rtems_rtl_symbols* symbols,
-                                  size_t             buckets);
+                                  size_t             slots);
 
 /**
  * Close the table and erase the hash table.
@@ -106,6 +122,26 @@ bool rtems_rtl_symbol_global_add (rtems_rtl_obj*       obj,
                                   const unsigned char* esyms,
                                   unsigned int         size);
 
+/**
+ * Hash a symbol name.
+ *
+ * @param name The name as an ASCIIZ string.
+ * @return uint32_t The hash of the name.
+ */
+uint32_t rtems_rtl_symbol_hash (const char* name);
+
+/**
+ * Find a symbol given the symbol label and its hash in the global symbol
+ * table.
+ *
+ * @param name The name as an ASCIIZ string.
+ * @param hash The hash of the name returned by @ref rtems_rtl_symbol_hash.
+ * @retval NULL No symbol found.
+ * @return rtems_rtl_obj_sym* Reference to the symbol.
+ */
+rtems_rtl_obj_sym* rtems_rtl_symbol_global_find_hash (const char* name,
+                                                      uint32_t    hash);
+
 /**
  * Find a symbol given the symbol label in the global symbol table.
  *
@@ -139,8 +175,11 @@ rtems_rtl_obj_sym* rtems_rtl_symbol_obj_find (rtems_rtl_obj* obj,
  * Add the object file's symbols to the global table.
  *
  * @param obj The object file the symbols are to be added.
+ * @retval true The symbols have been added.
+ * @retval false The global symbol table could not be resized. The RTL error
+ *               has the error.
  */
-void rtems_rtl_symbol_obj_add (rtems_rtl_obj* obj);
+bool rtems_rtl_symbol_obj_add (rtems_rtl_obj* obj);
 
 /**
  * Erase the object file's local symbols.
@@ -43,10 +43,13 @@
  * relocations are resolved and removed the table is compacted. The only
  * pointer in the table is the object file poniter. This is used to identify
  * which object the relocation belongs to. There are no linking or back
- * pointers in the unresolved relocations table. The table is scanned for each
- * object file's relocations. This is not fast but the table should be small
- * and if it happens to grow large you have other more pressing issues to
- * resolve in your application.
+ * pointers in the unresolved relocations table.
+ *
+ * The symbol names are indexed by a hash table so adding a relocation does
+ * not scan the table. Resolving looks up each unresolved name once in the
+ * global symbol table and then applies the relocations of all the resolved
+ * names in a single pass over the table. The relocations are applied grouped
+ * by object file and target section.
  *
  * The table holds two (2) types of records:
  *
@@ -58,7 +61,8 @@
  * counts the number of references and the string is removed from the table
  * when the reference count reaches 0. There can be many relocations
  * referencing the symbol. The strings are referenced by a single 16bit
- * unsigned integer which is the count of the string in the table.
+ * unsigned integer which is the index of the string in the name table. The
+ * index of a string does not change while the string is in the table.
  *
  * The section the relocation is for in the object is the section number. The
  * relocation data is series of machine word sized fields:
@@ -116,6 +120,8 @@ typedef struct rtems_rtl_unresolv_symbol
   uint16_t   refs;     /**< The number of references to this name. */
   uint16_t   flags;    /**< Flags to manage the symbol. */
   uint16_t   length;   /**< The length of this name. */
+  uint16_t   index;    /**< The index of this name in the name table. */
+  uint32_t   hash;     /**< The hash of this name. */
   const char name[];   /**< The symbol name. */
 } rtems_rtl_unresolv_symbol;
 
@@ -168,14 +174,31 @@ typedef struct rtems_rtl_unresolv_block
   rtems_rtl_unresolv_rec rec[]; /**< The records. More follow. */
 } rtems_rtl_unresolv_block;
 
+/**
+ * A slot in the unresolved symbol name hash table.
+ */
+typedef struct rtems_rtl_unresolv_slot
+{
+  uint32_t hash;   /**< The hash of the name. */
+  uint16_t index;  /**< The index of the name, 0 if the slot is empty. */
+} rtems_rtl_unresolv_slot;
+
 /**
  * Unresolved table holds the names and relocations.
  */
 typedef struct rtems_rtl_unresolved
 {
-  uint32_t            marker;     /**< Block marker. */
-  size_t              block_recs; /**< The records per blocks allocated. */
-  rtems_chain_control blocks;     /**< List of blocks. */
+  uint32_t                 marker;      /**< Block marker. */
+  size_t                   block_recs;  /**< The records per blocks
+                                         *   allocated. */
+  rtems_chain_control      blocks;      /**< List of blocks. */
+  rtems_rtl_unresolv_rec** names;       /**< The name records by index. */
+  size_t                   names_size;  /**< The size of the name table. */
+  size_t                   name_count;  /**< The number of names. */
+  size_t                   name_next;   /**< The next index to try. */
+  rtems_rtl_unresolv_slot* slots;       /**< The name hash table. */
+  size_t                   nslots;      /**< The number of hash slots. */
+  unsigned int             shift;       /**< The hash to home slot shift. */
 } rtems_rtl_unresolved;
 
 /**
@@ -84,9 +84,10 @@ extern "C" {
 #define RTL_GLUE(a,b) RTL_XGLUE(a,b)
 
 /**
- * The number of buckets in the global symbol table.
+ * The initial number of slots in the global symbol table. The table grows on
+ * demand.
  */
-#define RTEMS_RTL_SYMS_GLOBAL_BUCKETS (32)
+#define RTEMS_RTL_SYMS_GLOBAL_BUCKETS (256)
 
 /**
  * The number of relocation record per block in the unresolved table.
@@ -98,6 +99,12 @@ extern "C" {
  */
 #define RTEMS_RTL_DEPENDENCY_BLOCK_SIZE (16)
 
+/**
+ * The minimum number of records in a relocation section to relocate the
+ * section in parallel if there are relocation workers.
+ */
+#define RTEMS_RTL_RELOC_PARALLEL_RECORDS (1024)
+
 /**
  * The global debugger interface variable.
  */
@@ -221,6 +228,16 @@ void rtems_rtl_obj_caches (rtems_rtl_obj_cache** symbols,
  */
 void rtems_rtl_obj_caches_flush (void);
 
+/**
+ * Set all the object file caches to reference the memory map of a file. The
+ * map must be valid until the caches are flushed.
+ *
+ * @param fd The file descriptor of the mapped file.
+ * @param map The base of the memory map of the file.
+ * @param size The size of the file.
+ */
+void rtems_rtl_obj_caches_map (int fd, const void* map, size_t size);
+
 /**
  * Get the RTL decompressor setting for the cache and the offset in the file
  * the compressed stream starts. This call assumes the RTL is locked.
@@ -386,6 +403,22 @@ bool rtems_rtl_path_append (const char* path);
 
 bool rtems_rtl_path_prepend (const char* path);
 
+/**
+ * Set the number of workers relocating the records of a relocation section in
+ * parallel. The loading task is a worker and count - 1 worker tasks are
+ * created with the priority of the calling task. A relocation section is
+ * relocated in parallel if it has at least RTEMS_RTL_RELOC_PARALLEL_RECORDS
+ * records and the architecture's relocation handlers are reentrant. The
+ * relocation records, symbols and strings of the section are read into memory
+ * if the object file is not mapped.
+ *
+ * @param count The number of workers. A count of 0 or 1 disables parallel
+ *              relocation.
+ * @retval true The workers have been set.
+ * @retval false The worker tasks could not be created. The error is set.
+ */
+bool rtems_rtl_set_relocate_workers (uint32_t count);
+
 /**
  * Add an exported symbol table to the global symbol table. This call is
  * normally used by an object file when loaded that contains a global symbol
@@ -44,10 +44,13 @@
 #include <rtems/score/chainimpl.h>
 #include <rtems/score/threaddispatch.h>
 #include <rtems/score/threadqimpl.h>
+#include <rtems/score/watchdogticks.h>
 
 #include <limits.h>
 #include <string.h>
 
+struct iovec;
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -74,6 +77,30 @@ extern "C" {
  */
 #define  CORE_MESSAGE_QUEUE_URGENT_REQUEST INT_MIN
 
+/**
+ * @brief This thread wait option indicates a thread waiting to receive a
+ *   message into its buffer.
+ *
+ * A thread waiting to send a message uses the message size as the thread
+ * wait option.  The message size is less than the thread wait options for
+ * the other waiting threads.  Threads waiting to receive and threads waiting
+ * for a message buffer are enqueued at the same time if all message buffers
+ * are on loan, so the thread wait option tells them apart.
+ */
+#define CORE_MESSAGE_QUEUE_WAIT_RECEIVE UINT32_MAX
+
+/**
+ * @brief This thread wait option indicates a thread waiting to receive a
+ *   message buffer on loan.
+ */
+#define CORE_MESSAGE_QUEUE_WAIT_RECEIVE_BUFFER ( UINT32_MAX - 1 )
+
+/**
+ * @brief This thread wait option indicates a thread waiting to obtain an
+ *   empty message buffer on loan.
+ */
+#define CORE_MESSAGE_QUEUE_WAIT_OBTAIN_BUFFER ( UINT32_MAX - 2 )
+
 /**
  *  @brief The modes in which a message may be submitted to a message queue.
  *
@@ -334,11 +361,250 @@ Status_Control _CORE_message_queue_Seize(
   Thread_queue_Context       *queue_context
 );
 
+/**
+ * @brief Obtains an empty message buffer on loan.
+ *
+ * The message buffer is taken from the inactive messages of the message
+ * queue.  The caller may fill it and submit it with
+ * _CORE_message_queue_Submit_buffer() or give it back with
+ * _CORE_message_queue_Release_buffer().  A thread waiting for a message
+ * buffer waits in the same order as a thread waiting to send a message.
+ *
+ * @param[in, out] the_message_queue The message queue to operate upon.
+ * @param executing The executing thread.
+ * @param[out] buffer The begin of the message buffer on loan.
+ * @param wait Indicates whether the calling thread is willing to block
+ *        if no message buffer is available.
+ * @param queue_context The thread queue context used for
+ *   _CORE_message_queue_Acquire() or _CORE_message_queue_Acquire_critical().
+ *
+ * @retval STATUS_SUCCESSFUL A message buffer was obtained.
+ * @retval STATUS_TOO_MANY No message buffers were available.
+ * @retval STATUS_MESSAGE_QUEUE_WAIT_IN_ISR The caller is in an ISR, do not block!
+ * @retval STATUS_TIMEOUT A timeout occurred.
+ */
+Status_Control _CORE_message_queue_Obtain_buffer(
+  CORE_message_queue_Control *the_message_queue,
+  Thread_Control             *executing,
+  void                      **buffer,
+  bool                        wait,
+  Thread_queue_Context       *queue_context
+);
+
+/**
+ * @brief Submits a message buffer on loan to the message queue.
+ *
+ * The message buffer is enqueued without a copy.  If a thread waits to
+ * receive a message buffer on loan, the message buffer is handed over to
+ * this thread.  If a thread waits to receive a message into its buffer, the
+ * message is copied and the message buffer is released.  The message buffer
+ * is no longer on loan to the caller if the submit was successful.
+ *
+ * @param[in, out] the_message_queue The message queue to operate upon.
+ * @param buffer The begin of the message buffer on loan.
+ * @param size The size of the message.
+ * @param submit_type Determines whether the message is prepended,
+ *        appended, or enqueued in priority order.
+ * @param queue_context The thread queue context used for
+ *   _CORE_message_queue_Acquire() or _CORE_message_queue_Acquire_critical().
+ *
+ * @retval STATUS_SUCCESSFUL The message was successfully submitted.
+ * @retval STATUS_INVALID_ADDRESS The buffer is not a message buffer of the
+ *   message queue.
+ * @retval STATUS_MESSAGE_INVALID_SIZE The message size was too big.
+ */
+Status_Control _CORE_message_queue_Submit_buffer(
+  CORE_message_queue_Control      *the_message_queue,
+  void                            *buffer,
+  size_t                           size,
+  CORE_message_queue_Submit_types  submit_type,
+  Thread_queue_Context            *queue_context
+);
+
+/**
+ * @brief Seizes a message buffer on loan from the message queue.
+ *
+ * This is _CORE_message_queue_Seize() without the copy of the message.  The
+ * message buffer stays on loan to the caller until it is given back with
+ * _CORE_message_queue_Release_buffer() or submitted again.
+ *
+ * @param[in, out] the_message_queue The message queue to seize a message from.
+ * @param executing The executing thread.
+ * @param[out] buffer The begin of the message buffer on loan.
+ * @param[out] size_p The size of the message.
+ * @param wait Indicates whether the calling thread is willing to block
+ *        if the message queue is empty.
+ * @param queue_context The thread queue context used for
+ *   _CORE_message_queue_Acquire() or _CORE_message_queue_Acquire_critical().
+ *
+ * @retval STATUS_SUCCESSFUL The message was successfully seized from the message queue.
+ * @retval STATUS_UNSATISFIED Wait was set to false and there is currently no pending message.
+ * @retval STATUS_TIMEOUT A timeout occurred.
+ *
+ * @note Returns message priority via return area in TCB.
+ */
+Status_Control _CORE_message_queue_Seize_buffer(
+  CORE_message_queue_Control *the_message_queue,
+  Thread_Control             *executing,
+  void                      **buffer,
+  size_t                     *size_p,
+  bool                        wait,
+  Thread_queue_Context       *queue_context
+);
+
+/**
+ * @brief Releases a message buffer on loan.
+ *
+ * The message buffer is handed over to the first thread waiting for a
+ * message buffer or returned to the inactive messages.
+ *
+ * @param[in, out] the_message_queue The message queue to operate upon.
+ * @param buffer The begin of the message buffer on loan.
+ * @param queue_context The thread queue context used for
+ *   _CORE_message_queue_Acquire() or _CORE_message_queue_Acquire_critical().
+ *
+ * @retval STATUS_SUCCESSFUL The message buffer was released.
+ * @retval STATUS_INVALID_ADDRESS The buffer is not a message buffer of the
+ *   message queue.
+ */
+Status_Control _CORE_message_queue_Release_buffer(
+  CORE_message_queue_Control *the_message_queue,
+  void                       *buffer,
+  Thread_queue_Context       *queue_context
+);
+
+/**
+ * @brief Surrenders a message buffer which is no longer in use.
+ *
+ * If the first waiting thread waits for a message buffer, then the message
+ * buffer is handed over to this thread.  A thread waiting to send a message
+ * gets its message inserted into the message buffer.  Otherwise, the
+ * message buffer is returned to the inactive messages.
+ *
+ * @param[in, out] the_message_queue The message queue to operate upon.
+ * @param[in, out] the_message The message buffer.
+ * @param queue_context The thread queue context used for
+ *   _CORE_message_queue_Acquire() or _CORE_message_queue_Acquire_critical().
+ *   The message queue is released.
+ */
+void _CORE_message_queue_Surrender_buffer(
+  CORE_message_queue_Control *the_message_queue,
+  CORE_message_queue_Buffer  *the_message,
+  Thread_queue_Context       *queue_context
+);
+
+/**
+ * @brief The message queue batch context.
+ *
+ * This context is used by _CORE_message_queue_Submit_many() to deliver the
+ * messages of a batch to the waiting receivers while the thread queue is
+ * flushed.
+ */
+typedef struct {
+  /**
+   * @brief This member contains the thread queue context.
+   *
+   * It shall be used to acquire the message queue.
+   */
+  Thread_queue_Context Queue_context;
+
+  /**
+   * @brief This member references the messages of the batch.
+   */
+  const struct iovec *messages;
+
+  /**
+   * @brief This member contains the index of the next message to submit.
+   */
+  uint32_t index;
+
+  /**
+   * @brief This member contains the count of messages of the batch.
+   */
+  uint32_t count;
+
+  /**
+   * @brief This member contains the submit type of the messages.
+   */
+  CORE_message_queue_Submit_types submit_type;
+} CORE_message_queue_Batch_context;
+
+/**
+ * @brief Submits a batch of messages to the message queue.
+ *
+ * The messages are delivered to the waiting receivers or enqueued in order.
+ * All receivers which get a message are unblocked after a single release of
+ * the message queue.  Thread dispatching is disabled until the whole batch
+ * is submitted, so a receiver picks up the rest of the batch after a single
+ * wakeup.  The batch stops at the first message which exceeds the
+ * maximum message size or if no message buffer is available.  The caller
+ * does not block.
+ *
+ * @param[in, out] the_message_queue The message queue to operate upon.
+ * @param messages The messages.  Each I/O vector element defines one message.
+ * @param count The count of messages.
+ * @param[out] submitted The count of submitted messages.
+ * @param submit_type Determines whether the messages are prepended,
+ *        appended, or enqueued in priority order.
+ * @param[in, out] context The batch context.  The thread queue context of it
+ *   shall be used for _CORE_message_queue_Acquire() or
+ *   _CORE_message_queue_Acquire_critical().
+ *
+ * @retval STATUS_SUCCESSFUL All messages were successfully submitted.
+ * @retval STATUS_MESSAGE_INVALID_SIZE A message size was too big.
+ * @retval STATUS_TOO_MANY No message buffers were available.
+ */
+Status_Control _CORE_message_queue_Submit_many(
+  CORE_message_queue_Control       *the_message_queue,
+  const struct iovec               *messages,
+  uint32_t                          count,
+  uint32_t                         *submitted,
+  CORE_message_queue_Submit_types   submit_type,
+  CORE_message_queue_Batch_context *context
+);
+
+/**
+ * @brief Seizes a batch of messages from the message queue.
+ *
+ * Up to the specified count of pending messages are copied to the buffers of
+ * the I/O vector.  The I/O vector element length is set to the size of the
+ * received message.  Each buffer shall be large enough to receive a message
+ * of the maximum message size.  The threads waiting to send a message or for
+ * a message buffer are unblocked after a single release of the message
+ * queue.  If the message queue is empty, then the caller may block until the
+ * first message arrives.
+ *
+ * @param[in, out] the_message_queue The message queue to seize messages from.
+ * @param executing The executing thread.
+ * @param[in, out] messages The message buffers.
+ * @param count The count of message buffers.
+ * @param[out] seized The count of seized messages.
+ * @param wait Indicates whether the calling thread is willing to block
+ *        if the message queue is empty.
+ * @param queue_context The thread queue context used for
+ *   _CORE_message_queue_Acquire() or _CORE_message_queue_Acquire_critical().
+ *
+ * @retval STATUS_SUCCESSFUL At least one message was seized.
+ * @retval STATUS_UNSATISFIED Wait was set to false and there is currently no pending message.
+ * @retval STATUS_TIMEOUT A timeout occurred.
+ */
+Status_Control _CORE_message_queue_Seize_many(
+  CORE_message_queue_Control *the_message_queue,
+  Thread_Control             *executing,
+  struct iovec               *messages,
+  uint32_t                    count,
+  uint32_t                   *seized,
+  bool                        wait,
+  Thread_queue_Context       *queue_context
+);
+
 /**
  * @brief Inserts a message into the message queue.
  *
  * Copies the specified content into the message storage space and then
  * inserts the message into the message queue according to the submit type.
+ * The content is not copied if the content source is the message storage
+ * space.
  *
  * @param[in, out] the_message_queue The message queue to insert a message in.
  * @param[in, out] the_message The message to insert in the message queue.
@@ -488,6 +754,231 @@ static inline void _CORE_message_queue_Copy_buffer (
   memcpy(destination, source, size);
 }
 
+/**
+ * @brief Gets the size of a message buffer including the message buffer
+ *   header.
+ *
+ * @param maximum_message_size is the maximum message size of the message
+ *   queue.
+ *
+ * @return Returns the message buffer size.
+ */
+static inline size_t _CORE_message_queue_Buffer_size(
+  size_t maximum_message_size
+)
+{
+  return RTEMS_ALIGN_UP( maximum_message_size, sizeof( uintptr_t ) )
+    + sizeof( CORE_message_queue_Buffer );
+}
+
+/**
+ * @brief Lends the message buffer to the application.
+ *
+ * A message buffer on loan is on no chain of the message queue.  The buffer
+ * returned to the application shall be given back by
+ * _CORE_message_queue_Submit_buffer() or
+ * _CORE_message_queue_Release_buffer().
+ *
+ * @param[out] the_message The message buffer to lend.
+ *
+ * @return Returns the begin of the message.
+ */
+static inline void *_CORE_message_queue_Lend_buffer(
+  CORE_message_queue_Buffer *the_message
+)
+{
+  _Chain_Set_off_chain( &the_message->Node );
+  return the_message->buffer;
+}
+
+/**
+ * @brief Gets the message buffer on loan of the message begin.
+ *
+ * @param the_message_queue The message queue.
+ * @param buffer The begin of a message.
+ *
+ * @retval pointer The message buffer of the message begin.
+ * @retval NULL The address is not the begin of a message buffer of the
+ *   message queue or the message buffer is not on loan, for example because
+ *   it was already submitted or released.
+ */
+static inline CORE_message_queue_Buffer *_CORE_message_queue_Get_buffer(
+  const CORE_message_queue_Control *the_message_queue,
+  const void                       *buffer
+)
+{
+  CORE_message_queue_Buffer *the_message;
+  uintptr_t                  begin;
+  uintptr_t                  offset;
+  size_t                     buffer_size;
+
+  begin = (uintptr_t) the_message_queue->message_buffers;
+  offset = (uintptr_t) buffer - sizeof( CORE_message_queue_Buffer ) - begin;
+  buffer_size = _CORE_message_queue_Buffer_size(
+    the_message_queue->maximum_message_size
+  );
+
+  if (
+    offset >= (uintptr_t) the_message_queue->maximum_pending_messages
+      * buffer_size
+      || offset % buffer_size != 0
+  ) {
+    return NULL;
+  }
+
+  the_message = (CORE_message_queue_Buffer *) ( begin + offset );
+
+  if ( !_Chain_Is_node_off_chain( &the_message->Node ) ) {
+    return NULL;
+  }
+
+  return the_message;
+}
+
+/**
+ * @brief Checks if a message buffer of the message queue is on loan.
+ *
+ * The message queue lock shall be acquired.  This function visits each
+ * message buffer of the message queue, so it should be used only on rare
+ * occasions, for example when the message queue is deleted.
+ *
+ * @param the_message_queue The message queue.
+ *
+ * @retval true At least one message buffer is on loan.
+ * @retval false No message buffer is on loan.
+ */
+static inline bool _CORE_message_queue_Has_buffers_on_loan(
+  const CORE_message_queue_Control *the_message_queue
+)
+{
+  uintptr_t begin;
+  size_t    buffer_size;
+  uint32_t  i;
+
+  begin = (uintptr_t) the_message_queue->message_buffers;
+  buffer_size = _CORE_message_queue_Buffer_size(
+    the_message_queue->maximum_message_size
+  );
+
+  for ( i = 0; i < the_message_queue->maximum_pending_messages; ++i ) {
+    const CORE_message_queue_Buffer *the_message;
+
+    the_message = (const CORE_message_queue_Buffer *)
+      ( begin + (uintptr_t) i * buffer_size );
+
+    if ( _Chain_Is_node_off_chain( &the_message->Node ) ) {
+      return true;
+    }
+  }
+
+  return false;
+}
+
+/**
+ * @brief Checks if the waiting thread waits to receive a message.
+ *
+ * @param the_thread The thread waiting on the message queue.
+ *
+ * @retval true The thread waits to receive a message.
+ * @retval false The thread waits to send a message or for a message buffer.
+ */
+static inline bool _CORE_message_queue_Is_receiver(
+  const Thread_Control *the_thread
+)
+{
+  return the_thread->Wait.option >= CORE_MESSAGE_QUEUE_WAIT_RECEIVE_BUFFER;
+}
+
+/**
+ * @brief Gets the deadline of the timeout of a blocking message queue
+ *   operation.
+ *
+ * A thread which waits on the message queue may be woken up with the
+ * #STATUS_MESSAGE_QUEUE_RETRY status to retry its operation.  The operation
+ * shall wait at most the timeout of the caller in total.  This function shall
+ * be called once before the first enqueue of the operation, see
+ * _CORE_message_queue_Set_remaining_timeout().
+ *
+ * @param queue_context The thread queue context of the operation.
+ *
+ * @return Returns the deadline in clock ticks, if the timeout is given in
+ *   clock ticks, otherwise zero.
+ */
+static inline Watchdog_Interval _CORE_message_queue_Get_deadline(
+  const Thread_queue_Context *queue_context
+)
+{
+  if (
+    queue_context->enqueue_callout != _Thread_queue_Add_timeout_ticks
+      || queue_context->Timeout.ticks == WATCHDOG_NO_TIMEOUT
+  ) {
+    return 0;
+  }
+
+  return _Watchdog_Ticks_since_boot + queue_context->Timeout.ticks;
+}
+
+/**
+ * @brief Sets the timeout of a blocking message queue operation to the time
+ *   remaining until the deadline before the operation is retried.
+ *
+ * Timeouts in timespec format of the message queue APIs are absolute, so
+ * only timeouts in clock ticks are adjusted.
+ *
+ * @param[in, out] queue_context The thread queue context of the operation.
+ * @param deadline The deadline returned by
+ *   _CORE_message_queue_Get_deadline().
+ *
+ * @retval true The operation may be retried.
+ * @retval false The deadline passed.
+ */
+static inline bool _CORE_message_queue_Set_remaining_timeout(
+  Thread_queue_Context *queue_context,
+  Watchdog_Interval     deadline
+)
+{
+  Watchdog_Interval remaining;
+
+  if (
+    queue_context->enqueue_callout != _Thread_queue_Add_timeout_ticks
+      || queue_context->Timeout.ticks == WATCHDOG_NO_TIMEOUT
+  ) {
+    return true;
+  }
+
+  remaining = deadline - _Watchdog_Ticks_since_boot;
+
+  if ( (int32_t) remaining <= 0 ) {
+    return false;
+  }
+
+  queue_context->Timeout.ticks = remaining;
+  return true;
+}
+
+/**
+ * @brief Gets the first thread waiting on the message queue.
+ *
+ * @param the_message_queue The message queue.
+ *
+ * @retval thread The first waiting thread.
+ * @retval NULL No thread waits on the message queue.
+ */
+static inline Thread_Control *_CORE_message_queue_First_waiter(
+  const CORE_message_queue_Control *the_message_queue
+)
+{
+  const Thread_queue_Heads *heads;
+
+  heads = the_message_queue->Wait_queue.Queue.heads;
+
+  if ( heads == NULL ) {
+    return NULL;
+  }
+
+  return ( *the_message_queue->operations->first )( heads );
+}
+
 /**
  * @brief Allocates a message buffer from the inactive message buffer chain.
  *
@@ -635,8 +1126,8 @@ static inline Thread_Control *_CORE_message_queue_Dequeue_receiver(
   Thread_queue_Context            *queue_context
 )
 {
-  Thread_queue_Heads *heads;
-  Thread_Control     *the_thread;
+  Thread_Control            *the_thread;
+  CORE_message_queue_Buffer *the_message;
 
   /*
    *  If there are pending messages, then there can't be threads
@@ -652,16 +1143,31 @@ static inline Thread_Control *_CORE_message_queue_Dequeue_receiver(
 
   /*
    *  There must be no pending messages if there is a thread waiting to
-   *  receive a message.
+   *  receive a message.  If all message buffers are on loan, then the
+   *  first thread may wait for a message buffer.
    */
-  heads = the_message_queue->Wait_queue.Queue.heads;
-  if ( heads == NULL ) {
+  the_thread = _CORE_message_queue_First_waiter( the_message_queue );
+  if ( the_thread == NULL || !_CORE_message_queue_Is_receiver( the_thread ) ) {
     return NULL;
   }
 
+  /*
+   *  A thread waiting to receive a message buffer on loan gets a copy of the
+   *  message in an inactive message buffer.
+   */
+  if ( the_thread->Wait.option == CORE_MESSAGE_QUEUE_WAIT_RECEIVE_BUFFER ) {
+    the_message =
+      _CORE_message_queue_Allocate_message_buffer( the_message_queue );
+    if ( the_message == NULL ) {
+      return NULL;
+    }
+  } else {
+    the_message = NULL;
+  }
+
   the_thread = ( *the_message_queue->operations->surrender )(
     &the_message_queue->Wait_queue.Queue,
-    heads,
+    the_message_queue->Wait_queue.Queue.heads,
     NULL,
     queue_context
   );
@@ -669,11 +1175,18 @@ static inline Thread_Control *_CORE_message_queue_Dequeue_receiver(
    *(size_t *) the_thread->Wait.return_argument = size;
    the_thread->Wait.count = (uint32_t) submit_type;
 
-  _CORE_message_queue_Copy_buffer(
-    buffer,
-    the_thread->Wait.return_argument_second.mutable_object,
-    size
-  );
+  if ( the_message != NULL ) {
+    the_message->size = size;
+    _CORE_message_queue_Copy_buffer( buffer, the_message->buffer, size );
+    *(void **) the_thread->Wait.return_argument_second.mutable_object =
+      _CORE_message_queue_Lend_buffer( the_message );
+  } else {
+    _CORE_message_queue_Copy_buffer(
+      buffer,
+      the_thread->Wait.return_argument_second.mutable_object,
+      size
+    );
+  }
 
   _Thread_queue_Resume(
     &the_message_queue->Wait_queue.Queue,
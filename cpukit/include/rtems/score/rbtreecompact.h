@@ -0,0 +1,544 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/**
+ * @file
+ *
+ * @ingroup RTEMSScoreRBTree
+ *
+ * @brief This header file provides interfaces of the compact and counted
+ *   red-black trees of the @ref RTEMSScoreRBTree which are only used by the
+ *   implementation.
+ */
+
+/*
+ * Copyright (C) 2026 On-Line Applications Research Corporation (OAR)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#ifndef _RTEMS_SCORE_RBTREECOMPACT_H
+#define _RTEMS_SCORE_RBTREECOMPACT_H
+
+#include <rtems/score/basedefs.h>
+#include <rtems/score/assert.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @addtogroup RTEMSScoreRBTree
+ *
+ * @{
+ */
+
+/**
+ * @brief This constant defines the colour bit of the parent and colour word
+ *   of a compact red-black tree node.
+ *
+ * The nodes are aligned by at least two bytes, so the least significant bit
+ * of the parent node address is always zero.
+ */
+#define RBTREE_COMPACT_RED ( (uintptr_t) 1 )
+
+/**
+ * @brief Compact red-black tree node.
+ *
+ * In contrast to the ::RBTree_Node, the parent node pointer and the node
+ * colour are packed into one word.  This saves one word per node.  A node
+ * which is not part of a tree has itself as the parent node.
+ */
+typedef struct RBTree_Compact_node {
+  /**
+   * @brief The left child node.
+   */
+  struct RBTree_Compact_node *left;
+
+  /**
+   * @brief The right child node.
+   */
+  struct RBTree_Compact_node *right;
+
+  /**
+   * @brief The parent node address and the node colour.
+   *
+   * The node is red if the #RBTREE_COMPACT_RED bit is set, otherwise it is
+   * black.
+   */
+  uintptr_t parent_and_color;
+} RBTree_Compact_node;
+
+/**
+ * @brief Compact red-black tree control.
+ */
+typedef struct {
+  /**
+   * @brief The root node or NULL if the tree is empty.
+   */
+  RBTree_Compact_node *root;
+} RBTree_Compact_control;
+
+/**
+ * @brief Compact red-black tree augment handler.
+ *
+ * Augmented trees maintain data in each node which depends only on the node
+ * itself and the data of its child nodes, for example the node count of the
+ * subtree.  The handler shall recompute the data of the node from the data of
+ * its child nodes.  It is called for each node for which a tree operation
+ * changes the set of nodes in the subtree from the bottom to the top.
+ *
+ * @param[in, out] node is the node to update.
+ */
+typedef void ( *RBTree_Compact_augment )( RBTree_Compact_node *node );
+
+/**
+ * @brief Initializer for an empty compact red-black tree.
+ */
+#define RBTREE_COMPACT_INITIALIZER_EMPTY { NULL }
+
+/**
+ * @brief Initializes the compact red-black tree as empty.
+ *
+ * @param[out] the_rbtree is the compact red-black tree control.
+ */
+static inline void _RBTree_Compact_Initialize_empty(
+  RBTree_Compact_control *the_rbtree
+)
+{
+  the_rbtree->root = NULL;
+}
+
+/**
+ * @brief Checks if the compact red-black tree is empty.
+ *
+ * @param the_rbtree is the compact red-black tree control.
+ *
+ * @retval true The tree is empty.
+ * @retval false Otherwise.
+ */
+static inline bool _RBTree_Compact_Is_empty(
+  const RBTree_Compact_control *the_rbtree
+)
+{
+  return the_rbtree->root == NULL;
+}
+
+/**
+ * @brief Sets the compact red-black tree node as off-tree.
+ *
+ * Do not use this function on nodes which are a part of a tree.
+ *
+ * @param[out] the_node is the node to set off-tree.
+ */
+static inline void _RBTree_Compact_Set_off_tree(
+  RBTree_Compact_node *the_node
+)
+{
+  the_node->parent_and_color = (uintptr_t) the_node;
+}
+
+/**
+ * @brief Checks if the compact red-black tree node is off-tree.
+ *
+ * @param the_node is the node to check.
+ *
+ * @retval true The node is not a part of a tree (off-tree).
+ * @retval false The node is part of a tree.
+ */
+static inline bool _RBTree_Compact_Is_node_off_tree(
+  const RBTree_Compact_node *the_node
+)
+{
+  return the_node->parent_and_color == (uintptr_t) the_node;
+}
+
+/**
+ * @brief Returns the parent of the compact red-black tree node.
+ *
+ * @param the_node is the node.  It shall be part of a tree.
+ *
+ * @retval NULL The node is the root node.
+ * @retval parent The parent node.
+ */
+static inline RBTree_Compact_node *_RBTree_Compact_Parent(
+  const RBTree_Compact_node *the_node
+)
+{
+  return (RBTree_Compact_node *)
+    ( the_node->parent_and_color & ~RBTREE_COMPACT_RED );
+}
+
+/**
+ * @brief Checks if the compact red-black tree node is red.
+ *
+ * @param the_node is the node.  It may be NULL.
+ *
+ * @retval true The node is red.
+ * @retval false The node is black or NULL.
+ */
+static inline bool _RBTree_Compact_Is_red(
+  const RBTree_Compact_node *the_node
+)
+{
+  return the_node != NULL &&
+    ( the_node->parent_and_color & RBTREE_COMPACT_RED ) != 0;
+}
+
+/**
+ * @brief Adds a child node to the parent node of a compact red-black tree.
+ *
+ * This is the first step of an insert operation.  The tree shall be
+ * rebalanced afterwards by _RBTree_Compact_Insert_color().
+ *
+ * @param[out] the_node is the child node to add.
+ *
+ * @param parent is the parent node or NULL if the tree is empty.
+ *
+ * @param[out] link is the child node link of the parent node or the root
+ *   node link of the tree.
+ */
+static inline void _RBTree_Compact_Add_child(
+  RBTree_Compact_node  *the_node,
+  RBTree_Compact_node  *parent,
+  RBTree_Compact_node **link
+)
+{
+  _Assert( ( (uintptr_t) parent & RBTREE_COMPACT_RED ) == 0 );
+  the_node->left = NULL;
+  the_node->right = NULL;
+  the_node->parent_and_color = (uintptr_t) parent | RBTREE_COMPACT_RED;
+  *link = the_node;
+}
+
+/**
+ * @brief Rebalances the compact red-black tree after the insertion of the
+ *   node.
+ *
+ * @param[in, out] the_rbtree is the compact red-black tree control.
+ *
+ * @param[in, out] the_node is the most recently added node.
+ *
+ * @param augment is the augment handler.  It may be NULL.
+ */
+void _RBTree_Compact_Insert_color(
+  RBTree_Compact_control *the_rbtree,
+  RBTree_Compact_node    *the_node,
+  RBTree_Compact_augment  augment
+);
+
+/**
+ * @brief Extracts the node from the compact red-black tree.
+ *
+ * The node is set off-tree afterwards.
+ *
+ * @param[in, out] the_rbtree is the compact red-black tree control.
+ *
+ * @param[in, out] the_node is the node to extract.
+ *
+ * @param augment is the augment handler.  It may be NULL.
+ */
+void _RBTree_Compact_Extract(
+  RBTree_Compact_control *the_rbtree,
+  RBTree_Compact_node    *the_node,
+  RBTree_Compact_augment  augment
+);
+
+/**
+ * @brief Inserts the node into the compact red-black tree.
+ *
+ * @param[in, out] the_rbtree is the compact red-black tree control.
+ *
+ * @param[out] the_node is the node to insert.
+ *
+ * @param key is the key of the node to insert.
+ *
+ * @param less shall return true, if the key is less than the key of the
+ *   node, otherwise false.
+ *
+ * @retval true The inserted node is the new minimum node.
+ * @retval false Otherwise.
+ */
+static inline bool _RBTree_Compact_Insert_inline(
+  RBTree_Compact_control *the_rbtree,
+  RBTree_Compact_node    *the_node,
+  const void             *key,
+  bool                 ( *less )( const void *, const RBTree_Compact_node * )
+)
+{
+  RBTree_Compact_node **link;
+  RBTree_Compact_node  *parent;
+  bool                  is_new_minimum;
+
+  link = &the_rbtree->root;
+  parent = NULL;
+  is_new_minimum = true;
+
+  while ( *link != NULL ) {
+    parent = *link;
+
+    if ( ( *less )( key, parent ) ) {
+      link = &parent->left;
+    } else {
+      link = &parent->right;
+      is_new_minimum = false;
+    }
+  }
+
+  _RBTree_Compact_Add_child( the_node, parent, link );
+  _RBTree_Compact_Insert_color( the_rbtree, the_node, NULL );
+  return is_new_minimum;
+}
+
+/**
+ * @brief Returns the minimum node of the compact red-black tree.
+ *
+ * @param the_rbtree is the compact red-black tree control.
+ *
+ * @retval NULL The tree is empty.
+ * @retval node The minimum node.
+ */
+RBTree_Compact_node *_RBTree_Compact_Minimum(
+  const RBTree_Compact_control *the_rbtree
+);
+
+/**
+ * @brief Returns the maximum node of the compact red-black tree.
+ *
+ * @param the_rbtree is the compact red-black tree control.
+ *
+ * @retval NULL The tree is empty.
+ * @retval node The maximum node.
+ */
+RBTree_Compact_node *_RBTree_Compact_Maximum(
+  const RBTree_Compact_control *the_rbtree
+);
+
+/**
+ * @brief Returns the successor of the compact red-black tree node.
+ *
+ * @param the_node is the node.  It shall be part of a tree.
+ *
+ * @retval NULL The node is the maximum node.
+ * @retval node The successor node.
+ */
+RBTree_Compact_node *_RBTree_Compact_Successor(
+  const RBTree_Compact_node *the_node
+);
+
+/**
+ * @brief Returns the predecessor of the compact red-black tree node.
+ *
+ * @param the_node is the node.  It shall be part of a tree.
+ *
+ * @retval NULL The node is the minimum node.
+ * @retval node The predecessor node.
+ */
+RBTree_Compact_node *_RBTree_Compact_Predecessor(
+  const RBTree_Compact_node *the_node
+);
+
+/**
+ * @brief Counted red-black tree node.
+ *
+ * The counted red-black tree is a compact red-black tree augmented by the node
+ * count of each subtree.  It supports the selection of the node with a
+ * particular index in tree order and the computation of the index of a node
+ * in logarithmic time.  The counted nodes use a ::RBTree_Compact_control.
+ */
+typedef struct {
+  /**
+   * @brief The compact red-black tree node.
+   */
+  RBTree_Compact_node Node;
+
+  /**
+   * @brief The count of nodes in the subtree of this node including this
+   *   node.
+   */
+  size_t count;
+} RBTree_Counted_node;
+
+/**
+ * @brief Returns the counted node of the compact red-black tree node.
+ *
+ * @param the_node is the compact node.  It may be NULL.
+ *
+ * @return Returns the counted node or NULL if the compact node was NULL.
+ */
+static inline RBTree_Counted_node *_RBTree_Counted_Node(
+  const RBTree_Compact_node *the_node
+)
+{
+  return (RBTree_Counted_node *)
+    RTEMS_CONTAINER_OF( the_node, RBTree_Counted_node, Node );
+}
+
+/**
+ * @brief Returns the node count of the subtree of the compact node.
+ *
+ * @param the_node is the compact node of a counted node.  It may be NULL.
+ *
+ * @return Returns the node count of the subtree.
+ */
+static inline size_t _RBTree_Counted_Subtree_count(
+  const RBTree_Compact_node *the_node
+)
+{
+  if ( the_node == NULL ) {
+    return 0;
+  }
+
+  return _RBTree_Counted_Node( the_node )->count;
+}
+
+/**
+ * @brief Returns the node count of the counted red-black tree.
+ *
+ * @param the_rbtree is the counted red-black tree control.
+ *
+ * @return Returns the node count of the tree.
+ */
+static inline size_t _RBTree_Counted_Size(
+  const RBTree_Compact_control *the_rbtree
+)
+{
+  return _RBTree_Counted_Subtree_count( the_rbtree->root );
+}
+
+/**
+ * @brief Updates the node count of the counted node.
+ *
+ * This is the augment handler of the counted red-black tree.
+ *
+ * @param[in, out] the_node is the compact node of a counted node.
+ */
+void _RBTree_Counted_Augment( RBTree_Compact_node *the_node );
+
+/**
+ * @brief Inserts the node into the counted red-black tree.
+ *
+ * @param[in, out] the_rbtree is the counted red-black tree control.
+ *
+ * @param[out] the_node is the node to insert.
+ *
+ * @param key is the key of the node to insert.
+ *
+ * @param less shall return true, if the key is less than the key of the
+ *   node, otherwise false.
+ *
+ * @retval true The inserted node is the new minimum node.
+ * @retval false Otherwise.
+ */
+static inline bool _RBTree_Counted_Insert_inline(
+  RBTree_Compact_control *the_rbtree,
+  RBTree_Counted_node    *the_node,
+  const void             *key,
+  bool                 ( *less )( const void *, const RBTree_Compact_node * )
+)
+{
+  RBTree_Compact_node **link;
+  RBTree_Compact_node  *parent;
+  bool                  is_new_minimum;
+
+  link = &the_rbtree->root;
+  parent = NULL;
+  is_new_minimum = true;
+
+  while ( *link != NULL ) {
+    parent = *link;
+    ++_RBTree_Counted_Node( parent )->count;
+
+    if ( ( *less )( key, parent ) ) {
+      link = &parent->left;
+    } else {
+      link = &parent->right;
+      is_new_minimum = false;
+    }
+  }
+
+  the_node->count = 1;
+  _RBTree_Compact_Add_child( &the_node->Node, parent, link );
+  _RBTree_Compact_Insert_color(
+    the_rbtree,
+    &the_node->Node,
+    _RBTree_Counted_Augment
+  );
+  return is_new_minimum;
+}
+
+/**
+ * @brief Extracts the node from the counted red-black tree.
+ *
+ * @param[in, out] the_rbtree is the counted red-black tree control.
+ *
+ * @param[in, out] the_node is the node to extract.
+ */
+static inline void _RBTree_Counted_Extract(
+  RBTree_Compact_control *the_rbtree,
+  RBTree_Counted_node    *the_node
+)
+{
+  _RBTree_Compact_Extract(
+    the_rbtree,
+    &the_node->Node,
+    _RBTree_Counted_Augment
+  );
+}
+
+/**
+ * @brief Returns the node with the specified index in tree order of the
+ *   counted red-black tree.
+ *
+ * @param the_rbtree is the counted red-black tree control.
+ *
+ * @param index is the index of the node.  The minimum node has the index
+ *   zero.
+ *
+ * @retval NULL The index is greater than or equal to the node count of the
+ *   tree.
+ * @retval node The node with the specified index.
+ */
+RBTree_Counted_node *_RBTree_Counted_Nth(
+  const RBTree_Compact_control *the_rbtree,
+  size_t                        index
+);
+
+/**
+ * @brief Returns the index in tree order of the node of the counted
+ *   red-black tree.
+ *
+ * @param the_node is the node.  It shall be part of a tree.
+ *
+ * @return Returns the index of the node.  The minimum node has the index
+ *   zero.
+ */
+size_t _RBTree_Counted_Rank( const RBTree_Counted_node *the_node );
+
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
+/* end of include file */
@@ -75,6 +75,72 @@ void _RBTree_Append( RBTree_Control *the_rbtree, RBTree_Node *the_node );
  */
 void _RBTree_Prepend( RBTree_Control *the_rbtree, RBTree_Node *the_node );
 
+/**
+ * @brief Builds the red-black tree from nodes in tree order.
+ *
+ * The tree is built in linear time without key comparisons.  The resulting
+ * tree has a minimal height.  The caller shall ensure that the nodes are
+ * sorted with respect to the tree order.
+ *
+ * @param[out] the_rbtree is the red-black tree control.  The tree shall be
+ *   empty.
+ *
+ * @param nodes is the array of nodes sorted in tree order.
+ *
+ * @param count is the count of nodes in the array.
+ */
+void _RBTree_Build_sorted(
+  RBTree_Control    *the_rbtree,
+  RBTree_Node *const nodes[],
+  size_t             count
+);
+
+/**
+ * @brief Red-black tree extract visitor.
+ *
+ * @param[out] node is the extracted node.
+ *
+ * @param[in, out] visitor_arg is the visitor argument.
+ *
+ * @see _RBTree_Extract_range().
+ */
+typedef void ( *RBTree_Extract_visitor )(
+  RBTree_Node *node,
+  void        *visitor_arg
+);
+
+/**
+ * @brief Extracts a range of nodes from the red-black tree.
+ *
+ * The nodes from the first node up to and including the last node in tree
+ * order are extracted.  If the range covers a large part of the tree, then
+ * the remaining nodes are rebuilt into a tree of minimal height in linear time
+ * instead of extracting the nodes one by one.
+ *
+ * @param[in, out] the_rbtree is the red-black tree control.
+ *
+ * @param first is the first node of the range.
+ *
+ * @param last is the last node of the range.  It shall be equal to the first
+ *   node or a successor of the first node.
+ *
+ * @param visitor is the visitor called for each extracted node in tree order
+ *   after the extraction of the node.  The node is already set off tree, see
+ *   _RBTree_Is_node_off_tree().  It may be NULL.  The visitor shall not
+ *   access the tree.
+ *
+ * @param visitor_arg is the visitor argument.
+ *
+ * @return Returns the count of extracted nodes.
+ */
+size_t _RBTree_Extract_range(
+  RBTree_Control         *the_rbtree,
+  RBTree_Node            *first,
+  RBTree_Node            *last,
+  RBTree_Extract_visitor  visitor,
+  void                   *visitor_arg
+);
+
 /**
  * @brief Red-black tree visitor.
  *
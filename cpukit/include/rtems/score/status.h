@@ -145,6 +145,8 @@ typedef enum {
     STATUS_BUILD( STATUS_CLASSIC_INVALID_SIZE, ENOSPC ),
   STATUS_MESSAGE_QUEUE_NO_MEMORY =
     STATUS_BUILD( STATUS_CLASSIC_UNSATISFIED, ENOSPC ),
+  STATUS_MESSAGE_QUEUE_RETRY =
+    STATUS_BUILD( STATUS_CLASSIC_INTERNAL_ERROR, EBUSY ),
   STATUS_MESSAGE_QUEUE_WAIT_IN_ISR =
     STATUS_BUILD( STATUS_CLASSIC_INTERNAL_ERROR, EAGAIN ),
   STATUS_MESSAGE_QUEUE_WAS_DELETED =
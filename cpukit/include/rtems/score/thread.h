@@ -698,6 +698,15 @@ typedef struct {
    */
   ISR_lock_Control Lock;
 #endif
+
+  /**
+   * @brief Values of the keys with an object index less than or equal to
+   *   _POSIX_Keys_Direct_maximum indexed by the object index minus one.
+   *
+   * The array is provided by the thread control add-ons.  It is only accessed
+   * by the owner thread and with the object allocator lock held.
+   */
+  void **Direct_values;
 } Thread_Keys_information;
 
 /**
@@ -95,6 +95,9 @@ void _Workspace_Free(
 /**
  * @brief Duplicates string with memory from the workspace.
  *
+ * The duplicated string is allocated from the workspace heap and shall be
+ * freed by _Workspace_Free().
+ *
  * @param string The pointer to a zero terminated string.
  * @param len The length of the string (equal to strlen(string)).
  *
@@ -106,6 +109,167 @@ char *_Workspace_String_duplicate(
   size_t len
 );
 
+/**
+ * @brief This constant defines the size and alignment of a workspace slab in
+ *   bytes.
+ */
+#define WORKSPACE_SLAB_SIZE 2048
+
+/**
+ * @brief This constant defines the object size of the smallest workspace slab
+ *   size class in bytes.
+ */
+#define WORKSPACE_SLAB_MINIMUM_OBJECT_SIZE 16
+
+/**
+ * @brief This constant defines the count of workspace slab size classes.
+ *
+ * The object size of a size class is twice the object size of the previous
+ * size class.
+ */
+#define WORKSPACE_SLAB_CLASS_COUNT 5
+
+/**
+ * @brief This constant defines the maximum object size which is allocated
+ *   from a workspace slab.
+ */
+#define WORKSPACE_SLAB_MAXIMUM_OBJECT_SIZE \
+  ( WORKSPACE_SLAB_MINIMUM_OBJECT_SIZE << ( WORKSPACE_SLAB_CLASS_COUNT - 1 ) )
+
+/**
+ * @brief The workspace slab size class information.
+ */
+typedef struct {
+  /**
+   * @brief The object size of the size class in bytes.
+   */
+  uint32_t object_size;
+
+  /**
+   * @brief The count of objects in one slab of the size class.
+   */
+  uint32_t objects_per_slab;
+
+  /**
+   * @brief The count of slabs currently allocated for the size class.
+   */
+  uint32_t slab_count;
+
+  /**
+   * @brief The count of slabs which have no used objects.
+   */
+  uint32_t empty_slab_count;
+
+  /**
+   * @brief The count of objects currently allocated by users.
+   */
+  uint32_t used_object_count;
+
+  /**
+   * @brief The count of free objects in the processor caches.
+   */
+  uint32_t cached_object_count;
+
+  /**
+   * @brief The count of object allocations since system initialization.
+   */
+  uint32_t allocation_count;
+
+  /**
+   * @brief The count of slabs returned to the workspace since system
+   *   initialization.
+   */
+  uint32_t reclaimed_slab_count;
+} Workspace_Slab_information;
+
+/**
+ * @brief Allocates an object from the workspace slab size class which fits
+ *   the specified size.
+ *
+ * Free objects are cached per processor, so that in the common case an
+ * allocation takes an object from the cache of the current processor.
+ * Otherwise, the object is taken from a slab of the size class.  New slabs
+ * are allocated from the workspace on demand.  Sizes greater than
+ * #WORKSPACE_SLAB_MAXIMUM_OBJECT_SIZE are allocated directly from the
+ * workspace.
+ *
+ * The caller shall own the objects allocator lock or the system shall be
+ * in the initialization state.
+ *
+ * @param size The size of the object.
+ *
+ * @retval pointer The pointer to the object.  The pointer is at least
+ *   aligned by CPU_HEAP_ALIGNMENT.
+ * @retval NULL There was not enough memory available.
+ */
+void *_Workspace_Slab_allocate( size_t size );
+
+/**
+ * @brief Frees an object allocated by _Workspace_Slab_allocate().
+ *
+ * The slab of the object is determined by the address of the object, so this
+ * is a constant-time operation.  The memory of empty slabs is returned to the
+ * workspace by _Workspace_Slab_reclaim().  This function does not use the
+ * workspace heap for objects allocated from a slab, so the objects allocator
+ * lock is not required in this case.
+ *
+ * @param object The object to free.  If @a object is equal to NULL, then the
+ *   request is ignored.
+ * @param size The size used to allocate the object.
+ */
+void _Workspace_Slab_free( void *object, size_t size );
+
+/**
+ * @brief Duplicates string with memory from a workspace slab.
+ *
+ * This function is used for object string names.  The caller shall own the
+ * objects allocator lock or the system shall be in the initialization state.
+ *
+ * The duplicated string shall be freed by _Workspace_Slab_string_free().  It
+ * must not be passed to _Workspace_Free(), since it is not allocated from the
+ * workspace heap if it fits into a slab.
+ *
+ * @param string The pointer to a zero terminated string.
+ * @param len The maximum length of the string.
+ *
+ * @retval other Duplicated string.
+ * @retval NULL Not enough memory.
+ */
+char *_Workspace_Slab_string_duplicate(
+  const char *string,
+  size_t      len
+);
+
+/**
+ * @brief Frees a string duplicated by _Workspace_Slab_string_duplicate().
+ *
+ * @param string The string to free.  If @a string is equal to NULL, then the
+ *   request is ignored.
+ */
+void _Workspace_Slab_string_free( const char *string );
+
+/**
+ * @brief Returns the memory of empty workspace slabs to the workspace.
+ *
+ * The free objects of the processor caches are returned to their slabs
+ * before.  One empty slab is kept for each size class to avoid an allocation
+ * and free cycle of a slab on alternating object allocations and frees.
+ *
+ * The caller shall own the objects allocator lock.
+ *
+ * @return Returns the count of slabs returned to the workspace.
+ */
+uint32_t _Workspace_Slab_reclaim( void );
+
+/**
+ * @brief Gets the workspace slab size class information.
+ *
+ * @param[out] info is the array of size class information items.
+ */
+void _Workspace_Slab_get_information(
+  Workspace_Slab_information info[ WORKSPACE_SLAB_CLASS_COUNT ]
+);
+
 /** @} */
 
 #ifdef __cplusplus
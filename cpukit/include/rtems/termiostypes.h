@@ -351,6 +351,12 @@ typedef struct rtems_termios_tty {
   rtems_interval              rawInBufSemaphoreFirstTimeout;
   unsigned int                rawInBufDropped;  /* Statistics */
 
+  /*
+   * Count of raw input characters which wakes up the waiting reader in raw
+   * mode, zero wakes up the reader for each received chunk
+   */
+  unsigned int                rawInBufThreshold;
+
   /*
    * Raw output character buffer
    */
@@ -391,6 +397,14 @@ typedef struct rtems_termios_tty {
    */
   int                     txTaskCharsDequeued;
 
+  /*
+   * Shared daemon task support (for task-driven drivers), see
+   * rtems_termios_set_shared_daemon()
+   */
+  bool                    sharedDaemon;
+  rtems_chain_node        rxDaemonNode;
+  rtems_chain_node        txDaemonNode;
+
   /*
    * line discipline related stuff
    */
@@ -43,6 +43,7 @@
 #include <xz.h>
 
 #include <rtems/print.h>
+#include <rtems/rtems/tasks.h>
 
 /**
  *  @defgroup libmisc_untar_img Untar Image
@@ -62,8 +63,52 @@ extern "C" {
 #define UNTAR_GZ_INFLATE_FAILED 4
 #define UNTAR_GZ_INFLATE_END_FAILED 5
 
+/**
+ * @brief Untar option to pre-allocate each regular file to its final size
+ * before the file data is written.
+ *
+ * Pre-allocation uses ftruncate().  File systems which cannot extend a file
+ * with ftruncate() get the file data written without pre-allocation.
+ */
+#define UNTAR_PREALLOCATE 0x1
+
+/**
+ * @brief Untar option to create the regular files of an in-memory tar image
+ * as IMFS linear files.
+ *
+ * A linear file references its data in the tar image, so that the file data
+ * is not copied.  The tar image must stay valid and unchanged as long as the
+ * files exist.  Regular files outside of an IMFS are written.  This option
+ * is only used by Untar_FromMemory_Options().
+ */
+#define UNTAR_MAP_IMFS 0x2
+
 int Untar_FromMemory(void *tar_buf, size_t size);
 int Untar_FromMemory_Print(void *tar_buf, size_t size, const rtems_printer* printer);
+
+/**
+ * @brief Rips links, directories and files out of a block of memory.
+ *
+ * The data of each regular file is written with one write() call.
+ *
+ * @param tar_buf [in] Pointer to the TAR buffer.
+ * @param size [in] Length of the TAR buffer.
+ * @param options [in] Untar options, see #UNTAR_PREALLOCATE and
+ *   #UNTAR_MAP_IMFS.
+ * @param printer [in] The printer for messages.
+ *
+ * @retval UNTAR_SUCCESSFUL (0)    on successful completion.
+ * @retval UNTAR_FAIL              for a faulty step within the process.
+ * @retval UNTAR_INVALID_CHECKSUM  for an invalid header checksum.
+ * @retval UNTAR_INVALID_HEADER    for an invalid header.
+ */
+int Untar_FromMemory_Options(
+  void *tar_buf,
+  size_t size,
+  int options,
+  const rtems_printer* printer
+);
+
 int Untar_FromFile(const char *tar_name);
 int Untar_FromFile_Print(const char *tar_name, const rtems_printer* printer);
 
@@ -112,6 +157,20 @@ typedef struct {
    * @brief File descriptor of output file.
    */
   int out_fd;
+
+  /**
+   * @brief Untar options, see #UNTAR_PREALLOCATE.
+   *
+   * Untar_ChunkContext_Init() clears the options.
+   */
+  int options;
+
+  /**
+   * @brief Pipeline of the context or NULL.
+   *
+   * @see Untar_ChunkContext_Start_pipeline().
+   */
+  struct Untar_ChunkPipeline *pipeline;
 } Untar_ChunkContext;
 
 typedef struct {
@@ -173,6 +232,89 @@ typedef struct {
  */
 void Untar_ChunkContext_Init(Untar_ChunkContext *context);
 
+/**
+ * @brief The default stack size of the writer task of
+ *   Untar_ChunkContext_Start_pipeline().
+ *
+ * File systems with deep call chains may need more.
+ */
+#define UNTAR_WRITER_DEFAULT_STACK_SIZE (2 * RTEMS_MINIMUM_STACK_SIZE)
+
+/**
+ * @brief Starts a pipeline for the chunk context.
+ *
+ * With a pipeline, the files are written by a writer task.
+ * Untar_FromChunk_Print(), Untar_FromGzChunk_Print() and
+ * Untar_FromXzChunk_Print() hand the tar data over to the writer task through
+ * a ring of buffers, so that the decompression on the calling task and the
+ * file writes overlap.  The decompressors inflate directly into the ring
+ * buffers.  Each buffer is handed over when it is full, so that files are
+ * written in chunks of the buffer size.
+ *
+ * The pipeline must be ended with Untar_ChunkContext_Finish().
+ *
+ * @param context [in] Pointer to an initialized context structure.
+ * @param buffer_count [in] Count of ring buffers, at least two.
+ * @param buffer_size [in] Size of each ring buffer in bytes.
+ * @param priority [in] Priority of the writer task.
+ * @param stack_size [in] Stack size in bytes of the writer task, for example
+ *   #UNTAR_WRITER_DEFAULT_STACK_SIZE.
+ * @param printer [in] The printer for messages of the writer task.
+ *
+ * @retval UNTAR_SUCCESSFUL (0)    on successful completion.
+ * @retval UNTAR_FAIL              for invalid parameters or not enough
+ *                                 resources.
+ */
+int Untar_ChunkContext_Start_pipeline(
+  Untar_ChunkContext *context,
+  size_t buffer_count,
+  size_t buffer_size,
+  rtems_task_priority priority,
+  size_t stack_size,
+  const rtems_printer* printer
+);
+
+/**
+ * @brief Waits until the writer task processed all tar data and ends the
+ * pipeline of the chunk context.
+ *
+ * @param context [in] Pointer to a context structure.
+ *
+ * @retval UNTAR_SUCCESSFUL (0)    on successful completion or if the context
+ *                                 has no pipeline.
+ * @retval UNTAR_FAIL              for a faulty step within the process.
+ * @retval UNTAR_INVALID_CHECKSUM  for an invalid header checksum.
+ * @retval UNTAR_INVALID_HEADER    for an invalid header.
+ */
+int Untar_ChunkContext_Finish(Untar_ChunkContext *context);
+
+/**
+ * @brief Gets the free space of the current ring buffer of the pipeline.
+ *
+ * This function is used by the decompressors to write the tar data directly
+ * into the ring buffers.  It may wait for a free ring buffer.
+ *
+ * @param context [in] Pointer to a context structure with a pipeline.
+ * @param size [out] Size of the free space in bytes.
+ *
+ * @return Returns the begin of the free space.
+ */
+void *Untar_ChunkContext_Get_buffer(Untar_ChunkContext *context, size_t *size);
+
+/**
+ * @brief Adds the data written into the free space of the current ring buffer
+ * to the pipeline.
+ *
+ * The ring buffer is handed over to the writer task if it is full.
+ *
+ * @param context [in] Pointer to a context structure with a pipeline.
+ * @param size [in] Size of the data in bytes.
+ *
+ * @retval UNTAR_SUCCESSFUL (0)    on successful completion.
+ * @retval other                   the writer task failed with this status.
+ */
+int Untar_ChunkContext_Put_buffer(Untar_ChunkContext *context, size_t size);
+
 /*
  * @brief Rips links, directories and files out of a part of a block of memory.
  *
@@ -257,6 +399,87 @@ int Untar_FromXzChunk_Print(
   const rtems_printer* printer
 );
 
+/**
+ * @brief Initializes the Untar_XzChunkContext with a decoder which uses a
+ * dictionary of the pool.
+ *
+ * The decoder gives the dictionary back to the pool at the end of the
+ * stream or on an error.
+ *
+ * @param ctx [in] Pointer to a context structure.
+ * @param pool [in] Pool created with xz_dict_pool_create().
+ * @param inflateBuffer [in] Pointer to the output buffer of the decoder.
+ * @param inflateBufferSize [in] Size of inflateBuffer.
+ *
+ * @retval UNTAR_SUCCESSFUL (0)    on successful completion.
+ * @retval UNTAR_FAIL              if the pool has no free dictionary or the
+ *                                 decoder allocation failed.
+ */
+int Untar_XzChunkContext_Init_pool(
+  Untar_XzChunkContext *ctx,
+  struct xz_dict_pool *pool,
+  void *inflateBuffer,
+  size_t inflateBufferSize
+);
+
+/**
+ * @brief The default stack size of the decoder tasks of
+ *   Untar_FromXzMemory_Parallel().
+ *
+ * The XZ decoder state is allocated from the heap, so the decoder tasks need
+ * only a small stack.
+ */
+#define UNTAR_XZ_DECODER_DEFAULT_STACK_SIZE (2 * RTEMS_MINIMUM_STACK_SIZE)
+
+/**
+ * @brief Untars a XZ compressed POSIX TAR file in memory with decoder tasks
+ * which decode the blocks of the XZ file ahead.
+ *
+ * The blocks of a XZ file are independent of each other.  Files compressed
+ * with more than one block, for example with "xz --block-size=1MiB", are
+ * decoded by up to worker_count decoder tasks in parallel.  Each decoder task
+ * takes a dictionary of the pool.  The decoded blocks are handed over to the
+ * calling task through a ring of 2 * worker_count buffers of the maximum
+ * uncompressed block size.  The calling task extracts the blocks in order,
+ * so that the file writes overlap with the decompression.
+ *
+ * The ring is limited to slot_memory_max bytes.  If the limit allows less
+ * than 2 * worker_count buffers, then less buffers and at most one decoder
+ * task per buffer are used.
+ *
+ * Files with one block or with concatenated streams, and files with a block
+ * which does not fit into slot_memory_max bytes, are decoded on the calling
+ * task.
+ *
+ * @param xz_buf [in] Pointer to the XZ file.
+ * @param size [in] Size of the XZ file.
+ * @param pool [in] Pool created with xz_dict_pool_create().  The pool should
+ *   have at least worker_count dictionaries.  If it has less free
+ *   dictionaries, then less decoder tasks are used.
+ * @param worker_count [in] Maximum count of decoder tasks.
+ * @param priority [in] Priority of the decoder tasks.
+ * @param stack_size [in] Stack size in bytes of the decoder tasks, for example
+ *   #UNTAR_XZ_DECODER_DEFAULT_STACK_SIZE.
+ * @param slot_memory_max [in] Maximum size in bytes of the ring of decoded
+ *   blocks.  Use SIZE_MAX for no limit.
+ * @param printer [in] The printer for messages.
+ *
+ * @retval UNTAR_SUCCESSFUL (0)    on successful completion.
+ * @retval UNTAR_FAIL              for a faulty step within the process.
+ * @retval UNTAR_INVALID_CHECKSUM  for an invalid header checksum.
+ * @retval UNTAR_INVALID_HEADER    for an invalid header.
+ */
+int Untar_FromXzMemory_Parallel(
+  const void *xz_buf,
+  size_t size,
+  struct xz_dict_pool *pool,
+  uint32_t worker_count,
+  rtems_task_priority priority,
+  size_t stack_size,
+  size_t slot_memory_max,
+  const rtems_printer* printer
+);
+
 int Untar_ProcessHeader(Untar_HeaderContext *ctx, const char *bufr);
 
 #ifdef __cplusplus
@@ -237,6 +237,107 @@ XZ_EXTERN void xz_dec_reset(struct xz_dec *s);
  */
 XZ_EXTERN void xz_dec_end(struct xz_dec *s);
 
+/**
+ * struct xz_dict_pool - Opaque pool of LZMA2 dictionary buffers
+ *
+ * A pool provides dictionary buffers of a fixed size to decoders created
+ * with xz_dec_init_pool(). The buffers are allocated once when the pool
+ * is created, so that decoders can be created and freed repeatedly
+ * without large allocations.
+ */
+struct xz_dict_pool;
+
+/**
+ * xz_dict_pool_create() - Allocate a pool of dictionary buffers
+ * @dict_size:  Size of each dictionary buffer in bytes. This is the
+ *              maximum dictionary size supported by the decoders which
+ *              use the pool.
+ * @count:      Number of dictionary buffers
+ *
+ * On success, xz_dict_pool_create() returns a pointer to the pool.
+ * NULL is returned if the allocation fails.
+ */
+XZ_EXTERN struct xz_dict_pool *xz_dict_pool_create(uint32_t dict_size,
+						   unsigned int count);
+
+/**
+ * xz_dict_pool_destroy() - Free the pool and its dictionary buffers
+ * @pool:       Pool created with xz_dict_pool_create(). All decoders
+ *              which use the pool shall be freed with xz_dec_end().
+ *              If @pool is NULL, this function does nothing.
+ */
+XZ_EXTERN void xz_dict_pool_destroy(struct xz_dict_pool *pool);
+
+/**
+ * xz_dec_init_pool() - Allocate a decoder which uses a pool dictionary
+ * @pool:       Pool created with xz_dict_pool_create()
+ *
+ * The decoder works like a decoder in XZ_PREALLOC mode with the
+ * dictionary size of the pool as dict_max. The dictionary buffer is
+ * taken from the pool and returned to the pool by xz_dec_end(). The
+ * pool may be used by several threads.
+ *
+ * On success, xz_dec_init_pool() returns a pointer to the decoder
+ * state. NULL is returned if the allocation of the decoder state fails
+ * or the pool has no free dictionary buffer.
+ */
+XZ_EXTERN struct xz_dec *xz_dec_init_pool(struct xz_dict_pool *pool);
+
+/**
+ * struct xz_block - Location of a Block in a .xz file
+ * @in_pos:             Offset of the Block Header in the .xz file
+ * @unpadded_size:      Unpadded Size of the Block from the Index
+ * @uncompressed_size:  Uncompressed Size of the Block from the Index
+ * @out_pos:            Offset of the uncompressed data of the Block in
+ *                      the uncompressed data of the .xz file
+ */
+struct xz_block {
+	size_t in_pos;
+	size_t unpadded_size;
+	size_t uncompressed_size;
+	size_t out_pos;
+};
+
+/**
+ * xz_dec_index() - Get the Blocks of a .xz file from its Index
+ * @in:         The complete .xz file
+ * @in_size:    Size of the .xz file
+ * @blocks:     Array of Block locations, may be NULL to count the Blocks
+ * @count:      On input, the number of array elements if @blocks is not
+ *              NULL. On output, the number of Blocks.
+ *
+ * The Blocks of a .xz file are independent of each other, so they can be
+ * decoded in parallel with xz_dec_block().
+ *
+ * xz_dec_index() returns XZ_OK on success. XZ_OPTIONS_ERROR is returned
+ * for a file with more than one Stream, this is not supported.
+ * XZ_BUF_ERROR is returned if the array has less than the number of
+ * Blocks elements. XZ_MEMLIMIT_ERROR is returned if the sizes do not fit
+ * into size_t. XZ_FORMAT_ERROR and XZ_DATA_ERROR indicate an invalid
+ * file.
+ */
+XZ_EXTERN enum xz_ret xz_dec_index(const uint8_t *in, size_t in_size,
+				   struct xz_block *blocks, size_t *count);
+
+/**
+ * xz_dec_block() - Decode one Block of a .xz file
+ * @s:          Decoder state allocated using xz_dec_init() in multi-call
+ *              mode or xz_dec_init_pool()
+ * @in:         The complete .xz file
+ * @block:      Block location obtained by xz_dec_index()
+ * @out:        Output buffer of at least block->uncompressed_size bytes
+ *
+ * The Block is decoded as the only Block of a Stream with the Stream
+ * Flags of the file, so the integrity check of the Block and the Index
+ * Record of the Block are verified. The decoder state is reset before
+ * the Block is decoded.
+ *
+ * xz_dec_block() returns XZ_STREAM_END on success. Otherwise, the return
+ * values are the same as the ones of xz_dec_run().
+ */
+XZ_EXTERN enum xz_ret xz_dec_block(struct xz_dec *s, const uint8_t *in,
+				   const struct xz_block *block, uint8_t *out);
+
 /*
  * Standalone build (userspace build or in-kernel build for boot time use)
  * needs a CRC32 implementation. For normal in-kernel use, kernel's own
@@ -1523,6 +1523,25 @@ ZEXTERN uLong ZEXPORT crc32_combine OF((uLong crc1, uLong crc2, z_off_t len2));
    len2.
 */
 
+ZEXTERN uLong ZEXPORT adler32_copy OF((uLong adler, Bytef *dst,
+                                       const Bytef *src, uInt len));
+/*
+     Copy the bytes src[0..len-1] to dst[0..len-1] and update a running
+   Adler-32 checksum with the copied bytes.  The result is the same as
+   memcpy(dst, src, len) followed by adler32(adler, dst, len), however, the
+   data is checksummed block-wise while it is still in the data cache.  The
+   areas shall not overlap.  If src is Z_NULL, this function returns the
+   required initial value for the checksum.
+*/
+
+ZEXTERN uLong ZEXPORT crc32_copy OF((uLong crc, Bytef *dst,
+                                     const Bytef *src, uInt len));
+/*
+     Copy the bytes src[0..len-1] to dst[0..len-1] and update a running
+   CRC-32 with the copied bytes.  This is the CRC-32 counterpart of
+   adler32_copy().
+*/
+
 
                         /* various hacks, don't look :) */
 
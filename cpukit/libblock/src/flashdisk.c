@@ -148,8 +148,10 @@ typedef struct rtems_fdisk_segment_ctl
 
   uint32_t failed;        /**< The segment has failed. */
 
-  uint32_t erased;        /**< Counter to debugging. Wear support would
-                               remove this. */
+  uint32_t erased;        /**< Number of erases since the driver was
+                               initialised. Segments with the same
+                               number of available pages are used least
+                               erased first. */
 } rtems_fdisk_segment_ctl;
 
 /**
@@ -223,8 +225,24 @@ typedef struct rtems_flashdisk
   uint32_t info_level;                     /**< The info trace level. */
 
   uint32_t starvations;                    /**< Erased blocks starvations counter. */
+
+  rtems_id background_task;                /**< The background erase and
+                                                compact task. */
+
+  uint32_t compactions;                    /**< Write path compactions. */
+  uint32_t background_compactions;         /**< Background compactions. */
+  uint32_t background_erases;              /**< Background erases. */
+  uint32_t multi_page_reads;               /**< Read pages handler calls. */
+  uint32_t multi_page_writes;              /**< Write pages handler calls. */
+  uint64_t compact_stall_time;             /**< Nanoseconds writes spent
+                                                compacting and erasing. */
 } rtems_flashdisk;
 
+/**
+ * The maximum number of pages transferred in one run.
+ */
+#define RTEMS_FDISK_RUN_PAGES (32)
+
 /**
  * The CRC16 factor table. Created during initialisation.
  */
@@ -725,7 +743,8 @@ rtems_fdisk_seg_next_available_page (rtems_fdisk_segment_ctl* sc)
 }
 
 /**
- * Find the segment on the queue that has the most free pages.
+ * Find the segment on the queue that has the most free pages. The least
+ * erased segment wins a tie.
  */
 static rtems_fdisk_segment_ctl*
 rtems_fdisk_seg_most_available (const rtems_fdisk_segment_ctl_queue* queue)
@@ -735,8 +754,10 @@ rtems_fdisk_seg_most_available (const rtems_fdisk_segment_ctl_queue* queue)
 
   while (sc)
   {
-    if (rtems_fdisk_seg_pages_available (sc) >
-        rtems_fdisk_seg_pages_available (biggest))
+    uint32_t available = rtems_fdisk_seg_pages_available (sc);
+    uint32_t biggest_available = rtems_fdisk_seg_pages_available (biggest);
+    if ((available > biggest_available) ||
+        ((available == biggest_available) && (sc->erased < biggest->erased)))
       biggest = sc;
     sc = sc->next;
   }
@@ -927,6 +948,90 @@ rtems_fdisk_seg_write_page (rtems_flashdisk*         fd,
                                 page * fd->block_size, buffer, fd->block_size);
 }
 
+/**
+ * Read a run of contiguous pages of data from a segment. The run is read
+ * with one call if the driver has a read pages handler.
+ */
+static int
+rtems_fdisk_seg_read_pages (rtems_flashdisk*         fd,
+                            rtems_fdisk_segment_ctl* sc,
+                            uint32_t                 page,
+                            uint32_t                 count,
+                            void* const*             buffers)
+{
+  const rtems_fdisk_driver_handlers* ops;
+  uint32_t                           p;
+  ops = fd->devices[sc->device].descriptor->flash_ops;
+  if ((count > 1) && ops->read_pages)
+  {
+    const rtems_fdisk_segment_desc* sd;
+    sd = rtems_fdisk_seg_descriptor (fd, sc->device, sc->segment);
+#if RTEMS_FDISK_TRACE
+    rtems_fdisk_printf (fd, "  seg-read-pages: %02d-%03d: o=%08x c=%d",
+                        sc->device, sc->segment, page * fd->block_size, count);
+#endif
+    fd->multi_page_reads++;
+    return ops->read_pages (sd, sc->device, sc->segment,
+                            page * fd->block_size, buffers,
+                            fd->block_size, count);
+  }
+  for (p = 0; p < count; p++)
+  {
+    int ret = rtems_fdisk_seg_read_page (fd, sc, page + p, buffers[p]);
+    if (ret)
+      return ret;
+  }
+  return 0;
+}
+
+/**
+ * Write a run of contiguous pages of data to a segment. The run is
+ * written with one call if the driver has a write pages handler.
+ */
+static int
+rtems_fdisk_seg_write_pages (rtems_flashdisk*         fd,
+                             rtems_fdisk_segment_ctl* sc,
+                             uint32_t                 page,
+                             uint32_t                 count,
+                             const void* const*       buffers)
+{
+  const rtems_fdisk_driver_handlers* ops;
+  uint32_t                           p;
+  int                                ret;
+  ops = fd->devices[sc->device].descriptor->flash_ops;
+  if ((count > 1) && ops->write_pages)
+  {
+    const rtems_fdisk_segment_desc* sd;
+    if ((fd->flags & RTEMS_FDISK_BLANK_CHECK_BEFORE_WRITE))
+    {
+      ret = rtems_fdisk_seg_blank_check (fd, sc, page * fd->block_size,
+                                         count * fd->block_size);
+      if (ret)
+        return ret;
+    }
+    sd = rtems_fdisk_seg_descriptor (fd, sc->device, sc->segment);
+#if RTEMS_FDISK_TRACE
+    rtems_fdisk_printf (fd, "  seg-write-pages: %02d-%03d: o=%08x c=%d",
+                        sc->device, sc->segment, page * fd->block_size, count);
+#endif
+    fd->erased_blocks -= count;
+    fd->multi_page_writes++;
+    ret = ops->write_pages (sd, sc->device, sc->segment,
+                            page * fd->block_size, buffers,
+                            fd->block_size, count);
+    if (ret)
+      sc->failed = true;
+    return ret;
+  }
+  for (p = 0; p < count; p++)
+  {
+    ret = rtems_fdisk_seg_write_page (fd, sc, page + p, buffers[p]);
+    if (ret)
+      return ret;
+  }
+  return 0;
+}
+
 /**
  * Verify a page of data with the data in the segment.
  */
@@ -988,6 +1093,28 @@ rtems_fdisk_seg_write_page_desc (const rtems_flashdisk*       fd,
                                 page_desc, sizeof (rtems_fdisk_page_desc));
 }
 
+/**
+ * Write a run of page descriptors to a segment with one write. This code
+ * assumes the page descriptors are located at offset 0 in the segment.
+ */
+static int
+rtems_fdisk_seg_write_page_descs (const rtems_flashdisk*   fd,
+                                  rtems_fdisk_segment_ctl* sc,
+                                  uint32_t                 page,
+                                  uint32_t                 count)
+{
+  uint32_t offset = page * sizeof (rtems_fdisk_page_desc);
+  uint32_t size = count * sizeof (rtems_fdisk_page_desc);
+  if ((fd->flags & RTEMS_FDISK_BLANK_CHECK_BEFORE_WRITE))
+  {
+    int ret = rtems_fdisk_seg_blank_check (fd, sc, offset, size);
+    if (ret)
+      return ret;
+  }
+  return rtems_fdisk_seg_write (fd, sc, offset,
+                                &sc->page_descriptors[page], size);
+}
+
 /**
  * Write the page descriptor flags to a segment. This code assumes the page
  * descriptors are located at offset 0 in the segment.
@@ -1073,6 +1200,33 @@ rtems_fdisk_page_checksum (const uint8_t* buffer, uint32_t page_size)
   return cs;
 }
 
+/**
+ * Insert a segment into the available queue. The queue is sorted from the
+ * least number of available pages to the most and segments with the same
+ * number of available pages are sorted from the least number of erases to
+ * the most.
+ */
+static void
+rtems_fdisk_available_insert (rtems_flashdisk* fd, rtems_fdisk_segment_ctl* sc)
+{
+  rtems_fdisk_segment_ctl* seg = fd->available.head;
+  uint32_t                 available = rtems_fdisk_seg_pages_available (sc);
+
+  while (seg)
+  {
+    uint32_t seg_available = rtems_fdisk_seg_pages_available (seg);
+    if ((available < seg_available) ||
+        ((available == seg_available) && (sc->erased < seg->erased)))
+      break;
+    seg = seg->next;
+  }
+
+  if (seg)
+    rtems_fdisk_segment_queue_insert_before (&fd->available, seg, sc);
+  else
+    rtems_fdisk_segment_queue_push_tail (&fd->available, sc);
+}
+
 /**
  * Erase the segment.
  */
@@ -1112,11 +1266,11 @@ rtems_fdisk_erase_segment (rtems_flashdisk* fd, rtems_fdisk_segment_ctl* sc)
   sc->failed = false;
 
   /*
-   * Push to the tail of the available queue. It is a very
-   * simple type of wear reduction. Every other available
-   * segment will now get a go.
+   * Place the segment behind the empty segments that have been
+   * erased fewer times. Every less worn available segment will
+   * get a go first.
    */
-  rtems_fdisk_segment_queue_push_tail (&fd->available, sc);
+  rtems_fdisk_available_insert (fd, sc);
 
   return 0;
 }
@@ -1228,37 +1382,20 @@ rtems_fdisk_queue_segment (rtems_flashdisk* fd, rtems_fdisk_segment_ctl* sc)
      * empty segments longer aiding compaction.
      *
      * The down side is the wear effect as a single segment
-     * could be used more than segment. This will not be
-     * addressed until wear support is added.
-     *
-     * @note Wear support can be added by having counts for
-     * for the number of times a segment is erased. This
-     * available list is then sorted on the least number
-     * of available pages then empty segments are sorted
-     * on the least number of erases the segment has.
+     * could be used more than segment. Segments with the same
+     * number of available pages are sorted on the least number
+     * of erases so the least worn empty segment is used first.
      *
-     * The erase count can be stored in specially flaged
-     * pages and contain a counter (32bits?) and 32 bits
-     * for each segment. When a segment is erased a
+     * @note The erase counts are held in memory and start at 0
+     * when the driver is initialised. They can be stored in
+     * specially flaged pages and contain a counter (32bits?)
+     * and 32 bits for each segment. When a segment is erased a
      * bit is cleared for that segment. When 32 erasers
      * has occurred the page is re-written to the flash
      * with all the counters updated with the number of
      * bits cleared and all bits set back to 1.
      */
-    rtems_fdisk_segment_ctl* seg = fd->available.head;
-
-    while (seg)
-    {
-      if (rtems_fdisk_seg_pages_available (sc) <
-          rtems_fdisk_seg_pages_available (seg))
-        break;
-      seg = seg->next;
-    }
-
-    if (seg)
-      rtems_fdisk_segment_queue_insert_before (&fd->available, seg, sc);
-    else
-      rtems_fdisk_segment_queue_push_tail (&fd->available, sc);
+    rtems_fdisk_available_insert (fd, sc);
   }
 }
 
@@ -1734,366 +1871,561 @@ rtems_fdisk_recover_block_mappings (rtems_flashdisk* fd)
 }
 
 /**
- * Read a block. The block is checked to see if the page referenced
- * is valid and the page has a valid crc.
+ * Read a run of blocks. The pages referenced are checked to see if they
+ * are valid and have a valid crc. Blocks held in contiguous pages of a
+ * segment are read with a single segment read.
  *
  * @param fd The rtems_flashdisk control table.
- * @param block The block number to read.
- * @param buffer The buffer to write the data into.
+ * @param block The first block number to read.
+ * @param count The number of blocks to read.
+ * @param buffers The buffer for each block to write the data into.
  * @return 0 No error.
  * @return EIO Invalid block size, block number, segment pointer, crc,
  *             page flags.
  */
-static bool
-rtems_fdisk_read_block (rtems_flashdisk* fd,
-                        uint32_t         block,
-                        uint8_t*         buffer)
+static int
+rtems_fdisk_read_blocks (rtems_flashdisk* fd,
+                         uint32_t         block,
+                         uint32_t         count,
+                         void* const*     buffers)
 {
-  rtems_fdisk_block_ctl*   bc;
-  rtems_fdisk_segment_ctl* sc;
-  rtems_fdisk_page_desc*   pd;
-
 #if RTEMS_FDISK_TRACE
-  rtems_fdisk_info (fd, "read-block:%d", block);
+  rtems_fdisk_info (fd, "read-blocks:%d-%d", block, count);
 #endif
 
   /*
    * Broken out to allow info messages when testing.
    */
 
-  if (block >= (fd->block_count - fd->unavail_blocks))
+  if ((block >= (fd->block_count - fd->unavail_blocks)) ||
+      (count > ((fd->block_count - fd->unavail_blocks) - block)))
   {
     rtems_fdisk_error ("read-block: block out of range: %d", block);
     return EIO;
   }
 
-  bc = &fd->blocks[block];
-
-  if (!bc->segment)
+  while (count)
   {
-#if RTEMS_FDISK_TRACE
-    rtems_fdisk_info (fd, "read-block: no segment mapping: %d", block);
-#endif
-    memset (buffer, 0xff, fd->block_size);
-    return 0;
-  }
+    rtems_fdisk_block_ctl*   bc;
+    rtems_fdisk_segment_ctl* sc;
+    uint32_t                 run;
+    uint32_t                 b;
+    int                      ret;
 
-  sc = fd->blocks[block].segment;
-  pd = &sc->page_descriptors[bc->page];
+    bc = &fd->blocks[block];
 
+    if (!bc->segment)
+    {
 #if RTEMS_FDISK_TRACE
-  rtems_fdisk_info (fd,
-                    " read:%d=>%02d-%03d-%03d: p=%d a=%d u=%d b=%d n=%s: " \
-                    "f=%04x c=%04x b=%d",
-                    block, sc->device, sc->segment, bc->page,
-                    sc->pages, sc->pages_active, sc->pages_used, sc->pages_bad,
-                    sc->next ? "set" : "null",
-                    pd->flags, pd->crc, pd->block);
+      rtems_fdisk_info (fd, "read-block: no segment mapping: %d", block);
 #endif
+      memset (buffers[0], 0xff, fd->block_size);
+      block++;
+      buffers++;
+      count--;
+      continue;
+    }
 
-  if (rtems_fdisk_page_desc_flags_set (pd, RTEMS_FDISK_PAGE_ACTIVE))
-  {
-    if (rtems_fdisk_page_desc_flags_clear (pd, RTEMS_FDISK_PAGE_USED))
+    sc = bc->segment;
+
+    /*
+     * Extend the run over the following blocks held in the next pages
+     * of the same segment.
+     */
+    for (run = 0; run < count; run++)
     {
-      uint16_t cs;
+      rtems_fdisk_block_ctl* rbc = &fd->blocks[block + run];
+      rtems_fdisk_page_desc* pd;
 
-      /*
-       * We use the segment page offset not the page number used in the
-       * driver. This skips the page descriptors.
-       */
-      int ret = rtems_fdisk_seg_read_page (fd, sc,
-                                           bc->page + sc->pages_desc, buffer);
+      if ((rbc->segment != sc) || (rbc->page != (bc->page + run)))
+        break;
+
+      pd = &sc->page_descriptors[rbc->page];
 
-      if (ret)
-      {
 #if RTEMS_FDISK_TRACE
-        rtems_fdisk_info (fd,
-                          "read-block:%02d-%03d-%03d: read page failed: %s (%d)",
-                          sc->device, sc->segment, bc->page,
-                          strerror (ret), ret);
+      rtems_fdisk_info (fd,
+                        " read:%d=>%02d-%03d-%03d: p=%d a=%d u=%d b=%d n=%s: " \
+                        "f=%04x c=%04x b=%d",
+                        block + run, sc->device, sc->segment, rbc->page,
+                        sc->pages, sc->pages_active, sc->pages_used,
+                        sc->pages_bad, sc->next ? "set" : "null",
+                        pd->flags, pd->crc, pd->block);
 #endif
-        return ret;
+
+      if (!rtems_fdisk_page_desc_flags_set (pd, RTEMS_FDISK_PAGE_ACTIVE))
+      {
+        rtems_fdisk_error ("read-block: block page not active: %d: %d-%d-%d",
+                           block + run, sc->device, sc->segment, rbc->page);
+        return EIO;
       }
 
-      cs = rtems_fdisk_page_checksum (buffer, fd->block_size);
+      if (!rtems_fdisk_page_desc_flags_clear (pd, RTEMS_FDISK_PAGE_USED))
+      {
+        rtems_fdisk_error ("read-block: block points to used page: %d: %d-%d-%d",
+                           block + run, sc->device, sc->segment, rbc->page);
+        return EIO;
+      }
+    }
 
-      if (cs == pd->crc)
-        return 0;
+    /*
+     * We use the segment page offset not the page number used in the
+     * driver. This skips the page descriptors.
+     */
+    ret = rtems_fdisk_seg_read_pages (fd, sc, bc->page + sc->pages_desc,
+                                      run, buffers);
 
-      rtems_fdisk_error ("read-block: crc failure: %d: buffer:%04x page:%04x",
-                         block, cs, pd->crc);
+    if (ret)
+    {
+#if RTEMS_FDISK_TRACE
+      rtems_fdisk_info (fd,
+                        "read-block:%02d-%03d-%03d: read page failed: %s (%d)",
+                        sc->device, sc->segment, bc->page,
+                        strerror (ret), ret);
+#endif
+      return ret;
     }
-    else
+
+    for (b = 0; b < run; b++)
     {
-      rtems_fdisk_error ("read-block: block points to used page: %d: %d-%d-%d",
-                         block, sc->device, sc->segment, bc->page);
+      rtems_fdisk_page_desc* pd = &sc->page_descriptors[bc->page + b];
+      uint16_t               cs;
+
+      cs = rtems_fdisk_page_checksum (buffers[b], fd->block_size);
+
+      if (cs != pd->crc)
+      {
+        rtems_fdisk_error ("read-block: crc failure: %d: buffer:%04x page:%04x",
+                           block + b, cs, pd->crc);
+        return EIO;
+      }
     }
+
+    block += run;
+    buffers += run;
+    count -= run;
   }
-  else
+
+  return 0;
+}
+
+/**
+ * Erase the segments waiting to be erased if the disk is short of available
+ * segments then compact the disk. This is called from the write path and
+ * the time taken is recorded as write stall time.
+ */
+static int
+rtems_fdisk_compact_inline (rtems_flashdisk* fd)
+{
+  uint64_t start;
+  int      ret;
+
+  start = rtems_clock_get_uptime_nanoseconds ();
+
+  if (fd->erase.head &&
+      (rtems_fdisk_segment_count_queue (&fd->available) <=
+       fd->avail_compact_segs))
+    rtems_fdisk_erase_used (fd);
+
+  if (fd->used.head || rtems_fdisk_is_erased_blocks_starvation (fd))
+    fd->compactions++;
+
+  ret = rtems_fdisk_compact (fd);
+
+  fd->compact_stall_time += rtems_clock_get_uptime_nanoseconds () - start;
+
+  return ret;
+}
+
+/**
+ * Check if the page currently holding a block has the data to be written.
+ *
+ * @param fd The rtems_flashdisk control table.
+ * @param block The block number to check.
+ * @param buffer The data to be written to the block.
+ * @retval true The data in flash matches and the block need not be written.
+ * @retval false The block needs to be written.
+ */
+static bool
+rtems_fdisk_verify_block (rtems_flashdisk* fd,
+                          uint32_t         block,
+                          const void*      buffer)
+{
+  rtems_fdisk_block_ctl*   bc = &fd->blocks[block];
+  rtems_fdisk_segment_ctl* sc;
+
+  /*
+   * Does the page exist in flash ?
+   */
+  if (!bc->segment)
+    return false;
+
+  sc = bc->segment;
+
+  /*
+   * The page exists in flash so see if the page has been changed.
+   */
+  if (rtems_fdisk_seg_verify_page (fd, sc->device, sc->segment,
+                                   bc->page + sc->pages_desc, buffer) == 0)
   {
-    rtems_fdisk_error ("read-block: block page not active: %d: %d-%d-%d",
-                       block, sc->device, sc->segment, bc->page);
+#if RTEMS_FDISK_TRACE
+    rtems_fdisk_info (fd, "write-block:%d=>%02d-%03d-%03d: page verified",
+                      block, sc->device, sc->segment, bc->page);
+#endif
+    return true;
   }
 
-  return EIO;
+  return false;
 }
 
 /**
- * Write a block. The block:
- *
- *  # May never have existed in flash before this write.
- *  # Exists and needs to be moved to a new page.
- *
- * If the block does not exist in flash we need to get the next
- * segment available to place the page into. The segments with
- * available pages are held on the avaliable list sorted on least
- * number of available pages as the primary key. Currently there
- * is no secondary key. Empty segments are at the end of the list.
+ * Release the page holding a block once the new page of the block has been
+ * written.
  *
- * If the block already exists we need to set the USED bit in the
+ * We need to set the USED bit in the
  * current page's flags. This is a single byte which changes a 1 to
  * a 0 and can be done with a single 16 bit write. The driver for
  * 8 bit devices should only attempt the write on the changed bit.
  *
+ * The segment of the released page is queued but not compacted, the caller
+ * compacts once all blocks of a run point to their new pages.
+ *
  * @param fd The rtems_flashdisk control table.
- * @param block The block number to read.
- * @param block_size The size of the block. Must match what we have.
- * @param buffer The buffer to write the data into.
- * @return 0 No error.
- * @return EIO Invalid block size, block number, segment pointer, crc,
- *             page flags.
+ * @param bc The control of the block to release.
  */
-static int
-rtems_fdisk_write_block (rtems_flashdisk* fd,
-                         uint32_t         block,
-                         const uint8_t*   buffer)
+static void
+rtems_fdisk_release_block (rtems_flashdisk* fd, rtems_fdisk_block_ctl* bc)
 {
-  rtems_fdisk_block_ctl*   bc;
   rtems_fdisk_segment_ctl* sc;
   rtems_fdisk_page_desc*   pd;
-  uint32_t                 page;
   int                      ret;
 
+  sc = bc->segment;
+  pd = &sc->page_descriptors[bc->page];
+
 #if RTEMS_FDISK_TRACE
-  rtems_fdisk_info (fd, "write-block:%d", block);
+  rtems_fdisk_info (fd, " write:%02d-%03d-%03d: flag used",
+                    sc->device, sc->segment, bc->page);
 #endif
 
   /*
-   * Broken out to allow info messages when testing.
+   * The page exists in flash so we need to set the used flag
+   * in the page descriptor. The descriptor is in memory with the
+   * segment control block. We can assume this memory copy
+   * matches the flash device.
    */
 
-  if (block >= (fd->block_count - fd->unavail_blocks))
+  rtems_fdisk_page_desc_set_flags (pd, RTEMS_FDISK_PAGE_USED);
+
+  ret = rtems_fdisk_seg_write_page_desc_flags (fd, sc, bc->page, pd);
+
+  if (ret)
   {
-    rtems_fdisk_error ("write-block: block out of range: %d", block);
-    return EIO;
+#if RTEMS_FDISK_TRACE
+    rtems_fdisk_info (fd, " write:%02d-%03d-%03d: "      \
+                      "write used page desc failed: %s (%d)",
+                      sc->device, sc->segment, bc->page,
+                      strerror (ret), ret);
+#endif
+  }
+  else
+  {
+    sc->pages_active--;
+    sc->pages_used++;
   }
 
-  bc = &fd->blocks[block];
+  bc->segment = NULL;
 
   /*
-   * Does the page exist in flash ?
+   * If possible reuse this segment. This will mean the segment
+   * needs to be removed from the available list and placed
+   * back if space is still available.
    */
-  if (bc->segment)
+  rtems_fdisk_queue_segment (fd, sc);
+}
+
+/**
+ * Write a run of blocks. The blocks need not be consecutive. The old page of
+ * a block is released once its new page and page descriptor are written, so
+ * a failed write leaves the block in its old page.
+ *
+ * We need to get the next segment available to place the pages into. The
+ * segments with available pages are held on the avaliable list sorted on
+ * least number of available pages as the primary key and the least number
+ * of erases as the secondary key. Empty segments are at the end of the
+ * list. As many blocks as there are erased pages following the first
+ * erased page of the segment are written with a single segment write
+ * followed by a single write of their page descriptors.
+ *
+ * @param fd The rtems_flashdisk control table.
+ * @param blocks The block numbers to write.
+ * @param buffers The data for each block.
+ * @param count The number of blocks.
+ * @return 0 No error.
+ * @return EIO Invalid block size, block number, segment pointer, crc,
+ *             page flags.
+ * @return ENOSPC No available pages.
+ */
+static int
+rtems_fdisk_write_run (rtems_flashdisk*   fd,
+                       const uint32_t*    blocks,
+                       const void* const* buffers,
+                       uint32_t           count)
+{
+  while (count)
   {
-    sc = bc->segment;
-    pd = &sc->page_descriptors[bc->page];
+    rtems_fdisk_segment_ctl* sc;
+    rtems_fdisk_page_desc*   pd;
+    uint32_t                 page;
+    uint32_t                 pages;
+    uint32_t                 p;
+    bool                     released = false;
+    int                      ret;
 
-#if RTEMS_FDISK_TRACE
-    rtems_fdisk_info (fd, " write:%02d-%03d-%03d: flag used",
-                      sc->device, sc->segment, bc->page);
-#endif
+    /*
+     * Is it time to compact the disk ?
+     *
+     * We override the background compaction configruation.
+     */
+    if (rtems_fdisk_segment_count_queue (&fd->available) <=
+        fd->avail_compact_segs)
+      rtems_fdisk_compact_inline (fd);
 
     /*
-     * The page exists in flash so see if the page has been changed.
+     * Get the next avaliable segment.
      */
-    if (rtems_fdisk_seg_verify_page (fd, sc->device, sc->segment,
-                                     bc->page + sc->pages_desc, buffer) == 0)
-    {
-#if RTEMS_FDISK_TRACE
-      rtems_fdisk_info (fd, "write-block:%d=>%02d-%03d-%03d: page verified",
-                        block, sc->device, sc->segment, bc->page);
-#endif
-      return 0;
-    }
+    sc = rtems_fdisk_segment_queue_pop_head (&fd->available);
 
     /*
-     * The page exists in flash so we need to set the used flag
-     * in the page descriptor. The descriptor is in memory with the
-     * segment control block. We can assume this memory copy
-     * matches the flash device.
+     * Is the flash disk full ?
      */
+    if (!sc)
+    {
+      /*
+       * If compacting or erasing is configured for the background do it
+       * now to see if we can get some space back.
+       */
+      if ((fd->flags & (RTEMS_FDISK_BACKGROUND_COMPACT |
+                        RTEMS_FDISK_BACKGROUND_ERASE)))
+        rtems_fdisk_compact_inline (fd);
 
-    rtems_fdisk_page_desc_set_flags (pd, RTEMS_FDISK_PAGE_USED);
+      /*
+       * Try again for some free space.
+       */
+      sc = rtems_fdisk_segment_queue_pop_head (&fd->available);
 
-    ret = rtems_fdisk_seg_write_page_desc_flags (fd, sc, bc->page, pd);
+      if (!sc)
+      {
+        rtems_fdisk_error ("write-block: no available pages");
+        return ENOSPC;
+      }
+    }
 
-    if (ret)
-    {
 #if RTEMS_FDISK_TRACE
-      rtems_fdisk_info (fd, " write:%02d-%03d-%03d: "      \
-                        "write used page desc failed: %s (%d)",
-                        sc->device, sc->segment, bc->page,
-                        strerror (ret), ret);
-#endif
-    }
-    else
+    if (fd->info_level >= 3)
     {
-      sc->pages_active--;
-      sc->pages_used++;
+      char queues[5];
+      rtems_fdisk_queue_status (fd, sc, queues);
+      rtems_fdisk_info (fd, " write:%d=>%02d-%03d: queue check: %s",
+                        blocks[0], sc->device, sc->segment, queues);
     }
+#endif
 
     /*
-     * If possible reuse this segment. This will mean the segment
-     * needs to be removed from the available list and placed
-     * back if space is still available.
-     */
-    rtems_fdisk_queue_segment (fd, sc);
-
-    /*
-     * If no background compacting then compact in the forground.
-     * If we compact we ignore the error as there is little we
-     * can do from here. The write may will work.
-     */
-    if ((fd->flags & RTEMS_FDISK_BACKGROUND_COMPACT) == 0)
-      rtems_fdisk_compact (fd);
-  }
-
-  /*
-   * Is it time to compact the disk ?
-   *
-   * We override the background compaction configruation.
-   */
-  if (rtems_fdisk_segment_count_queue (&fd->available) <=
-      fd->avail_compact_segs)
-    rtems_fdisk_compact (fd);
-
-  /*
-   * Get the next avaliable segment.
-   */
-  sc = rtems_fdisk_segment_queue_pop_head (&fd->available);
-
-  /*
-   * Is the flash disk full ?
-   */
-  if (!sc)
-  {
-    /*
-     * If compacting is configured for the background do it now
-     * to see if we can get some space back.
+     * Find the next avaliable page in the segment and the number of
+     * erased pages that follow it.
      */
-    if ((fd->flags & RTEMS_FDISK_BACKGROUND_COMPACT))
-      rtems_fdisk_compact (fd);
 
-    /*
-     * Try again for some free space.
-     */
-    sc = rtems_fdisk_segment_queue_pop_head (&fd->available);
+    for (page = 0; page < sc->pages; page++)
+      if (rtems_fdisk_page_desc_erased (&sc->page_descriptors[page]))
+        break;
 
-    if (!sc)
+    if (page == sc->pages)
     {
-      rtems_fdisk_error ("write-block: no available pages");
-      return ENOSPC;
-    }
-  }
+      rtems_fdisk_error ("write-block: no erased page descs in segment: %d-%d",
+                         sc->device, sc->segment);
 
-#if RTEMS_FDISK_TRACE
-  if (fd->info_level >= 3)
-  {
-    char queues[5];
-    rtems_fdisk_queue_status (fd, sc, queues);
-    rtems_fdisk_info (fd, " write:%d=>%02d-%03d: queue check: %s",
-                      block, sc->device, sc->segment, queues);
-  }
-#endif
+      sc->failed = true;
+      rtems_fdisk_queue_segment (fd, sc);
 
-  /*
-   * Find the next avaliable page in the segment.
-   */
+      return EIO;
+    }
 
-  pd = sc->page_descriptors;
+    for (pages = 1; (pages < count) && ((page + pages) < sc->pages); pages++)
+      if (!rtems_fdisk_page_desc_erased (&sc->page_descriptors[page + pages]))
+        break;
 
-  for (page = 0; page < sc->pages; page++, pd++)
-  {
-    if (rtems_fdisk_page_desc_erased (pd))
+    for (p = 0; p < pages; p++)
     {
-      pd->crc   = rtems_fdisk_page_checksum (buffer, fd->block_size);
-      pd->block = block;
-
-      bc->segment = sc;
-      bc->page    = page;
+      pd = &sc->page_descriptors[page + p];
+      pd->crc   = rtems_fdisk_page_checksum (buffers[p], fd->block_size);
+      pd->block = blocks[p];
 
       rtems_fdisk_page_desc_set_flags (pd, RTEMS_FDISK_PAGE_ACTIVE);
 
 #if RTEMS_FDISK_TRACE
       rtems_fdisk_info (fd, " write:%d=>%02d-%03d-%03d: write: " \
                         "p=%d a=%d u=%d b=%d n=%s: f=%04x c=%04x b=%d",
-                        block, sc->device, sc->segment, page,
+                        blocks[p], sc->device, sc->segment, page + p,
                         sc->pages, sc->pages_active, sc->pages_used,
                         sc->pages_bad, sc->next ? "set" : "null",
                         pd->flags, pd->crc, pd->block);
 #endif
+    }
 
-      /*
-       * We use the segment page offset not the page number used in the
-       * driver. This skips the page descriptors.
-       */
-      ret = rtems_fdisk_seg_write_page (fd, sc, page + sc->pages_desc, buffer);
+    /*
+     * We use the segment page offset not the page number used in the
+     * driver. This skips the page descriptors.
+     */
+    ret = rtems_fdisk_seg_write_pages (fd, sc, page + sc->pages_desc,
+                                       pages, buffers);
+    if (ret)
+    {
+#if RTEMS_FDISK_TRACE
+      rtems_fdisk_info (fd, "write-block:%02d-%03d-%03d: write page failed: " \
+                        "%s (%d)", sc->device, sc->segment, page,
+                        strerror (ret), ret);
+#endif
+    }
+    else
+    {
+      ret = rtems_fdisk_seg_write_page_descs (fd, sc, page, pages);
       if (ret)
       {
 #if RTEMS_FDISK_TRACE
-        rtems_fdisk_info (fd, "write-block:%02d-%03d-%03d: write page failed: " \
-                          "%s (%d)", sc->device, sc->segment, page,
+        rtems_fdisk_info (fd, "write-block:%02d-%03d-%03d: "  \
+                          "write page desc failed: %s (%d)",
+                          sc->device, sc->segment, page,
                           strerror (ret), ret);
 #endif
       }
-      else
+    }
+
+    if (ret)
+    {
+      /*
+       * The blocks stay in their old pages. Do not let a compaction move
+       * the pages which may be partially written.
+       */
+      for (p = 0; p < pages; p++)
+        rtems_fdisk_page_desc_set_flags (&sc->page_descriptors[page + p],
+                                         RTEMS_FDISK_PAGE_USED);
+      sc->pages_used += pages;
+    }
+    else
+    {
+      /*
+       * Account for the new pages first so the segment is not erased if an
+       * old page in this segment is released.
+       */
+      sc->pages_active += pages;
+
+      for (p = 0; p < pages; p++)
       {
-        ret = rtems_fdisk_seg_write_page_desc (fd, sc, page, pd);
-        if (ret)
-        {
-#if RTEMS_FDISK_TRACE
-          rtems_fdisk_info (fd, "write-block:%02d-%03d-%03d: "  \
-                            "write page desc failed: %s (%d)",
-                            sc->device, sc->segment, bc->page,
-                            strerror (ret), ret);
-#endif
-        }
-        else
+        rtems_fdisk_block_ctl* bc = &fd->blocks[blocks[p]];
+
+        /*
+         * The block may never have existed in flash before this write.
+         */
+        if (bc->segment)
         {
-          sc->pages_active++;
+          rtems_fdisk_release_block (fd, bc);
+          released = true;
         }
+
+        bc->segment = sc;
+        bc->page    = page + p;
       }
+    }
 
-      rtems_fdisk_queue_segment (fd, sc);
+    rtems_fdisk_queue_segment (fd, sc);
 
-      if (rtems_fdisk_is_erased_blocks_starvation (fd))
-        rtems_fdisk_compact (fd);
+    /*
+     * If no background compacting then compact in the forground.
+     * If we compact we ignore the error as there is little we
+     * can do from here. The write may will work.
+     */
+    if (released && ((fd->flags & RTEMS_FDISK_BACKGROUND_COMPACT) == 0))
+      rtems_fdisk_compact_inline (fd);
+
+    if (rtems_fdisk_is_erased_blocks_starvation (fd))
+      rtems_fdisk_compact_inline (fd);
 
+    if (ret)
       return ret;
-    }
+
+    blocks += pages;
+    buffers += pages;
+    count -= pages;
   }
 
-  rtems_fdisk_error ("write-block: no erased page descs in segment: %d-%d",
-                     sc->device, sc->segment);
+  return 0;
+}
 
-  sc->failed = true;
-  rtems_fdisk_queue_segment (fd, sc);
+/**
+ * Write a run of consecutive blocks. Blocks whose data has not changed are
+ * skipped and the remaining blocks are written as a run.
+ *
+ * @param fd The rtems_flashdisk control table.
+ * @param block The first block number to write.
+ * @param count The number of blocks to write, no more than
+ *              RTEMS_FDISK_RUN_PAGES.
+ * @param buffers The data for each block.
+ * @return 0 No error.
+ * @return EIO Invalid block size, block number, segment pointer, crc,
+ *             page flags.
+ * @return ENOSPC No available pages.
+ */
+static int
+rtems_fdisk_write_blocks (rtems_flashdisk*   fd,
+                          uint32_t           block,
+                          uint32_t           count,
+                          const void* const* buffers)
+{
+  uint32_t    run_blocks[RTEMS_FDISK_RUN_PAGES];
+  const void* run_buffers[RTEMS_FDISK_RUN_PAGES];
+  uint32_t    run = 0;
+  uint32_t    b;
+
+#if RTEMS_FDISK_TRACE
+  rtems_fdisk_info (fd, "write-blocks:%d-%d", block, count);
+#endif
+
+  /*
+   * Broken out to allow info messages when testing.
+   */
+
+  if ((block >= (fd->block_count - fd->unavail_blocks)) ||
+      (count > ((fd->block_count - fd->unavail_blocks) - block)))
+  {
+    rtems_fdisk_error ("write-block: block out of range: %d", block);
+    return EIO;
+  }
+
+  for (b = 0; b < count; b++)
+  {
+    if (!rtems_fdisk_verify_block (fd, block + b, buffers[b]))
+    {
+      run_blocks[run] = block + b;
+      run_buffers[run] = buffers[b];
+      run++;
+    }
+  }
 
-  return EIO;
+  return rtems_fdisk_write_run (fd, run_blocks, run_buffers, run);
 }
 
 /**
- * Disk READ request handler. This primitive copies data from the
- * flash disk to the supplied buffer and invoke the callout function
- * to inform upper layer that reading is completed.
- *
- * @param req Pointer to the READ block device request info.
- * @retval 0 Always.  The request done callback contains the status.
+ * Transfer the blocks of a request in runs of consecutive block numbers.
+ * Scatter gather buffers holding consecutive blocks are merged into a run
+ * of up to RTEMS_FDISK_RUN_PAGES blocks.
  */
 static int
-rtems_fdisk_read (rtems_flashdisk* fd, rtems_blkdev_request* req)
+rtems_fdisk_transfer (rtems_flashdisk* fd, rtems_blkdev_request* req)
 {
   rtems_blkdev_sg_buffer* sg = req->bufs;
+  void*                   buffers[RTEMS_FDISK_RUN_PAGES];
+  uint32_t                first = 0;
+  uint32_t                run = 0;
   uint32_t                buf;
   int                     ret = 0;
 
@@ -2104,23 +2436,74 @@ rtems_fdisk_read (rtems_flashdisk* fd, rtems_blkdev_request* req)
     uint32_t b;
     fb = sg->length / fd->block_size;
     data = sg->buffer;
-    for (b = 0; b < fb; b++, data += fd->block_size)
+    for (b = 0; (ret == 0) && (b < fb); b++, data += fd->block_size)
     {
-      ret = rtems_fdisk_read_block (fd, sg->block + b, data);
-      if (ret)
-        break;
+      if ((run == RTEMS_FDISK_RUN_PAGES) ||
+          ((run > 0) && ((first + run) != (sg->block + b))))
+      {
+        if (req->req == RTEMS_BLKDEV_REQ_READ)
+          ret = rtems_fdisk_read_blocks (fd, first, run, buffers);
+        else
+          ret = rtems_fdisk_write_blocks (fd, first, run,
+                                          (const void* const*) buffers);
+        run = 0;
+      }
+      if (run == 0)
+        first = sg->block + b;
+      buffers[run++] = data;
     }
   }
 
+  if ((ret == 0) && (run > 0))
+  {
+    if (req->req == RTEMS_BLKDEV_REQ_READ)
+      ret = rtems_fdisk_read_blocks (fd, first, run, buffers);
+    else
+      ret = rtems_fdisk_write_blocks (fd, first, run,
+                                      (const void* const*) buffers);
+  }
+
+  return ret;
+}
+
+/**
+ * Disk READ request handler. This primitive copies data from the
+ * flash disk to the supplied buffer and invoke the callout function
+ * to inform upper layer that reading is completed.
+ *
+ * @param req Pointer to the READ block device request info.
+ * @retval 0 Always.  The request done callback contains the status.
+ */
+static int
+rtems_fdisk_read (rtems_flashdisk* fd, rtems_blkdev_request* req)
+{
+  int ret = rtems_fdisk_transfer (fd, req);
+
   rtems_blkdev_request_done (req, ret ? RTEMS_IO_ERROR : RTEMS_SUCCESSFUL);
 
   return 0;
 }
 
+/**
+ * Does the background task have work to do ?
+ */
+static bool
+rtems_fdisk_background_work (rtems_flashdisk* fd)
+{
+  if (fd->erase.head)
+    return true;
+  if ((fd->flags & RTEMS_FDISK_BACKGROUND_COMPACT) && fd->used.head &&
+      (rtems_fdisk_segment_count_queue (&fd->available) <=
+       (fd->avail_compact_segs + fd->compact_segs)))
+    return true;
+  return false;
+}
+
 /**
  * Flash disk WRITE request handler. This primitive copies data from
  * supplied buffer to flash disk and invoke the callout function to inform
- * upper layer that writing is completed.
+ * upper layer that writing is completed. The background task is woken if
+ * there are segments to erase or compact.
  *
  * @param req Pointers to the WRITE block device request info.
  * @retval 0 Always.  The request done callback contains the status.
@@ -2128,24 +2511,11 @@ rtems_fdisk_read (rtems_flashdisk* fd, rtems_blkdev_request* req)
 static int
 rtems_fdisk_write (rtems_flashdisk* fd, rtems_blkdev_request* req)
 {
-  rtems_blkdev_sg_buffer* sg = req->bufs;
-  uint32_t                buf;
-  int                     ret = 0;
+  int ret = rtems_fdisk_transfer (fd, req);
 
-  for (buf = 0; (ret == 0) && (buf < req->bufnum); buf++, sg++)
-  {
-    uint8_t* data;
-    uint32_t fb;
-    uint32_t b;
-    fb = sg->length / fd->block_size;
-    data = sg->buffer;
-    for (b = 0; b < fb; b++, data += fd->block_size)
-    {
-      ret = rtems_fdisk_write_block (fd, sg->block + b, data);
-      if (ret)
-        break;
-    }
-  }
+  if ((fd->background_task != 0) && rtems_fdisk_background_work (fd))
+    (void) rtems_event_system_send (fd->background_task,
+                                    RTEMS_EVENT_SYSTEM_SERVER);
 
   rtems_blkdev_request_done (req, ret ? RTEMS_IO_ERROR : RTEMS_SUCCESSFUL);
 
@@ -2237,6 +2607,53 @@ rtems_fdisk_monitoring_data (rtems_flashdisk*          fd,
   }
 
   data->info_level = fd->info_level;
+
+  data->compactions            = fd->compactions;
+  data->background_compactions = fd->background_compactions;
+  data->background_erases      = fd->background_erases;
+  data->multi_page_reads       = fd->multi_page_reads;
+  data->multi_page_writes      = fd->multi_page_writes;
+  data->compact_stall_time     = fd->compact_stall_time;
+  return 0;
+}
+
+/**
+ * Flash Disk Erase Counts are returned in the erase counts structure.
+ */
+static int
+rtems_fdisk_erase_count_data (rtems_flashdisk*          fd,
+                              rtems_fdisk_erase_counts* counts)
+{
+  uint32_t i;
+  uint32_t j;
+  uint32_t n = 0;
+
+  counts->segment_count = 0;
+  counts->min           = UINT32_MAX;
+  counts->max           = 0;
+  counts->total         = 0;
+
+  for (i = 0; i < fd->device_count; i++)
+  {
+    counts->segment_count += fd->devices[i].segment_count;
+
+    for (j = 0; j < fd->devices[i].segment_count; j++, n++)
+    {
+      uint32_t erased = fd->devices[i].segments[j].erased;
+
+      if (counts->counts && (n < counts->counts_size))
+        counts->counts[n] = erased;
+      if (erased < counts->min)
+        counts->min = erased;
+      if (erased > counts->max)
+        counts->max = erased;
+      counts->total += erased;
+    }
+  }
+
+  if (counts->segment_count == 0)
+    counts->min = 0;
+
   return 0;
 }
 
@@ -2442,6 +2859,11 @@ rtems_fdisk_ioctl (rtems_disk_device *dd, uint32_t req, void* argp)
       errno = rtems_fdisk_print_status (fd);
       break;
 
+    case RTEMS_FDISK_IOCTL_ERASE_COUNTS:
+      errno = rtems_fdisk_erase_count_data (fd,
+                                            (rtems_fdisk_erase_counts*) argp);
+      break;
+
     default:
       rtems_blkdev_ioctl (dd, req, argp);
       break;
@@ -2452,6 +2874,102 @@ rtems_fdisk_ioctl (rtems_disk_device *dd, uint32_t req, void* argp)
   return errno == 0 ? 0 : -1;
 }
 
+/**
+ * The background task erases the segments on the erase queue and compacts
+ * the disk before the write path needs to. It is woken by the write
+ * request handler and erases one segment for each hold of the lock so
+ * requests are not held off for more than one segment erase.
+ */
+static void
+rtems_fdisk_background_task (rtems_task_argument arg)
+{
+  rtems_flashdisk* fd = (rtems_flashdisk*) arg;
+
+  while (true)
+  {
+    rtems_event_set events;
+    bool            compacted = false;
+    bool            work;
+
+    (void) rtems_event_system_receive (RTEMS_EVENT_SYSTEM_SERVER,
+                                       RTEMS_EVENT_ALL | RTEMS_WAIT,
+                                       RTEMS_NO_TIMEOUT,
+                                       &events);
+
+    do
+    {
+      rtems_fdisk_segment_ctl* sc;
+
+      rtems_mutex_lock (&fd->lock);
+
+      sc = rtems_fdisk_segment_queue_pop_head (&fd->erase);
+      if (sc)
+      {
+        if (rtems_fdisk_erase_segment (fd, sc) == 0)
+          fd->background_erases++;
+      }
+      else if (!compacted && rtems_fdisk_background_work (fd))
+      {
+        fd->background_compactions++;
+        rtems_fdisk_compact (fd);
+        compacted = true;
+      }
+
+      work = (fd->erase.head != NULL) ||
+        (!compacted && rtems_fdisk_background_work (fd));
+
+      rtems_mutex_unlock (&fd->lock);
+    } while (work);
+  }
+}
+
+/**
+ * Create and start the background task if the disk is configured to erase
+ * or compact in the background. The disk still works without the task as
+ * the write path erases and compacts when it runs short of segments.
+ */
+static void
+rtems_fdisk_background_start (rtems_flashdisk*              fd,
+                              const rtems_flashdisk_config* c)
+{
+  rtems_task_priority priority;
+  rtems_status_code   sc;
+
+  if ((fd->flags & (RTEMS_FDISK_BACKGROUND_ERASE |
+                    RTEMS_FDISK_BACKGROUND_COMPACT)) == 0)
+    return;
+
+  priority = c->background_priority;
+  if (priority == 0)
+    priority = RTEMS_FDISK_BACKGROUND_PRIORITY_DEFAULT;
+
+  sc = rtems_task_create (rtems_build_name ('F', 'D', 'B', 'a' + fd->minor),
+                          priority,
+                          RTEMS_MINIMUM_STACK_SIZE,
+                          RTEMS_DEFAULT_MODES,
+                          RTEMS_DEFAULT_ATTRIBUTES,
+                          &fd->background_task);
+  if (sc == RTEMS_SUCCESSFUL)
+  {
+    sc = rtems_task_start (fd->background_task,
+                           rtems_fdisk_background_task,
+                           (rtems_task_argument) fd);
+    if (sc != RTEMS_SUCCESSFUL)
+    {
+      rtems_task_delete (fd->background_task);
+      fd->background_task = 0;
+    }
+  }
+  else
+  {
+    fd->background_task = 0;
+  }
+
+  if (sc != RTEMS_SUCCESSFUL)
+    rtems_fdisk_error ("background task start failed: %s",
+                       rtems_status_text (sc));
+}
+
 /**
  * Flash disk device driver initialization.
  *
@@ -2600,6 +3118,8 @@ rtems_fdisk_initialize (rtems_device_major_number major,
                          strerror (ret), ret);
       return ret;
     }
+
+    rtems_fdisk_background_start (fd, c);
   }
 
   return RTEMS_SUCCESSFUL;
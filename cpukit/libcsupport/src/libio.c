@@ -46,6 +46,9 @@
 #include <rtems.h>
 #include <rtems/libio_.h>
 #include <rtems/assoc.h>
+#include <rtems/sysinit.h>
+#include <rtems/score/isrlock.h>
+#include <rtems/score/percpudata.h>
 
 /* define this to alias O_NDELAY to  O_NONBLOCK, i.e.,
  * O_NDELAY is accepted on input but fcntl(F_GETFL) returns
@@ -125,27 +128,190 @@ int rtems_libio_to_fcntl_flags( unsigned int flags )
   return fcntl_flags;
 }
 
-rtems_libio_t *rtems_libio_allocate( void )
+/*
+ * The free file descriptors are cached per processor.  A processor cache is
+ * protected by its own ISR lock which is normally only acquired by the owner
+ * processor, so the allocation and release of file descriptors does not
+ * contend on a shared lock in the common case.  The caches exchange batches
+ * of file descriptors with the global free list protected by the libio lock.
+ */
+#define LIBIO_CACHE_BATCH 8
+
+#define LIBIO_CACHE_MAXIMUM ( 2 * LIBIO_CACHE_BATCH )
+
+typedef struct {
+  rtems_libio_t *head;
+  rtems_libio_t *tail;
+  uint32_t       count;
+  ISR_LOCK_MEMBER( Lock )
+} rtems_libio_cache;
+
+PER_CPU_DATA_NEED_INITIALIZATION();
+
+static PER_CPU_DATA_ITEM( rtems_libio_cache, rtems_libio_free_cache );
+
+static rtems_libio_cache *rtems_libio_get_cache( const Per_CPU_Control *cpu )
+{
+  rtems_libio_cache *cache;
+
+  cache = PER_CPU_DATA_GET( cpu, rtems_libio_cache, rtems_libio_free_cache );
+  return cache;
+}
+
+static rtems_libio_cache *rtems_libio_cache_acquire(
+  ISR_lock_Context *lock_context
+)
+{
+  rtems_libio_cache *cache;
+
+  _ISR_lock_ISR_disable( lock_context );
+  cache = rtems_libio_get_cache( _Per_CPU_Get() );
+  _ISR_lock_Acquire( &cache->Lock, lock_context );
+  return cache;
+}
+
+static void rtems_libio_cache_release(
+  rtems_libio_cache *cache,
+  ISR_lock_Context  *lock_context
+)
+{
+  _ISR_lock_Release_and_ISR_enable( &cache->Lock, lock_context );
+}
+
+static rtems_libio_t *rtems_libio_cache_get( rtems_libio_cache *cache )
 {
   rtems_libio_t *iop;
 
+  iop = cache->head;
+
+  if ( iop != NULL ) {
+    cache->head = iop->data1;
+    --cache->count;
+  }
+
+  return iop;
+}
+
+static void rtems_libio_cache_append(
+  rtems_libio_cache *cache,
+  rtems_libio_t     *first,
+  rtems_libio_t     *last,
+  uint32_t           count
+)
+{
+  last->data1 = NULL;
+
+  if ( cache->count == 0 ) {
+    cache->head = first;
+  } else {
+    cache->tail->data1 = first;
+  }
+
+  cache->tail = last;
+  cache->count += count;
+}
+
+/*
+ * If the global free list is empty, then the remaining free file descriptors
+ * may be in the caches of other processors.
+ */
+static rtems_libio_t *rtems_libio_steal( void )
+{
+  uint32_t cpu_index;
+  uint32_t cpu_max;
+
+  cpu_max = rtems_scheduler_get_processor_maximum();
+
+  for ( cpu_index = 0; cpu_index < cpu_max; ++cpu_index ) {
+    rtems_libio_cache *cache;
+    rtems_libio_t     *iop;
+    ISR_lock_Context   lock_context;
+
+    cache = rtems_libio_get_cache( _Per_CPU_Get_by_index( cpu_index ) );
+    _ISR_lock_ISR_disable_and_acquire( &cache->Lock, &lock_context );
+    iop = rtems_libio_cache_get( cache );
+    _ISR_lock_Release_and_ISR_enable( &cache->Lock, &lock_context );
+
+    if ( iop != NULL ) {
+      return iop;
+    }
+  }
+
+  return NULL;
+}
+
+static void rtems_libio_cache_initialize( void )
+{
+  uint32_t cpu_index;
+  uint32_t cpu_max;
+
+  cpu_max = rtems_scheduler_get_processor_maximum();
+
+  for ( cpu_index = 0; cpu_index < cpu_max; ++cpu_index ) {
+    _ISR_lock_Initialize(
+      &rtems_libio_get_cache( _Per_CPU_Get_by_index( cpu_index ) )->Lock,
+      "libio cache"
+    );
+  }
+}
+
+RTEMS_SYSINIT_ITEM(
+  rtems_libio_cache_initialize,
+  RTEMS_SYSINIT_LIBIO,
+  RTEMS_SYSINIT_ORDER_MIDDLE
+);
+
+rtems_libio_t *rtems_libio_allocate( void )
+{
+  rtems_libio_cache *cache;
+  rtems_libio_t     *iop;
+  rtems_libio_t     *last;
+  uint32_t           count;
+  ISR_lock_Context   lock_context;
+
+  cache = rtems_libio_cache_acquire( &lock_context );
+  iop = rtems_libio_cache_get( cache );
+  rtems_libio_cache_release( cache, &lock_context );
+
+  if ( iop != NULL ) {
+    return iop;
+  }
+
+  /*
+   * Take a batch of file descriptors from the global free list.  Keep the
+   * first one and put the rest into the cache of the current processor.
+   */
   rtems_libio_lock();
 
   iop = rtems_libio_iop_free_head;
 
-  if ( iop != NULL ) {
-    void *next;
+  if ( iop == NULL ) {
+    rtems_libio_unlock();
+    return rtems_libio_steal();
+  }
 
-    next = iop->data1;
-    rtems_libio_iop_free_head = next;
+  last = iop;
+  count = 1;
 
-    if ( next == NULL ) {
-      rtems_libio_iop_free_tail = &rtems_libio_iop_free_head;
-    }
+  while ( count < LIBIO_CACHE_BATCH && last->data1 != NULL ) {
+    last = last->data1;
+    ++count;
+  }
+
+  rtems_libio_iop_free_head = last->data1;
+
+  if ( rtems_libio_iop_free_head == NULL ) {
+    rtems_libio_iop_free_tail = &rtems_libio_iop_free_head;
   }
 
   rtems_libio_unlock();
 
+  if ( count > 1 ) {
+    cache = rtems_libio_cache_acquire( &lock_context );
+    rtems_libio_cache_append( cache, iop->data1, last, count - 1 );
+    rtems_libio_cache_release( cache, &lock_context );
+  }
+
   return iop;
 }
 
@@ -153,12 +319,14 @@ void rtems_libio_free(
   rtems_libio_t *iop
 )
 {
-  size_t zero;
+  rtems_libio_cache *cache;
+  rtems_libio_t     *first;
+  rtems_libio_t     *last;
+  ISR_lock_Context   lock_context;
+  size_t             zero;
 
   rtems_filesystem_location_free( &iop->pathinfo );
 
-  rtems_libio_lock();
-
   /*
    * Clear everything except the reference count part.  At this point in time
    * there may be still some holders of this file descriptor.
@@ -168,11 +336,73 @@ void rtems_libio_free(
   memset( (char *) iop + zero, 0, sizeof( *iop ) - zero );
 
   /*
-   * Append it to the free list.  This increases the likelihood that a use
-   * after close is detected.
+   * Append it to the cache of the current processor.  If the cache is full,
+   * then move the oldest batch to the global free list.  The cache is a FIFO,
+   * however, it holds at most LIBIO_CACHE_MAXIMUM descriptors and may be
+   * empty.  A closed descriptor may be reused by one of the next allocations
+   * on this processor, so a use after close is less likely to be detected
+   * than with the single global free list.
    */
-  *rtems_libio_iop_free_tail = iop;
-  rtems_libio_iop_free_tail = &iop->data1;
+  cache = rtems_libio_cache_acquire( &lock_context );
+  rtems_libio_cache_append( cache, iop, iop, 1 );
+
+  if ( cache->count > LIBIO_CACHE_MAXIMUM ) {
+    uint32_t count;
+
+    first = cache->head;
+    last = first;
+
+    for ( count = 1; count < LIBIO_CACHE_BATCH; ++count ) {
+      last = last->data1;
+    }
+
+    cache->head = last->data1;
+    cache->count -= LIBIO_CACHE_BATCH;
+    last->data1 = NULL;
+  } else {
+    first = NULL;
+    last = NULL;
+  }
+
+  rtems_libio_cache_release( cache, &lock_context );
+
+  if ( first != NULL ) {
+    rtems_libio_lock();
+    *rtems_libio_iop_free_tail = first;
+    rtems_libio_iop_free_tail = &last->data1;
+    rtems_libio_unlock();
+  }
+}
+
+uint32_t rtems_libio_count_free( void )
+{
+  rtems_libio_t *iop;
+  uint32_t       free_count;
+  uint32_t       cpu_index;
+  uint32_t       cpu_max;
+
+  free_count = 0;
+  rtems_libio_lock();
+
+  iop = rtems_libio_iop_free_head;
+  while ( iop != NULL ) {
+    ++free_count;
+    iop = iop->data1;
+  }
 
   rtems_libio_unlock();
+
+  cpu_max = rtems_scheduler_get_processor_maximum();
+
+  for ( cpu_index = 0; cpu_index < cpu_max; ++cpu_index ) {
+    rtems_libio_cache *cache;
+    ISR_lock_Context   lock_context;
+
+    cache = rtems_libio_get_cache( _Per_CPU_Get_by_index( cpu_index ) );
+    _ISR_lock_ISR_disable_and_acquire( &cache->Lock, &lock_context );
+    free_count += cache->count;
+    _ISR_lock_Release_and_ISR_enable( &cache->Lock, &lock_context );
+  }
+
+  return free_count;
 }
@@ -0,0 +1,624 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/*
+ * Copyright (C) 2026 On-Line Applications Research Corporation (OAR)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/printer.h>
+
+#include <rtems.h>
+#include <rtems/bspIo.h>
+#include <rtems/score/atomic.h>
+#include <rtems/score/io.h>
+#include <rtems/score/percpudata.h>
+#include <rtems/score/threaddispatch.h>
+#include <rtems/score/userextimpl.h>
+
+#include <errno.h>
+#include <inttypes.h>
+#include <limits.h>
+#include <stdlib.h>
+
+#define PRINTK_LOG_WAKE_UP RTEMS_EVENT_0
+
+#define PRINTK_LOG_LINE_MAX 128
+
+#define PRINTK_LOG_BUFFER_MIN 256
+
+#define PRINTK_LOG_CONSUMER_FATAL UINT_MAX
+
+typedef struct {
+  uint64_t uptime;
+  uint32_t size;
+} printk_log_record;
+
+typedef struct {
+  printk_log_record record;
+  char              text[ PRINTK_LOG_LINE_MAX ];
+} printk_log_line;
+
+/*
+ * The ring buffer of a processor.  The producers of a ring buffer are the
+ * threads and interrupts executing on the owner processor.  They are
+ * serialized by disabling interrupts on this processor.  The consumers are
+ * the log task and the fatal extension.  They are serialized by the consumer
+ * indicator of the control.  The head and tail are free running byte
+ * positions.
+ */
+typedef struct {
+  char          *buffer;
+  unsigned long  mask;
+  Atomic_Ulong   head;
+  Atomic_Ulong   tail;
+  Atomic_Uint    lost;
+  uint32_t       lost_reported;
+  bool           line_start;
+} printk_log_ring;
+
+/*
+ * The consumer indicator is zero, if no consumer outputs records.  It is
+ * PRINTK_LOG_CONSUMER_FATAL, if the fatal extension owns the records,
+ * otherwise it is the index of the processor of the log task plus one.
+ */
+typedef struct {
+  bool                      started;
+  Atomic_Uint               idle;
+  Atomic_Uint               consumer;
+  rtems_id                  task;
+  void                    (*output_char)( char c );
+  User_extensions_Control   extension;
+} printk_log_control;
+
+PER_CPU_DATA_NEED_INITIALIZATION();
+
+static PER_CPU_DATA_ITEM( printk_log_ring, printk_log_rings );
+
+static void printk_log_fatal(
+  Internal_errors_Source source,
+  bool                   always_set_to_false,
+  Internal_errors_t      code
+);
+
+static printk_log_control printk_log_instance = {
+  .extension = {
+    .Callouts = {
+      .fatal = printk_log_fatal
+    }
+  }
+};
+
+static printk_log_ring *printk_log_get_ring( const Per_CPU_Control *cpu )
+{
+  printk_log_ring *ring;
+
+  ring = PER_CPU_DATA_GET( cpu, printk_log_ring, printk_log_rings );
+  return ring;
+}
+
+static void printk_log_copy_in(
+  printk_log_ring *ring,
+  unsigned long    pos,
+  const void      *src,
+  size_t           n
+)
+{
+  size_t offset;
+  size_t first;
+
+  offset = pos & ring->mask;
+  first = ring->mask + 1 - offset;
+
+  if ( first >= n ) {
+    memcpy( &ring->buffer[ offset ], src, n );
+  } else {
+    memcpy( &ring->buffer[ offset ], src, first );
+    memcpy( &ring->buffer[ 0 ], (const char *) src + first, n - first );
+  }
+}
+
+static void printk_log_copy_out(
+  const printk_log_ring *ring,
+  unsigned long          pos,
+  void                  *dst,
+  size_t                 n
+)
+{
+  size_t offset;
+  size_t first;
+
+  offset = pos & ring->mask;
+  first = ring->mask + 1 - offset;
+
+  if ( first >= n ) {
+    memcpy( dst, &ring->buffer[ offset ], n );
+  } else {
+    memcpy( dst, &ring->buffer[ offset ], first );
+    memcpy( (char *) dst + first, &ring->buffer[ 0 ], n - first );
+  }
+}
+
+static void printk_log_put_line( int c, void *arg )
+{
+  printk_log_line *line;
+
+  line = arg;
+
+  if ( line->record.size < PRINTK_LOG_LINE_MAX ) {
+    line->text[ line->record.size ] = (char) c;
+    ++line->record.size;
+  }
+}
+
+static void printk_log_put_output( int c, void *arg )
+{
+  printk_log_control *ctx;
+
+  ctx = arg;
+  ( *ctx->output_char )( (char) c );
+}
+
+static void printk_log_report_lost(
+  printk_log_control *ctx,
+  printk_log_ring    *ring,
+  uint32_t            cpu_index
+)
+{
+  uint32_t lost;
+
+  lost = _Atomic_Load_uint( &ring->lost, ATOMIC_ORDER_RELAXED );
+
+  if ( lost != ring->lost_reported ) {
+    _IO_Printf(
+      printk_log_put_output,
+      ctx,
+      "*** PRINTK LOG: %" PRIu32 " RECORDS LOST ON PROCESSOR %" PRIu32
+        " ***\n",
+      lost - ring->lost_reported,
+      cpu_index
+    );
+    ring->lost_reported = lost;
+  }
+}
+
+static bool printk_log_output_next( printk_log_control *ctx )
+{
+  printk_log_ring   *next;
+  printk_log_line    line;
+  uint32_t           next_index;
+  uint32_t           cpu_index;
+  uint32_t           cpu_max;
+  unsigned long      tail;
+  uint32_t           i;
+
+  next = NULL;
+  next_index = 0;
+  cpu_max = rtems_scheduler_get_processor_maximum();
+
+  for ( cpu_index = 0; cpu_index < cpu_max; ++cpu_index ) {
+    printk_log_ring   *ring;
+    printk_log_record  record;
+    unsigned long      head;
+
+    ring = printk_log_get_ring( _Per_CPU_Get_by_index( cpu_index ) );
+    printk_log_report_lost( ctx, ring, cpu_index );
+
+    head = _Atomic_Load_ulong( &ring->head, ATOMIC_ORDER_ACQUIRE );
+    tail = _Atomic_Load_ulong( &ring->tail, ATOMIC_ORDER_RELAXED );
+
+    if ( head == tail ) {
+      continue;
+    }
+
+    printk_log_copy_out( ring, tail, &record, sizeof( record ) );
+
+    /* Output the records of all processors in timestamp order */
+    if ( next == NULL || record.uptime < line.record.uptime ) {
+      next = ring;
+      next_index = cpu_index;
+      line.record = record;
+    }
+  }
+
+  if ( next == NULL ) {
+    return false;
+  }
+
+  tail = _Atomic_Load_ulong( &next->tail, ATOMIC_ORDER_RELAXED );
+  printk_log_copy_out(
+    next,
+    tail + sizeof( line.record ),
+    &line.text[ 0 ],
+    line.record.size
+  );
+  if ( next->line_start ) {
+    _IO_Printf(
+      printk_log_put_output,
+      ctx,
+      "[%5" PRIu32 ".%06" PRIu32 "] [%" PRIu32 "] ",
+      (uint32_t) ( line.record.uptime / 1000000000 ),
+      (uint32_t) ( ( line.record.uptime % 1000000000 ) / 1000 ),
+      next_index
+    );
+  }
+
+  for ( i = 0; i < line.record.size; ++i ) {
+    ( *ctx->output_char )( line.text[ i ] );
+  }
+
+  next->line_start = line.record.size > 0 &&
+    line.text[ line.record.size - 1 ] == '\n';
+
+  /* Release the record after the output for rtems_printk_log_drain() */
+  _Atomic_Store_ulong(
+    &next->tail,
+    tail + sizeof( line.record ) + line.record.size,
+    ATOMIC_ORDER_RELEASE
+  );
+
+  return true;
+}
+
+static bool printk_log_try_acquire_consumer(
+  printk_log_control *ctx,
+  unsigned int        consumer
+)
+{
+  unsigned int expected;
+
+  expected = 0;
+  return _Atomic_Compare_exchange_uint(
+    &ctx->consumer,
+    &expected,
+    consumer,
+    ATOMIC_ORDER_ACQUIRE,
+    ATOMIC_ORDER_RELAXED
+  );
+}
+
+static void printk_log_release_consumer( printk_log_control *ctx )
+{
+  _Atomic_Store_uint( &ctx->consumer, 0, ATOMIC_ORDER_RELEASE );
+}
+
+/*
+ * Output the next record as the consumer.  Thread dispatching is disabled, so
+ * that the consumer indicator cannot be held by a preempted log task.
+ */
+static bool printk_log_output_next_as_task( printk_log_control *ctx )
+{
+  Per_CPU_Control *cpu_self;
+  uint32_t         cpu_index;
+  bool             more;
+
+  cpu_self = _Thread_Dispatch_disable();
+  cpu_index = _Per_CPU_Get_index( cpu_self );
+
+  while ( !printk_log_try_acquire_consumer( ctx, cpu_index + 1 ) ) {
+    /* Wait for the fatal extension on another processor */
+  }
+
+  more = printk_log_output_next( ctx );
+  printk_log_release_consumer( ctx );
+  _Thread_Dispatch_enable( cpu_self );
+
+  return more;
+}
+
+static bool printk_log_is_pending( void )
+{
+  uint32_t cpu_index;
+  uint32_t cpu_max;
+
+  cpu_max = rtems_scheduler_get_processor_maximum();
+
+  for ( cpu_index = 0; cpu_index < cpu_max; ++cpu_index ) {
+    printk_log_ring *ring;
+
+    ring = printk_log_get_ring( _Per_CPU_Get_by_index( cpu_index ) );
+
+    if (
+      _Atomic_Load_ulong( &ring->head, ATOMIC_ORDER_RELAXED ) !=
+        _Atomic_Load_ulong( &ring->tail, ATOMIC_ORDER_RELAXED )
+    ) {
+      return true;
+    }
+  }
+
+  return false;
+}
+
+static void printk_log_task( rtems_task_argument arg )
+{
+  printk_log_control *ctx;
+
+  ctx = (printk_log_control *) arg;
+
+  while ( true ) {
+    rtems_event_set unused;
+
+    while ( printk_log_output_next_as_task( ctx ) ) {
+      /* Output the next record */
+    }
+
+    /*
+     * Announce that we are about to wait for new records.  The producers check
+     * the idle indicator after they published a record.  The fences ensure
+     * that either the producer sees the indicator or we see the record.
+     */
+    _Atomic_Store_uint( &ctx->idle, 1, ATOMIC_ORDER_RELAXED );
+    _Atomic_Fence( ATOMIC_ORDER_SEQ_CST );
+
+    if ( printk_log_is_pending() ) {
+      _Atomic_Store_uint( &ctx->idle, 0, ATOMIC_ORDER_RELAXED );
+      continue;
+    }
+
+    rtems_event_receive(
+      PRINTK_LOG_WAKE_UP,
+      RTEMS_EVENT_ALL | RTEMS_WAIT,
+      RTEMS_NO_TIMEOUT,
+      &unused
+    );
+  }
+}
+
+static void printk_log_fatal(
+  Internal_errors_Source source,
+  bool                   always_set_to_false,
+  Internal_errors_t      code
+)
+{
+  printk_log_control *ctx;
+  unsigned int        self;
+
+  (void) source;
+  (void) always_set_to_false;
+  (void) code;
+
+  ctx = &printk_log_instance;
+  self = rtems_scheduler_get_processor() + 1;
+
+  /*
+   * On SMP configurations, the log task may output a record on another
+   * processor.  Wait until it is done.  If the log task was interrupted on
+   * this processor in the middle of a record, then it cannot finish.  If a
+   * fatal extension on another processor owns the records, then it outputs
+   * them.  In both cases, the pending records are not flushed here.  The
+   * consumer indicator is not released, so the log task stops to output
+   * records.
+   */
+  while (
+    !printk_log_try_acquire_consumer( ctx, PRINTK_LOG_CONSUMER_FATAL )
+  ) {
+    unsigned int consumer;
+
+    consumer = _Atomic_Load_uint( &ctx->consumer, ATOMIC_ORDER_RELAXED );
+
+    if ( consumer == self || consumer == PRINTK_LOG_CONSUMER_FATAL ) {
+      return;
+    }
+  }
+
+  while ( printk_log_output_next( ctx ) ) {
+    /* Output the next record */
+  }
+}
+
+int rtems_printk_log_start( const rtems_printk_log_config *config )
+{
+  printk_log_control *ctx;
+  rtems_status_code   sc;
+  size_t              buffer_size;
+  size_t              stack_size;
+  char               *buffers;
+  uint32_t            cpu_index;
+  uint32_t            cpu_max;
+
+  ctx = &printk_log_instance;
+  buffer_size = config->buffer_size;
+
+  if (
+    buffer_size < PRINTK_LOG_BUFFER_MIN ||
+      ( buffer_size & ( buffer_size - 1 ) ) != 0
+  ) {
+    return EINVAL;
+  }
+
+  if ( ctx->started ) {
+    return EBUSY;
+  }
+
+  cpu_max = rtems_scheduler_get_processor_maximum();
+  buffers = malloc( cpu_max * buffer_size );
+
+  if ( buffers == NULL ) {
+    return ENOMEM;
+  }
+
+  stack_size = config->task_stack_size;
+
+  if ( stack_size == 0 ) {
+    stack_size = RTEMS_MINIMUM_STACK_SIZE;
+  }
+
+  sc = rtems_task_create(
+    rtems_build_name( 'P', 'L', 'O', 'G' ),
+    config->task_priority,
+    stack_size,
+    RTEMS_DEFAULT_MODES,
+    RTEMS_DEFAULT_ATTRIBUTES,
+    &ctx->task
+  );
+
+  if ( sc != RTEMS_SUCCESSFUL ) {
+    free( buffers );
+    return sc == RTEMS_INVALID_PRIORITY ? EINVAL : ENOMEM;
+  }
+
+  for ( cpu_index = 0; cpu_index < cpu_max; ++cpu_index ) {
+    printk_log_ring *ring;
+
+    ring = printk_log_get_ring( _Per_CPU_Get_by_index( cpu_index ) );
+    ring->buffer = &buffers[ cpu_index * buffer_size ];
+    ring->mask = buffer_size - 1;
+    ring->line_start = true;
+  }
+
+  if ( config->output_char != NULL ) {
+    ctx->output_char = config->output_char;
+  } else {
+    ctx->output_char = rtems_putc;
+  }
+
+  _User_extensions_Add_set( &ctx->extension );
+
+  _Atomic_Fence( ATOMIC_ORDER_RELEASE );
+  ctx->started = true;
+
+  sc = rtems_task_start(
+    ctx->task,
+    printk_log_task,
+    (rtems_task_argument) ctx
+  );
+  _Assert_Unused_variable_equals( sc, RTEMS_SUCCESSFUL );
+
+  return 0;
+}
+
+int rtems_vprintk_log( const char *fmt, va_list ap )
+{
+  printk_log_control    *ctx;
+  printk_log_ring       *ring;
+  printk_log_line        line;
+  rtems_interrupt_level  level;
+  unsigned long          head;
+  unsigned long          tail;
+  size_t                 size;
+  int                    n;
+
+  ctx = &printk_log_instance;
+
+  if ( !ctx->started ) {
+    return vprintk( fmt, ap );
+  }
+
+  /* Format outside the critical section into a record on the stack */
+  line.record.size = 0;
+  n = _IO_Vprintf( printk_log_put_line, &line, fmt, ap );
+  size = sizeof( line.record ) + line.record.size;
+
+  rtems_interrupt_local_disable( level );
+  ring = printk_log_get_ring( _Per_CPU_Get() );
+  head = _Atomic_Load_ulong( &ring->head, ATOMIC_ORDER_RELAXED );
+  tail = _Atomic_Load_ulong( &ring->tail, ATOMIC_ORDER_ACQUIRE );
+
+  if ( ring->mask + 1 - ( head - tail ) < size ) {
+    _Atomic_Fetch_add_uint( &ring->lost, 1, ATOMIC_ORDER_RELAXED );
+    rtems_interrupt_local_enable( level );
+    return 0;
+  }
+
+  line.record.uptime = rtems_clock_get_uptime_nanoseconds();
+  printk_log_copy_in( ring, head, &line, size );
+  _Atomic_Store_ulong( &ring->head, head + size, ATOMIC_ORDER_RELEASE );
+  rtems_interrupt_local_enable( level );
+
+  _Atomic_Fence( ATOMIC_ORDER_SEQ_CST );
+
+  if (
+    _Atomic_Load_uint( &ctx->idle, ATOMIC_ORDER_RELAXED ) != 0 &&
+      _Atomic_Exchange_uint( &ctx->idle, 0, ATOMIC_ORDER_RELAXED ) != 0
+  ) {
+    (void) rtems_event_send( ctx->task, PRINTK_LOG_WAKE_UP );
+  }
+
+  return n;
+}
+
+int rtems_printk_log( const char *fmt, ... )
+{
+  va_list ap;
+  int     n;
+
+  va_start( ap, fmt );
+  n = rtems_vprintk_log( fmt, ap );
+  va_end( ap );
+
+  return n;
+}
+
+static int printk_log_printer( void *context, const char *fmt, va_list ap )
+{
+  (void) context;
+  return rtems_vprintk_log( fmt, ap );
+}
+
+void rtems_print_printer_printk_log( rtems_printer *printer )
+{
+  printer->context = NULL;
+  printer->printer = printk_log_printer;
+}
+
+void rtems_printk_log_drain( void )
+{
+  uint32_t cpu_index;
+  uint32_t cpu_max;
+
+  if ( !printk_log_instance.started ) {
+    return;
+  }
+
+  cpu_max = rtems_scheduler_get_processor_maximum();
+
+  for ( cpu_index = 0; cpu_index < cpu_max; ++cpu_index ) {
+    printk_log_ring *ring;
+    unsigned long    head;
+
+    ring = printk_log_get_ring( _Per_CPU_Get_by_index( cpu_index ) );
+    head = _Atomic_Load_ulong( &ring->head, ATOMIC_ORDER_ACQUIRE );
+
+    while (
+      (long) ( head - _Atomic_Load_ulong( &ring->tail, ATOMIC_ORDER_ACQUIRE ) )
+        > 0
+    ) {
+      (void) rtems_task_wake_after( 1 );
+    }
+  }
+}
+
+uint32_t rtems_printk_log_get_lost( uint32_t cpu_index )
+{
+  const printk_log_ring *ring;
+
+  if ( cpu_index >= rtems_scheduler_get_processor_maximum() ) {
+    return 0;
+  }
+
+  ring = printk_log_get_ring( _Per_CPU_Get_by_index( cpu_index ) );
+  return _Atomic_Load_uint( &ring->lost, ATOMIC_ORDER_RELAXED );
+}
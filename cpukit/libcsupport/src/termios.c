@@ -108,6 +108,39 @@ static rtems_task rtems_termios_txdaemon(rtems_task_argument argument);
 #define TERMIOS_RX_PROC_EVENT      RTEMS_EVENT_1
 #define TERMIOS_RX_TERMINATE_EVENT RTEMS_EVENT_0
 
+#define TERMIOS_SHARED_DAEMON_EVENT RTEMS_EVENT_1
+
+/*
+ * The receive daemons pass the polled characters in chunks of this size to
+ * rtems_termios_enqueue_raw_characters()
+ */
+#define TERMIOS_RX_CHUNK_SIZE 64
+
+/*
+ * The shared daemon task serves all task-driven devices opened while shared
+ * daemons are enabled.  The devices with pending work are queued on the
+ * receive and transmit chains.  The daemon processes the devices with the
+ * shared daemon mutex held, so that a device can be removed safely.
+ */
+static bool rtems_termios_use_shared_daemon;
+
+static rtems_id rtems_termios_shared_daemon_id;
+
+static RTEMS_CHAIN_DEFINE_EMPTY(rtems_termios_shared_rx);
+
+static RTEMS_CHAIN_DEFINE_EMPTY(rtems_termios_shared_tx);
+
+RTEMS_INTERRUPT_LOCK_DEFINE(
+  static,
+  rtems_termios_shared_lock,
+  "termios daemon"
+)
+
+static rtems_mutex rtems_termios_shared_mutex =
+  RTEMS_MUTEX_INITIALIZER( "termios daemon" );
+
+static rtems_task rtems_termios_shared_daemon(rtems_task_argument argument);
+
 static rtems_mutex rtems_termios_ttyMutex =
   RTEMS_MUTEX_INITIALIZER( "termios" );
 
@@ -269,6 +302,89 @@ needDeviceMutex (rtems_termios_tty *tty)
     || tty->handler.mode == TERMIOS_TASK_DRIVEN;
 }
 
+/*
+ * Called with the termios mutex held
+ */
+static rtems_status_code
+rtems_termios_shared_daemon_start (void)
+{
+  rtems_status_code sc;
+
+  if (rtems_termios_shared_daemon_id != 0)
+    return RTEMS_SUCCESSFUL;
+
+  sc = rtems_task_create (
+       rtems_build_name ('T', 'D', 'm', 'n'),
+       TERMIOS_RXTASK_PRIO,
+       TERMIOS_RXTASK_STACKSIZE,
+       RTEMS_NO_PREEMPT | RTEMS_NO_TIMESLICE |
+       RTEMS_NO_ASR,
+       RTEMS_NO_FLOATING_POINT | RTEMS_LOCAL,
+       &rtems_termios_shared_daemon_id);
+  if (sc != RTEMS_SUCCESSFUL)
+    return sc;
+
+  sc = rtems_task_start(
+    rtems_termios_shared_daemon_id, rtems_termios_shared_daemon, 0);
+  if (sc != RTEMS_SUCCESSFUL) {
+    (void) rtems_task_delete (rtems_termios_shared_daemon_id);
+    rtems_termios_shared_daemon_id = 0;
+  }
+
+  return sc;
+}
+
+/*
+ * Queue the device for the shared daemon.
+ * NOTE: This routine may run in the context of a device interrupt handler.
+ */
+static void
+rtems_termios_shared_daemon_notify (rtems_termios_tty *tty,
+  rtems_chain_control *chain, rtems_chain_node *node)
+{
+  rtems_interrupt_lock_context lock_context;
+  bool notify;
+
+  rtems_interrupt_lock_acquire (&rtems_termios_shared_lock, &lock_context);
+  notify = tty->sharedDaemon && rtems_chain_is_node_off_chain (node);
+  if (notify)
+    rtems_chain_append_unprotected (chain, node);
+  rtems_interrupt_lock_release (&rtems_termios_shared_lock, &lock_context);
+
+  if (notify) {
+    rtems_status_code sc;
+
+    sc = rtems_event_send (rtems_termios_shared_daemon_id,
+      TERMIOS_SHARED_DAEMON_EVENT);
+    if (sc != RTEMS_SUCCESSFUL)
+      rtems_fatal_error_occurred (sc);
+  }
+}
+
+/*
+ * Make sure that the shared daemon no longer uses the device.  The daemon
+ * processes devices only with the shared daemon mutex held.
+ */
+static void
+rtems_termios_shared_daemon_remove (rtems_termios_tty *tty)
+{
+  rtems_interrupt_lock_context lock_context;
+
+  rtems_mutex_lock (&rtems_termios_shared_mutex);
+  rtems_interrupt_lock_acquire (&rtems_termios_shared_lock, &lock_context);
+  tty->sharedDaemon = false;
+  if (!rtems_chain_is_node_off_chain (&tty->rxDaemonNode)) {
+    rtems_chain_extract_unprotected (&tty->rxDaemonNode);
+    rtems_chain_set_off_chain (&tty->rxDaemonNode);
+  }
+  if (!rtems_chain_is_node_off_chain (&tty->txDaemonNode)) {
+    rtems_chain_extract_unprotected (&tty->txDaemonNode);
+    rtems_chain_set_off_chain (&tty->txDaemonNode);
+  }
+  rtems_interrupt_lock_release (&rtems_termios_shared_lock, &lock_context);
+  rtems_mutex_unlock (&rtems_termios_shared_mutex);
+}
+
 static void
 rtems_termios_destroy_tty (rtems_termios_tty *tty, void *arg, bool last_close)
 {
@@ -286,7 +402,9 @@ rtems_termios_destroy_tty (rtems_termios_tty *tty, void *arg, bool last_close)
     rtems_mutex_unlock (&tty->osem);
   }
 
-  if (tty->handler.mode == TERMIOS_TASK_DRIVEN) {
+  if (tty->handler.mode == TERMIOS_TASK_DRIVEN && tty->sharedDaemon) {
+    rtems_termios_shared_daemon_remove (tty);
+  } else if (tty->handler.mode == TERMIOS_TASK_DRIVEN) {
     rtems_status_code sc;
 
     /*
@@ -467,7 +585,20 @@ rtems_termios_open_tty(
     /*
      * Create I/O tasks
      */
-    if (tty->handler.mode == TERMIOS_TASK_DRIVEN) {
+    if (tty->handler.mode == TERMIOS_TASK_DRIVEN &&
+        rtems_termios_use_shared_daemon) {
+      rtems_status_code sc;
+
+      sc = rtems_termios_shared_daemon_start ();
+      if (sc != RTEMS_SUCCESSFUL)
+        rtems_fatal_error_occurred (sc);
+
+      tty->sharedDaemon = true;
+      tty->rxTaskId = rtems_termios_shared_daemon_id;
+      tty->txTaskId = rtems_termios_shared_daemon_id;
+      rtems_chain_set_off_chain (&tty->rxDaemonNode);
+      rtems_chain_set_off_chain (&tty->txDaemonNode);
+    } else if (tty->handler.mode == TERMIOS_TASK_DRIVEN) {
       rtems_status_code sc;
 
       sc = rtems_task_create (
@@ -550,7 +681,7 @@ rtems_termios_open_tty(
     /*
      * start I/O tasks, if needed
      */
-    if (tty->handler.mode == TERMIOS_TASK_DRIVEN) {
+    if (tty->handler.mode == TERMIOS_TASK_DRIVEN && !tty->sharedDaemon) {
       rtems_status_code sc;
 
       sc = rtems_task_start(
@@ -696,6 +827,14 @@ rtems_status_code rtems_termios_bufsize (
   return RTEMS_SUCCESSFUL;
 }
 
+rtems_status_code rtems_termios_set_shared_daemon (bool shared)
+{
+  rtems_termios_obtain ();
+  rtems_termios_use_shared_daemon = shared;
+  rtems_termios_release ();
+  return RTEMS_SUCCESSFUL;
+}
+
 static void
 termios_set_flowctrl(struct rtems_termios_tty *tty)
 {
@@ -831,6 +970,8 @@ rtems_termios_ioctl (void *arg)
         }
       }
     }
+    /* wake up a waiting reader with the next chunk */
+    tty->rawInBufThreshold = 0;
     if (tty->handler.set_attributes) {
       sc = (*tty->handler.set_attributes)(tty->device_context, &tty->termios) ?
         RTEMS_SUCCESSFUL : RTEMS_IO_ERROR;
@@ -1487,6 +1628,96 @@ fillBufferPoll (struct rtems_termios_tty *tty)
   return RTEMS_TERMIOS_IPROC_CONTINUE;
 }
 
+/*
+ * In raw mode the input characters need no processing, so they can be moved
+ * in chunks between the raw input queue and the input buffer
+ */
+static bool
+isRawInput (const rtems_termios_tty *tty)
+{
+  return (tty->termios.c_lflag & (ICANON | ISIG | ECHO | ECHOE | ECHOK |
+      ECHONL | ECHOPRT | ECHOCTL | ECHOKE)) == 0 &&
+    (tty->termios.c_iflag & (ISTRIP | IUCLC | IGNCR | ICRNL | INLCR)) == 0 &&
+    (tty->flow_ctrl & (FL_MDXON | FL_MDXOF | FL_MDRTS)) == 0 &&
+    rtems_termios_linesw[tty->t_line].l_rint == NULL;
+}
+
+static unsigned int
+rawInputCount (const rtems_termios_tty *tty)
+{
+  unsigned int size = tty->rawInBuf.Size;
+
+  return (tty->rawInBuf.Tail + size - tty->rawInBuf.Head) % size;
+}
+
+/*
+ * Copy the characters of the raw input queue to the input buffer.  The
+ * characters between Head and Tail belong to the reader, so the copy is done
+ * without the device lock.
+ */
+static unsigned int
+copyRawInput (struct rtems_termios_tty *tty)
+{
+  rtems_termios_device_context *ctx = tty->device_context;
+  rtems_interrupt_lock_context  lock_context;
+  unsigned int                  size = tty->rawInBuf.Size;
+  unsigned int                  head;
+  unsigned int                  start;
+  unsigned int                  first;
+  unsigned int                  n;
+
+  rtems_termios_device_lock_acquire (ctx, &lock_context);
+  head = tty->rawInBuf.Head;
+  n = rawInputCount (tty);
+  rtems_termios_device_lock_release (ctx, &lock_context);
+
+  n = MIN (n, CBUFSIZE - 1 - tty->ccount);
+  if (n == 0)
+    return 0;
+
+  /* The characters are stored at Head + 1 onwards */
+  start = (head + 1) % size;
+  first = MIN (n, size - start);
+  memcpy (&tty->cbuf[tty->ccount], &tty->rawInBuf.theBuf[start], first);
+  memcpy (&tty->cbuf[tty->ccount + first], &tty->rawInBuf.theBuf[0],
+    n - first);
+  tty->ccount += n;
+
+  rtems_termios_device_lock_acquire (ctx, &lock_context);
+  tty->rawInBuf.Head = (head + n) % size;
+  rtems_termios_device_lock_release (ctx, &lock_context);
+
+  return n;
+}
+
+/*
+ * Tell the raw mode receive path how many characters the reader needs before
+ * it waits.  The reader is woken up for each chunk if VTIME is used since the
+ * timer is an inter-character timer.  Returns true, if the characters are
+ * already available.
+ */
+static bool
+setRawInputThreshold (struct rtems_termios_tty *tty)
+{
+  rtems_termios_device_context *ctx = tty->device_context;
+  rtems_interrupt_lock_context  lock_context;
+  unsigned int                  threshold;
+  bool                          ready;
+
+  threshold = 1;
+  if (tty->termios.c_cc[VTIME] == 0 &&
+      tty->termios.c_cc[VMIN] > tty->ccount) {
+    threshold = tty->termios.c_cc[VMIN] - tty->ccount;
+  }
+
+  rtems_termios_device_lock_acquire (ctx, &lock_context);
+  tty->rawInBufThreshold = threshold;
+  ready = rawInputCount (tty) >= threshold;
+  rtems_termios_device_lock_release (ctx, &lock_context);
+
+  return ready;
+}
+
 /*
  * Fill the input buffer from the raw input queue
  */
@@ -1499,6 +1730,15 @@ fillBufferQueue (struct rtems_termios_tty *tty)
 
   while ( wait ) {
     rtems_interrupt_lock_context lock_context;
+    bool raw = isRawInput (tty);
+
+    if (raw) {
+      if (copyRawInput (tty) > 0) {
+        if (tty->ccount >= tty->termios.c_cc[VMIN])
+          wait = false;
+        timeout = tty->rawInBufSemaphoreTimeout;
+      }
+    }
 
     /*
      * Process characters read from raw queue
@@ -1570,6 +1810,10 @@ fillBufferQueue (struct rtems_termios_tty *tty)
         rtems_binary_semaphore *sem;
         int eno;
 
+        if (raw && setRawInputThreshold (tty)) {
+          continue;
+        }
+
         sem = &tty->rawInBuf.Semaphore;
 
         if (tty->rawInBufSemaphoreWait) {
@@ -1669,6 +1913,12 @@ rtems_termios_read (void *arg)
  */
 void rtems_termios_rxirq_occured(struct rtems_termios_tty *tty)
 {
+  if (tty->sharedDaemon) {
+    rtems_termios_shared_daemon_notify (tty, &rtems_termios_shared_rx,
+      &tty->rxDaemonNode);
+    return;
+  }
+
   /*
    * send event to rx daemon task
    */
@@ -1689,6 +1939,76 @@ mustCallReceiveCallback (const rtems_termios_tty *tty, unsigned char c,
   }
 }
 
+/*
+ * Place characters on raw queue in raw mode, see isRawInput().
+ * NOTE: This routine runs in the context of the
+ *       device receive interrupt handler.
+ * Returns the number of characters dropped because of overflow.
+ */
+static int
+enqueueRawInput (struct rtems_termios_tty *tty, const char *buf, int len)
+{
+  rtems_termios_device_context *ctx = tty->device_context;
+  rtems_interrupt_lock_context  lock_context;
+  unsigned int                  size;
+  unsigned int                  tail;
+  unsigned int                  start;
+  unsigned int                  first;
+  unsigned int                  count;
+  unsigned int                  n;
+  bool                          callReciveCallback;
+  bool                          wakeUpReader;
+  int                           dropped;
+
+  rtems_termios_device_lock_acquire (ctx, &lock_context);
+
+  size = tty->rawInBuf.Size;
+  tail = tty->rawInBuf.Tail;
+  count = rawInputCount (tty);
+
+  /* One slot stays unused to distinguish a full from an empty queue */
+  n = MIN ((unsigned int) len, size - 1 - count);
+  dropped = len - (int) n;
+
+  /* The characters are stored at Tail + 1 onwards */
+  start = (tail + 1) % size;
+  first = MIN (n, size - start);
+  memcpy (&tty->rawInBuf.theBuf[start], buf, first);
+  memcpy (&tty->rawInBuf.theBuf[0], buf + first, n - first);
+  tty->rawInBuf.Tail = (tail + n) % size;
+  count += n;
+
+  callReciveCallback = false;
+
+  /*
+   * check to see if rcv wakeup callback was set
+   */
+  if (tty->tty_rcv.sw_pfn != NULL && !tty->tty_rcvwakeup &&
+      (dropped > 0 || count >= tty->termios.c_cc[VMIN])) {
+    tty->tty_rcvwakeup = true;
+    callReciveCallback = true;
+  }
+
+  /*
+   * wake up the reader only if it can make progress
+   */
+  wakeUpReader = dropped > 0 || count >= tty->rawInBufThreshold;
+
+  rtems_termios_device_lock_release (ctx, &lock_context);
+
+  if (callReciveCallback) {
+    (*tty->tty_rcv.sw_pfn)(&tty->termios, tty->tty_rcv.sw_arg);
+  }
+
+  tty->rawInBufDropped += dropped;
+
+  if (wakeUpReader) {
+    rtems_binary_semaphore_post (&tty->rawInBuf.Semaphore);
+  }
+
+  return dropped;
+}
+
 /*
  * Place characters on raw queue.
  * NOTE: This routine runs in the context of the
@@ -1721,6 +2041,10 @@ rtems_termios_enqueue_raw_characters (void *ttyp, const char *buf, int len)
     return 0;
   }
 
+  if (isRawInput (tty)) {
+    return enqueueRawInput (tty, buf, len);
+  }
+
   while (len--) {
     c = *buf++;
     /* FIXME: implement IXANY: any character restarts output */
@@ -1965,6 +2289,13 @@ rtems_termios_dequeue_characters (void *ttyp, int len)
      * send wake up to transmitter task
      */
     tty->txTaskCharsDequeued = len;
+
+    if (tty->sharedDaemon) {
+      rtems_termios_shared_daemon_notify (tty, &rtems_termios_shared_tx,
+        &tty->txDaemonNode);
+      return 0; /* nothing to output in IRQ... */
+    }
+
     sc = rtems_event_send(tty->txTaskId, TERMIOS_TX_START_EVENT);
     if (sc != RTEMS_SUCCESSFUL)
       rtems_fatal_error_occurred (sc);
@@ -1984,6 +2315,66 @@ rtems_termios_dequeue_characters (void *ttyp, int len)
   return rtems_termios_refill_transmitter(tty);
 }
 
+/*
+ * process a transmit event in a daemon task
+ */
+static void rtems_termios_txdaemon_process(struct rtems_termios_tty *tty)
+{
+  /*
+   * call any line discipline start function
+   */
+  if (rtems_termios_linesw[tty->t_line].l_start != NULL) {
+    rtems_termios_linesw[tty->t_line].l_start(tty, tty->txTaskCharsDequeued);
+
+    if (tty->t_line == PPPDISC) {
+      /*
+       * Do not call rtems_termios_refill_transmitter() in this case similar
+       * to rtems_termios_dequeue_characters().
+       */
+      return;
+    }
+  }
+
+  /*
+   * try to push further characters to device
+   */
+  rtems_termios_refill_transmitter(tty);
+}
+
+/*
+ * process a receive event in a daemon task, read at most one chunk of
+ * characters and pass it to the raw input queue
+ */
+static void rtems_termios_rxdaemon_process(struct rtems_termios_tty *tty)
+{
+  rtems_termios_device_context *ctx = tty->device_context;
+  char buf[TERMIOS_RX_CHUNK_SIZE];
+  int n = 0;
+  int c;
+
+  /*
+   * poll_read may call enqueue on its own and return EOF
+   */
+  while (n < TERMIOS_RX_CHUNK_SIZE &&
+         (c = tty->handler.poll_read(ctx)) != EOF) {
+    buf[n++] = c;
+  }
+
+  if (n > 0) {
+    rtems_termios_enqueue_raw_characters (tty, buf, n);
+  }
+
+  /*
+   * If the chunk is full, then more characters may be available.  Do not
+   * keep on polling the device, instead signal a new receive event.  So, the
+   * daemon goes back to its event wait and sees a terminate event or serves
+   * other devices in between.
+   */
+  if (n == TERMIOS_RX_CHUNK_SIZE) {
+    rtems_termios_rxirq_occured (tty);
+  }
+}
+
 /*
  * this task actually processes any transmit events
  */
@@ -2007,25 +2398,7 @@ static rtems_task rtems_termios_txdaemon(rtems_task_argument argument)
       rtems_task_exit();
     }
 
-    /*
-     * call any line discipline start function
-     */
-    if (rtems_termios_linesw[tty->t_line].l_start != NULL) {
-      rtems_termios_linesw[tty->t_line].l_start(tty, tty->txTaskCharsDequeued);
-
-      if (tty->t_line == PPPDISC) {
-        /*
-         * Do not call rtems_termios_refill_transmitter() in this case similar
-         * to rtems_termios_dequeue_characters().
-         */
-        continue;
-      }
-    }
-
-    /*
-     * try to push further characters to device
-     */
-    rtems_termios_refill_transmitter(tty);
+    rtems_termios_txdaemon_process(tty);
   }
 }
 
@@ -2035,10 +2408,7 @@ static rtems_task rtems_termios_txdaemon(rtems_task_argument argument)
 static rtems_task rtems_termios_rxdaemon(rtems_task_argument argument)
 {
   struct rtems_termios_tty *tty = (struct rtems_termios_tty *)argument;
-  rtems_termios_device_context *ctx = tty->device_context;
   rtems_event_set the_event;
-  int c;
-  char c_buf;
 
   while (1) {
     /*
@@ -2055,17 +2425,57 @@ static rtems_task rtems_termios_rxdaemon(rtems_task_argument argument)
       rtems_task_exit();
     }
 
-    /*
-     * do something
-     */
-    c = tty->handler.poll_read(ctx);
-    if (c != EOF) {
-      /*
-       * poll_read did call enqueue on its own
-       */
-      c_buf = c;
-      rtems_termios_enqueue_raw_characters ( tty,&c_buf,1);
+    rtems_termios_rxdaemon_process(tty);
+  }
+}
+
+/*
+ * this task serves the receive and transmit events of all devices using the
+ * shared daemon
+ */
+static rtems_task rtems_termios_shared_daemon(rtems_task_argument argument)
+{
+  rtems_event_set the_event;
+
+  (void) argument;
+
+  while (1) {
+    rtems_event_receive(
+      TERMIOS_SHARED_DAEMON_EVENT,
+      RTEMS_EVENT_ANY | RTEMS_WAIT,
+      RTEMS_NO_TIMEOUT,
+      &the_event
+    );
+
+    rtems_mutex_lock (&rtems_termios_shared_mutex);
+
+    while (1) {
+      rtems_interrupt_lock_context lock_context;
+      rtems_chain_node *node;
+      bool rx;
+
+      rtems_interrupt_lock_acquire (&rtems_termios_shared_lock, &lock_context);
+      node = rtems_chain_get_unprotected (&rtems_termios_shared_rx);
+      rx = (node != NULL);
+      if (!rx)
+        node = rtems_chain_get_unprotected (&rtems_termios_shared_tx);
+      if (node != NULL)
+        rtems_chain_set_off_chain (node);
+      rtems_interrupt_lock_release (&rtems_termios_shared_lock, &lock_context);
+
+      if (node == NULL)
+        break;
+
+      if (rx) {
+        rtems_termios_rxdaemon_process (
+          RTEMS_CONTAINER_OF (node, struct rtems_termios_tty, rxDaemonNode));
+      } else {
+        rtems_termios_txdaemon_process (
+          RTEMS_CONTAINER_OF (node, struct rtems_termios_tty, txDaemonNode));
+      }
     }
+
+    rtems_mutex_unlock (&rtems_termios_shared_mutex);
   }
 }
 
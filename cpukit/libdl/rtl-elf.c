@@ -53,6 +53,7 @@
 #include <rtems/rtl/rtl-trace.h>
 #include "rtl-trampoline.h"
 #include "rtl-unwind.h"
+#include "rtl-workers.h"
 #include <rtems/rtl/rtl-unresolved.h>
 
 /**
@@ -221,6 +222,73 @@ typedef bool (*rtems_rtl_elf_reloc_handler)(rtems_rtl_obj*      obj,
                                             bool                resolved,
                                             void*               data);
 
+/**
+ * Return the section's data in the memory map of the object file.
+ */
+static const void*
+rtems_rtl_elf_sect_mapped (const rtems_rtl_obj*      obj,
+                           const rtems_rtl_obj_sect* sect)
+{
+  off_t offset = obj->ooffset + sect->offset;
+  if (offset < 0 || (size_t) offset + sect->size > obj->map_size)
+  {
+    rtems_rtl_set_error (EINVAL, "section outside of the file");
+    return NULL;
+  }
+  return (const uint8_t*) obj->map_base + offset;
+}
+
+/**
+ * Read the section's data from the object file.
+ */
+static bool
+rtems_rtl_elf_sect_read (const rtems_rtl_obj*      obj,
+                         int                       fd,
+                         const rtems_rtl_obj_sect* sect,
+                         void*                     buffer)
+{
+  uint8_t* base_offset;
+  size_t   len;
+
+  if (lseek (fd, obj->ooffset + sect->offset, SEEK_SET) < 0)
+  {
+    rtems_rtl_set_error (errno, "section load seek failed");
+    return false;
+  }
+
+  base_offset = buffer;
+  len = sect->size;
+
+  while (len)
+  {
+    ssize_t r = read (fd, base_offset, len);
+    if (r <= 0)
+    {
+      rtems_rtl_set_error (errno, "section load read failed");
+      return false;
+    }
+    base_offset += r;
+    len -= r;
+  }
+
+  return true;
+}
+
+/**
+ * A relocation record only needs the name of the symbol it references if the
+ * symbol is global or common.
+ */
+static bool
+rtems_rtl_elf_reloc_sym_named (const Elf_Sym* sym)
+{
+  return ELF_ST_TYPE (sym->st_info) == STT_OBJECT ||
+         ELF_ST_TYPE (sym->st_info) == STT_COMMON ||
+         ELF_ST_TYPE (sym->st_info) == STT_FUNC ||
+         ELF_ST_TYPE (sym->st_info) == STT_NOTYPE ||
+         ELF_ST_TYPE (sym->st_info) == STT_TLS ||
+         sym->st_shndx == SHN_COMMON;
+}
+
 /**
  * Relocation parser data.
  */
@@ -321,6 +389,47 @@ rtems_rtl_elf_reloc_parser (rtems_rtl_obj*      obj,
   return true;
 }
 
+/**
+ * Relocate a relocation record with a resolved symbol. The call is reentrant
+ * if the architecture's relocation handlers are reentrant.
+ */
+static bool
+rtems_rtl_elf_reloc_apply (rtems_rtl_obj*      obj,
+                           bool                is_rela,
+                           const void*         relbuf,
+                           rtems_rtl_obj_sect* targetsect,
+                           const Elf_Sym*      sym,
+                           const char*         symname,
+                           Elf_Word            symvalue)
+{
+  rtems_rtl_elf_rel_status rs;
+
+  if (is_rela)
+  {
+    const Elf_Rela* rela = (const Elf_Rela*) relbuf;
+    if (rtems_rtl_trace (RTEMS_RTL_TRACE_RELOC))
+      printf ("rtl: rela: sym:%s(%d)=%08jx type:%d off:%08jx addend:%d\n",
+              symname, (int) ELF_R_SYM (rela->r_info),
+              (uintmax_t) symvalue, (int) ELF_R_TYPE (rela->r_info),
+              (uintmax_t) rela->r_offset, (int) rela->r_addend);
+    rs = rtems_rtl_elf_relocate_rela (obj, rela, targetsect,
+                                      symname, sym->st_info, symvalue);
+  }
+  else
+  {
+    const Elf_Rel* rel = (const Elf_Rel*) relbuf;
+    if (rtems_rtl_trace (RTEMS_RTL_TRACE_RELOC))
+      printf ("rtl: rel: sym:%s(%d)=%08jx type:%d off:%08jx\n",
+              symname, (int) ELF_R_SYM (rel->r_info),
+              (uintmax_t) symvalue, (int) ELF_R_TYPE (rel->r_info),
+              (uintmax_t) rel->r_offset);
+    rs = rtems_rtl_elf_relocate_rel (obj, rel, targetsect,
+                                     symname, sym->st_info, symvalue);
+  }
+
+  return rs == rtems_rtl_elf_rel_no_error;
+}
+
 static bool
 rtems_rtl_elf_reloc_relocator (rtems_rtl_obj*      obj,
                                bool                is_rela,
@@ -366,33 +475,11 @@ rtems_rtl_elf_reloc_relocator (rtems_rtl_obj*      obj,
   }
   else
   {
-    rtems_rtl_obj*           sobj;
-    rtems_rtl_elf_rel_status rs;
+    rtems_rtl_obj* sobj;
 
-    if (is_rela)
-    {
-      if (rtems_rtl_trace (RTEMS_RTL_TRACE_RELOC))
-        printf ("rtl: rela: sym:%s(%d)=%08jx type:%d off:%08jx addend:%d\n",
-                symname, (int) ELF_R_SYM (rela->r_info),
-                (uintmax_t) symvalue, (int) ELF_R_TYPE (rela->r_info),
-                (uintmax_t) rela->r_offset, (int) rela->r_addend);
-      rs = rtems_rtl_elf_relocate_rela (obj, rela, targetsect,
-                                        symname, sym->st_info, symvalue);
-      if (rs != rtems_rtl_elf_rel_no_error)
-        return false;
-    }
-    else
-    {
-      if (rtems_rtl_trace (RTEMS_RTL_TRACE_RELOC))
-        printf ("rtl: rel: sym:%s(%d)=%08jx type:%d off:%08jx\n",
-                symname, (int) ELF_R_SYM (rel->r_info),
-                (uintmax_t) symvalue, (int) ELF_R_TYPE (rel->r_info),
-                (uintmax_t) rel->r_offset);
-      rs = rtems_rtl_elf_relocate_rel (obj, rel, targetsect,
-                                       symname, sym->st_info, symvalue);
-      if (rs != rtems_rtl_elf_rel_no_error)
-        return false;
-    }
+    if (!rtems_rtl_elf_reloc_apply (obj, is_rela, relbuf, targetsect,
+                                    sym, symname, symvalue))
+      return false;
 
     sobj = rtems_rtl_find_obj_with_symbol (symbol);
 
@@ -412,6 +499,405 @@ rtems_rtl_elf_reloc_relocator (rtems_rtl_obj*      obj,
   return true;
 }
 
+/**
+ * The number of dependent object files a relocation worker can hold. A record
+ * referencing another object file is relocated by the loading task if the
+ * worker cannot hold the object file.
+ */
+#define RTEMS_RTL_ELF_RELOC_DEPENDENTS (8)
+
+/**
+ * The records of a relocation section a worker relocates.
+ */
+typedef struct
+{
+  size_t         begin;      /**< The first record. */
+  size_t         end;        /**< The record after the last record. */
+  size_t         dependents; /**< The number of dependent object files. */
+  rtems_rtl_obj* depends[RTEMS_RTL_ELF_RELOC_DEPENDENTS]; /**< Dependents. */
+  bool           failed;     /**< A relocation failed. */
+} rtems_rtl_elf_reloc_part;
+
+/**
+ * A relocation section being relocated in parallel. The relocation records,
+ * the symbol table and the string table are in memory.
+ */
+typedef struct
+{
+  rtems_rtl_obj*            obj;          /**< The object file. */
+  rtems_rtl_obj_sect*       targetsect;   /**< The section being relocated. */
+  bool                      is_rela;      /**< The records are RELA. */
+  size_t                    reloc_size;   /**< The size of a record. */
+  size_t                    records;      /**< The number of records. */
+  const uint8_t*            relocs;       /**< The relocation records. */
+  const uint8_t*            syms;         /**< The symbol table. */
+  size_t                    nsyms;        /**< The number of symbols. */
+  const char*               strings;      /**< The string table. */
+  size_t                    strings_size; /**< The string table's size. */
+  void*                     buffers[3];   /**< The read section data. */
+  bool*                     deferred;     /**< Records relocated later. */
+  rtems_rtl_elf_reloc_part* parts;        /**< The parts of the workers. */
+} rtems_rtl_elf_reloc_job;
+
+static bool
+rtems_rtl_elf_reloc_image (rtems_rtl_obj*            obj,
+                           int                       fd,
+                           const rtems_rtl_obj_sect* sect,
+                           const void**              image,
+                           void**                    buffer)
+{
+  if (obj->map_base != NULL)
+  {
+    *image = rtems_rtl_elf_sect_mapped (obj, sect);
+    return *image != NULL;
+  }
+
+  *buffer = rtems_rtl_alloc_new (RTEMS_RTL_ALLOC_OBJECT, sect->size, false);
+  if (*buffer == NULL)
+  {
+    rtems_rtl_set_error (ENOMEM, "no memory for relocation section");
+    return false;
+  }
+
+  *image = *buffer;
+
+  return rtems_rtl_elf_sect_read (obj, fd, sect, *buffer);
+}
+
+static void
+rtems_rtl_elf_reloc_job_free (rtems_rtl_elf_reloc_job* job)
+{
+  int b;
+  for (b = 0; b < 3; ++b)
+    rtems_rtl_alloc_del (RTEMS_RTL_ALLOC_OBJECT, job->buffers[b]);
+  rtems_rtl_alloc_del (RTEMS_RTL_ALLOC_OBJECT, job->deferred);
+  rtems_rtl_alloc_del (RTEMS_RTL_ALLOC_OBJECT, job->parts);
+}
+
+static Elf_Addr
+rtems_rtl_elf_reloc_job_offset (const rtems_rtl_elf_reloc_job* job,
+                                size_t                         reloc)
+{
+  Elf_Rel rel;
+  memcpy (&rel, job->relocs + (reloc * job->reloc_size), sizeof (rel));
+  return rel.r_offset;
+}
+
+/**
+ * Read a relocation record and resolve the symbol it references. The call is
+ * reentrant.
+ */
+static bool
+rtems_rtl_elf_reloc_job_record (const rtems_rtl_elf_reloc_job* job,
+                                size_t                         reloc,
+                                void*                          relbuf,
+                                Elf_Sym*                       sym,
+                                const char**                   symname,
+                                rtems_rtl_obj_sym**            symbol,
+                                Elf_Word*                      symvalue,
+                                bool*                          resolved)
+{
+  Elf_Word info;
+
+  memcpy (relbuf, job->relocs + (reloc * job->reloc_size), job->reloc_size);
+
+  if (job->is_rela)
+    info = ((const Elf_Rela*) relbuf)->r_info;
+  else
+    info = ((const Elf_Rel*) relbuf)->r_info;
+
+  if (ELF_R_SYM (info) >= job->nsyms)
+  {
+    rtems_rtl_set_error (EINVAL, "invalid relocation symbol");
+    return false;
+  }
+
+  memcpy (sym, job->syms + (ELF_R_SYM (info) * sizeof (*sym)), sizeof (*sym));
+
+  *symname = NULL;
+  *symbol = NULL;
+  *symvalue = 0;
+  *resolved = true;
+
+  if (rtems_rtl_elf_reloc_sym_named (sym))
+  {
+    if (sym->st_name >= job->strings_size)
+    {
+      rtems_rtl_set_error (EINVAL, "invalid relocation symbol name");
+      return false;
+    }
+    *symname = job->strings + sym->st_name;
+  }
+
+  if (rtems_rtl_elf_rel_resolve_sym (ELF_R_TYPE (info)))
+    *resolved = rtems_rtl_elf_find_symbol (job->obj,
+                                           sym, *symname,
+                                           symbol, symvalue);
+
+  return true;
+}
+
+static bool
+rtems_rtl_elf_reloc_part_depends (rtems_rtl_elf_reloc_part* part,
+                                  rtems_rtl_obj*            sobj)
+{
+  size_t d;
+  for (d = 0; d < part->dependents; ++d)
+  {
+    if (part->depends[d] == sobj)
+      return true;
+  }
+  if (part->dependents >= RTEMS_RTL_ELF_RELOC_DEPENDENTS)
+    return false;
+  part->depends[part->dependents++] = sobj;
+  return true;
+}
+
+/**
+ * The relocation worker's job. Records with unresolved symbols are deferred
+ * because the unresolved table is not reentrant. The dependent object files
+ * are held by the worker and added by the loading task. The first error of a
+ * worker task is held by the workers and reported by the loading task.
+ */
+static void
+rtems_rtl_elf_reloc_worker_job (uint32_t worker, void* data)
+{
+  rtems_rtl_elf_reloc_job*  job = (rtems_rtl_elf_reloc_job*) data;
+  rtems_rtl_elf_reloc_part* part = &job->parts[worker];
+  size_t                    reloc;
+
+  for (reloc = part->begin; reloc < part->end; ++reloc)
+  {
+    uint8_t            relbuf[sizeof (Elf_Rela)];
+    rtems_rtl_obj_sym* symbol;
+    Elf_Sym            sym;
+    const char*        symname;
+    Elf_Word           symvalue;
+    bool               resolved;
+
+    if (!rtems_rtl_elf_reloc_job_record (job, reloc, relbuf,
+                                         &sym, &symname,
+                                         &symbol, &symvalue, &resolved))
+    {
+      part->failed = true;
+      return;
+    }
+
+    if (resolved && symbol != NULL)
+    {
+      rtems_rtl_obj* sobj = rtems_rtl_find_obj_with_symbol (symbol);
+      if (sobj != NULL && !rtems_rtl_elf_reloc_part_depends (part, sobj))
+        resolved = false;
+    }
+
+    if (!resolved)
+    {
+      job->deferred[reloc] = true;
+      continue;
+    }
+
+    if (!rtems_rtl_elf_reloc_apply (job->obj, job->is_rela, relbuf,
+                                    job->targetsect,
+                                    &sym, symname, symvalue))
+    {
+      part->failed = true;
+      return;
+    }
+  }
+}
+
+/**
+ * Should the relocation section be relocated in parallel?
+ */
+static bool
+rtems_rtl_elf_reloc_parallel (const rtems_rtl_obj_sect* sect)
+{
+  size_t reloc_size;
+
+  if (rtems_rtl_workers_count () <= 1 || !rtems_rtl_elf_relocate_reentrant ())
+    return false;
+
+  if ((sect->flags & RTEMS_RTL_OBJ_SECT_RELA) == RTEMS_RTL_OBJ_SECT_RELA)
+    reloc_size = sizeof (Elf_Rela);
+  else
+    reloc_size = sizeof (Elf_Rel);
+
+  return (sect->size / reloc_size) >= RTEMS_RTL_RELOC_PARALLEL_RECORDS;
+}
+
+/**
+ * Relocate the records of a relocation section in parallel. The records are
+ * split into a part for each worker. Relocation records in an object file do
+ * not overlap except for records relocating the same location together and
+ * these records are kept in a single part. The deferred records are relocated
+ * in order by the loading task once all workers have finished.
+ */
+static bool
+rtems_rtl_elf_relocate_parallel (rtems_rtl_obj*      obj,
+                                 int                 fd,
+                                 rtems_rtl_obj_sect* sect)
+{
+  rtems_rtl_elf_reloc_job job = { 0 };
+  rtems_rtl_obj_sect*     symsect;
+  rtems_rtl_obj_sect*     strtab;
+  const void*             image;
+  uint32_t                workers;
+  size_t                  begin;
+  size_t                  reloc;
+  uint32_t                w;
+
+  job.obj = obj;
+
+  /*
+   * Ignore the relocations if the target section does not exist or is not
+   * loaded.
+   */
+  job.targetsect = rtems_rtl_obj_find_section_by_index (obj, sect->info);
+  if (!job.targetsect)
+    return true;
+
+  if ((job.targetsect->flags & RTEMS_RTL_OBJ_SECT_LOAD) == 0)
+    return true;
+
+  symsect = rtems_rtl_obj_find_section (obj, ".symtab");
+  if (!symsect)
+  {
+    rtems_rtl_set_error (EINVAL, "no .symtab section");
+    return false;
+  }
+
+  strtab = rtems_rtl_obj_find_section (obj, ".strtab");
+  if (!strtab)
+  {
+    rtems_rtl_set_error (EINVAL, "no .strtab section");
+    return false;
+  }
+
+  job.is_rela = ((sect->flags & RTEMS_RTL_OBJ_SECT_RELA) ==
+                 RTEMS_RTL_OBJ_SECT_RELA) ? true : false;
+  job.reloc_size = job.is_rela ? sizeof (Elf_Rela) : sizeof (Elf_Rel);
+  job.records = sect->size / job.reloc_size;
+  job.nsyms = symsect->size / sizeof (Elf_Sym);
+  job.strings_size = strtab->size;
+
+  if (!rtems_rtl_elf_reloc_image (obj, fd, sect, &image, &job.buffers[0]))
+  {
+    rtems_rtl_elf_reloc_job_free (&job);
+    return false;
+  }
+  job.relocs = image;
+
+  if (!rtems_rtl_elf_reloc_image (obj, fd, symsect, &image, &job.buffers[1]))
+  {
+    rtems_rtl_elf_reloc_job_free (&job);
+    return false;
+  }
+  job.syms = image;
+
+  if (!rtems_rtl_elf_reloc_image (obj, fd, strtab, &image, &job.buffers[2]))
+  {
+    rtems_rtl_elf_reloc_job_free (&job);
+    return false;
+  }
+  job.strings = image;
+
+  workers = rtems_rtl_workers_count ();
+
+  job.parts = rtems_rtl_alloc_new (RTEMS_RTL_ALLOC_OBJECT,
+                                   sizeof (rtems_rtl_elf_reloc_part) * workers,
+                                   true);
+  job.deferred = rtems_rtl_alloc_new (RTEMS_RTL_ALLOC_OBJECT,
+                                      sizeof (bool) * job.records,
+                                      true);
+  if (job.parts == NULL || job.deferred == NULL)
+  {
+    rtems_rtl_set_error (ENOMEM, "no memory for relocation workers");
+    rtems_rtl_elf_reloc_job_free (&job);
+    return false;
+  }
+
+  begin = 0;
+  for (w = 0; w < workers; ++w)
+  {
+    size_t end = job.records;
+    if (w < (workers - 1))
+    {
+      end = begin + (job.records / workers);
+      while (end > begin && end < job.records &&
+             rtems_rtl_elf_reloc_job_offset (&job, end) ==
+             rtems_rtl_elf_reloc_job_offset (&job, end - 1))
+        ++end;
+    }
+    job.parts[w].begin = begin;
+    job.parts[w].end = end;
+    begin = end;
+  }
+
+  if (rtems_rtl_trace (RTEMS_RTL_TRACE_RELOC))
+    printf ("rtl: relocation: %s, syms:%s, records:%zu workers:%" PRIu32 "\n",
+            sect->name, symsect->name, job.records, workers);
+
+  rtems_rtl_workers_run (rtems_rtl_elf_reloc_worker_job, &job);
+
+  for (w = 0; w < workers; ++w)
+  {
+    if (job.parts[w].failed)
+    {
+      rtems_rtl_workers_report_error (w);
+      rtems_rtl_elf_reloc_job_free (&job);
+      return false;
+    }
+  }
+
+  for (w = 0; w < workers; ++w)
+  {
+    size_t d;
+    for (d = 0; d < job.parts[w].dependents; ++d)
+    {
+      rtems_rtl_obj* sobj = job.parts[w].depends[d];
+      if (rtems_rtl_trace (RTEMS_RTL_TRACE_DEPENDENCY))
+        printf ("rtl: depend: %s -> %s\n", obj->oname, sobj->oname);
+      if (rtems_rtl_obj_add_dependent (obj, sobj))
+        rtems_rtl_obj_inc_reference (sobj);
+    }
+  }
+
+  for (reloc = 0; reloc < job.records; ++reloc)
+  {
+    if (job.deferred[reloc])
+    {
+      uint8_t            relbuf[sizeof (Elf_Rela)];
+      rtems_rtl_obj_sym* symbol;
+      Elf_Sym            sym;
+      const char*        symname;
+      Elf_Word           symvalue;
+      bool               resolved;
+
+      if (!rtems_rtl_elf_reloc_job_record (&job, reloc, relbuf,
+                                           &sym, &symname,
+                                           &symbol, &symvalue, &resolved) ||
+          !rtems_rtl_elf_reloc_relocator (obj,
+                                          job.is_rela, relbuf, job.targetsect,
+                                          symbol, &sym, symname, symvalue,
+                                          resolved, NULL))
+      {
+        rtems_rtl_elf_reloc_job_free (&job);
+        return false;
+      }
+    }
+  }
+
+  rtems_rtl_elf_reloc_job_free (&job);
+
+  /*
+   * Set the unresolved externals status if there are unresolved externals.
+   */
+  if (obj->unresolved)
+    obj->flags |= RTEMS_RTL_OBJ_UNRESOLVED;
+
+  return true;
+}
+
 static bool
 rtems_rtl_elf_relocate_worker (rtems_rtl_obj*              obj,
                                int                         fd,
@@ -510,12 +996,7 @@ rtems_rtl_elf_relocate_worker (rtems_rtl_obj*              obj,
     /*
      * Only need the name of the symbol if global or a common symbol.
      */
-    if (ELF_ST_TYPE (sym.st_info) == STT_OBJECT ||
-        ELF_ST_TYPE (sym.st_info) == STT_COMMON ||
-        ELF_ST_TYPE (sym.st_info) == STT_FUNC ||
-        ELF_ST_TYPE (sym.st_info) == STT_NOTYPE ||
-        ELF_ST_TYPE (sym.st_info) == STT_TLS ||
-        sym.st_shndx == SHN_COMMON)
+    if (rtems_rtl_elf_reloc_sym_named (&sym))
     {
       size_t len;
       off = obj->ooffset + strtab->offset + sym.st_name;
@@ -577,29 +1058,23 @@ rtems_rtl_elf_relocs_locator (rtems_rtl_obj*      obj,
                               rtems_rtl_obj_sect* sect,
                               void*               data)
 {
+  if (rtems_rtl_elf_reloc_parallel (sect))
+    return rtems_rtl_elf_relocate_parallel (obj, fd, sect);
   return rtems_rtl_elf_relocate_worker (obj, fd, sect,
                                         rtems_rtl_elf_reloc_relocator, data);
 }
 
 bool
 rtems_rtl_obj_relocate_unresolved (rtems_rtl_unresolv_reloc* reloc,
+                                   rtems_rtl_obj_sect*       sect,
                                    rtems_rtl_obj_sym*        sym)
 {
-  rtems_rtl_obj_sect*      sect;
   bool                     is_rela;
   Elf_Word                 symvalue;
-  rtems_rtl_obj*           sobj;
   rtems_rtl_elf_rel_status rs;
 
   is_rela = reloc->flags & 1;
 
-  sect = rtems_rtl_obj_find_section_by_index (reloc->obj, reloc->sect);
-  if (!sect)
-  {
-    rtems_rtl_set_error (ENOEXEC, "unresolved sect not found");
-    return false;
-  }
-
   symvalue = (Elf_Word) (intptr_t) sym->value;
   if (is_rela)
   {
@@ -638,20 +1113,6 @@ rtems_rtl_obj_relocate_unresolved (rtems_rtl_unresolv_reloc* reloc,
       reloc->obj->flags &= ~RTEMS_RTL_OBJ_UNRESOLVED;
   }
 
-  sobj = rtems_rtl_find_obj_with_symbol (sym);
-
-  if (rtems_rtl_trace (RTEMS_RTL_TRACE_DEPENDENCY))
-    printf ("rtl: depend: %s -> %s:%s\n",
-            reloc->obj->oname,
-            sobj == NULL ? "not-found" : sobj->oname,
-            sym->name);
-
-  if (sobj != NULL)
-  {
-    if (rtems_rtl_obj_add_dependent (reloc->obj, sobj))
-      rtems_rtl_obj_inc_reference (sobj);
-  }
-
   return true;
 }
 
@@ -1168,7 +1629,6 @@ rtems_rtl_elf_symbols_load (rtems_rtl_obj*      obj,
           value = symbol.st_value;
         }
 
-        rtems_chain_set_off_chain (&osym->node);
         memcpy (string, name, strlen (name) + 1);
         osym->name = string;
         osym->value = (void*) (intptr_t) value;
@@ -1227,8 +1687,8 @@ rtems_rtl_elf_symbols_locate (rtems_rtl_obj*      obj,
       }
   }
 
-  if (obj->global_size)
-    rtems_rtl_symbol_obj_add (obj);
+  if (obj->global_size && !rtems_rtl_symbol_obj_add (obj))
+    return false;
 
   return true;
 }
@@ -1269,31 +1729,19 @@ rtems_rtl_elf_loader (rtems_rtl_obj*      obj,
                       rtems_rtl_obj_sect* sect,
                       void*               data)
 {
-  uint8_t* base_offset;
-  size_t   len;
-
-  if (lseek (fd, obj->ooffset + sect->offset, SEEK_SET) < 0)
-  {
-    rtems_rtl_set_error (errno, "section load seek failed");
-    return false;
-  }
-
-  base_offset = sect->base;
-  len = sect->size;
-
-  while (len)
+  /*
+   * Copy the section from the memory map of the file if mapped.
+   */
+  if (obj->map_base != NULL)
   {
-    ssize_t r = read (fd, base_offset, len);
-    if (r <= 0)
-    {
-      rtems_rtl_set_error (errno, "section load read failed");
+    const void* image = rtems_rtl_elf_sect_mapped (obj, sect);
+    if (image == NULL)
       return false;
-    }
-    base_offset += r;
-    len -= r;
+    memcpy (sect->base, image, sect->size);
+    return true;
   }
 
-  return true;
+  return rtems_rtl_elf_sect_read (obj, fd, sect, sect->base);
 }
 
 static bool
@@ -1753,6 +2201,12 @@ rtems_rtl_elf_file_load (rtems_rtl_obj* obj, int fd)
   if (!rtems_rtl_obj_relocate (obj, fd, rtems_rtl_elf_relocs_parser, &relocs))
     return false;
 
+  /*
+   * Use the sections that are not relocated in place if the file is mapped
+   * into memory.
+   */
+  rtems_rtl_obj_map_sections (obj);
+
   /*
    * Lock the allocator so the section memory and the trampoline memory are as
    * clock as possible.
@@ -168,6 +168,16 @@ bool rtems_rtl_elf_rel_resolve_sym (Elf_Word type);
  */
 size_t rtems_rtl_elf_relocate_tramp_max_size (void);
 
+/**
+ * Architecture specific check if the relocation handlers can be called
+ * concurrently for different relocation records of a section and in any
+ * order.
+ *
+ * @retval true The relocation handlers are reentrant.
+ * @retval false The relocation records have to be relocated in order.
+ */
+bool rtems_rtl_elf_relocate_reentrant (void);
+
 /**
  * Architecture specific relocation trampoline handler compiled in for a
  * specific architecture by the build system. The handler determines if the
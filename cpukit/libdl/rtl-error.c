@@ -44,16 +44,20 @@
 
 #include <rtems/rtl/rtl.h>
 #include "rtl-error.h"
+#include "rtl-workers.h"
 
 void
 rtems_rtl_set_error (int error, const char* format, ...)
 {
-  rtems_rtl_data* rtl = rtems_rtl_lock ();
-  va_list         ap;
+  va_list ap;
   va_start (ap, format);
-  rtl->last_errno = error;
-  vsnprintf (rtl->last_error, sizeof (rtl->last_error), format, ap);
-  rtems_rtl_unlock ();
+  if (!rtems_rtl_workers_set_error (error, format, ap))
+  {
+    rtems_rtl_data* rtl = rtems_rtl_lock ();
+    rtl->last_errno = error;
+    vsnprintf (rtl->last_error, sizeof (rtl->last_error), format, ap);
+    rtems_rtl_unlock ();
+  }
   va_end (ap);
 }
 
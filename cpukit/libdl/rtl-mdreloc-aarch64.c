@@ -167,6 +167,12 @@ rtems_rtl_elf_relocate_tramp_max_size (void)
   return 16;
 }
 
+bool
+rtems_rtl_elf_relocate_reentrant (void)
+{
+  return true;
+}
+
 uint32_t
 rtems_rtl_elf_section_flags (const rtems_rtl_obj* obj,
                              const Elf_Shdr*      shdr)
@@ -417,6 +423,7 @@ rtems_rtl_elf_reloc_rela (rtems_rtl_obj*            obj,
       target = (intptr_t)target >> 2;
 
       if (((Elf_Sword)target > 0x1FFFFFF) || ((Elf_Sword)target < -0x2000000)) {
+        void*    tramp;
         Elf_Word tramp_addr;
         size_t   tramp_size = get_veneer_size(ELF_R_TYPE(rela->r_info));
 
@@ -426,15 +433,16 @@ rtems_rtl_elf_reloc_rela (rtems_rtl_obj*            obj,
           return rtems_rtl_elf_rel_tramp_add;
         }
 
-        if (!rtems_rtl_obj_has_tramp_space (obj, tramp_size)) {
+        tramp = rtems_rtl_obj_tramp_alloc (obj, tramp_size);
+        if (tramp == NULL) {
           rtems_rtl_set_error (EINVAL,
                                "%s: CALL/JUMP26: overflow: no tramp memory",
                                sect->name);
           return rtems_rtl_elf_rel_failure;
         }
 
-        tramp_addr = ((Elf_Addr) obj->tramp_brk) | (symvalue & 1);
-        obj->tramp_brk = set_veneer(obj->tramp_brk, symvalue);
+        tramp_addr = ((Elf_Addr) tramp) | (symvalue & 1);
+        set_veneer(tramp, symvalue);
 
         target = tramp_addr + rela->r_addend - (uintptr_t)where;
         target = (uintptr_t)target >> 2;
@@ -114,6 +114,12 @@ rtems_rtl_elf_relocate_tramp_max_size (void)
   return 8;
 }
 
+bool
+rtems_rtl_elf_relocate_reentrant (void)
+{
+  return true;
+}
+
 uint32_t
 rtems_rtl_elf_section_flags (const rtems_rtl_obj* obj,
                              const Elf_Shdr*      shdr)
@@ -259,6 +265,7 @@ rtems_rtl_elf_reloc_rel (rtems_rtl_obj*            obj,
       tmp = (Elf_Sword)tmp >> 2;
 
       if (((Elf_Sword)tmp > 0x7fffff) || ((Elf_Sword)tmp < -0x800000)) {
+        void*    tramp;
         Elf_Word tramp_addr;
         size_t   tramp_size = get_veneer_size(ELF_R_TYPE(rel->r_info));
 
@@ -268,15 +275,16 @@ rtems_rtl_elf_reloc_rel (rtems_rtl_obj*            obj,
           return rtems_rtl_elf_rel_tramp_add;
         }
 
-        if (!rtems_rtl_obj_has_tramp_space (obj, tramp_size)) {
+        tramp = rtems_rtl_obj_tramp_alloc (obj, tramp_size);
+        if (tramp == NULL) {
           rtems_rtl_set_error (EINVAL,
                                "%s: CALL/JUMP24: overflow: no tramp memory",
                                sect->name);
           return rtems_rtl_elf_rel_failure;
         }
 
-        tramp_addr = ((Elf_Addr) obj->tramp_brk) | (symvalue & 1);
-        obj->tramp_brk = set_veneer(obj->tramp_brk, symvalue);
+        tramp_addr = ((Elf_Addr) tramp) | (symvalue & 1);
+        set_veneer(tramp, symvalue);
 
         tmp = tramp_addr + (addend << 2) - (Elf_Addr)where;
         tmp = (Elf_Sword)tmp >> 2;
@@ -438,6 +446,7 @@ rtems_rtl_elf_reloc_rel (rtems_rtl_obj*            obj,
       tmp = tmp - (Elf_Addr)where;
 
       if (((Elf_Sword)tmp > 0x7fffff) || ((Elf_Sword)tmp < -0x800000)) {
+        void*    tramp;
         Elf_Word tramp_addr;
         size_t   tramp_size = get_veneer_size(ELF_R_TYPE(rel->r_info));
 
@@ -448,15 +457,16 @@ rtems_rtl_elf_reloc_rel (rtems_rtl_obj*            obj,
           return rtems_rtl_elf_rel_tramp_add;
         }
 
-        if (!rtems_rtl_obj_has_tramp_space (obj, tramp_size)) {
+        tramp = rtems_rtl_obj_tramp_alloc (obj, tramp_size);
+        if (tramp == NULL) {
           rtems_rtl_set_error (EINVAL,
                                "%s: THM_CALL/JUMP24: overflow: no tramp memory",
                                sect->name);
           return rtems_rtl_elf_rel_failure;
         }
 
-        tramp_addr = ((Elf_Addr) obj->tramp_brk) | (symvalue & 1);
-        obj->tramp_brk = set_veneer(obj->tramp_brk, symvalue);
+        tramp_addr = ((Elf_Addr) tramp) | (symvalue & 1);
+        set_veneer(tramp, symvalue);
 
 
         tmp = tramp_addr + addend;
@@ -108,6 +108,12 @@ rtems_rtl_elf_relocate_tramp_max_size (void)
   return 0;
 }
 
+bool
+rtems_rtl_elf_relocate_reentrant (void)
+{
+  return true;
+}
+
 rtems_rtl_elf_rel_status
 rtems_rtl_elf_relocate_rela_tramp (rtems_rtl_obj*            obj,
                                    const Elf_Rela*           rela,
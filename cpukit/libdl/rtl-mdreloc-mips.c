@@ -102,6 +102,16 @@ rtems_rtl_elf_relocate_tramp_max_size (void)
   return 0;
 }
 
+bool
+rtems_rtl_elf_relocate_reentrant (void)
+{
+  /*
+   * The HI16 records are held until the matching LO16 record is relocated
+   * so the records are relocated in order.
+   */
+  return false;
+}
+
 rtems_rtl_elf_rel_status
 rtems_rtl_elf_relocate_rela_tramp (rtems_rtl_obj*            obj,
                                    const Elf_Rela*           rela,
@@ -216,6 +216,12 @@ rtems_rtl_elf_relocate_tramp_max_size (void)
   return 4 * 4;
 }
 
+bool
+rtems_rtl_elf_relocate_reentrant (void)
+{
+  return true;
+}
+
 static void*
 set_veneer (void* tramopline, Elf_Addr target)
 {
@@ -311,6 +317,7 @@ rtems_rtl_elf_reloc_rela (rtems_rtl_obj*            obj,
 
       tmp = (symvalue + rela->r_addend) >> 2;
       if (tmp > ((1<<bits) - 1 )) {
+        void*    tramp;
         Elf_Word tramp_addr;
         size_t   tramp_size = get_veneer_size(ELF_R_TYPE(rela->r_info));
         if (parsing) {
@@ -318,16 +325,16 @@ rtems_rtl_elf_reloc_rela (rtems_rtl_obj*            obj,
             printf ("rtl: ADDR14/ADDR24 tramp add\n");
           return rtems_rtl_elf_rel_tramp_add;
         }
-        if (!rtems_rtl_obj_has_tramp_space (obj, tramp_size)) {
+        tramp = rtems_rtl_obj_tramp_alloc (obj, tramp_size);
+        if (tramp == NULL) {
           if (rtems_rtl_trace (RTEMS_RTL_TRACE_RELOC))
             printf ("rtl: ADDR14/ADDR24 no tramp slot: %s\n", rtems_rtl_obj_oname (obj));
           rtems_rtl_set_error (ENOMEM, "%s: tramp: no slot: ADDR14/ADDR24", sect->name);
           return rtems_rtl_elf_rel_failure;
         }
         needs_tramp = true;
-        tramp_addr = (Elf_Addr) obj->tramp_brk;
-        obj->tramp_brk = set_veneer(obj->tramp_brk,
-                                    symvalue + rela->r_addend);
+        tramp_addr = (Elf_Addr) tramp;
+        set_veneer(tramp, symvalue + rela->r_addend);
         tmp = *where;
         tmp &= ~mask;
         tmp |= (tramp_addr + rela->r_addend) & mask;
@@ -409,6 +416,7 @@ rtems_rtl_elf_reloc_rela (rtems_rtl_obj*            obj,
       tmp =((int) (symvalue + rela->r_addend - (Elf_Addr)where)) >> 2;
       if (((Elf_Sword)tmp > ((1<<(bits-1)) - 1)) ||
           ((Elf_Sword)tmp < -(1<<(bits-1)))) {
+        void*    tramp;
         Elf_Word tramp_addr;
         size_t   tramp_size = get_veneer_size(ELF_R_TYPE(rela->r_info));
         if (parsing) {
@@ -416,16 +424,16 @@ rtems_rtl_elf_reloc_rela (rtems_rtl_obj*            obj,
             printf ("rtl: REL24/REL14 tramp add\n");
           return rtems_rtl_elf_rel_tramp_add;
         }
-        if (!rtems_rtl_obj_has_tramp_space (obj, tramp_size)) {
+        tramp = rtems_rtl_obj_tramp_alloc (obj, tramp_size);
+        if (tramp == NULL) {
           if (rtems_rtl_trace (RTEMS_RTL_TRACE_RELOC))
             printf ("rtl: REL24/REL14 no tramp slot: %s\n", rtems_rtl_obj_oname (obj));
           rtems_rtl_set_error (ENOMEM, "%s: tramp: no slot: REL24/REL14", sect->name);
           return rtems_rtl_elf_rel_failure;
         }
         needs_tramp = true;
-        tramp_addr = (Elf_Addr) obj->tramp_brk;
-        obj->tramp_brk = set_veneer(obj->tramp_brk,
-                                    symvalue + rela->r_addend);
+        tramp_addr = (Elf_Addr) tramp;
+        set_veneer(tramp, symvalue + rela->r_addend);
         tmp = *where;
         tmp &= ~mask;
         tmp |= (tramp_addr + rela->r_addend - (Elf_Addr)where) & mask;
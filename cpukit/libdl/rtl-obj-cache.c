@@ -58,6 +58,7 @@ rtems_rtl_obj_cache_open (rtems_rtl_obj_cache* cache, size_t size)
   cache->offset    = 0;
   cache->size      = size;
   cache->level     = 0;
+  cache->map       = NULL;
   cache->buffer    = rtems_rtl_alloc_new (RTEMS_RTL_ALLOC_OBJECT, size, false);
   if (!cache->buffer)
   {
@@ -77,6 +78,7 @@ rtems_rtl_obj_cache_close (rtems_rtl_obj_cache* cache)
   cache->fd        = -1;
   cache->file_size = 0;
   cache->level     = 0;
+  cache->map       = NULL;
 }
 
 void
@@ -88,6 +90,22 @@ rtems_rtl_obj_cache_flush (rtems_rtl_obj_cache* cache)
   cache->file_size = 0;
   cache->offset    = 0;
   cache->level     = 0;
+  cache->map       = NULL;
+}
+
+void
+rtems_rtl_obj_cache_map (rtems_rtl_obj_cache* cache,
+                         int                  fd,
+                         const void*          map,
+                         size_t               size)
+{
+  if (rtems_rtl_trace (RTEMS_RTL_TRACE_CACHE))
+    printf ("rtl: cache: %2d: map: %p size=%zu\n", fd, map, size);
+  cache->fd        = fd;
+  cache->file_size = size;
+  cache->offset    = 0;
+  cache->level     = 0;
+  cache->map       = map;
 }
 
 bool
@@ -132,6 +150,15 @@ rtems_rtl_obj_cache_read (rtems_rtl_obj_cache* cache,
         printf ("rtl: cache: %2d: truncate length=%d\n", fd, (int) *length);
 
     }
+
+    /*
+     * Reference the data in the file's memory map.
+     */
+    if (cache->map != NULL)
+    {
+      *buffer = (void*) (cache->map + offset);
+      return true;
+    }
   }
 
   while (true)
@@ -42,8 +42,11 @@
 #include <stdlib.h>
 #include <stdio.h>
 #include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
 
 #include <rtems/libio_.h>
+#include <rtems/rtems/intr.h>
 
 #include <rtems/rtl/rtl.h>
 #include "rtl-chain-iterator.h"
@@ -70,6 +73,12 @@
 #define RTEMS_RTL_ELF_LOADER_COUNT 0
 #endif
 
+/**
+ * The trampoline allocator lock. The relocation workers allocate trampolines
+ * concurrently.
+ */
+RTEMS_INTERRUPT_LOCK_DEFINE (static, rtems_rtl_obj_tramp_lock, "RTL Tramp")
+
 /**
  * The table of supported loader formats.
  */
@@ -122,6 +131,19 @@ rtems_rtl_obj_free_names (rtems_rtl_obj* obj)
     rtems_rtl_alloc_del (RTEMS_RTL_ALLOC_OBJECT, (void*) obj->fname);
 }
 
+static void
+rtems_rtl_obj_unmap (rtems_rtl_obj* obj)
+{
+  if (obj->map_base != NULL)
+  {
+    if (rtems_rtl_trace (RTEMS_RTL_TRACE_LOAD_SECT))
+      printf ("rtl: unmap: %p\n", obj->map_base);
+    munmap (obj->map_base, obj->map_size);
+    obj->map_base = NULL;
+    obj->map_size = 0;
+  }
+}
+
 bool
 rtems_rtl_obj_free (rtems_rtl_obj* obj)
 {
@@ -134,6 +156,7 @@ rtems_rtl_obj_free (rtems_rtl_obj* obj)
     rtems_chain_extract (&obj->link);
   rtems_rtl_alloc_module_del (&obj->text_base, &obj->const_base, &obj->eh_base,
                               &obj->data_base, &obj->bss_base);
+  rtems_rtl_obj_unmap (obj);
   rtems_rtl_obj_erase_sections (obj);
   rtems_rtl_obj_erase_dependents (obj);
   rtems_rtl_symbol_obj_erase (obj);
@@ -320,7 +343,8 @@ static bool
 rtems_rtl_obj_sect_summer (rtems_chain_node* node, void* data)
 {
   rtems_rtl_obj_sect* sect = (rtems_rtl_obj_sect*) node;
-  if ((sect->flags & RTEMS_RTL_OBJ_SECT_ARCH_ALLOC) == 0)
+  if ((sect->flags & (RTEMS_RTL_OBJ_SECT_ARCH_ALLOC |
+                      RTEMS_RTL_OBJ_SECT_MAPPED)) == 0)
   {
     rtems_rtl_obj_sect_summer_data* summer = data;
     if ((sect->flags & summer->mask) == summer->mask)
@@ -548,6 +572,23 @@ rtems_rtl_obj_sect_match_index (rtems_chain_node* node, void* data)
   return true;
 }
 
+void*
+rtems_rtl_obj_tramp_alloc (rtems_rtl_obj* obj, size_t size)
+{
+  rtems_interrupt_lock_context lock_context;
+  void*                        tramp = NULL;
+
+  rtems_interrupt_lock_acquire (&rtems_rtl_obj_tramp_lock, &lock_context);
+  if (rtems_rtl_obj_has_tramp_space (obj, size))
+  {
+    tramp = obj->tramp_brk;
+    obj->tramp_brk = (uint8_t*) obj->tramp_brk + size;
+  }
+  rtems_interrupt_lock_release (&rtems_rtl_obj_tramp_lock, &lock_context);
+
+  return tramp;
+}
+
 rtems_rtl_obj_sect*
 rtems_rtl_obj_find_section_by_index (const rtems_rtl_obj* obj,
                                      int                  index)
@@ -1043,7 +1084,9 @@ rtems_rtl_obj_sections_locate (uint32_t            mask,
     {
       if (sect->load_order == order)
       {
-        if ((sect->flags & RTEMS_RTL_OBJ_SECT_ARCH_ALLOC) == 0)
+        bool mapped = rtems_rtl_obj_sect_is_mapped (sect);
+
+        if (!mapped && (sect->flags & RTEMS_RTL_OBJ_SECT_ARCH_ALLOC) == 0)
         {
           base_offset = rtems_rtl_obj_align (base_offset, sect->alignment);
           sect->base = base + base_offset;
@@ -1055,7 +1098,7 @@ rtems_rtl_obj_sections_locate (uint32_t            mask,
                   order, sect->name, sect->base, sect->size,
                   sect->flags, sect->alignment, sect->link);
 
-        if (sect->base)
+        if (!mapped && sect->base)
           base_offset += sect->size;
 
         ++order;
@@ -1069,6 +1112,87 @@ rtems_rtl_obj_sections_locate (uint32_t            mask,
   }
 }
 
+/**
+ * Relocation target iterator data.
+ */
+typedef struct
+{
+  int  section;   /**< The section to check. */
+  bool relocated; /**< A relocation section targets the section. */
+} rtems_rtl_obj_sect_reloc_data;
+
+static bool
+rtems_rtl_obj_sect_reloc_target (rtems_chain_node* node, void* data)
+{
+  rtems_rtl_obj_sect*            sect = (rtems_rtl_obj_sect*) node;
+  rtems_rtl_obj_sect_reloc_data* rd = data;
+  const uint32_t                 mask = (RTEMS_RTL_OBJ_SECT_REL |
+                                         RTEMS_RTL_OBJ_SECT_RELA);
+  if ((sect->flags & mask) != 0 && sect->info == rd->section)
+  {
+    rd->relocated = true;
+    return false;
+  }
+  return true;
+}
+
+static bool
+rtems_rtl_obj_sect_mapper (rtems_chain_node* node, void* data)
+{
+  rtems_rtl_obj_sect*           sect = (rtems_rtl_obj_sect*) node;
+  rtems_rtl_obj*                obj = data;
+  rtems_rtl_obj_sect_reloc_data rd;
+  const uint32_t                load = RTEMS_RTL_OBJ_SECT_LOAD;
+  const uint32_t                types = (RTEMS_RTL_OBJ_SECT_TEXT |
+                                         RTEMS_RTL_OBJ_SECT_CONST);
+  const uint32_t                skip = (RTEMS_RTL_OBJ_SECT_ARCH_ALLOC |
+                                        RTEMS_RTL_OBJ_SECT_LINK |
+                                        RTEMS_RTL_OBJ_SECT_WRITE);
+  off_t                         offset;
+  uint8_t*                      base;
+
+  if (sect->size == 0 ||
+      (sect->flags & load) != load ||
+      (sect->flags & types) == 0 ||
+      (sect->flags & skip) != 0)
+    return true;
+
+  offset = obj->ooffset + sect->offset;
+  if (offset < 0 || (size_t) offset + sect->size > obj->map_size)
+    return true;
+
+  base = (uint8_t*) obj->map_base + offset;
+  if (sect->alignment > 1 && ((uintptr_t) base % sect->alignment) != 0)
+    return true;
+
+  /*
+   * A relocated section is written to so it cannot be used in place.
+   */
+  rd.section = sect->section;
+  rd.relocated = false;
+  rtems_rtl_chain_iterate (&obj->sections,
+                           rtems_rtl_obj_sect_reloc_target,
+                           &rd);
+  if (rd.relocated)
+    return true;
+
+  sect->base = base;
+  sect->flags |= RTEMS_RTL_OBJ_SECT_MAPPED;
+
+  if (rtems_rtl_trace (RTEMS_RTL_TRACE_LOAD_SECT))
+    printf ("rtl: map sect: %s -> %p (s:%zi)\n",
+            sect->name, sect->base, sect->size);
+
+  return true;
+}
+
+void
+rtems_rtl_obj_map_sections (rtems_rtl_obj* obj)
+{
+  if (obj->map_base != NULL)
+    rtems_rtl_chain_iterate (&obj->sections, rtems_rtl_obj_sect_mapper, obj);
+}
+
 bool
 rtems_rtl_obj_alloc_sections (rtems_rtl_obj*             obj,
                               int                        fd,
@@ -1207,7 +1331,13 @@ rtems_rtl_obj_sections_loader (uint32_t                   mask,
                   order, sect->name, sect->base, sect->size,
                   sect->flags, sect->alignment, sect->link);
 
-        if ((sect->flags & RTEMS_RTL_OBJ_SECT_LOAD) == RTEMS_RTL_OBJ_SECT_LOAD)
+        if (rtems_rtl_obj_sect_is_mapped (sect))
+        {
+          /*
+           * The section is used in place in the memory map of the file.
+           */
+        }
+        else if ((sect->flags & RTEMS_RTL_OBJ_SECT_LOAD) == RTEMS_RTL_OBJ_SECT_LOAD)
         {
           if (!handler (obj, fd, sect, data))
           {
@@ -1388,6 +1518,37 @@ rtems_rtl_obj_orphaned (rtems_rtl_obj* obj)
           rtems_rtl_obj_get_reference (obj) == 0);
 }
 
+static void
+rtems_rtl_obj_map (rtems_rtl_obj* obj, int fd)
+{
+  struct stat sb;
+  void*       map;
+
+  if (fstat (fd, &sb) < 0 || !S_ISREG (sb.st_mode) || sb.st_size <= 0)
+    return;
+
+  /*
+   * RTEMS cannot protect memory so a mapping has to be writable. The loader
+   * does not write to the map.
+   */
+  map = mmap (NULL, sb.st_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  if (map == MAP_FAILED)
+  {
+    if (rtems_rtl_trace (RTEMS_RTL_TRACE_LOAD_SECT))
+      printf ("rtl: map: %s: not supported\n", rtems_rtl_obj_fname (obj));
+    return;
+  }
+
+  if (rtems_rtl_trace (RTEMS_RTL_TRACE_LOAD_SECT))
+    printf ("rtl: map: %s -> %p (s:%zu)\n",
+            rtems_rtl_obj_fname (obj), map, (size_t) sb.st_size);
+
+  obj->map_base = map;
+  obj->map_size = sb.st_size;
+
+  rtems_rtl_obj_caches_map (fd, map, sb.st_size);
+}
+
 bool
 rtems_rtl_obj_load (rtems_rtl_obj* obj)
 {
@@ -1426,6 +1587,12 @@ rtems_rtl_obj_load (rtems_rtl_obj* obj)
     }
   }
 
+  /*
+   * Map the file into memory if the file system supports it. The loader then
+   * references the file's data in place rather than reading a copy.
+   */
+  rtems_rtl_obj_map (obj, fd);
+
   /*
    * Call the format specific loader.
    */
@@ -1435,6 +1602,17 @@ rtems_rtl_obj_load (rtems_rtl_obj* obj)
     return false;
   }
 
+  /*
+   * Only keep the map if a section is used in place.
+   */
+  if (obj->map_base != NULL &&
+      rtems_rtl_obj_find_section_by_mask (obj, -1,
+                                          RTEMS_RTL_OBJ_SECT_MAPPED) == NULL)
+  {
+    rtems_rtl_obj_caches_flush ();
+    rtems_rtl_obj_unmap (obj);
+  }
+
    /*
     * For GDB
     */
@@ -675,7 +675,6 @@ rtems_rtl_rap_load_symbols (rtems_rtl_rap* rap, rtems_rtl_obj* obj)
       return false;
     }
 
-    rtems_chain_set_off_chain (&gsym->node);
     gsym->name = rap->strtab + name;
     gsym->value = (uint8_t*) (value + symsect->base);
     gsym->data = data & 0xffff;
@@ -690,8 +689,8 @@ rtems_rtl_rap_load_symbols (rtems_rtl_rap* rap, rtems_rtl_obj* obj)
     ++gsym;
   }
 
-  if (obj->global_syms)
-    rtems_rtl_symbol_obj_add (obj);
+  if (obj->global_syms && !rtems_rtl_symbol_obj_add (obj))
+    return false;
 
   return true;
 }
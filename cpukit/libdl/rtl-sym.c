@@ -58,48 +58,226 @@ static rtems_rtl_obj_sym global_sym_add =
   .value = (void*) rtems_rtl_base_sym_global_add
 };
 
-static uint_fast32_t
+uint32_t
 rtems_rtl_symbol_hash (const char *s)
 {
-  uint_fast32_t h = 5381;
+  uint32_t      h = 5381;
   unsigned char c;
   for (c = *s; c != '\0'; c = *++s)
     h = h * 33 + c;
-  return h & 0xffffffff;
+  return h;
 }
 
+/*
+ * The table is a power of two in size. Use the top bits of the product with
+ * the golden ratio as the home slot so all bits of the hash contribute.
+ */
+static size_t
+rtems_rtl_symbol_slot_home (const rtems_rtl_symbols* symbols, uint32_t hash)
+{
+  return (size_t) ((hash * UINT32_C (0x9e3779b1)) >> symbols->shift);
+}
+
+static unsigned int
+rtems_rtl_symbol_table_shift (size_t nslots)
+{
+  unsigned int shift = 32;
+  while (nslots > 1)
+  {
+    nslots >>= 1;
+    --shift;
+  }
+  return shift;
+}
+
+static rtems_rtl_symbol_slot*
+rtems_rtl_symbol_table_lookup (const rtems_rtl_symbols* symbols,
+                               const char*              name,
+                               uint32_t                 hash)
+{
+  size_t mask = symbols->nslots - 1;
+  size_t s = rtems_rtl_symbol_slot_home (symbols, hash);
+
+  while (symbols->slots[s].symbol != NULL)
+  {
+    rtems_rtl_symbol_slot* slot = &symbols->slots[s];
+    if (slot->hash == hash && strcmp (name, slot->symbol->name) == 0)
+      return slot;
+    s = (s + 1) & mask;
+  }
+
+  return NULL;
+}
+
+static void
+rtems_rtl_symbol_table_place (rtems_rtl_symbols* symbols,
+                              rtems_rtl_obj_sym* symbol,
+                              uint32_t           hash)
+{
+  size_t mask = symbols->nslots - 1;
+  size_t s = rtems_rtl_symbol_slot_home (symbols, hash);
+
+  while (symbols->slots[s].symbol != NULL)
+    s = (s + 1) & mask;
+
+  symbols->slots[s].hash = hash;
+  symbols->slots[s].symbol = symbol;
+  ++symbols->count;
+}
+
+static bool
+rtems_rtl_symbol_table_resize (rtems_rtl_symbols* symbols, size_t nslots)
+{
+  rtems_rtl_symbol_slot* slots;
+  size_t                 old_nslots;
+  size_t                 s;
+
+  slots = rtems_rtl_alloc_new (RTEMS_RTL_ALLOC_SYMBOL,
+                               nslots * sizeof (rtems_rtl_symbol_slot),
+                               true);
+  if (slots == NULL)
+    return false;
+
+  if (rtems_rtl_trace (RTEMS_RTL_TRACE_GLOBAL_SYM))
+    printf ("rtl: global symbol table resize: %zu -> %zu (%zu symbols)\n",
+            symbols->nslots, nslots, symbols->count);
+
+  old_nslots = symbols->nslots;
+  symbols->nslots = nslots;
+  symbols->shift = rtems_rtl_symbol_table_shift (nslots);
+  symbols->count = 0;
+
+  /*
+   * The stored hashes let the entries move without touching the symbol
+   * names.
+   */
+  for (s = 0; s < old_nslots; ++s)
+  {
+    const rtems_rtl_symbol_slot* slot = &symbols->slots[s];
+    if (slot->symbol != NULL)
+    {
+      size_t mask = nslots - 1;
+      size_t n = rtems_rtl_symbol_slot_home (symbols, slot->hash);
+      while (slots[n].symbol != NULL)
+        n = (n + 1) & mask;
+      slots[n] = *slot;
+      ++symbols->count;
+    }
+  }
+
+  rtems_rtl_alloc_del (RTEMS_RTL_ALLOC_SYMBOL, symbols->slots);
+  symbols->slots = slots;
+
+  return true;
+}
+
+/*
+ * Remove the entry from the table by shifting back the following entries of
+ * the probe sequence. The table does not need deleted markers.
+ */
 static void
+rtems_rtl_symbol_table_remove (rtems_rtl_symbols*     symbols,
+                               rtems_rtl_symbol_slot* slot)
+{
+  size_t mask = symbols->nslots - 1;
+  size_t hole = slot - symbols->slots;
+  size_t s = hole;
+
+  while (true)
+  {
+    size_t home;
+
+    s = (s + 1) & mask;
+    if (symbols->slots[s].symbol == NULL)
+      break;
+
+    /*
+     * An entry can fill the hole if its home slot is not cyclically in
+     * (hole, s].
+     */
+    home = rtems_rtl_symbol_slot_home (symbols, symbols->slots[s].hash);
+    if (hole <= s ? (hole < home && home <= s) : (hole < home || home <= s))
+      continue;
+
+    symbols->slots[hole] = symbols->slots[s];
+    hole = s;
+  }
+
+  symbols->slots[hole].hash = 0;
+  symbols->slots[hole].symbol = NULL;
+  --symbols->count;
+}
+
+/*
+ * Insert the symbol if no symbol with the same name is in the table. The
+ * first symbol added with a name wins.
+ */
+static bool
 rtems_rtl_symbol_global_insert (rtems_rtl_symbols* symbols,
                                 rtems_rtl_obj_sym* symbol)
 {
-  uint_fast32_t hash = rtems_rtl_symbol_hash (symbol->name);
-  rtems_chain_append (&symbols->buckets[hash % symbols->nbuckets],
-                      &symbol->node);
+  uint32_t hash = rtems_rtl_symbol_hash (symbol->name);
+
+  if (rtems_rtl_symbol_table_lookup (symbols, symbol->name, hash) != NULL)
+    return true;
+
+  /*
+   * Keep the load factor at or below 3/4.
+   */
+  if ((symbols->count + 1) * 4 > symbols->nslots * 3)
+  {
+    if (!rtems_rtl_symbol_table_resize (symbols, symbols->nslots * 2))
+    {
+      rtems_rtl_set_error (ENOMEM, "no memory to resize global symbol table");
+      return false;
+    }
+  }
+
+  rtems_rtl_symbol_table_place (symbols, symbol, hash);
+  return true;
+}
+
+static void
+rtems_rtl_symbol_global_remove (rtems_rtl_symbols* symbols,
+                                rtems_rtl_obj_sym* symbol)
+{
+  rtems_rtl_symbol_slot* slot;
+  slot = rtems_rtl_symbol_table_lookup (symbols,
+                                        symbol->name,
+                                        rtems_rtl_symbol_hash (symbol->name));
+  if (slot != NULL && slot->symbol == symbol)
+    rtems_rtl_symbol_table_remove (symbols, slot);
 }
 
 bool
 rtems_rtl_symbol_table_open (rtems_rtl_symbols* symbols,
-                             size_t             buckets)
+                             size_t             slots)
 {
-  symbols->buckets = rtems_rtl_alloc_new (RTEMS_RTL_ALLOC_SYMBOL,
-                                          buckets * sizeof (rtems_chain_control),
-                                          true);
-  if (!symbols->buckets)
+  size_t nslots = 2;
+  while (nslots < slots)
+    nslots <<= 1;
+  symbols->slots = rtems_rtl_alloc_new (RTEMS_RTL_ALLOC_SYMBOL,
+                                        nslots * sizeof (rtems_rtl_symbol_slot),
+                                        true);
+  if (!symbols->slots)
   {
     rtems_rtl_set_error (ENOMEM, "no memory for global symbol table");
     return false;
   }
-  symbols->nbuckets = buckets;
-  for (buckets = 0; buckets < symbols->nbuckets; ++buckets)
-    rtems_chain_initialize_empty (&symbols->buckets[buckets]);
-  rtems_rtl_symbol_global_insert (symbols, &global_sym_add);
+  symbols->nslots = nslots;
+  symbols->min_nslots = nslots;
+  symbols->shift = rtems_rtl_symbol_table_shift (nslots);
+  symbols->count = 0;
+  rtems_rtl_symbol_table_place (symbols,
+                                &global_sym_add,
+                                rtems_rtl_symbol_hash (global_sym_add.name));
   return true;
 }
 
 void
 rtems_rtl_symbol_table_close (rtems_rtl_symbols* symbols)
 {
-  rtems_rtl_alloc_del (RTEMS_RTL_ALLOC_SYMBOL, symbols->buckets);
+  rtems_rtl_alloc_del (RTEMS_RTL_ALLOC_SYMBOL, symbols->slots);
 }
 
 bool
@@ -182,42 +360,53 @@ rtems_rtl_symbol_global_add (rtems_rtl_obj*       obj,
     sym->value = copy_voidp.value;
     if (rtems_rtl_trace (RTEMS_RTL_TRACE_GLOBAL_SYM))
       printf ("rtl: esyms: %s -> %8p\n", sym->name, sym->value);
-    if (rtems_rtl_symbol_global_find (sym->name) == NULL)
-      rtems_rtl_symbol_global_insert (symbols, sym);
     ++sym;
   }
 
   obj->global_syms = count;
 
+  /*
+   * Size the table for all the symbols before adding them so the table is
+   * resized at most once.
+   */
+  while ((symbols->count + count) * 4 > symbols->nslots * 3)
+  {
+    if (!rtems_rtl_symbol_table_resize (symbols, symbols->nslots * 2))
+    {
+      rtems_rtl_set_error (ENOMEM, "no memory to resize global symbol table");
+      return false;
+    }
+  }
+
+  for (s = 0, sym = obj->global_table; s < count; ++s, ++sym)
+  {
+    if (!rtems_rtl_symbol_global_insert (symbols, sym))
+      return false;
+  }
+
   return true;
 }
 
 rtems_rtl_obj_sym*
-rtems_rtl_symbol_global_find (const char* name)
+rtems_rtl_symbol_global_find_hash (const char* name, uint32_t hash)
 {
-  rtems_rtl_symbols*   symbols;
-  uint_fast32_t        hash;
-  rtems_chain_control* bucket;
-  rtems_chain_node*    node;
+  rtems_rtl_symbols*     symbols;
+  rtems_rtl_symbol_slot* slot;
 
   symbols = rtems_rtl_global_symbols ();
 
-  hash = rtems_rtl_symbol_hash (name);
-  bucket = &symbols->buckets[hash % symbols->nbuckets];
-  node = rtems_chain_first (bucket);
+  slot = rtems_rtl_symbol_table_lookup (symbols, name, hash);
+  if (slot == NULL)
+    return NULL;
 
-  while (!rtems_chain_is_tail (bucket, node))
-  {
-    rtems_rtl_obj_sym* sym = (rtems_rtl_obj_sym*) node;
-    /*
-     * Use the hash. I could add this to the symbol but it uses more memory.
-     */
-    if (strcmp (name, sym->name) == 0)
-      return sym;
-    node = rtems_chain_next (node);
-  }
+  return slot->symbol;
+}
 
-  return NULL;
+rtems_rtl_obj_sym*
+rtems_rtl_symbol_global_find (const char* name)
+{
+  return rtems_rtl_symbol_global_find_hash (name,
+                                            rtems_rtl_symbol_hash (name));
 }
 
 static int
@@ -277,7 +466,7 @@ rtems_rtl_symbol_obj_find (rtems_rtl_obj* obj, const char* name)
   return rtems_rtl_symbol_global_find (name);
 }
 
-void
+bool
 rtems_rtl_symbol_obj_add (rtems_rtl_obj* obj)
 {
   rtems_rtl_symbols* symbols;
@@ -287,7 +476,12 @@ rtems_rtl_symbol_obj_add (rtems_rtl_obj* obj)
   symbols = rtems_rtl_global_symbols ();
 
   for (s = 0, sym = obj->global_table; s < obj->global_syms; ++s, ++sym)
-    rtems_rtl_symbol_global_insert (symbols, sym);
+  {
+    if (!rtems_rtl_symbol_global_insert (symbols, sym))
+      return false;
+  }
+
+  return true;
 }
 
 void
@@ -308,14 +502,25 @@ rtems_rtl_symbol_obj_erase (rtems_rtl_obj* obj)
   rtems_rtl_symbol_obj_erase_local (obj);
   if (obj->global_table)
   {
+    rtems_rtl_symbols* symbols;
     rtems_rtl_obj_sym* sym;
     size_t             s;
+    size_t             nslots;
+    symbols = rtems_rtl_global_symbols ();
     for (s = 0, sym = obj->global_table; s < obj->global_syms; ++s, ++sym)
-        if (!rtems_chain_is_node_off_chain (&sym->node))
-          rtems_chain_extract (&sym->node);
+      rtems_rtl_symbol_global_remove (symbols, sym);
     rtems_rtl_alloc_del (RTEMS_RTL_ALLOC_SYMBOL, obj->global_table);
     obj->global_table = NULL;
     obj->global_size = 0;
     obj->global_syms = 0;
+    /*
+     * Shrink the table once it is less than a quarter full. If there is no
+     * memory for the smaller table keep the current one.
+     */
+    nslots = symbols->nslots;
+    while (nslots > symbols->min_nslots && symbols->count * 4 < nslots / 2)
+      nslots /= 2;
+    if (nslots != symbols->nslots)
+      rtems_rtl_symbol_table_resize (symbols, nslots);
   }
 }
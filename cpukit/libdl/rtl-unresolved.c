@@ -147,198 +147,475 @@ rtems_rtl_unresolved_rec_first_free (rtems_rtl_unresolv_block* block)
   return &block->rec[0] + block->recs;
 }
 
-/**
- * Name management iterator data.
+/*
+ * The table is a power of two in size. Use the top bits of the product with
+ * the golden ratio as the home slot so all bits of the hash contribute.
  */
-typedef struct
+static size_t
+rtems_rtl_unresolved_slot_home (const rtems_rtl_unresolved* unresolved,
+                                uint32_t                    hash)
+{
+  return (size_t) ((hash * UINT32_C (0x9e3779b1)) >> unresolved->shift);
+}
+
+static void
+rtems_rtl_unresolved_slot_place (rtems_rtl_unresolv_slot* slots,
+                                 size_t                   mask,
+                                 size_t                   home,
+                                 uint32_t                 hash,
+                                 uint16_t                 index)
 {
-  const char*             name;   /**< The name being searched for. */
-  size_t                  length; /**< The length of the name. */
-  rtems_rtl_unresolv_rec* rec;    /**< The record being searched for. */
-  int                     index;  /**< The name's index. */
-  int                     offset; /**< The offset to move the index. */
-} rtl_unresolved_name_data;
+  size_t s = home;
+  while (slots[s].index != 0)
+    s = (s + 1) & mask;
+  slots[s].hash = hash;
+  slots[s].index = index;
+}
 
 static bool
-rtems_rtl_unresolved_find_name_iterator (rtems_rtl_unresolv_rec* rec,
-                                         void*                   data)
+rtems_rtl_unresolved_slots_resize (rtems_rtl_unresolved* unresolved,
+                                   size_t                nslots)
 {
-  rtl_unresolved_name_data* nd = (rtl_unresolved_name_data*) data;
-  if (rec->type == rtems_rtl_unresolved_symbol)
+  rtems_rtl_unresolv_slot* slots;
+  size_t                   old_nslots;
+  unsigned int             shift;
+  size_t                   s;
+
+  slots = rtems_rtl_alloc_new (RTEMS_RTL_ALLOC_EXTERNAL,
+                               nslots * sizeof (rtems_rtl_unresolv_slot),
+                               true);
+  if (slots == NULL)
   {
-    if ((rec->rec.name.length == nd->length)
-        && (strcmp (rec->rec.name.name, nd->name) == 0))
+    rtems_rtl_set_error (ENOMEM, "no memory for unresolved name index");
+    return false;
+  }
+
+  for (shift = 32, s = nslots; s > 1; s >>= 1)
+    --shift;
+
+  old_nslots = unresolved->nslots;
+  unresolved->nslots = nslots;
+  unresolved->shift = shift;
+
+  for (s = 0; s < old_nslots; ++s)
+  {
+    const rtems_rtl_unresolv_slot* slot = &unresolved->slots[s];
+    if (slot->index != 0)
     {
-      ++rec->rec.name.refs;
-      return true;
+      size_t home = rtems_rtl_unresolved_slot_home (unresolved, slot->hash);
+      rtems_rtl_unresolved_slot_place (slots, nslots - 1, home,
+                                       slot->hash, slot->index);
     }
-    ++nd->index;
   }
-  return false;
+
+  rtems_rtl_alloc_del (RTEMS_RTL_ALLOC_EXTERNAL, unresolved->slots);
+  unresolved->slots = slots;
+
+  return true;
 }
 
-static int
-rtems_rtl_unresolved_find_name (const char* name)
+static uint16_t
+rtems_rtl_unresolved_find_name (rtems_rtl_unresolved* unresolved,
+                                const char*           name,
+                                uint32_t              hash)
 {
-  rtl_unresolved_name_data nd = {
-    .name = name,
-    .length = strlen (name) + 1,
-    .rec = NULL,
-    .index = 1,
-    .offset = 0
-  };
-  if (rtems_rtl_unresolved_iterate (rtems_rtl_unresolved_find_name_iterator,
-                                    &nd))
-    return nd.index;
-  return -1;
+  size_t mask;
+  size_t s;
+
+  if (unresolved->nslots == 0)
+    return 0;
+
+  mask = unresolved->nslots - 1;
+  s = rtems_rtl_unresolved_slot_home (unresolved, hash);
+
+  while (unresolved->slots[s].index != 0)
+  {
+    const rtems_rtl_unresolv_slot* slot = &unresolved->slots[s];
+    if (slot->hash == hash)
+    {
+      const rtems_rtl_unresolv_rec* rec = unresolved->names[slot->index];
+      if (strcmp (rec->rec.name.name, name) == 0)
+        return slot->index;
+    }
+    s = (s + 1) & mask;
+  }
+
+  return 0;
 }
 
-static bool
-rtems_rtl_unresolved_find_index_iterator (rtems_rtl_unresolv_rec* rec,
-                                          void*                   data)
+/*
+ * Remove the name from the hash table by shifting back the following entries
+ * of the probe sequence. The table does not need deleted markers.
+ */
+static void
+rtems_rtl_unresolved_slot_remove (rtems_rtl_unresolved* unresolved,
+                                  uint32_t              hash,
+                                  uint16_t              index)
 {
-  rtl_unresolved_name_data* nd = (rtl_unresolved_name_data*) data;
-  if (rec == nd->rec)
-    return true;
-  if (rec->type == rtems_rtl_unresolved_symbol)
-    ++nd->index;
-  return false;
+  size_t mask = unresolved->nslots - 1;
+  size_t hole = rtems_rtl_unresolved_slot_home (unresolved, hash);
+  size_t s;
+
+  while (unresolved->slots[hole].index != index)
+    hole = (hole + 1) & mask;
+
+  s = hole;
+
+  while (true)
+  {
+    size_t home;
+
+    s = (s + 1) & mask;
+    if (unresolved->slots[s].index == 0)
+      break;
+
+    home = rtems_rtl_unresolved_slot_home (unresolved,
+                                           unresolved->slots[s].hash);
+    if (hole <= s ? (hole < home && home <= s) : (hole < home || home <= s))
+      continue;
+
+    unresolved->slots[hole] = unresolved->slots[s];
+    hole = s;
+  }
+
+  unresolved->slots[hole].hash = 0;
+  unresolved->slots[hole].index = 0;
 }
 
-static int
-rtems_rtl_unresolved_find_index (rtems_rtl_unresolv_rec* rec)
+/*
+ * Allocate a name index and make sure the hash table has room for the name.
+ * Index 0 is not used so the hash table can use it to mark empty slots.
+ */
+static uint16_t
+rtems_rtl_unresolved_name_index_alloc (rtems_rtl_unresolved* unresolved)
 {
-  rtl_unresolved_name_data nd = {
-    .name = NULL,
-    .length = 0,
-    .rec = rec,
-    .index = 1,
-    .offset = 0
-  };
-  if (rtems_rtl_unresolved_iterate (rtems_rtl_unresolved_find_index_iterator,
-                                    &nd))
-    return nd.index;
-  return -1;
+  size_t index;
+
+  if ((unresolved->name_count + 1) * 4 > unresolved->nslots * 3)
+  {
+    size_t nslots = unresolved->nslots == 0 ? 64 : unresolved->nslots * 2;
+    if (!rtems_rtl_unresolved_slots_resize (unresolved, nslots))
+      return 0;
+  }
+
+  if (unresolved->name_count + 1 >= unresolved->names_size)
+  {
+    rtems_rtl_unresolv_rec** names;
+    size_t                   size;
+
+    size = unresolved->names_size == 0 ? 64 : unresolved->names_size * 2;
+    if (size > UINT16_MAX + 1)
+      size = UINT16_MAX + 1;
+
+    if (unresolved->name_count + 1 >= size)
+    {
+      rtems_rtl_set_error (ENOMEM, "too many unresolved names");
+      return 0;
+    }
+
+    names = rtems_rtl_alloc_new (RTEMS_RTL_ALLOC_EXTERNAL,
+                                 size * sizeof (rtems_rtl_unresolv_rec*),
+                                 true);
+    if (names == NULL)
+    {
+      rtems_rtl_set_error (ENOMEM, "no memory for unresolved name table");
+      return 0;
+    }
+
+    if (unresolved->names != NULL)
+      memcpy (names, unresolved->names,
+              unresolved->names_size * sizeof (rtems_rtl_unresolv_rec*));
+
+    rtems_rtl_alloc_del (RTEMS_RTL_ALLOC_EXTERNAL, unresolved->names);
+    unresolved->names = names;
+    unresolved->name_next = unresolved->names_size;
+    unresolved->names_size = size;
+  }
+
+  index = unresolved->name_next;
+  while (index == 0 || unresolved->names[index] != NULL)
+  {
+    ++index;
+    if (index >= unresolved->names_size)
+      index = 1;
+  }
+
+  unresolved->name_next = index + 1;
+  if (unresolved->name_next >= unresolved->names_size)
+    unresolved->name_next = 1;
+
+  return (uint16_t) index;
 }
 
+/*
+ * Names move when records are removed from the blocks. Update the name table
+ * once the table has been compacted.
+ */
 static bool
-rtems_rtl_unresolved_reindex_iterator (rtems_rtl_unresolv_rec* rec,
-                                       void*                   data)
+rtems_rtl_unresolved_names_update_iterator (rtems_rtl_unresolv_rec* rec,
+                                            void*                   data)
 {
-  rtl_unresolved_name_data* nd = (rtl_unresolved_name_data*) data;
-  /*
-   * Reindexing only effects the reloc records.
-   */
-  if (rec->type == rtems_rtl_unresolved_reloc)
-  {
-    if (rec->rec.reloc.name >= nd->index)
-      rec->rec.reloc.name += nd->offset;
-  }
+  rtems_rtl_unresolved* unresolved = (rtems_rtl_unresolved*) data;
+  if (rec->type == rtems_rtl_unresolved_symbol)
+    unresolved->names[rec->rec.name.index] = rec;
   return false;
 }
 
 static void
-rtems_rtl_unresolved_reindex_names (uint16_t index, int offset)
+rtems_rtl_unresolved_names_update (rtems_rtl_unresolved* unresolved)
 {
-  rtl_unresolved_name_data nd = {
-    .name = NULL,
-    .length = 0,
-    .rec = NULL,
-    .index = index,
-    .offset = offset
-  };
-  rtems_rtl_unresolved_iterate (rtems_rtl_unresolved_reindex_iterator,
-                                &nd);
+  rtems_rtl_unresolved_iterate (rtems_rtl_unresolved_names_update_iterator,
+                                unresolved);
 }
 
+
+/**
+ * A name resolved by the global symbol table.
+ */
+typedef struct rtems_rtl_unresolved_found
+{
+  rtems_rtl_obj_sym* sym;        /**< The symbol, NULL if not resolved. */
+  rtems_rtl_obj*     sobj;       /**< The object file defining the symbol. */
+  bool               sobj_valid; /**< The object file has been looked up. */
+} rtems_rtl_unresolved_found;
+
+/**
+ * A relocation to apply in a batch.
+ */
+typedef struct rtems_rtl_unresolved_batch
+{
+  rtems_rtl_unresolv_rec* rec;  /**< The relocation record. */
+  size_t                  seq;  /**< The order in the table. */
+} rtems_rtl_unresolved_batch;
+
 /**
  * Struct to pass relocation data in the iterator.
  */
 typedef struct rtems_rtl_unresolved_reloc_data
 {
-  uint16_t                name;     /**< Name index. */
-  rtems_rtl_unresolv_rec* name_rec; /**< Name record. */
-  rtems_rtl_obj_sym*      sym;      /**< The symbol record. */
+  rtems_rtl_unresolved*       unresolved; /**< The unresolved table. */
+  rtems_rtl_unresolved_found* found;      /**< The found names by index. */
+  rtems_rtl_unresolved_batch* batch;      /**< The batch, NULL if none. */
+  size_t                      size;       /**< The size of the batch. */
+  size_t                      count;      /**< The relocations in the batch. */
+  rtems_rtl_obj*              obj;        /**< The current object file. */
+  uint16_t                    sect_index; /**< The current section index. */
+  rtems_rtl_obj_sect*         sect;       /**< The current section. */
 } rtems_rtl_unresolved_reloc_data;
 
-static bool
-rtems_rtl_unresolved_resolve_reloc (rtems_rtl_unresolv_rec* rec,
-                                    void*                   data)
+static void
+rtems_rtl_unresolved_resolve_reloc (rtems_rtl_unresolved_reloc_data* rd,
+                                    rtems_rtl_unresolv_rec*          rec)
 {
-  if (rec->type == rtems_rtl_unresolved_reloc)
-  {
-    rtems_chain_control*             pending;
-    rtems_rtl_unresolved_reloc_data* rd;
+  rtems_rtl_unresolv_reloc*   reloc = &rec->rec.reloc;
+  rtems_rtl_unresolv_rec*     name_rec = rd->unresolved->names[reloc->name];
+  rtems_rtl_unresolved_found* found = &rd->found[reloc->name];
+  rtems_rtl_obj*              obj = reloc->obj;
 
-    rd = (rtems_rtl_unresolved_reloc_data*) data;
+  if (rtems_rtl_trace (RTEMS_RTL_TRACE_UNRESOLVED))
+    printf ("rtl: unresolv: resolve reloc: %s\n", name_rec->rec.name.name);
 
-    if (rec->rec.reloc.name == rd->name && rec->rec.reloc.obj != NULL)
+  /*
+   * The relocations are grouped by object file and target section so the
+   * section only needs to be looked up when the group changes.
+   */
+  if (rd->sect == NULL || rd->obj != obj || rd->sect_index != reloc->sect)
+  {
+    rd->obj = obj;
+    rd->sect_index = reloc->sect;
+    rd->sect = rtems_rtl_obj_find_section_by_index (obj, reloc->sect);
+    if (rd->sect == NULL)
     {
-      if (rtems_rtl_trace (RTEMS_RTL_TRACE_UNRESOLVED))
-        printf ("rtl: unresolv: resolve reloc: %s\n",
-                rd->name_rec->rec.name.name);
+      rtems_rtl_set_error (ENOEXEC, "unresolved sect not found");
+      return;
+    }
+  }
 
-      if (rtems_rtl_obj_relocate_unresolved (&rec->rec.reloc, rd->sym))
-      {
-        /*
-         * If all unresolved externals are resolved add the obj module
-         * to the pending queue. This will flush the object module's
-         * data from the cache and call it's constructors.
-         */
-        if (rec->rec.reloc.obj->unresolved == 0)
-        {
-          pending = rtems_rtl_pending_unprotected ();
-          rtems_chain_extract (&rec->rec.reloc.obj->link);
-          rtems_chain_append (pending, &rec->rec.reloc.obj->link);
-        }
+  if (!rtems_rtl_obj_relocate_unresolved (reloc, rd->sect, found->sym))
+    return;
 
-        /*
-         * Set the object pointer to NULL to indicate the record is
-         * not used anymore. Update the reference count of the name so
-         * it can garbage collected if not referenced. The sweep after
-         * relocating will remove the reloc records with obj set to
-         * NULL and names with a reference count of 0.
-         */
-        rec->rec.reloc.obj = NULL;
-        if (rd->name_rec != NULL && rd->name_rec->rec.name.refs > 0)
-          --rd->name_rec->rec.name.refs;
-      }
-    }
+  if (!found->sobj_valid)
+  {
+    found->sobj = rtems_rtl_find_obj_with_symbol (found->sym);
+    found->sobj_valid = true;
+  }
+
+  if (rtems_rtl_trace (RTEMS_RTL_TRACE_DEPENDENCY))
+    printf ("rtl: depend: %s -> %s:%s\n",
+            obj->oname,
+            found->sobj == NULL ? "not-found" : found->sobj->oname,
+            found->sym->name);
+
+  if (found->sobj != NULL)
+  {
+    if (rtems_rtl_obj_add_dependent (obj, found->sobj))
+      rtems_rtl_obj_inc_reference (found->sobj);
+  }
+
+  /*
+   * If all unresolved externals are resolved add the obj module
+   * to the pending queue. This will flush the object module's
+   * data from the cache and call it's constructors.
+   */
+  if (obj->unresolved == 0)
+  {
+    rtems_chain_control* pending = rtems_rtl_pending_unprotected ();
+    rtems_chain_extract (&obj->link);
+    rtems_chain_append (pending, &obj->link);
+  }
+
+  /*
+   * Set the object pointer to NULL to indicate the record is
+   * not used anymore. Update the reference count of the name so
+   * it can garbage collected if not referenced. The sweep after
+   * relocating will remove the reloc records with obj set to
+   * NULL and names with a reference count of 0.
+   */
+  reloc->obj = NULL;
+  if (name_rec->rec.name.refs > 0)
+    --name_rec->rec.name.refs;
+}
+
+static bool
+rtems_rtl_unresolved_count_iterator (rtems_rtl_unresolv_rec* rec,
+                                     void*                   data)
+{
+  if (rec->type == rtems_rtl_unresolved_reloc && rec->rec.reloc.obj != NULL)
+  {
+    rtems_rtl_unresolved_reloc_data* rd;
+    rd = (rtems_rtl_unresolved_reloc_data*) data;
+    if (rd->found[rec->rec.reloc.name].sym != NULL)
+      ++rd->size;
   }
   return false;
 }
 
 static bool
-rtems_rtl_unresolved_resolve_iterator (rtems_rtl_unresolv_rec* rec,
-                                       void*                   data)
+rtems_rtl_unresolved_batch_iterator (rtems_rtl_unresolv_rec* rec,
+                                     void*                   data)
 {
-  if (rec->type == rtems_rtl_unresolved_symbol)
+  if (rec->type == rtems_rtl_unresolved_reloc && rec->rec.reloc.obj != NULL)
   {
     rtems_rtl_unresolved_reloc_data* rd;
     rd = (rtems_rtl_unresolved_reloc_data*) data;
+    if (rd->found[rec->rec.reloc.name].sym != NULL)
+    {
+      /*
+       * Apply the relocation now if there is no batch or the batch is full.
+       */
+      if (rd->batch != NULL && rd->count < rd->size)
+      {
+        rd->batch[rd->count].rec = rec;
+        rd->batch[rd->count].seq = rd->count;
+        ++rd->count;
+      }
+      else
+      {
+        rtems_rtl_unresolved_resolve_reloc (rd, rec);
+      }
+    }
+  }
+  return false;
+}
 
-    ++rd->name;
+static int
+rtems_rtl_unresolved_batch_compare (const void* a, const void* b)
+{
+  const rtems_rtl_unresolved_batch* ba = a;
+  const rtems_rtl_unresolved_batch* bb = b;
+  const rtems_rtl_unresolv_reloc*   ra = &ba->rec->rec.reloc;
+  const rtems_rtl_unresolv_reloc*   rb = &bb->rec->rec.reloc;
+  /*
+   * Group by object file and target section. The order of the object files
+   * is the order of their addresses, which is arbitrary but groups the
+   * relocations of an object file. Keep the table order inside a target
+   * section. Some architectures pair relocation records.
+   */
+  if (ra->obj != rb->obj)
+    return (uintptr_t) ra->obj < (uintptr_t) rb->obj ? -1 : 1;
+  if (ra->sect != rb->sect)
+    return ra->sect < rb->sect ? -1 : 1;
+  if (ba->seq != bb->seq)
+    return ba->seq < bb->seq ? -1 : 1;
+  return 0;
+}
 
-    if (rtems_rtl_trace (RTEMS_RTL_TRACE_UNRESOLVED))
-      printf ("rtl: unresolv: lookup: %d: %s\n", rd->name, rec->rec.name.name);
+/*
+ * Look up each unresolved name once in the global symbol table, then apply
+ * the relocations of the resolved names in one pass over the table.
+ */
+static void
+rtems_rtl_unresolved_resolve_names (void)
+{
+  rtems_rtl_unresolved*           unresolved;
+  rtems_rtl_unresolved_reloc_data rd = { 0 };
+  bool                            found;
+  size_t                          index;
+
+  unresolved = rtems_rtl_unresolved_unprotected ();
+  if (unresolved == NULL || unresolved->name_count == 0)
+    return;
+
+  rd.unresolved = unresolved;
+  rd.found = rtems_rtl_alloc_new (RTEMS_RTL_ALLOC_OBJECT,
+                                  unresolved->names_size *
+                                  sizeof (rtems_rtl_unresolved_found),
+                                  true);
+  if (rd.found == NULL)
+  {
+    rtems_rtl_set_error (ENOMEM, "no memory to resolve names");
+    return;
+  }
 
-    rd->sym = rtems_rtl_symbol_global_find (rec->rec.name.name);
+  found = false;
 
-    if (rd->sym)
+  for (index = 1; index < unresolved->names_size; ++index)
+  {
+    rtems_rtl_unresolv_rec* rec = unresolved->names[index];
+    if (rec != NULL)
     {
       if (rtems_rtl_trace (RTEMS_RTL_TRACE_UNRESOLVED))
-        printf ("rtl: unresolv: found: %s\n", rec->rec.name.name);
+        printf ("rtl: unresolv: lookup: %zu: %s\n", index, rec->rec.name.name);
 
-      rd->name_rec = rec;
-
-      rtems_rtl_unresolved_iterate (rtems_rtl_unresolved_resolve_reloc, rd);
+      rd.found[index].sym =
+        rtems_rtl_symbol_global_find_hash (rec->rec.name.name,
+                                           rec->rec.name.hash);
+      if (rd.found[index].sym != NULL)
+      {
+        if (rtems_rtl_trace (RTEMS_RTL_TRACE_UNRESOLVED))
+          printf ("rtl: unresolv: found: %s\n", rec->rec.name.name);
+        found = true;
+      }
+    }
+  }
 
-      rd->name_rec = NULL;
-      rd->sym = NULL;
+  if (found)
+  {
+    /*
+     * Collect the relocations and apply them grouped by object file and
+     * target section. Without the memory for the batch apply them in the
+     * order of the table. The batch is sized by counting the relocation
+     * records since the name reference counts are only 16 bits wide.
+     */
+    rtems_rtl_unresolved_iterate (rtems_rtl_unresolved_count_iterator, &rd);
+    if (rd.size != 0)
+      rd.batch = rtems_rtl_alloc_new (RTEMS_RTL_ALLOC_OBJECT,
+                                      rd.size *
+                                      sizeof (rtems_rtl_unresolved_batch),
+                                      false);
+    rtems_rtl_unresolved_iterate (rtems_rtl_unresolved_batch_iterator, &rd);
+    if (rd.batch != NULL)
+    {
+      size_t b;
+      qsort (rd.batch, rd.count, sizeof (rtems_rtl_unresolved_batch),
+             rtems_rtl_unresolved_batch_compare);
+      for (b = 0; b < rd.count; ++b)
+        rtems_rtl_unresolved_resolve_reloc (&rd, rd.batch[b].rec);
+      rtems_rtl_alloc_del (RTEMS_RTL_ALLOC_OBJECT, rd.batch);
     }
   }
 
-  return false;
+  rtems_rtl_alloc_del (RTEMS_RTL_ALLOC_OBJECT, rd.found);
 }
 
 /**
@@ -346,7 +623,6 @@ rtems_rtl_unresolved_resolve_iterator (rtems_rtl_unresolv_rec* rec,
  */
 typedef struct rtems_rtl_unresolved_archive_reloc_data
 {
-  uint16_t                 name;     /**< Name index. */
   rtems_rtl_archive_search result;   /**< The result of the load. */
   rtems_rtl_archives*      archives; /**< The archives to search. */
 } rtems_rtl_unresolved_archive_reloc_data;
@@ -360,15 +636,13 @@ rtems_rtl_unresolved_archive_iterator (rtems_rtl_unresolv_rec* rec,
     rtems_rtl_unresolved_archive_reloc_data* ard;
     ard = (rtems_rtl_unresolved_archive_reloc_data*) data;
 
-    ++ard->name;
-
     if ((rec->rec.name.flags & RTEMS_RTL_UNRESOLV_SYM_SEARCH_ARCHIVE) != 0)
     {
       rtems_rtl_archive_search result;
 
       if (rtems_rtl_trace (RTEMS_RTL_TRACE_UNRESOLVED))
         printf ("rtl: unresolv: archive lookup: %d: %s\n",
-                ard->name, rec->rec.name.name);
+                rec->rec.name.index, rec->rec.name.name);
 
       result = rtems_rtl_archive_obj_load (ard->archives,
                                            rec->rec.name.name, true);
@@ -451,11 +725,11 @@ rtems_rtl_unresolved_compact (void)
   if (unresolved)
   {
     /*
-     * Iterate over the blocks removing any empty strings. If a string is
-     * removed update the indexes of all strings above this level.
+     * Iterate over the blocks removing any empty strings. The index of a
+     * string does not change when it moves so only the name table needs to
+     * be updated once the blocks are compacted.
      */
     rtems_chain_node* node = rtems_chain_first (&unresolved->blocks);
-    uint16_t          index = 0;
     while (!rtems_chain_is_tail (&unresolved->blocks, node))
     {
       rtems_rtl_unresolv_block* block = (rtems_rtl_unresolv_block*) node;
@@ -466,20 +740,22 @@ rtems_rtl_unresolved_compact (void)
 
         if (rec->type == rtems_rtl_unresolved_symbol)
         {
-          ++index;
           if (rec->rec.name.refs == 0)
           {
             size_t name_recs;
             if (rtems_rtl_trace (RTEMS_RTL_TRACE_UNRESOLVED))
               printf ("rtl: unresolv: remove name: %s\n", rec->rec.name.name);
-            rtems_rtl_unresolved_reindex_names (index, -1);
+            rtems_rtl_unresolved_slot_remove (unresolved,
+                                              rec->rec.name.hash,
+                                              rec->rec.name.index);
+            unresolved->names[rec->rec.name.index] = NULL;
+            --unresolved->name_count;
             /*
              * Compact the block removing the name record.
              */
             name_recs = rtems_rtl_unresolved_symbol_recs (rec->rec.name.name);
             rtems_rtl_unresolved_clean_block (block, rec, name_recs,
                                               unresolved->block_recs);
-            --index;
             next_rec = false;
           }
         }
@@ -500,6 +776,8 @@ rtems_rtl_unresolved_compact (void)
       node = rtems_rtl_unresolved_delete_block_if_empty (&unresolved->blocks,
                                                          block);
     }
+
+    rtems_rtl_unresolved_names_update (unresolved);
   }
 }
 
@@ -510,6 +788,13 @@ rtems_rtl_unresolved_table_open (rtems_rtl_unresolved* unresolved,
   unresolved->marker = 0xdeadf00d;
   unresolved->block_recs = block_recs;
   rtems_chain_initialize_empty (&unresolved->blocks);
+  unresolved->names = NULL;
+  unresolved->names_size = 0;
+  unresolved->name_count = 0;
+  unresolved->name_next = 0;
+  unresolved->slots = NULL;
+  unresolved->nslots = 0;
+  unresolved->shift = 0;
   return rtems_rtl_unresolved_block_alloc (unresolved);
 }
 
@@ -523,6 +808,8 @@ rtems_rtl_unresolved_table_close (rtems_rtl_unresolved* unresolved)
     rtems_rtl_alloc_del (RTEMS_RTL_ALLOC_EXTERNAL, node);
     node = next;
   }
+  rtems_rtl_alloc_del (RTEMS_RTL_ALLOC_EXTERNAL, unresolved->names);
+  rtems_rtl_alloc_del (RTEMS_RTL_ALLOC_EXTERNAL, unresolved->slots);
 }
 
 bool
@@ -561,7 +848,8 @@ rtems_rtl_unresolved_add (rtems_rtl_obj*        obj,
   rtems_rtl_unresolved*     unresolved;
   rtems_rtl_unresolv_block* block;
   rtems_rtl_unresolv_rec*   rec;
-  int                       name_index;
+  uint32_t                  hash;
+  uint16_t                  name_index;
 
   if (rtems_rtl_trace (RTEMS_RTL_TRACE_UNRESOLVED))
     printf ("rtl: unresolv: add: %s(s:%d) -> %s\n",
@@ -574,14 +862,16 @@ rtems_rtl_unresolved_add (rtems_rtl_obj*        obj,
   /*
    * Is the name present?
    */
-  name_index = rtems_rtl_unresolved_find_name (name);
+  hash = rtems_rtl_symbol_hash (name);
+  name_index = rtems_rtl_unresolved_find_name (unresolved, name, hash);
 
   /*
-   * An index less than 0 means the name was not found.
+   * An index of 0 means the name was not found.
    */
-  if (name_index < 0)
+  if (name_index == 0)
   {
     size_t name_recs;
+    size_t home;
 
     name_recs = rtems_rtl_unresolved_symbol_recs (name);
 
@@ -596,34 +886,33 @@ rtems_rtl_unresolved_add (rtems_rtl_obj*        obj,
         return false;
     }
 
+    name_index = rtems_rtl_unresolved_name_index_alloc (unresolved);
+    if (name_index == 0)
+      return false;
+
     /*
      * Find the record in the block.
      */
     rec = rtems_rtl_unresolved_rec_first_free (block);
 
-    /*
-     * Enter the new record before reindexing so the iterator can see
-     * it and the iterator is called.
-     */
     rec->type = rtems_rtl_unresolved_symbol;
     rec->rec.name.refs = 1;
     rec->rec.name.flags = RTEMS_RTL_UNRESOLV_SYM_SEARCH_ARCHIVE;
     rec->rec.name.length = strlen (name) + 1;
+    rec->rec.name.index = name_index;
+    rec->rec.name.hash = hash;
     memcpy ((void*) &rec->rec.name.name[0], name, rec->rec.name.length);
     block->recs += name_recs;
 
-    /*
-     * Find the name index for the name and then reindex the names which
-     * are moved up because of the insertion.
-     */
-    name_index = rtems_rtl_unresolved_find_index (rec);
-    if (name_index < 0)
-    {
-      rtems_rtl_set_error (ENOMEM, "internal unresolved block error");
-      return false;
-    }
-
-    rtems_rtl_unresolved_reindex_names (name_index, 1);
+    unresolved->names[name_index] = rec;
+    ++unresolved->name_count;
+    home = rtems_rtl_unresolved_slot_home (unresolved, hash);
+    rtems_rtl_unresolved_slot_place (unresolved->slots, unresolved->nslots - 1,
+                                     home, hash, name_index);
+  }
+  else
+  {
+    ++unresolved->names[name_index]->rec.name.refs;
   }
 
   /*
@@ -661,29 +950,23 @@ rtems_rtl_unresolved_resolve (void)
     printf ("rtl: unresolv: global resolve\n");
 
   /*
-   * The resolving process is two separate stages, The first stage is to
-   * iterate over the unresolved symbols searching the global symbol table. If
-   * a symbol is found iterate over the unresolved relocation records for the
-   * symbol fixing up the relocations. The second stage is to search the
-   * archives for symbols we have not searched before and if a symbol is found
-   * in an archve load the object file. Loading an object file stops the
-   * search of the archives for symbols and stage one is performed again. The
-   * process repeats until no more symbols are resolved or there is an error.
+   * The resolving process is two separate stages, The first stage is to look
+   * up each of the unresolved symbols in the global symbol table and then fix
+   * up the relocation records of the symbols found in a single pass over the
+   * table. The second stage is to search the archives for symbols we have not
+   * searched before and if a symbol is found in an archve load the object
+   * file. Loading an object file stops the search of the archives for
+   * symbols and stage one is performed again. The process repeats until no
+   * more symbols are resolved or there is an error.
    */
   while (resolving)
   {
-    rtems_rtl_unresolved_reloc_data rd = {
-      .name = 0,
-      .name_rec = NULL,
-      .sym = NULL
-    };
     rtems_rtl_unresolved_archive_reloc_data ard = {
-      .name = 0,
       .result = rtems_rtl_archive_search_not_found,
       .archives = rtems_rtl_archives_unprotected ()
     };
 
-    rtems_rtl_unresolved_iterate (rtems_rtl_unresolved_resolve_iterator, &rd);
+    rtems_rtl_unresolved_resolve_names ();
     rtems_rtl_unresolved_compact ();
     rtems_rtl_unresolved_iterate (rtems_rtl_unresolved_archive_iterator, &ard);
 
@@ -773,6 +1056,8 @@ rtems_rtl_trampoline_remove (rtems_rtl_obj* obj)
       node = rtems_rtl_unresolved_delete_block_if_empty (&unresolved->blocks,
                                                          block);
     }
+
+    rtems_rtl_unresolved_names_update (unresolved);
   }
 }
 
@@ -799,8 +1084,8 @@ rtems_rtl_unresolved_dump_iterator (rtems_rtl_unresolv_rec* rec,
     break;
   case rtems_rtl_unresolved_symbol:
     ++dd->names;
-    printf (" %3zu: 1:  name: %3zu refs:%4d: flags:%04x %s (%d)\n",
-            dd->rec, dd->names,
+    printf (" %3zu: 1:  name: %3d refs:%4d: flags:%04x %s (%d)\n",
+            dd->rec, rec->rec.name.index,
             rec->rec.name.refs,
             rec->rec.name.flags,
             rec->rec.name.name,
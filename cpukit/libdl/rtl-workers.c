@@ -0,0 +1,297 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/**
+ * @file
+ *
+ * @ingroup rtems_rtl
+ *
+ * @brief RTEMS Run-Time Linker Worker Tasks
+ */
+
+/*
+ * Copyright (C) 2026 On-Line Applications Research Corporation (OAR)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <errno.h>
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+
+#include <rtems.h>
+#include <rtems/thread.h>
+
+#include <rtems/rtl/rtl-allocator.h>
+#include "rtl-error.h"
+#include <rtems/rtl/rtl-trace.h>
+#include "rtl-workers.h"
+
+/**
+ * The stack size of a worker task. The relocation handlers can print trace
+ * messages.
+ */
+#define RTEMS_RTL_WORKERS_STACK_SIZE (RTEMS_MINIMUM_STACK_SIZE * 4)
+
+/**
+ * The first error of a worker task in a job. A worker task cannot take the
+ * RTL lock held by the task running the job so the error is held here until
+ * the job has finished.
+ */
+typedef struct
+{
+  int  error;       /**< The errno error number, 0 if no error. */
+  char message[64]; /**< The error message. */
+} rtems_rtl_workers_error;
+
+/**
+ * The worker tasks.
+ */
+typedef struct
+{
+  uint32_t                  count; /**< The number of workers. */
+  rtems_id*                 tasks; /**< The worker tasks. */
+  rtems_rtl_workers_error*  errors; /**< The errors of the worker tasks. */
+  rtems_binary_semaphore*   start; /**< Start a worker task. */
+  rtems_counting_semaphore  done;  /**< A worker task has finished. */
+  rtems_rtl_workers_job     job;   /**< The job, NULL to exit. */
+  void*                     data;  /**< The job's user data. */
+} rtems_rtl_workers;
+
+static rtems_rtl_workers workers = { .count = 1 };
+
+static rtems_task
+rtems_rtl_workers_task (rtems_task_argument arg)
+{
+  uint32_t worker = (uint32_t) arg;
+
+  while (true)
+  {
+    rtems_binary_semaphore_wait (&workers.start[worker - 1]);
+
+    if (workers.job == NULL)
+      break;
+
+    workers.job (worker, workers.data);
+    rtems_counting_semaphore_post (&workers.done);
+  }
+
+  rtems_counting_semaphore_post (&workers.done);
+  rtems_task_exit ();
+}
+
+static void
+rtems_rtl_workers_wait (uint32_t tasks)
+{
+  while (tasks-- > 0)
+    rtems_counting_semaphore_wait (&workers.done);
+}
+
+static void
+rtems_rtl_workers_delete (uint32_t tasks)
+{
+  uint32_t t;
+
+  /*
+   * The started tasks exit when there is no job.
+   */
+  workers.job = NULL;
+  for (t = 0; t < tasks; ++t)
+    rtems_binary_semaphore_post (&workers.start[t]);
+  rtems_rtl_workers_wait (tasks);
+
+  for (t = 0; t < workers.count - 1; ++t)
+    rtems_binary_semaphore_destroy (&workers.start[t]);
+  rtems_counting_semaphore_destroy (&workers.done);
+
+  rtems_rtl_alloc_del (RTEMS_RTL_ALLOC_OBJECT, workers.errors);
+  rtems_rtl_alloc_del (RTEMS_RTL_ALLOC_OBJECT, workers.start);
+  rtems_rtl_alloc_del (RTEMS_RTL_ALLOC_OBJECT, workers.tasks);
+
+  workers.count = 1;
+  workers.tasks = NULL;
+  workers.start = NULL;
+  workers.errors = NULL;
+}
+
+bool
+rtems_rtl_workers_set (uint32_t count)
+{
+  rtems_task_priority priority;
+  rtems_status_code   sc;
+  uint32_t            t;
+
+  if (count == 0)
+    count = 1;
+
+  if (count == workers.count)
+    return true;
+
+  if (workers.count > 1)
+    rtems_rtl_workers_delete (workers.count - 1);
+
+  if (count == 1)
+    return true;
+
+  sc = rtems_task_set_priority (RTEMS_SELF, RTEMS_CURRENT_PRIORITY, &priority);
+  if (sc != RTEMS_SUCCESSFUL)
+  {
+    rtems_rtl_set_error (EINVAL, "worker priority: %s",
+                         rtems_status_text (sc));
+    return false;
+  }
+
+  workers.tasks = rtems_rtl_alloc_new (RTEMS_RTL_ALLOC_OBJECT,
+                                       sizeof (rtems_id) * (count - 1),
+                                       true);
+  workers.start = rtems_rtl_alloc_new (RTEMS_RTL_ALLOC_OBJECT,
+                                       sizeof (rtems_binary_semaphore) *
+                                       (count - 1),
+                                       true);
+  workers.errors = rtems_rtl_alloc_new (RTEMS_RTL_ALLOC_OBJECT,
+                                        sizeof (rtems_rtl_workers_error) *
+                                        (count - 1),
+                                        true);
+  if (workers.tasks == NULL || workers.start == NULL || workers.errors == NULL)
+  {
+    rtems_rtl_alloc_del (RTEMS_RTL_ALLOC_OBJECT, workers.errors);
+    rtems_rtl_alloc_del (RTEMS_RTL_ALLOC_OBJECT, workers.start);
+    rtems_rtl_alloc_del (RTEMS_RTL_ALLOC_OBJECT, workers.tasks);
+    workers.tasks = NULL;
+    workers.start = NULL;
+    workers.errors = NULL;
+    rtems_rtl_set_error (ENOMEM, "no memory for workers");
+    return false;
+  }
+
+  workers.count = count;
+  rtems_counting_semaphore_init (&workers.done, "RTL Workers", 0);
+  for (t = 0; t < count - 1; ++t)
+    rtems_binary_semaphore_init (&workers.start[t], "RTL Worker");
+
+  for (t = 0; t < count - 1; ++t)
+  {
+    sc = rtems_task_create (rtems_build_name ('R', 'T', 'L', 'W'),
+                            priority,
+                            RTEMS_RTL_WORKERS_STACK_SIZE,
+                            RTEMS_DEFAULT_MODES,
+                            RTEMS_DEFAULT_ATTRIBUTES,
+                            &workers.tasks[t]);
+    if (sc == RTEMS_SUCCESSFUL)
+    {
+      sc = rtems_task_start (workers.tasks[t],
+                             rtems_rtl_workers_task,
+                             (rtems_task_argument) (t + 1));
+      if (sc != RTEMS_SUCCESSFUL)
+        rtems_task_delete (workers.tasks[t]);
+    }
+    if (sc != RTEMS_SUCCESSFUL)
+    {
+      rtems_rtl_workers_delete (t);
+      rtems_rtl_set_error (ENOMEM, "worker task: %s", rtems_status_text (sc));
+      return false;
+    }
+  }
+
+  if (rtems_rtl_trace (RTEMS_RTL_TRACE_DETAIL))
+    printf ("rtl: workers: count=%" PRIu32 " priority=%" PRIu32 "\n",
+            count, (uint32_t) priority);
+
+  return true;
+}
+
+uint32_t
+rtems_rtl_workers_count (void)
+{
+  return workers.count;
+}
+
+void
+rtems_rtl_workers_run (rtems_rtl_workers_job job, void* data)
+{
+  uint32_t t;
+
+  if (workers.count > 1)
+  {
+    workers.job = job;
+    workers.data = data;
+    for (t = 0; t < workers.count - 1; ++t)
+    {
+      workers.errors[t].error = 0;
+      rtems_binary_semaphore_post (&workers.start[t]);
+    }
+  }
+
+  job (0, data);
+
+  if (workers.count > 1)
+  {
+    rtems_rtl_workers_wait (workers.count - 1);
+    workers.job = NULL;
+    workers.data = NULL;
+  }
+}
+
+bool
+rtems_rtl_workers_set_error (int error, const char* format, va_list ap)
+{
+  rtems_id self;
+  uint32_t t;
+
+  if (workers.count <= 1 || workers.job == NULL)
+    return false;
+
+  self = rtems_task_self ();
+
+  for (t = 0; t < workers.count - 1; ++t)
+  {
+    if (workers.tasks[t] == self)
+    {
+      rtems_rtl_workers_error* we = &workers.errors[t];
+      if (we->error == 0)
+      {
+        we->error = error;
+        vsnprintf (we->message, sizeof (we->message), format, ap);
+      }
+      return true;
+    }
+  }
+
+  return false;
+}
+
+void
+rtems_rtl_workers_report_error (uint32_t worker)
+{
+  rtems_rtl_workers_error* we;
+
+  if (worker == 0 || worker >= workers.count)
+    return;
+
+  we = &workers.errors[worker - 1];
+  if (we->error != 0)
+    rtems_rtl_set_error (we->error, "%s", we->message);
+}
@@ -0,0 +1,111 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/**
+ * @file
+ *
+ * @ingroup rtems_rtl
+ *
+ * @brief RTEMS Run-Time Linker Worker Tasks Header
+ */
+
+/*
+ * Copyright (C) 2026 On-Line Applications Research Corporation (OAR)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#if !defined (_RTEMS_RTL_WORKERS_H_)
+#define _RTEMS_RTL_WORKERS_H_
+
+#include <stdarg.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/**
+ * The worker tasks job handler. The handler is called once by each worker
+ * with the worker's index. Index 0 is the task running the job.
+ *
+ * @param worker The index of the worker.
+ * @param data The job's user data.
+ */
+typedef void (*rtems_rtl_workers_job) (uint32_t worker, void* data);
+
+/**
+ * Set the number of workers. Worker tasks are created or deleted so there are
+ * count - 1 worker tasks. The task running a job is also a worker. The worker
+ * tasks have the priority of the calling task. Assumes the RTL is locked.
+ *
+ * @param count The number of workers. A count of 0 or 1 deletes all worker
+ *              tasks.
+ * @retval true The worker tasks have been created.
+ * @retval false The worker tasks could not be created. The error is set.
+ */
+bool rtems_rtl_workers_set (uint32_t count);
+
+/**
+ * Return the number of workers. The number is 1 if there are no worker tasks.
+ *
+ * @return uint32_t The number of workers.
+ */
+uint32_t rtems_rtl_workers_count (void);
+
+/**
+ * Run a job on all workers and wait for all workers to finish the job. The
+ * calling task is worker 0. Assumes the RTL is locked.
+ *
+ * @param job The job handler.
+ * @param data The job's user data.
+ */
+void rtems_rtl_workers_run (rtems_rtl_workers_job job, void* data);
+
+/**
+ * Hold the error of a worker task running a job. Only the first error of a
+ * worker task in a job is held. The error is reported by the task running
+ * the job once the job has finished.
+ *
+ * @param error The errno error number.
+ * @param format The error format string.
+ * @param ap The variable arguments that depend on the format string.
+ * @retval true The calling task is a worker task running a job and the error
+ *              is held.
+ * @retval false The calling task is not a worker task running a job.
+ */
+bool rtems_rtl_workers_set_error (int error, const char* format, va_list ap);
+
+/**
+ * Set the RTL error to the error held by a worker task in the last job. The
+ * error of worker 0 is set directly and there is nothing to report. Assumes
+ * the RTL is locked.
+ *
+ * @param worker The index of the worker.
+ */
+void rtems_rtl_workers_report_error (uint32_t worker);
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif
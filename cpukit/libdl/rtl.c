@@ -51,6 +51,7 @@
 #include "rtl-chain-iterator.h"
 #include "rtl-error.h"
 #include "rtl-string.h"
+#include "rtl-workers.h"
 
 /**
  * Symbol table cache size. They can be big so the cache needs space to work.
@@ -373,6 +374,17 @@ rtems_rtl_obj_caches_flush (void)
   }
 }
 
+void
+rtems_rtl_obj_caches_map (int fd, const void* map, size_t size)
+{
+  if (rtl)
+  {
+    rtems_rtl_obj_cache_map (&rtl->symbols, fd, map, size);
+    rtems_rtl_obj_cache_map (&rtl->strings, fd, map, size);
+    rtems_rtl_obj_cache_map (&rtl->relocs, fd, map, size);
+  }
+}
+
 void
 rtems_rtl_obj_decompress (rtems_rtl_obj_comp** decomp,
                           rtems_rtl_obj_cache* cache,
@@ -856,6 +868,24 @@ rtems_rtl_path_prepend (const char* path)
   return rtems_rtl_path_update (true, path);
 }
 
+bool
+rtems_rtl_set_relocate_workers (uint32_t count)
+{
+  bool r;
+
+  if (!rtems_rtl_lock ())
+  {
+    rtems_rtl_set_error (EINVAL, "workers cannot lock rtl");
+    return false;
+  }
+
+  r = rtems_rtl_workers_set (count);
+
+  rtems_rtl_unlock ();
+
+  return r;
+}
+
 void
 rtems_rtl_base_sym_global_add (const unsigned char* esyms,
                                unsigned int         size)
@@ -95,6 +95,32 @@ static int IMFS_linfile_open(
   return 0;
 }
 
+/*
+ * The data of a linear file is in memory so a shared mapping can reference
+ * it directly. Private mappings are read by mmap() and do not use this
+ * handler. Memory is not protected so the user of the mapping must not
+ * write to it.
+ */
+static int IMFS_linfile_mmap(
+  rtems_libio_t  *iop,
+  void          **addr,
+  size_t          len,
+  int             prot,
+  off_t           off
+)
+{
+  IMFS_file_t *file = IMFS_iop_to_file( iop );
+  const unsigned char *data = file->Linearfile.direct;
+
+  (void) len;
+  (void) prot;
+
+  IMFS_update_atime( &file->Node );
+  *addr = RTEMS_DECONST( unsigned char *, &data[ off ] );
+
+  return 0;
+}
+
 static const rtems_filesystem_file_handlers_r IMFS_linfile_handlers = {
   .open_h = IMFS_linfile_open,
   .close_h = rtems_filesystem_default_close,
@@ -108,7 +134,7 @@ static const rtems_filesystem_file_handlers_r IMFS_linfile_handlers = {
   .fdatasync_h = rtems_filesystem_default_fsync_or_fdatasync_success,
   .fcntl_h = rtems_filesystem_default_fcntl,
   .kqfilter_h = rtems_filesystem_default_kqfilter,
-  .mmap_h = rtems_filesystem_default_mmap,
+  .mmap_h = IMFS_linfile_mmap,
   .poll_h = rtems_filesystem_default_poll,
   .readv_h = rtems_filesystem_default_readv,
   .writev_h = rtems_filesystem_default_writev
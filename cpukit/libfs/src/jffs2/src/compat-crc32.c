@@ -54,6 +54,7 @@
 //==========================================================================
 
 #include <cyg/crc/crc.h>
+#include <pthread.h>
 
   /* ====================================================================== */
   /*  COPYRIGHT (C) 1986 Gary S. Brown.  You may use this program, or       */
@@ -120,17 +121,68 @@ static const cyg_uint32 crc32_tab[] = {
       0x2d02ef8dL
    };
 
+/* The tables to process eight bytes in one step (slice-by-8).  The table k
+   contains the CRC of each byte value followed by k zero bytes. */
+static cyg_uint32 crc32_slice_tab[8][256];
+
+static pthread_once_t crc32_slice_once = PTHREAD_ONCE_INIT;
+
+static void
+crc32_slice_init(void)
+{
+  cyg_uint32 c;
+  int n, k;
+
+  for (n = 0;  n < 256;  n++) {
+    c = crc32_tab[n];
+    crc32_slice_tab[0][n] = c;
+    for (k = 1;  k < 8;  k++) {
+      c = crc32_tab[c & 0xff] ^ (c >> 8);
+      crc32_slice_tab[k][n] = c;
+    }
+  }
+}
+
+#define CRC32_LE32(s) \
+  ((cyg_uint32)(s)[0] | ((cyg_uint32)(s)[1] << 8) | \
+   ((cyg_uint32)(s)[2] << 16) | ((cyg_uint32)(s)[3] << 24))
+
+static cyg_uint32
+crc32_update(cyg_uint32 crc32val, const unsigned char *s, int len)
+{
+  const cyg_uint32 (*t)[256];
+  cyg_uint32 lo, hi;
+
+  if (len >= 16) {
+    (void) pthread_once(&crc32_slice_once, crc32_slice_init);
+    t = (const cyg_uint32 (*)[256]) crc32_slice_tab;
+
+    /* The byte-wise word loads work independent of alignment and byte
+       order */
+    while (len >= 8) {
+      lo = crc32val ^ CRC32_LE32(s);
+      hi = CRC32_LE32(s + 4);
+      crc32val = t[7][lo & 0xff] ^ t[6][(lo >> 8) & 0xff] ^
+                 t[5][(lo >> 16) & 0xff] ^ t[4][lo >> 24] ^
+                 t[3][hi & 0xff] ^ t[2][(hi >> 8) & 0xff] ^
+                 t[1][(hi >> 16) & 0xff] ^ t[0][hi >> 24];
+      s += 8;
+      len -= 8;
+    }
+  }
+
+  while (len-- > 0) {
+    crc32val = crc32_tab[(crc32val ^ *s++) & 0xff] ^ (crc32val >> 8);
+  }
+  return crc32val;
+}
+
 /* This is the standard Gary S. Brown's 32 bit CRC algorithm, but
    accumulate the CRC into the result of a previous CRC. */
 cyg_uint32 
 cyg_crc32_accumulate(cyg_uint32 crc32val, unsigned char *s, int len)
 {
-  int i;
-
-  for (i = 0;  i < len;  i++) {
-    crc32val = crc32_tab[(crc32val ^ s[i]) & 0xff] ^ (crc32val >> 8);
-  }
-  return crc32val;
+  return crc32_update(crc32val, s, len);
 }
 
 /* This is the standard Gary S. Brown's 32 bit CRC algorithm */
@@ -146,14 +198,10 @@ cyg_crc32(unsigned char *s, int len)
 cyg_uint32
 cyg_ether_crc32_accumulate(cyg_uint32 crc32val, unsigned char *s, int len)
 {
-  int i;
-
   if (s == 0) return 0L;
   
   crc32val = crc32val ^ 0xffffffff;
-  for (i = 0;  i < len;  i++) {
-      crc32val = crc32_tab[(crc32val ^ s[i]) & 0xff] ^ (crc32val >> 8);
-  }
+  crc32val = crc32_update(crc32val, s, len);
   return crc32val ^ 0xffffffff;
 }
 
@@ -142,9 +142,15 @@ jffs2_flash_direct_writev(struct jffs2_sb_info *c, const struct iovec *vecs,
 int jffs2_flash_erase(struct jffs2_sb_info * c,
 			   struct jffs2_eraseblock * jeb)
 {
-	const struct super_block *sb = OFNI_BS_2SFFJ(c);
+	struct super_block *sb = OFNI_BS_2SFFJ(c);
 	rtems_jffs2_flash_control *fc = sb->s_flash_control;
 
+	if (sb->s_gc_task != 0 && sb->s_gc_task == rtems_task_self()) {
+		++sb->s_gc_stats.background_erases;
+	} else {
+		++sb->s_gc_stats.foreground_erases;
+	}
+
 	return (*fc->erase)(fc, jeb->offset);
 }
 
@@ -31,6 +31,7 @@
 #include <rtems/libio.h>
 #include <rtems/libio_.h>
 #include <rtems/sysinit.h>
+#include <rtems/config.h>
 
 /* Ensure that the JFFS2 values are identical to the POSIX defines */
 
@@ -366,6 +367,11 @@ static void rtems_jffs2_free_fs_info(rtems_jffs2_fs_info *fs_info, bool do_mount
 		free(c->blocks);
 	}
 
+	if (sb->s_gc_task != 0) {
+		/* The task was created but not started */
+		(void) rtems_task_delete(sb->s_gc_task);
+	}
+
 	rtems_jffs2_flash_control_destroy(fs_info->sb.s_flash_control);
 	rtems_jffs2_compressor_control_destroy(fs_info->sb.s_compressor_control);
 	rtems_recursive_mutex_destroy(&sb->s_mutex);
@@ -580,6 +586,14 @@ static int rtems_jffs2_ioctl(
 		case RTEMS_JFFS2_FORCE_GARBAGE_COLLECTION:
 			eno = -jffs2_garbage_collect_pass(&inode->i_sb->jffs2_sb);
 			break;
+		case RTEMS_JFFS2_GET_GC_STATS:
+			memcpy(buffer, &inode->i_sb->s_gc_stats, sizeof(inode->i_sb->s_gc_stats));
+			eno = 0;
+			break;
+		case RTEMS_JFFS2_RESET_GC_STATS:
+			memset(&inode->i_sb->s_gc_stats, 0, sizeof(inode->i_sb->s_gc_stats));
+			eno = 0;
+			break;
 		default:
 			eno = EINVAL;
 			break;
@@ -649,6 +663,35 @@ static ssize_t rtems_jffs2_file_read(rtems_libio_t *iop, void *buf, size_t len)
 	}
 }
 
+static void rtems_jffs2_account_write(
+	struct super_block *sb,
+	uint64_t begin,
+	uint32_t inline_work
+)
+{
+	rtems_jffs2_gc_stats *stats = &sb->s_gc_stats;
+	struct jffs2_sb_info *c = JFFS2_SB_INFO(sb);
+	uint64_t now = rtems_clock_get_uptime_nanoseconds();
+	uint64_t delta = now - begin;
+
+	sb->s_last_write = now;
+	++stats->writes;
+
+	if (delta > stats->write_time_max) {
+		stats->write_time_max = delta;
+	}
+
+	if (stats->foreground_passes + stats->foreground_erases != inline_work) {
+		++stats->write_stalls;
+		stats->write_stall_time += delta;
+	}
+
+	if (sb->s_gc_task != 0
+	    && c->nr_free_blocks + c->nr_erasing_blocks < sb->s_gc_target_free_blocks) {
+		(void) rtems_event_system_send(sb->s_gc_task, RTEMS_EVENT_SYSTEM_SERVER);
+	}
+}
+
 static ssize_t rtems_jffs2_file_write(rtems_libio_t *iop, const void *buf, size_t len)
 {
 	struct _inode *inode = rtems_jffs2_get_inode_by_iop(iop);
@@ -656,6 +699,8 @@ static ssize_t rtems_jffs2_file_write(rtems_libio_t *iop, const void *buf, size_
 	struct jffs2_sb_info *c = JFFS2_SB_INFO(inode->i_sb);
 	struct jffs2_raw_inode ri;
 	uint32_t writtenlen;
+	uint32_t inline_work;
+	uint64_t begin;
 	off_t pos;
 	int eno = 0;
 
@@ -667,7 +712,10 @@ static ssize_t rtems_jffs2_file_write(rtems_libio_t *iop, const void *buf, size_
 	ri.gid = cpu_to_je16(inode->i_gid);
 	ri.atime = ri.ctime = ri.mtime = cpu_to_je32(get_seconds());
 
+	begin = rtems_clock_get_uptime_nanoseconds();
 	rtems_jffs2_do_lock(inode->i_sb);
+	inline_work = inode->i_sb->s_gc_stats.foreground_passes
+		+ inode->i_sb->s_gc_stats.foreground_erases;
 
 	if (rtems_libio_iop_is_append(iop)) {
 		pos = inode->i_size;
@@ -702,6 +750,7 @@ static ssize_t rtems_jffs2_file_write(rtems_libio_t *iop, const void *buf, size_
 		}
 	}
 
+	rtems_jffs2_account_write(inode->i_sb, begin, inline_work);
 	rtems_jffs2_do_unlock(inode->i_sb);
 
 	if (eno == 0) {
@@ -1053,13 +1102,20 @@ static void rtems_jffs2_freenode(const rtems_filesystem_location_info_t *loc)
 
 static void jffs2_remove_delayed_work(struct delayed_work *dwork);
 
+static void rtems_jffs2_stop_gc_task(struct super_block *sb);
+
 static void rtems_jffs2_fsunmount(rtems_filesystem_mount_table_entry_t *mt_entry)
 {
 	rtems_jffs2_fs_info *fs_info = mt_entry->fs_info;
 	struct _inode *root_i = mt_entry->mt_fs_root->location.node_access;
 #ifdef CONFIG_JFFS2_FS_WRITEBUFFER
 	struct jffs2_sb_info *c = JFFS2_SB_INFO(&fs_info->sb);
+#endif
+
+	/* Stop the garbage collection task before the file system goes away */
+	rtems_jffs2_stop_gc_task(&fs_info->sb);
 
+#ifdef CONFIG_JFFS2_FS_WRITEBUFFER
 	/* Remove wbuf delayed work */
 	jffs2_remove_delayed_work(&c->wbuf_dwork);
 
@@ -1342,6 +1398,152 @@ RTEMS_SYSINIT_ITEM(
   RTEMS_SYSINIT_ORDER_MIDDLE
 );
 
+int jffs2_garbage_collect_pass_inline(struct jffs2_sb_info *c)
+{
+	struct super_block *sb = OFNI_BS_2SFFJ(c);
+	uint64_t begin = rtems_clock_get_uptime_nanoseconds();
+	int ret;
+
+	ret = jffs2_garbage_collect_pass(c);
+
+	++sb->s_gc_stats.foreground_passes;
+	sb->s_gc_stats.foreground_time += rtems_clock_get_uptime_nanoseconds() - begin;
+
+	return ret;
+}
+
+static bool rtems_jffs2_gc_is_needed(struct super_block *sb)
+{
+	struct jffs2_sb_info *c = JFFS2_SB_INFO(sb);
+	uint32_t dirty;
+
+	if (jffs2_is_readonly(c)) {
+		return false;
+	}
+
+	if (jffs2_thread_should_wake(c)) {
+		return true;
+	}
+
+	/* See jffs2_thread_should_wake() */
+	dirty = c->dirty_size + c->erasing_size - c->nr_erasing_blocks * c->sector_size;
+
+	return c->nr_free_blocks + c->nr_erasing_blocks < sb->s_gc_target_free_blocks
+		&& dirty >= c->sector_size;
+}
+
+static bool rtems_jffs2_gc_should_yield(struct super_block *sb)
+{
+	struct jffs2_sb_info *c = JFFS2_SB_INFO(sb);
+	uint64_t quiet = rtems_configuration_get_nanoseconds_per_tick();
+
+	/*
+	 * Let the writers go ahead as long as they would not run into an inline
+	 * garbage collection.
+	 */
+	return rtems_clock_get_uptime_nanoseconds() - sb->s_last_write < quiet
+		&& c->nr_free_blocks + c->nr_erasing_blocks > c->resv_blocks_gctrigger;
+}
+
+static rtems_task rtems_jffs2_gc_task(rtems_task_argument arg)
+{
+	struct super_block *sb = (struct super_block *) arg;
+	struct jffs2_sb_info *c = JFFS2_SB_INFO(sb);
+	rtems_interval timeout = rtems_clock_get_ticks_per_second();
+
+	while (sb->s_gc_stopper == 0) {
+		rtems_event_set events;
+		bool yield = false;
+
+		(void) rtems_event_system_receive(
+			RTEMS_EVENT_SYSTEM_SERVER,
+			RTEMS_EVENT_ANY | RTEMS_WAIT,
+			timeout,
+			&events
+		);
+
+		while (sb->s_gc_stopper == 0) {
+			uint64_t begin;
+			int ret;
+
+			rtems_jffs2_do_lock(sb);
+
+			if (!rtems_jffs2_gc_is_needed(sb)) {
+				rtems_jffs2_do_unlock(sb);
+				break;
+			}
+
+			if (rtems_jffs2_gc_should_yield(sb)) {
+				rtems_jffs2_do_unlock(sb);
+				yield = true;
+				break;
+			}
+
+			begin = rtems_clock_get_uptime_nanoseconds();
+			ret = jffs2_garbage_collect_pass(c);
+			++sb->s_gc_stats.background_passes;
+			sb->s_gc_stats.background_time +=
+				rtems_clock_get_uptime_nanoseconds() - begin;
+
+			rtems_jffs2_do_unlock(sb);
+
+			if (ret != 0) {
+				break;
+			}
+		}
+
+		if (yield) {
+			timeout = 1;
+		} else {
+			timeout = rtems_clock_get_ticks_per_second();
+		}
+	}
+
+	(void) rtems_event_transient_send(sb->s_gc_stopper);
+	rtems_task_exit();
+}
+
+static int rtems_jffs2_create_gc_task(
+	struct super_block *sb,
+	const rtems_jffs2_mount_data *jffs2_mount_data
+)
+{
+	rtems_task_priority priority = jffs2_mount_data->gc_task_priority;
+	rtems_status_code sc;
+
+	if (priority == 0) {
+		priority = RTEMS_JFFS2_GC_TASK_PRIORITY_DEFAULT;
+	}
+
+	sc = rtems_task_create(
+		rtems_build_name('J', 'F', 'G', 'C'),
+		priority,
+		2 * RTEMS_MINIMUM_STACK_SIZE,
+		RTEMS_DEFAULT_MODES,
+		RTEMS_DEFAULT_ATTRIBUTES,
+		&sb->s_gc_task
+	);
+	if (sc != RTEMS_SUCCESSFUL) {
+		sb->s_gc_task = 0;
+
+		return -rtems_status_code_to_errno(sc);
+	}
+
+	sb->s_gc_target_free_blocks = jffs2_mount_data->gc_target_free_blocks;
+
+	return 0;
+}
+
+static void rtems_jffs2_stop_gc_task(struct super_block *sb)
+{
+	if (sb->s_gc_task != 0) {
+		sb->s_gc_stopper = rtems_task_self();
+		(void) rtems_event_system_send(sb->s_gc_task, RTEMS_EVENT_SYSTEM_SERVER);
+		(void) rtems_event_transient_receive(RTEMS_WAIT, RTEMS_NO_TIMEOUT);
+		sb->s_gc_task = 0;
+	}
+}
+
 int rtems_jffs2_initialize(
 	rtems_filesystem_mount_table_entry_t *mt_entry,
 	const void *data
@@ -1403,6 +1605,12 @@ int rtems_jffs2_initialize(
 		sb->s_flash_control = fc;
 		sb->s_compressor_control = jffs2_mount_data->compressor_control;
 
+		if (jffs2_mount_data->gc_target_free_blocks > 0 && !sb->s_is_readonly) {
+			err = rtems_jffs2_create_gc_task(sb, jffs2_mount_data);
+		}
+	}
+
+	if (err == 0) {
 #ifdef CONFIG_JFFS2_FS_WRITEBUFFER
 		c->mtd = malloc(sizeof(struct mtd_info));
 		if (!c->mtd) {
@@ -1452,6 +1660,11 @@ int rtems_jffs2_initialize(
 		mt_entry->mt_fs_root->location.node_access = sb->s_root;
 		mt_entry->mt_fs_root->location.handlers = &rtems_jffs2_directory_handlers;
 
+		if (sb->s_gc_task != 0) {
+			(void) rtems_task_start(sb->s_gc_task, rtems_jffs2_gc_task,
+				(rtems_task_argument) sb);
+		}
+
 		return 0;
 	} else {
 		if (fs_info != NULL) {
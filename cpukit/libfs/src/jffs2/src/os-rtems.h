@@ -32,6 +32,8 @@
 #include <time.h>
 
 #include <rtems/jffs2.h>
+#include <rtems/rtems/event.h>
+#include <rtems/rtems/tasks.h>
 #include <rtems/thread.h>
 
 #define CONFIG_JFFS2_RTIME
@@ -108,6 +110,11 @@ struct super_block {
 	rtems_recursive_mutex	s_mutex;
 	char			s_name_buf[JFFS2_MAX_NAME_LEN];
 	uint32_t		s_flags;
+	rtems_id		s_gc_task;
+	rtems_id		s_gc_stopper;
+	uint32_t		s_gc_target_free_blocks;
+	uint64_t		s_last_write;
+	rtems_jffs2_gc_stats	s_gc_stats;
 };
 
 #define sleep_on_spinunlock(wq, sl) spin_unlock(sl)
@@ -128,6 +135,10 @@ static inline void jffs2_garbage_collect_trigger(struct jffs2_sb_info *c)
 	if (fc->trigger_garbage_collection != NULL) {
 		(*fc->trigger_garbage_collection)(fc);
 	}
+
+	if (sb->s_gc_task != 0) {
+		(void) rtems_event_system_send(sb->s_gc_task, RTEMS_EVENT_SYSTEM_SERVER);
+	}
 }
 
 /* fs-rtems.c */
@@ -136,6 +147,7 @@ struct _inode *jffs2_iget(struct super_block *sb, cyg_uint32 ino);
 void jffs2_iput(struct _inode * i);
 void jffs2_gc_release_inode(struct jffs2_sb_info *c, struct jffs2_inode_info *f);
 struct jffs2_inode_info *jffs2_gc_fetch_inode(struct jffs2_sb_info *c, int inum, int nlink);
+int jffs2_garbage_collect_pass_inline(struct jffs2_sb_info *c);
 
 /* Avoid polluting RTEMS namespace with names not starting in jffs2_ */
 #define os_to_jffs2_mode(x) jffs2_from_os_mode(x)
@@ -22,8 +22,10 @@
 #include <sys/param.h>
 #include <sys/filio.h>
 #include <errno.h>
+#include <limits.h>
 #include <stdlib.h>
 #include <string.h>
+#include <unistd.h>
 
 #include <rtems.h>
 #include <rtems/libio_.h>
@@ -56,6 +58,131 @@ static rtems_mutex pipe_mutex = RTEMS_MUTEX_INITIALIZER("Pipes");
 #define PIPE_WAKEUPWRITERS(_pipe) \
   rtems_condition_variable_broadcast(&(_pipe)->writeBarrier)
 
+/*
+ * The ring wraps around at a segment boundary, so a range which does not
+ * cross a segment boundary is contiguous in memory.
+ */
+static char *pipe_at(
+  const pipe_control_t *pipe,
+  unsigned int          offset
+)
+{
+  return pipe->Segments[offset / pipe->SegmentSize] +
+    offset % pipe->SegmentSize;
+}
+
+static unsigned int pipe_contiguous(
+  const pipe_control_t *pipe,
+  unsigned int          offset
+)
+{
+  return pipe->SegmentSize - offset % pipe->SegmentSize;
+}
+
+static void pipe_copy_out(
+  const pipe_control_t *pipe,
+  char                 *buffer,
+  unsigned int          count
+)
+{
+  unsigned int offset = pipe->Start;
+
+  while (count > 0) {
+    unsigned int chunk = MIN(count, pipe_contiguous(pipe, offset));
+
+    memcpy(buffer, pipe_at(pipe, offset), chunk);
+    buffer += chunk;
+    count -= chunk;
+    offset = (offset + chunk) % pipe->Size;
+  }
+}
+
+static void pipe_copy_in(
+  pipe_control_t *pipe,
+  const char     *buffer,
+  unsigned int    count
+)
+{
+  unsigned int offset = PIPE_WSTART(pipe);
+
+  while (count > 0) {
+    unsigned int chunk = MIN(count, pipe_contiguous(pipe, offset));
+
+    memcpy(pipe_at(pipe, offset), buffer, chunk);
+    buffer += chunk;
+    count -= chunk;
+    offset = (offset + chunk) % pipe->Size;
+  }
+}
+
+/*
+ * Readers wait only while the pipe is empty, so they have to be woken up only
+ * if the pipe becomes non-empty.
+ */
+static void pipe_produce(
+  pipe_control_t *pipe,
+  unsigned int    count
+)
+{
+  bool was_empty = PIPE_EMPTY(pipe);
+
+  pipe->Length += count;
+
+  if (was_empty && pipe->waitingReaders > 0)
+    PIPE_WAKEUPREADERS(pipe);
+}
+
+/*
+ * Writers are woken up only if the free space reaches the smallest amount
+ * requested by a waiting writer.  This avoids a wake up for each read of a
+ * few bytes.
+ */
+static void pipe_consume(
+  pipe_control_t *pipe,
+  unsigned int    count
+)
+{
+  pipe->Start += count;
+  pipe->Start %= pipe->Size;
+  pipe->Length -= count;
+  /*
+   * For buffering optimization.  A splice into the pipe fills the range after
+   * the data unlocked, so the write start must not move in the meantime.
+   */
+  if (PIPE_EMPTY(pipe) && !pipe->spliceIn)
+    pipe->Start = 0;
+
+  if (pipe->waitingWriters > 0 && PIPE_SPACE(pipe) >= pipe->writeThreshold) {
+    pipe->writeThreshold = UINT_MAX;
+    PIPE_WAKEUPWRITERS(pipe);
+  }
+}
+
+static void pipe_wait_for_space(
+  pipe_control_t *pipe,
+  unsigned int    space
+)
+{
+  if (pipe->waitingWriters == 0 || space < pipe->writeThreshold)
+    pipe->writeThreshold = space;
+
+  pipe->waitingWriters ++;
+  PIPE_WRITEWAIT(pipe);
+  pipe->waitingWriters --;
+}
+
+static void pipe_free_segments(
+  pipe_control_t *pipe
+)
+{
+  unsigned int i;
+
+  for (i = 0; i < pipe->SegmentCount; ++i)
+    free(pipe->Segments[i]);
+
+  free(pipe->Segments);
+}
+
 /*
  * Alloc pipe control structure, buffer, and resources.
  * Called with pipe_semaphore held.
@@ -66,6 +193,7 @@ static int pipe_alloc(
 {
   static char c = 'a';
   pipe_control_t *pipe;
+  unsigned int i;
   int err = -ENOMEM;
 
   pipe = malloc(sizeof(pipe_control_t));
@@ -73,13 +201,25 @@ static int pipe_alloc(
     return err;
   memset(pipe, 0, sizeof(pipe_control_t));
 
-  pipe->Size = PIPE_BUF;
-  pipe->Buffer = malloc(pipe->Size);
-  if (pipe->Buffer == NULL) {
+  pipe->SegmentSize = MIN(rtems_pipe_buffer_size, PIPE_SEGMENT_SIZE);
+  pipe->SegmentCount = (rtems_pipe_buffer_size + pipe->SegmentSize - 1) /
+    pipe->SegmentSize;
+  pipe->Size = pipe->SegmentCount * pipe->SegmentSize;
+  pipe->Segments = calloc(pipe->SegmentCount, sizeof(*pipe->Segments));
+  if (pipe->Segments == NULL) {
     free(pipe);
     return -ENOMEM;
   }
 
+  for (i = 0; i < pipe->SegmentCount; ++i) {
+    pipe->Segments[i] = malloc(pipe->SegmentSize);
+    if (pipe->Segments[i] == NULL) {
+      pipe_free_segments(pipe);
+      free(pipe);
+      return -ENOMEM;
+    }
+  }
+
   rtems_condition_variable_init(&pipe->readBarrier, "Pipe Read");
   rtems_condition_variable_init(&pipe->writeBarrier, "Pipe Write");
   rtems_mutex_init(&pipe->Mutex, "Pipe");
@@ -98,7 +238,7 @@ static inline void pipe_free(
   rtems_condition_variable_destroy(&pipe->readBarrier);
   rtems_condition_variable_destroy(&pipe->writeBarrier);
   rtems_mutex_destroy(&pipe->Mutex);
-  free(pipe->Buffer);
+  pipe_free_segments(pipe);
   free(pipe);
 }
 
@@ -273,13 +413,14 @@ ssize_t pipe_read(
   rtems_libio_t  *iop
 )
 {
-  int chunk, chunk1, read = 0, ret = 0;
+  int chunk, read = 0, ret = 0;
 
   PIPE_LOCK(pipe);
 
-  while (PIPE_EMPTY(pipe)) {
+  /* A splice out of the pipe consumes the data at the start unlocked */
+  while (PIPE_EMPTY(pipe) || pipe->spliceOut) {
     /* Not an error */
-    if (pipe->Writers == 0)
+    if (PIPE_EMPTY(pipe) && pipe->Writers == 0)
       goto out_locked;
 
     if (LIBIO_NODELAY(iop)) {
@@ -295,23 +436,8 @@ ssize_t pipe_read(
 
   /* Read chunk bytes */
   chunk = MIN(count - read,  pipe->Length);
-  chunk1 = pipe->Size - pipe->Start;
-  if (chunk > chunk1) {
-    memcpy(buffer + read, pipe->Buffer + pipe->Start, chunk1);
-    memcpy(buffer + read + chunk1, pipe->Buffer, chunk - chunk1);
-  }
-  else
-    memcpy(buffer + read, pipe->Buffer + pipe->Start, chunk);
-
-  pipe->Start += chunk;
-  pipe->Start %= pipe->Size;
-  pipe->Length -= chunk;
-  /* For buffering optimization */
-  if (PIPE_EMPTY(pipe))
-    pipe->Start = 0;
-
-  if (pipe->waitingWriters > 0)
-    PIPE_WAKEUPWRITERS(pipe);
+  pipe_copy_out(pipe, (char *) buffer + read, chunk);
+  pipe_consume(pipe, chunk);
   read += chunk;
 
 out_locked:
@@ -329,7 +455,7 @@ ssize_t pipe_write(
   rtems_libio_t  *iop
 )
 {
-  int chunk, chunk1, written = 0, ret = 0;
+  int chunk, written = 0, ret = 0;
 
   /* Write nothing */
   if (count == 0)
@@ -346,16 +472,15 @@ ssize_t pipe_write(
   chunk = count <= pipe->Size ? count : 1;
 
   while (written < count) {
-    while (PIPE_SPACE(pipe) < chunk) {
+    /* A splice into the pipe fills the free space unlocked */
+    while (PIPE_SPACE(pipe) < chunk || pipe->spliceIn) {
       if (LIBIO_NODELAY(iop)) {
         ret = -EAGAIN;
         goto out_locked;
       }
 
       /* Wait until there is chunk bytes space or no reader exists */
-      pipe->waitingWriters ++;
-      PIPE_WRITEWAIT(pipe);
-      pipe->waitingWriters --;
+      pipe_wait_for_space(pipe, chunk);
 
       if (pipe->Readers == 0) {
         ret = -EPIPE;
@@ -364,20 +489,19 @@ ssize_t pipe_write(
     }
 
     chunk = MIN(count - written, PIPE_SPACE(pipe));
-    chunk1 = pipe->Size - PIPE_WSTART(pipe);
-    if (chunk > chunk1) {
-      memcpy(pipe->Buffer + PIPE_WSTART(pipe), buffer + written, chunk1);
-      memcpy(pipe->Buffer, buffer + written + chunk1, chunk - chunk1);
-    }
-    else
-      memcpy(pipe->Buffer + PIPE_WSTART(pipe), buffer + written, chunk);
-
-    pipe->Length += chunk;
-    if (pipe->waitingReaders > 0)
-      PIPE_WAKEUPREADERS(pipe);
+    pipe_copy_in(pipe, (const char *) buffer + written, chunk);
+    pipe_produce(pipe, chunk);
     written += chunk;
-    /* Write of more than PIPE_BUF bytes can be interleaved */
-    chunk = 1;
+
+    /*
+     * Write of more than PIPE_BUF bytes can be interleaved.  A blocking writer
+     * waits until half of the buffer is free to avoid a context switch for
+     * each few bytes consumed by the reader.
+     */
+    if (LIBIO_NODELAY(iop))
+      chunk = 1;
+    else
+      chunk = MIN(count - written, pipe->Size / 2);
   }
 
 out_locked:
@@ -394,6 +518,169 @@ out_locked:
   return ret;
 }
 
+/*
+ * Hand out the contiguous ranges of the pipe buffer directly to the write
+ * handler of the destination.  The pipe is unlocked during the write, so that
+ * writers of the pipe are not blocked by the destination.  Other readers wait
+ * until the splice is done, so the range cannot be consumed in the meantime.
+ * Writers only fill the free space and do not touch the range.
+ */
+static int pipe_splice_out(
+  pipe_control_t   *pipe,
+  pipe_splice_args *args,
+  rtems_libio_t    *iop
+)
+{
+  size_t done = 0;
+  int ret = 0;
+
+  PIPE_LOCK(pipe);
+
+  /* A splice out of the pipe consumes the data at the start unlocked */
+  while (PIPE_EMPTY(pipe) || pipe->spliceOut) {
+    /* Not an error */
+    if (PIPE_EMPTY(pipe) && pipe->Writers == 0)
+      goto out_locked;
+
+    if (LIBIO_NODELAY(iop)) {
+      ret = -EAGAIN;
+      goto out_locked;
+    }
+
+    /* Wait until pipe is no more empty or no writer exists */
+    pipe->waitingReaders ++;
+    PIPE_READWAIT(pipe);
+    pipe->waitingReaders --;
+  }
+
+  pipe->spliceOut = true;
+
+  while (done < args->count && !PIPE_EMPTY(pipe)) {
+    unsigned int chunk;
+    char *data;
+    ssize_t n;
+
+    chunk = MIN(args->count - done, pipe->Length);
+    chunk = MIN(chunk, pipe_contiguous(pipe, pipe->Start));
+    data = pipe_at(pipe, pipe->Start);
+
+    PIPE_UNLOCK(pipe);
+    n = write(args->fd, data, chunk);
+    if (n < 0)
+      ret = -errno;
+    PIPE_LOCK(pipe);
+
+    if (n <= 0)
+      break;
+
+    pipe_consume(pipe, n);
+    done += n;
+
+    if ((size_t) n < chunk)
+      break;
+  }
+
+  pipe->spliceOut = false;
+
+  if (pipe->waitingReaders > 0)
+    PIPE_WAKEUPREADERS(pipe);
+
+out_locked:
+  PIPE_UNLOCK(pipe);
+
+  args->transferred = done;
+  if (done > 0)
+    return 0;
+  return ret;
+}
+
+/*
+ * Let the read handler of the source fill the free contiguous ranges of the
+ * pipe buffer directly.  The pipe is unlocked during the read, so that
+ * readers of the pipe are not blocked by the source.  Other writers wait until
+ * the splice is done, so the range cannot be filled in the meantime.  Readers
+ * only consume the data before the range and do not move the write start.
+ */
+static int pipe_splice_in(
+  pipe_control_t   *pipe,
+  pipe_splice_args *args,
+  rtems_libio_t    *iop
+)
+{
+  size_t done = 0;
+  int ret = 0;
+
+  PIPE_LOCK(pipe);
+
+  if (pipe->Readers == 0) {
+    ret = -EPIPE;
+    goto out_locked;
+  }
+
+  while (PIPE_FULL(pipe) || pipe->spliceIn) {
+    if (LIBIO_NODELAY(iop)) {
+      ret = -EAGAIN;
+      goto out_locked;
+    }
+
+    /* Wait until there is space or no reader exists */
+    pipe_wait_for_space(pipe, 1);
+
+    if (pipe->Readers == 0) {
+      ret = -EPIPE;
+      goto out_locked;
+    }
+  }
+
+  pipe->spliceIn = true;
+
+  while (done < args->count && !PIPE_FULL(pipe)) {
+    unsigned int offset;
+    unsigned int chunk;
+    ssize_t n;
+
+    offset = PIPE_WSTART(pipe);
+    chunk = MIN(args->count - done, PIPE_SPACE(pipe));
+    chunk = MIN(chunk, pipe_contiguous(pipe, offset));
+
+    PIPE_UNLOCK(pipe);
+    n = read(args->fd, pipe_at(pipe, offset), chunk);
+    if (n < 0)
+      ret = -errno;
+    PIPE_LOCK(pipe);
+
+    if (n <= 0)
+      break;
+
+    pipe_produce(pipe, n);
+    done += n;
+
+    if ((size_t) n < chunk)
+      break;
+  }
+
+  pipe->spliceIn = false;
+
+  if (pipe->waitingWriters > 0) {
+    pipe->writeThreshold = UINT_MAX;
+    PIPE_WAKEUPWRITERS(pipe);
+  }
+
+out_locked:
+  PIPE_UNLOCK(pipe);
+
+#ifdef RTEMS_POSIX_API
+  /* Signal SIGPIPE */
+  if (ret == -EPIPE)
+    kill(getpid(), SIGPIPE);
+#endif
+
+  args->transferred = done;
+  if (done > 0)
+    return 0;
+  return ret;
+}
+
 int pipe_ioctl(
   pipe_control_t  *pipe,
   ioctl_command_t  cmd,
@@ -401,6 +688,23 @@ int pipe_ioctl(
   rtems_libio_t   *iop
 )
 {
+  if (cmd == PIPE_SPLICE_OUT || cmd == PIPE_SPLICE_IN) {
+    if (buffer == NULL)
+      return -EFAULT;
+
+    if (cmd == PIPE_SPLICE_OUT) {
+      if ((LIBIO_ACCMODE(iop) & LIBIO_FLAGS_READ) == 0)
+        return -EBADF;
+
+      return pipe_splice_out(pipe, buffer, iop);
+    }
+
+    if ((LIBIO_ACCMODE(iop) & LIBIO_FLAGS_WRITE) == 0)
+      return -EBADF;
+
+    return pipe_splice_in(pipe, buffer, iop);
+  }
+
   if (cmd == FIONREAD) {
     if (buffer == NULL)
       return -EFAULT;
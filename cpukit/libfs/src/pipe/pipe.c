@@ -18,6 +18,8 @@
 #include "config.h"
 #endif
 
+#include <sys/ioctl.h>
+#include <sys/stat.h>
 #include <stdio.h>
 #include <string.h>
 #include <fcntl.h>
@@ -83,3 +85,39 @@ int pipe(
   return 0;
 }
 
+ssize_t rtems_pipe_splice(
+  int    fd_in,
+  int    fd_out,
+  size_t count
+)
+{
+  pipe_splice_args args;
+  struct stat st_in;
+  struct stat st_out;
+  int rv;
+
+  if (fstat(fd_in, &st_in) != 0 || fstat(fd_out, &st_out) != 0)
+    return -1;
+
+  if (count == 0)
+    return 0;
+
+  args.count = count;
+  args.transferred = 0;
+
+  if (S_ISFIFO(st_in.st_mode) && !S_ISFIFO(st_out.st_mode)) {
+    args.fd = fd_out;
+    rv = ioctl(fd_in, PIPE_SPLICE_OUT, &args);
+  } else if (!S_ISFIFO(st_in.st_mode) && S_ISFIFO(st_out.st_mode)) {
+    args.fd = fd_in;
+    rv = ioctl(fd_out, PIPE_SPLICE_IN, &args);
+  } else {
+    /* Exactly one of the file descriptors shall refer to a pipe */
+    rtems_set_errno_and_return_minus_one(EINVAL);
+  }
+
+  if (rv != 0)
+    return -1;
+
+  return (ssize_t) args.transferred;
+}
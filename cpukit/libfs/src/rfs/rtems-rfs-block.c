@@ -126,6 +126,10 @@ rtems_rfs_block_map_open (rtems_rfs_file_system*  fs,
 
   map->dirty = false;
   map->inode = NULL;
+  map->extents = false;
+  map->extent_count = 0;
+  map->extent.count = 0;
+  map->extent_index = 0;
   rtems_rfs_block_set_size_zero (&map->size);
   rtems_rfs_block_set_bpos_zero (&map->bpos);
 
@@ -156,6 +160,19 @@ rtems_rfs_block_map_open (rtems_rfs_file_system*  fs,
   map->last_map_block = rtems_rfs_inode_get_last_map_block (inode);
   map->last_data_block = rtems_rfs_inode_get_last_data_block (inode);
 
+  /*
+   * An empty map on a file system with extents holds extents once it
+   * grows. The inode slots of an empty map can hold a symbolic link's name so
+   * the extent count is only valid if the map has blocks.
+   */
+  if ((rtems_rfs_inode_get_flags (inode) & RTEMS_RFS_INODE_FLAG_EXTENTS) != 0)
+    map->extents = true;
+  else if (rtems_rfs_fs_extents (fs) && (map->size.count == 0))
+    map->extents = true;
+
+  if (map->extents && (map->size.count != 0))
+    map->extent_count = map->blocks[RTEMS_RFS_BLOCK_EXTENT_COUNT_SLOT];
+
   rc = rtems_rfs_inode_unload (fs, inode, false);
 
   return rc;
@@ -178,6 +195,15 @@ rtems_rfs_block_map_close (rtems_rfs_file_system* fs,
     {
       int b;
 
+      if (map->extents)
+      {
+        uint16_t flags = rtems_rfs_inode_get_flags (map->inode);
+        if ((flags & RTEMS_RFS_INODE_FLAG_EXTENTS) == 0)
+          rtems_rfs_inode_set_flags (map->inode,
+                                     flags | RTEMS_RFS_INODE_FLAG_EXTENTS);
+        map->blocks[RTEMS_RFS_BLOCK_EXTENT_COUNT_SLOT] = map->extent_count;
+      }
+
       for (b = 0; b < RTEMS_RFS_INODE_BLOCKS; b++)
         rtems_rfs_inode_set_block (map->inode, b, map->blocks[b]);
       rtems_rfs_inode_set_block_count (map->inode, map->size.count);
@@ -248,6 +274,236 @@ rtems_rfs_block_find_indirect (rtems_rfs_file_system*   fs,
   return 0;
 }
 
+/**
+ * Is the map's table of extent blocks held in blocks referenced by the inode
+ * rather than in the inode ?
+ *
+ * @param fs The file system.
+ * @param extents The number of extents in the map.
+ * @return bool True if the extent blocks are held in tables.
+ */
+static bool
+rtems_rfs_block_map_extent_tables (rtems_rfs_file_system* fs,
+                                   uint32_t               extents)
+{
+  return extents >
+    (RTEMS_RFS_BLOCK_EXTENT_BLOCKS * rtems_rfs_block_extents_per_block (fs));
+}
+
+/**
+ * Get the block number of an extent block.
+ *
+ * @param fs The file system.
+ * @param map The map holding the extents.
+ * @param index The index of the extent block in the map.
+ * @param block Pointer to the block number of the extent block.
+ * @return int The error number (errno). No error if 0.
+ */
+static int
+rtems_rfs_block_map_extent_block (rtems_rfs_file_system* fs,
+                                  rtems_rfs_block_map*   map,
+                                  rtems_rfs_block_no     index,
+                                  rtems_rfs_block_no*    block)
+{
+  if (!rtems_rfs_block_map_extent_tables (fs, map->extent_count))
+    *block = map->blocks[index];
+  else
+  {
+    int rc;
+    rc = rtems_rfs_block_find_indirect (fs, &map->doubly_buffer,
+                                        map->blocks[index / fs->blocks_per_block],
+                                        index % fs->blocks_per_block,
+                                        block);
+    if (rc > 0)
+      return rc;
+  }
+
+  return 0;
+}
+
+/**
+ * Get an extent from the map.
+ *
+ * @param fs The file system.
+ * @param map The map holding the extents.
+ * @param index The index of the extent in the map.
+ * @param extent Pointer to the extent to fill in.
+ * @return int The error number (errno). No error if 0.
+ */
+static int
+rtems_rfs_block_map_extent_get (rtems_rfs_file_system*  fs,
+                                rtems_rfs_block_map*    map,
+                                uint32_t                index,
+                                rtems_rfs_block_extent* extent)
+{
+  if (map->extent_count <= RTEMS_RFS_BLOCK_INODE_EXTENTS)
+  {
+    extent->bno = index == 0 ? 0 : map->blocks[1];
+    extent->block = map->blocks[index * 2];
+    extent->count = map->blocks[(index * 2) + 1];
+  }
+  else
+  {
+    size_t             epb = rtems_rfs_block_extents_per_block (fs);
+    int                entry = (index % epb) * 3;
+    rtems_rfs_block_no extent_block;
+    int                rc;
+
+    rc = rtems_rfs_block_map_extent_block (fs, map, index / epb, &extent_block);
+    if (rc > 0)
+      return rc;
+
+    rc = rtems_rfs_buffer_handle_request (fs, &map->singly_buffer,
+                                          extent_block, true);
+    if (rc > 0)
+      return rc;
+
+    extent->bno = rtems_rfs_block_get_number (&map->singly_buffer, entry);
+    extent->block = rtems_rfs_block_get_number (&map->singly_buffer, entry + 1);
+    extent->count = rtems_rfs_block_get_number (&map->singly_buffer, entry + 2);
+  }
+
+  if ((extent->count == 0) ||
+      (extent->block >= rtems_rfs_fs_blocks (fs)) ||
+      (extent->count > (rtems_rfs_fs_blocks (fs) - extent->block)))
+  {
+    if (rtems_rfs_trace (RTEMS_RFS_TRACE_BLOCK_FIND))
+      printf ("rtems-rfs: block-find: invalid extent: index=%" PRIu32
+              " bno=%" PRIu32 " block=%" PRIu32 " count=%" PRIu32 "\n",
+              index, extent->bno, extent->block, extent->count);
+    return EIO;
+  }
+
+  return 0;
+}
+
+/**
+ * Set an extent in the map. The extent must be held in the map, use append to
+ * add an extent.
+ *
+ * @param fs The file system.
+ * @param map The map holding the extents.
+ * @param index The index of the extent in the map.
+ * @param extent Pointer to the extent to set.
+ * @return int The error number (errno). No error if 0.
+ */
+static int
+rtems_rfs_block_map_extent_set (rtems_rfs_file_system*  fs,
+                                rtems_rfs_block_map*    map,
+                                uint32_t                index,
+                                rtems_rfs_block_extent* extent)
+{
+  if (map->extent_count <= RTEMS_RFS_BLOCK_INODE_EXTENTS)
+  {
+    map->blocks[index * 2] = extent->block;
+    map->blocks[(index * 2) + 1] = extent->count;
+  }
+  else
+  {
+    size_t             epb = rtems_rfs_block_extents_per_block (fs);
+    int                entry = (index % epb) * 3;
+    rtems_rfs_block_no extent_block;
+    int                rc;
+
+    rc = rtems_rfs_block_map_extent_block (fs, map, index / epb, &extent_block);
+    if (rc > 0)
+      return rc;
+
+    rc = rtems_rfs_buffer_handle_request (fs, &map->singly_buffer,
+                                          extent_block, true);
+    if (rc > 0)
+      return rc;
+
+    rtems_rfs_block_set_number (&map->singly_buffer, entry, extent->bno);
+    rtems_rfs_block_set_number (&map->singly_buffer, entry + 1, extent->block);
+    rtems_rfs_block_set_number (&map->singly_buffer, entry + 2, extent->count);
+  }
+
+  map->dirty = true;
+  return 0;
+}
+
+/**
+ * Find a block in a map holding extents. The extent found is cached in the
+ * map so blocks in the same extent are found without a search.
+ *
+ * @param fs The file system.
+ * @param map The map holding the extents.
+ * @param bno The logical block number to find.
+ * @param block Pointer to the block number found.
+ * @return int The error number (errno). No error if 0.
+ */
+static int
+rtems_rfs_block_map_extent_find (rtems_rfs_file_system* fs,
+                                 rtems_rfs_block_map*   map,
+                                 rtems_rfs_block_no     bno,
+                                 rtems_rfs_block_no*    block)
+{
+  rtems_rfs_block_extent* extent = &map->extent;
+
+  if ((extent->count != 0) &&
+      ((bno - extent->bno) == extent->count) &&
+      ((map->extent_index + 1) < map->extent_count))
+  {
+    /*
+     * Sequential access moving to the next extent.
+     */
+    int rc;
+
+    rc = rtems_rfs_block_map_extent_get (fs, map, map->extent_index + 1,
+                                         extent);
+    if (rc > 0)
+    {
+      extent->count = 0;
+      return rc;
+    }
+
+    map->extent_index++;
+  }
+
+  if ((extent->count == 0) ||
+      (bno < extent->bno) || ((bno - extent->bno) >= extent->count))
+  {
+    uint32_t low = 0;
+    uint32_t high = map->extent_count;
+
+    extent->count = 0;
+
+    while (low < high)
+    {
+      rtems_rfs_block_extent probe;
+      uint32_t               mid = low + ((high - low) / 2);
+      int                    rc;
+
+      rc = rtems_rfs_block_map_extent_get (fs, map, mid, &probe);
+      if (rc > 0)
+        return rc;
+
+      if (bno < probe.bno)
+        high = mid;
+      else if ((bno - probe.bno) >= probe.count)
+        low = mid + 1;
+      else
+      {
+        *extent = probe;
+        map->extent_index = mid;
+        break;
+      }
+    }
+
+    if (extent->count == 0)
+    {
+      if (rtems_rfs_trace (RTEMS_RFS_TRACE_BLOCK_FIND))
+        printf ("rtems-rfs: block-find: block not in extents: bno=%" PRIu32
+                " extents=%" PRIu32 "\n", bno, map->extent_count);
+      return EIO;
+    }
+  }
+
+  *block = extent->block + (bno - extent->bno);
+  return 0;
+}
+
 int
 rtems_rfs_block_map_find (rtems_rfs_file_system* fs,
                           rtems_rfs_block_map*   map,
@@ -271,6 +527,10 @@ rtems_rfs_block_map_find (rtems_rfs_file_system* fs,
   {
     *block = map->bpos.block;
   }
+  else if (map->extents)
+  {
+    rc = rtems_rfs_block_map_extent_find (fs, map, bpos->bno, block);
+  }
   else
   {
     /*
@@ -421,6 +681,238 @@ rtems_rfs_block_map_indirect_alloc (rtems_rfs_file_system*   fs,
   return 0;
 }
 
+/**
+ * Append an extent to a map holding extents. When the extents no longer fit
+ * in the inode they are moved to an extent block and new extent blocks are
+ * allocated as needed. When the inode slots are all used by extent blocks the
+ * slots are moved to a table of extent blocks.
+ *
+ * @param fs The file system data.
+ * @param map The map to append the extent to.
+ * @param extent The extent to append.
+ * @return int The error number (errno). No error if 0.
+ */
+static int
+rtems_rfs_block_map_extent_append (rtems_rfs_file_system*  fs,
+                                   rtems_rfs_block_map*    map,
+                                   rtems_rfs_block_extent* extent)
+{
+  size_t             epb = rtems_rfs_block_extents_per_block (fs);
+  uint32_t           index = map->extent_count;
+  rtems_rfs_block_no extent_block;
+  rtems_rfs_block_no table;
+  int                rc;
+
+  if (index < RTEMS_RFS_BLOCK_INODE_EXTENTS)
+  {
+    map->blocks[index * 2] = extent->block;
+    map->blocks[(index * 2) + 1] = extent->count;
+    map->extent_count++;
+    map->dirty = true;
+    return 0;
+  }
+
+  extent_block = index / epb;
+
+  if (extent_block >= (RTEMS_RFS_BLOCK_EXTENT_BLOCKS * fs->blocks_per_block))
+    return EFBIG;
+
+  if (index == RTEMS_RFS_BLOCK_INODE_EXTENTS)
+  {
+    /*
+     * Upping is moving the extents held in the inode to an extent block.
+     */
+    rtems_rfs_block_extent inode_extents[RTEMS_RFS_BLOCK_INODE_EXTENTS];
+    int                    e;
+
+    if (rtems_rfs_trace (RTEMS_RFS_TRACE_BLOCK_MAP_GROW))
+      printf ("rtems-rfs: block-map-grow: upping extents: block-count=%" PRId32 "\n",
+              map->size.count);
+
+    for (e = 0; e < RTEMS_RFS_BLOCK_INODE_EXTENTS; e++)
+    {
+      rc = rtems_rfs_block_map_extent_get (fs, map, e, &inode_extents[e]);
+      if (rc > 0)
+        return rc;
+    }
+
+    rc = rtems_rfs_block_map_indirect_alloc (fs, map, &map->singly_buffer,
+                                             &extent_block, false);
+    if (rc > 0)
+      return rc;
+
+    for (e = 0; e < RTEMS_RFS_BLOCK_INODE_EXTENTS; e++)
+    {
+      rtems_rfs_block_set_number (&map->singly_buffer, (e * 3),
+                                  inode_extents[e].bno);
+      rtems_rfs_block_set_number (&map->singly_buffer, (e * 3) + 1,
+                                  inode_extents[e].block);
+      rtems_rfs_block_set_number (&map->singly_buffer, (e * 3) + 2,
+                                  inode_extents[e].count);
+    }
+
+    memset (map->blocks, 0, sizeof (map->blocks));
+    map->blocks[0] = extent_block;
+  }
+  else if ((index % epb) == 0)
+  {
+    rtems_rfs_block_no new_block;
+
+    /*
+     * The extent is the first in a new extent block.
+     */
+    rc = rtems_rfs_block_map_indirect_alloc (fs, map, &map->singly_buffer,
+                                             &new_block, false);
+    if (rc > 0)
+      return rc;
+
+    if (extent_block < RTEMS_RFS_BLOCK_EXTENT_BLOCKS)
+      map->blocks[extent_block] = new_block;
+    else
+    {
+      if (extent_block == RTEMS_RFS_BLOCK_EXTENT_BLOCKS)
+      {
+        /*
+         * Move the extent blocks held in the inode to a table.
+         */
+        int b;
+
+        rc = rtems_rfs_block_map_indirect_alloc (fs, map, &map->doubly_buffer,
+                                                 &table, false);
+        if (rc > 0)
+        {
+          rtems_rfs_group_bitmap_free (fs, false, new_block);
+          return rc;
+        }
+
+        for (b = 0; b < RTEMS_RFS_BLOCK_EXTENT_BLOCKS; b++)
+          rtems_rfs_block_set_number (&map->doubly_buffer, b, map->blocks[b]);
+
+        memset (map->blocks, 0, sizeof (map->blocks));
+        map->blocks[0] = table;
+      }
+      else if ((extent_block % fs->blocks_per_block) == 0)
+      {
+        rc = rtems_rfs_block_map_indirect_alloc (fs, map, &map->doubly_buffer,
+                                                 &table, false);
+        if (rc > 0)
+        {
+          rtems_rfs_group_bitmap_free (fs, false, new_block);
+          return rc;
+        }
+
+        map->blocks[extent_block / fs->blocks_per_block] = table;
+      }
+      else
+      {
+        rc = rtems_rfs_buffer_handle_request (fs, &map->doubly_buffer,
+                                              map->blocks[extent_block /
+                                                          fs->blocks_per_block],
+                                              true);
+        if (rc > 0)
+        {
+          rtems_rfs_group_bitmap_free (fs, false, new_block);
+          return rc;
+        }
+      }
+
+      rtems_rfs_block_set_number (&map->doubly_buffer,
+                                  extent_block % fs->blocks_per_block,
+                                  new_block);
+    }
+  }
+
+  map->extent_count++;
+  map->dirty = true;
+
+  return rtems_rfs_block_map_extent_set (fs, map, index, extent);
+}
+
+/**
+ * Grow a map holding extents. A block adjacent to the last block in the map
+ * extends the last extent rather than adding an extent.
+ *
+ * @param fs The file system data.
+ * @param map The map to grow.
+ * @param blocks The number of blocks to grow the map by.
+ * @param new_block The first block allocated to the map.
+ * @return int The error number (errno). No error if 0.
+ */
+static int
+rtems_rfs_block_map_extent_grow (rtems_rfs_file_system* fs,
+                                 rtems_rfs_block_map*   map,
+                                 size_t                 blocks,
+                                 rtems_rfs_block_no*    new_block)
+{
+  int b;
+
+  for (b = 0; b < blocks; b++)
+  {
+    rtems_rfs_block_extent extent;
+    rtems_rfs_bitmap_bit   block;
+    bool                   merged = false;
+    int                    rc;
+
+    rc = rtems_rfs_group_bitmap_alloc (fs, map->last_data_block,
+                                       false, &block);
+    if (rc > 0)
+      return rc;
+
+    if (map->extent_count > 0)
+    {
+      rc = rtems_rfs_block_map_extent_get (fs, map, map->extent_count - 1,
+                                           &extent);
+      if (rc > 0)
+      {
+        rtems_rfs_group_bitmap_free (fs, false, block);
+        return rc;
+      }
+
+      if ((extent.block + extent.count) == block)
+      {
+        extent.count++;
+        rc = rtems_rfs_block_map_extent_set (fs, map, map->extent_count - 1,
+                                             &extent);
+        if (rc > 0)
+        {
+          rtems_rfs_group_bitmap_free (fs, false, block);
+          return rc;
+        }
+        merged = true;
+      }
+    }
+
+    if (!merged)
+    {
+      extent.bno = map->size.count;
+      extent.block = block;
+      extent.count = 1;
+      rc = rtems_rfs_block_map_extent_append (fs, map, &extent);
+      if (rc > 0)
+      {
+        rtems_rfs_group_bitmap_free (fs, false, block);
+        return rc;
+      }
+    }
+
+    /*
+     * The last extent is the one the next find will most likely want.
+     */
+    map->extent = extent;
+    map->extent_index = map->extent_count - 1;
+
+    map->size.count++;
+    map->size.offset = 0;
+
+    if (b == 0)
+      *new_block = block;
+    map->last_data_block = block;
+    map->dirty = true;
+  }
+
+  return 0;
+}
+
 int
 rtems_rfs_block_map_grow (rtems_rfs_file_system* fs,
                           rtems_rfs_block_map*   map,
@@ -436,6 +928,9 @@ rtems_rfs_block_map_grow (rtems_rfs_file_system* fs,
   if ((map->size.count + blocks) >= rtems_rfs_fs_max_block_map_blocks (fs))
     return EFBIG;
 
+  if (map->extents)
+    return rtems_rfs_block_map_extent_grow (fs, map, blocks, new_block);
+
   /*
    * Allocate a block at a time. The buffer handles hold the blocks so adding
    * this way does not thrash the cache with lots of requests.
@@ -664,6 +1159,175 @@ rtems_rfs_block_map_indirect_shrink (rtems_rfs_file_system*   fs,
   return rc;
 }
 
+/**
+ * Remove the last extent from a map holding extents. Extent blocks and tables
+ * no longer used are freed. If the remaining extent blocks fit in the inode
+ * they are moved back into the inode and if the remaining extents fit in the
+ * inode they are moved back into the inode.
+ *
+ * @param fs The file system data.
+ * @param map The map to remove the extent from.
+ * @return int The error number (errno). No error if 0.
+ */
+static int
+rtems_rfs_block_map_extent_remove (rtems_rfs_file_system* fs,
+                                   rtems_rfs_block_map*   map)
+{
+  size_t             epb = rtems_rfs_block_extents_per_block (fs);
+  uint32_t           index = map->extent_count - 1;
+  rtems_rfs_block_no extent_block = index / epb;
+  rtems_rfs_block_no block_to_free = 0;
+  rtems_rfs_block_no table_to_free = 0;
+  int                rc;
+
+  if (map->extent_count <= RTEMS_RFS_BLOCK_INODE_EXTENTS)
+  {
+    map->blocks[index * 2] = 0;
+    map->blocks[(index * 2) + 1] = 0;
+  }
+  else if (index == RTEMS_RFS_BLOCK_INODE_EXTENTS)
+  {
+    /*
+     * Move the remaining extents back into the inode and free the extent
+     * block.
+     */
+    rtems_rfs_block_extent inode_extents[RTEMS_RFS_BLOCK_INODE_EXTENTS];
+    int                    e;
+
+    for (e = 0; e < RTEMS_RFS_BLOCK_INODE_EXTENTS; e++)
+    {
+      rc = rtems_rfs_block_map_extent_get (fs, map, e, &inode_extents[e]);
+      if (rc > 0)
+        return rc;
+    }
+
+    block_to_free = map->blocks[0];
+
+    memset (map->blocks, 0, sizeof (map->blocks));
+    for (e = 0; e < RTEMS_RFS_BLOCK_INODE_EXTENTS; e++)
+    {
+      map->blocks[e * 2] = inode_extents[e].block;
+      map->blocks[(e * 2) + 1] = inode_extents[e].count;
+    }
+  }
+  else if ((index % epb) == 0)
+  {
+    /*
+     * The extent is the only one in its extent block.
+     */
+    rc = rtems_rfs_block_map_extent_block (fs, map, extent_block,
+                                           &block_to_free);
+    if (rc > 0)
+      return rc;
+
+    if (extent_block < RTEMS_RFS_BLOCK_EXTENT_BLOCKS)
+      map->blocks[extent_block] = 0;
+    else if (extent_block == RTEMS_RFS_BLOCK_EXTENT_BLOCKS)
+    {
+      /*
+       * Move the extent blocks in the table back into the inode. The table is
+       * in the doubly buffer after finding the extent block.
+       */
+      int b;
+
+      table_to_free = map->blocks[0];
+      for (b = 0; b < RTEMS_RFS_BLOCK_EXTENT_BLOCKS; b++)
+        map->blocks[b] = rtems_rfs_block_get_number (&map->doubly_buffer, b);
+    }
+    else if ((extent_block % fs->blocks_per_block) == 0)
+    {
+      table_to_free = map->blocks[extent_block / fs->blocks_per_block];
+      map->blocks[extent_block / fs->blocks_per_block] = 0;
+    }
+  }
+
+  map->extent_count--;
+  map->extent.count = 0;
+  map->dirty = true;
+
+  if (block_to_free != 0)
+  {
+    rc = rtems_rfs_group_bitmap_free (fs, false, block_to_free);
+    if (rc > 0)
+      return rc;
+    map->last_map_block = block_to_free;
+  }
+
+  if (table_to_free != 0)
+  {
+    rc = rtems_rfs_group_bitmap_free (fs, false, table_to_free);
+    if (rc > 0)
+      return rc;
+    map->last_map_block = table_to_free;
+  }
+
+  return 0;
+}
+
+/**
+ * Shrink a map holding extents. Blocks are freed from the end of the last
+ * extent.
+ *
+ * @param fs The file system data.
+ * @param map The map to shrink.
+ * @param blocks The number of blocks to shrink the map by.
+ * @return int The error number (errno). No error if 0.
+ */
+static int
+rtems_rfs_block_map_extent_shrink (rtems_rfs_file_system* fs,
+                                   rtems_rfs_block_map*   map,
+                                   size_t                 blocks)
+{
+  while (blocks)
+  {
+    rtems_rfs_block_extent extent;
+    int                    rc;
+
+    rc = rtems_rfs_block_map_extent_get (fs, map, map->extent_count - 1,
+                                         &extent);
+    if (rc > 0)
+      return rc;
+
+    while (blocks && extent.count)
+    {
+      rtems_rfs_block_no block_to_free;
+
+      block_to_free = extent.block + extent.count - 1;
+
+      rc = rtems_rfs_group_bitmap_free (fs, false, block_to_free);
+      if (rc > 0)
+        break;
+
+      extent.count--;
+      map->size.count--;
+      map->size.offset = 0;
+      map->last_data_block = block_to_free;
+      map->dirty = true;
+      blocks--;
+    }
+
+    if (extent.count == 0)
+    {
+      int rrc = rtems_rfs_block_map_extent_remove (fs, map);
+      if (rc == 0)
+        rc = rrc;
+    }
+    else
+    {
+      int rrc = rtems_rfs_block_map_extent_set (fs, map, map->extent_count - 1,
+                                                &extent);
+      map->extent.count = 0;
+      if (rc == 0)
+        rc = rrc;
+    }
+
+    if (rc > 0)
+      return rc;
+  }
+
+  return 0;
+}
+
 int
 rtems_rfs_block_map_shrink (rtems_rfs_file_system* fs,
                             rtems_rfs_block_map*   map,
@@ -679,6 +1343,14 @@ rtems_rfs_block_map_shrink (rtems_rfs_file_system* fs,
   if (blocks > map->size.count)
     blocks = map->size.count;
 
+  if (map->extents)
+  {
+    int rc = rtems_rfs_block_map_extent_shrink (fs, map, blocks);
+    if (rc > 0)
+      return rc;
+    blocks = 0;
+  }
+
   while (blocks)
   {
     rtems_rfs_block_no block;
@@ -149,6 +149,18 @@ rtems_rfs_buffer_handle_request (rtems_rfs_file_system*   fs,
               rtems_rfs_buffer_refs (handle) + 1);
   }
 
+  /*
+   * A modified buffer held by the running journal transaction cannot be
+   * requested from the cache until the transaction has been committed.
+   */
+  if (rtems_rfs_journal_active (fs) &&
+      !rtems_rfs_buffer_handle_has_block (handle))
+  {
+    handle->buffer = rtems_rfs_journal_scan (fs, block);
+    if (rtems_rfs_buffer_handle_has_block (handle))
+      rtems_rfs_buffer_mark_dirty (handle);
+  }
+
   /*
    * If the buffer has not been found check the local cache of released
    * buffers. There are release and released modified lists to preserve the
@@ -239,7 +251,17 @@ rtems_rfs_buffer_handle_release (rtems_rfs_file_system*   fs,
       rtems_chain_extract_unprotected (rtems_rfs_buffer_link (handle));
       fs->buffers_count--;
 
-      if (rtems_rfs_fs_no_local_cache (fs))
+      /*
+       * A buffer modified by this or another handle while the buffer was
+       * shared is held by the journal's transaction.
+       */
+      if (rtems_rfs_journal_active (fs) &&
+          (rtems_rfs_buffer_dirty (handle) ||
+           rtems_rfs_journal_logged (fs, rtems_rfs_buffer_bnum (handle))))
+      {
+        rc = rtems_rfs_journal_add (fs, handle->buffer);
+      }
+      else if (rtems_rfs_fs_no_local_cache (fs))
       {
         handle->buffer->user = (void*) 0;
         rc = rtems_rfs_buffer_io_release (handle->buffer,
@@ -298,12 +320,60 @@ rtems_rfs_buffer_handle_release (rtems_rfs_file_system*   fs,
         }
       }
     }
+    else if (rtems_rfs_journal_active (fs) && rtems_rfs_buffer_dirty (handle))
+    {
+      /*
+       * The changes made by this handle are part of the transaction even if
+       * the last handle to release the buffer does not modify it.
+       */
+      rc = rtems_rfs_journal_mark (fs, rtems_rfs_buffer_bnum (handle));
+    }
     handle->buffer = NULL;
   }
 
   return rc;
 }
 
+int
+rtems_rfs_buffer_handle_release_data (rtems_rfs_file_system*   fs,
+                                      rtems_rfs_buffer_handle* handle)
+{
+  int rrc = 0;
+  int rc;
+
+  if (!rtems_rfs_journal_active (fs) ||
+      !rtems_rfs_buffer_handle_has_block (handle) ||
+      !rtems_rfs_buffer_dirty (handle) ||
+      (rtems_rfs_buffer_refs (handle) != 1))
+    return rtems_rfs_buffer_handle_release (fs, handle);
+
+  if (rtems_rfs_trace (RTEMS_RFS_TRACE_BUFFER_HANDLE_RELEASE))
+    printf ("rtems-rfs: buffer-release-data: block=%" PRIu32 "\n",
+            rtems_rfs_buffer_bnum (handle));
+
+  rtems_rfs_buffer_refs_down (handle);
+  rtems_chain_extract_unprotected (rtems_rfs_buffer_link (handle));
+  fs->buffers_count--;
+
+  /*
+   * A block freed and reused as data in the running transaction cannot be
+   * written until the transaction freeing the block is committed. A block
+   * with a copy in the journal is revoked so the copy is not replayed.
+   */
+  rc = rtems_rfs_journal_revoke (fs, rtems_rfs_buffer_bnum (handle));
+  if (rc > 0)
+    rrc = rc;
+
+  handle->buffer->user = (void*) 0;
+  rc = rtems_rfs_buffer_io_release (handle->buffer, true);
+  if ((rc > 0) && (rrc == 0))
+    rrc = rc;
+
+  handle->buffer = NULL;
+
+  return rrc;
+}
+
 int
 rtems_rfs_buffer_open (const char* name, rtems_rfs_file_system* fs)
 {
@@ -398,13 +468,35 @@ int
 rtems_rfs_buffer_sync (rtems_rfs_file_system* fs)
 {
   int result = 0;
-#if RTEMS_RFS_USE_LIBBLOCK
-  rtems_status_code sc;
-#endif
+  int rc;
 
   if (rtems_rfs_trace (RTEMS_RFS_TRACE_BUFFER_SYNC))
     printf ("rtems-rfs: buffer-sync: syncing\n");
 
+  rc = rtems_rfs_journal_commit (fs);
+  if (rc > 0)
+  {
+    if (rtems_rfs_trace (RTEMS_RFS_TRACE_BUFFER_SYNC))
+      printf ("rtems-rfs: buffer-sync: journal commit failed: %d: %s\n",
+              rc, strerror (rc));
+    result = rc;
+  }
+
+  rc = rtems_rfs_buffer_flush (fs);
+  if ((rc > 0) && (result == 0))
+    result = rc;
+
+  return result;
+}
+
+int
+rtems_rfs_buffer_flush (rtems_rfs_file_system* fs)
+{
+  int result = 0;
+#if RTEMS_RFS_USE_LIBBLOCK
+  rtems_status_code sc;
+#endif
+
   /*
    * @todo Split in the separate files for each type.
    */
@@ -502,6 +594,9 @@ rtems_rfs_buffers_release (rtems_rfs_file_system* fs)
                                 true);
   if ((rc > 0) && (rrc == 0))
     rrc = rc;
+  rc = rtems_rfs_journal_release (fs);
+  if ((rc > 0) && (rrc == 0))
+    rrc = rc;
 
   return rrc;
 }
@@ -49,6 +49,7 @@
 
 #include <inttypes.h>
 #include <rtems/inttypes.h>
+#include <stdlib.h>
 #include <string.h>
 
 #include <rtems/rfs/rtems-rfs-block.h>
@@ -65,6 +66,666 @@
   (((_l) <= RTEMS_RFS_DIR_ENTRY_SIZE) || ((_l) >= rtems_rfs_fs_max_name (_f)) \
    || (_i < RTEMS_RFS_ROOT_INO) || (_i > rtems_rfs_fs_inodes (_f)))
 
+/**
+ * Is the directory indexed ?
+ */
+#define rtems_rfs_dir_indexed(_i) \
+  ((rtems_rfs_inode_get_flags (_i) & RTEMS_RFS_INODE_FLAG_DIR_INDEX) != 0)
+
+/**
+ * The number of entries an index block can hold.
+ */
+#define rtems_rfs_dir_index_max(_f) \
+  ((int) ((rtems_rfs_fs_block_size (_f) - RTEMS_RFS_DIR_INDEX_ENTRIES) / \
+          RTEMS_RFS_DIR_INDEX_ENTRY_SIZE))
+
+/**
+ * Return a pointer to an entry in an index block.
+ */
+#define rtems_rfs_dir_index_entry(_d, _e) \
+  ((_d) + RTEMS_RFS_DIR_INDEX_ENTRIES + ((_e) * RTEMS_RFS_DIR_INDEX_ENTRY_SIZE))
+
+/**
+ * Access the fields of an index block.
+ */
+#define rtems_rfs_dir_index_count(_d) \
+  rtems_rfs_read_u16 ((_d) + RTEMS_RFS_DIR_INDEX_COUNT)
+#define rtems_rfs_dir_index_set_count(_d, _c) \
+  rtems_rfs_write_u16 ((_d) + RTEMS_RFS_DIR_INDEX_COUNT, _c)
+#define rtems_rfs_dir_index_levels(_d) \
+  rtems_rfs_read_u16 ((_d) + RTEMS_RFS_DIR_INDEX_LEVELS)
+#define rtems_rfs_dir_index_hash(_d, _e) \
+  rtems_rfs_read_u32 (rtems_rfs_dir_index_entry (_d, _e))
+#define rtems_rfs_dir_index_block(_d, _e) \
+  rtems_rfs_read_u32 (rtems_rfs_dir_index_entry (_d, _e) + 4)
+
+/**
+ * The index blocks passed through to reach a block of entries. The root is
+ * level 0.
+ */
+typedef struct rtems_rfs_dir_index_path_s
+{
+  rtems_rfs_block_no bno;   /**< The logical block of the index block. */
+  int                slot;  /**< The index entry followed. */
+  int                count; /**< The number of entries in the index block. */
+} rtems_rfs_dir_index_path;
+
+/**
+ * An entry in a block of entries being split.
+ */
+typedef struct rtems_rfs_dir_index_sort_s
+{
+  uint32_t hash;
+  int      offset;
+  int      length;
+} rtems_rfs_dir_index_sort;
+
+static void
+rtems_rfs_dir_index_init (rtems_rfs_file_system* fs, uint8_t* data, int levels)
+{
+  memset (data, 0xff, rtems_rfs_fs_block_size (fs));
+  rtems_rfs_dir_set_entry_ino (data, RTEMS_RFS_EMPTY_INO);
+  rtems_rfs_dir_index_set_count (data, 0);
+  rtems_rfs_write_u16 (data + RTEMS_RFS_DIR_INDEX_LEVELS, levels);
+}
+
+static void
+rtems_rfs_dir_index_set_entry (uint8_t*           data,
+                               int                slot,
+                               uint32_t           hash,
+                               rtems_rfs_block_no bno)
+{
+  uint8_t* entry = rtems_rfs_dir_index_entry (data, slot);
+  rtems_rfs_write_u32 (entry, hash);
+  rtems_rfs_write_u32 (entry + 4, bno);
+}
+
+/**
+ * Request a logical block of the directory.
+ */
+static int
+rtems_rfs_dir_index_request (rtems_rfs_file_system*   fs,
+                             rtems_rfs_block_map*     map,
+                             rtems_rfs_buffer_handle* handle,
+                             rtems_rfs_block_no       bno)
+{
+  rtems_rfs_block_pos bpos;
+  rtems_rfs_block_no  block;
+  int                 rc;
+
+  rtems_rfs_block_set_bpos_zero (&bpos);
+  bpos.bno = bno;
+
+  rc = rtems_rfs_block_map_find (fs, map, &bpos, &block);
+  if (rc > 0)
+  {
+    if (rc == ENXIO)
+      rc = EIO;
+    return rc;
+  }
+
+  return rtems_rfs_buffer_handle_request (fs, handle, block, true);
+}
+
+/**
+ * Add a block to the end of the directory and request it. The block's data is
+ * not read.
+ */
+static int
+rtems_rfs_dir_index_grow (rtems_rfs_file_system*   fs,
+                          rtems_rfs_block_map*     map,
+                          rtems_rfs_buffer_handle* handle,
+                          rtems_rfs_block_no*      bno)
+{
+  rtems_rfs_block_no block;
+  int                rc;
+
+  rc = rtems_rfs_block_map_grow (fs, map, 1, &block);
+  if (rc > 0)
+    return rc;
+
+  *bno = rtems_rfs_block_map_count (map) - 1;
+
+  return rtems_rfs_buffer_handle_request (fs, handle, block, false);
+}
+
+/**
+ * Walk the index from the root to the block of entries that holds the hash.
+ * The handle is left holding the lowest index block.
+ */
+static int
+rtems_rfs_dir_index_find (rtems_rfs_file_system*    fs,
+                          rtems_rfs_inode_handle*   dir,
+                          rtems_rfs_block_map*      map,
+                          rtems_rfs_buffer_handle*  handle,
+                          uint32_t                  hash,
+                          rtems_rfs_dir_index_path* path,
+                          int*                      levels,
+                          rtems_rfs_block_no*       leaf)
+{
+  rtems_rfs_block_no bno = 0;
+  int                level = 0;
+
+  while (true)
+  {
+    uint8_t*           data;
+    rtems_rfs_block_no child;
+    int                count;
+    int                low;
+    int                high;
+    int                rc;
+
+    rc = rtems_rfs_dir_index_request (fs, map, handle, bno);
+    if (rc > 0)
+      return rc;
+
+    data  = rtems_rfs_buffer_data (handle);
+    count = rtems_rfs_dir_index_count (data);
+
+    if (level == 0)
+      *levels = rtems_rfs_dir_index_levels (data);
+
+    if ((*levels >= RTEMS_RFS_DIR_INDEX_MAX_LEVELS) ||
+        (rtems_rfs_dir_entry_ino (data) != RTEMS_RFS_EMPTY_INO) ||
+        (rtems_rfs_dir_entry_length (data) != RTEMS_RFS_DIR_ENTRY_EMPTY) ||
+        (rtems_rfs_dir_index_levels (data) != (*levels - level)) ||
+        (count == 0) || (count > rtems_rfs_dir_index_max (fs)))
+    {
+      if (rtems_rfs_trace (RTEMS_RFS_TRACE_DIR_LOOKUP_INO))
+        printf ("rtems-rfs: dir-index-find: "
+                "bad index block for ino %" PRIu32 ": bno=%" PRIu32
+                " level=%d count=%d\n",
+                rtems_rfs_inode_ino (dir), bno, level, count);
+      return EIO;
+    }
+
+    /*
+     * Find the last entry with a hash less than or equal to the hash. The
+     * first entry holds the lowest hash below the block so is always a match.
+     */
+    low = 0;
+    high = count;
+    while ((high - low) > 1)
+    {
+      int mid = low + ((high - low) / 2);
+      if (rtems_rfs_dir_index_hash (data, mid) <= hash)
+        low = mid;
+      else
+        high = mid;
+    }
+
+    child = rtems_rfs_dir_index_block (data, low);
+    if ((child == 0) || (child >= rtems_rfs_block_map_count (map)))
+    {
+      if (rtems_rfs_trace (RTEMS_RFS_TRACE_DIR_LOOKUP_INO))
+        printf ("rtems-rfs: dir-index-find: "
+                "bad index entry for ino %" PRIu32 ": bno=%" PRIu32
+                " entry=%d child=%" PRIu32 "\n",
+                rtems_rfs_inode_ino (dir), bno, low, child);
+      return EIO;
+    }
+
+    path[level].bno = bno;
+    path[level].slot = low;
+    path[level].count = count;
+
+    if (level == *levels)
+    {
+      *leaf = child;
+      return 0;
+    }
+
+    bno = child;
+    level++;
+  }
+}
+
+/**
+ * Insert an index entry after the entry followed in the index block at the
+ * level of the path. A full index block is split and the new index block is
+ * inserted into the level above. A full root moves its entries to a new index
+ * block and the index gains a level.
+ */
+static int
+rtems_rfs_dir_index_insert (rtems_rfs_file_system*    fs,
+                            rtems_rfs_block_map*      map,
+                            rtems_rfs_buffer_handle*  handle,
+                            rtems_rfs_dir_index_path* path,
+                            int                       level,
+                            uint32_t                  hash,
+                            rtems_rfs_block_no        child)
+{
+  size_t             block_size = rtems_rfs_fs_block_size (fs);
+  uint8_t*           data;
+  uint8_t*           copy;
+  rtems_rfs_block_no bno;
+  int                slot = path[level].slot + 1;
+  int                count;
+  int                levels;
+  int                half;
+  int                rc;
+
+  rc = rtems_rfs_dir_index_request (fs, map, handle, path[level].bno);
+  if (rc > 0)
+    return rc;
+
+  data   = rtems_rfs_buffer_data (handle);
+  count  = rtems_rfs_dir_index_count (data);
+  levels = rtems_rfs_dir_index_levels (data);
+
+  if (count < rtems_rfs_dir_index_max (fs))
+  {
+    memmove (rtems_rfs_dir_index_entry (data, slot + 1),
+             rtems_rfs_dir_index_entry (data, slot),
+             (count - slot) * RTEMS_RFS_DIR_INDEX_ENTRY_SIZE);
+    rtems_rfs_dir_index_set_entry (data, slot, hash, child);
+    rtems_rfs_dir_index_set_count (data, count + 1);
+    rtems_rfs_buffer_mark_dirty (handle);
+    return 0;
+  }
+
+  /*
+   * The copy has room for the entry being inserted.
+   */
+  copy = malloc (block_size + RTEMS_RFS_DIR_INDEX_ENTRY_SIZE);
+  if (!copy)
+    return ENOMEM;
+
+  memcpy (copy, data, block_size);
+
+  if (level == 0)
+  {
+    rc = rtems_rfs_dir_index_grow (fs, map, handle, &bno);
+    if (rc == 0)
+    {
+      memcpy (rtems_rfs_buffer_data (handle), copy, block_size);
+      rtems_rfs_buffer_mark_dirty (handle);
+      rc = rtems_rfs_dir_index_request (fs, map, handle, 0);
+    }
+
+    free (copy);
+
+    if (rc > 0)
+      return rc;
+
+    data = rtems_rfs_buffer_data (handle);
+    rtems_rfs_dir_index_init (fs, data, levels + 1);
+    rtems_rfs_dir_index_set_entry (data, 0, 0, bno);
+    rtems_rfs_dir_index_set_count (data, 1);
+    rtems_rfs_buffer_mark_dirty (handle);
+
+    /*
+     * The old root is now the index block below the root.
+     */
+    memmove (&path[1], &path[0], (levels + 1) * sizeof (path[0]));
+    path[0].bno = 0;
+    path[0].slot = 0;
+    path[0].count = 1;
+    path[1].bno = bno;
+
+    return rtems_rfs_dir_index_insert (fs, map, handle, path, 1, hash, child);
+  }
+
+  memmove (rtems_rfs_dir_index_entry (copy, slot + 1),
+           rtems_rfs_dir_index_entry (copy, slot),
+           (count - slot) * RTEMS_RFS_DIR_INDEX_ENTRY_SIZE);
+  rtems_rfs_dir_index_set_entry (copy, slot, hash, child);
+  count++;
+  half = count / 2;
+
+  rc = rtems_rfs_dir_index_grow (fs, map, handle, &bno);
+  if (rc == 0)
+  {
+    data = rtems_rfs_buffer_data (handle);
+    rtems_rfs_dir_index_init (fs, data, levels);
+    memcpy (rtems_rfs_dir_index_entry (data, 0),
+            rtems_rfs_dir_index_entry (copy, half),
+            (count - half) * RTEMS_RFS_DIR_INDEX_ENTRY_SIZE);
+    rtems_rfs_dir_index_set_count (data, count - half);
+    rtems_rfs_buffer_mark_dirty (handle);
+
+    rc = rtems_rfs_dir_index_request (fs, map, handle, path[level].bno);
+    if (rc == 0)
+    {
+      data = rtems_rfs_buffer_data (handle);
+      memcpy (rtems_rfs_dir_index_entry (data, 0),
+              rtems_rfs_dir_index_entry (copy, 0),
+              half * RTEMS_RFS_DIR_INDEX_ENTRY_SIZE);
+      memset (rtems_rfs_dir_index_entry (data, half), 0xff,
+              block_size - (rtems_rfs_dir_index_entry (data, half) - data));
+      rtems_rfs_dir_index_set_count (data, half);
+      rtems_rfs_buffer_mark_dirty (handle);
+      hash = rtems_rfs_dir_index_hash (copy, half);
+    }
+  }
+
+  free (copy);
+
+  if (rc > 0)
+    return rc;
+
+  return rtems_rfs_dir_index_insert (fs, map, handle, path, level - 1,
+                                     hash, bno);
+}
+
+/**
+ * Can the index take another block of entries ?
+ */
+static bool
+rtems_rfs_dir_index_full (rtems_rfs_file_system*    fs,
+                          rtems_rfs_dir_index_path* path,
+                          int                       levels)
+{
+  int level;
+  for (level = 0; level <= levels; level++)
+    if (path[level].count < rtems_rfs_dir_index_max (fs))
+      return false;
+  return (levels + 1) >= RTEMS_RFS_DIR_INDEX_MAX_LEVELS;
+}
+
+static int
+rtems_rfs_dir_index_sort_compare (const void* a, const void* b)
+{
+  const rtems_rfs_dir_index_sort* sa = a;
+  const rtems_rfs_dir_index_sort* sb = b;
+  if (sa->hash < sb->hash)
+    return -1;
+  if (sa->hash > sb->hash)
+    return 1;
+  return sa->offset - sb->offset;
+}
+
+/**
+ * Split a block of entries in two by hash and add the new block to the index.
+ * Entries with the same hash stay in the same block.
+ */
+static int
+rtems_rfs_dir_index_split (rtems_rfs_file_system*    fs,
+                           rtems_rfs_inode_handle*   dir,
+                           rtems_rfs_block_map*      map,
+                           rtems_rfs_buffer_handle*  handle,
+                           rtems_rfs_dir_index_path* path,
+                           int                       levels,
+                           rtems_rfs_block_no        leaf)
+{
+  size_t                    block_size = rtems_rfs_fs_block_size (fs);
+  rtems_rfs_dir_index_sort* sorted;
+  uint8_t*                  copy;
+  uint8_t*                  data;
+  rtems_rfs_block_no        bno;
+  uint32_t                  hash;
+  int                       count;
+  int                       offset;
+  int                       split;
+  int                       e;
+  int                       rc;
+
+  copy = malloc (block_size);
+  if (!copy)
+    return ENOMEM;
+
+  sorted = malloc ((block_size / RTEMS_RFS_DIR_ENTRY_SIZE) * sizeof (*sorted));
+  if (!sorted)
+  {
+    free (copy);
+    return ENOMEM;
+  }
+
+  rc = rtems_rfs_dir_index_request (fs, map, handle, leaf);
+  if (rc > 0)
+  {
+    free (sorted);
+    free (copy);
+    return rc;
+  }
+
+  memcpy (copy, rtems_rfs_buffer_data (handle), block_size);
+
+  count = 0;
+  offset = 0;
+
+  while (offset < (block_size - RTEMS_RFS_DIR_ENTRY_SIZE))
+  {
+    uint8_t*      entry = copy + offset;
+    rtems_rfs_ino eino;
+    int           elength;
+
+    elength = rtems_rfs_dir_entry_length (entry);
+    eino    = rtems_rfs_dir_entry_ino (entry);
+
+    if (elength == RTEMS_RFS_DIR_ENTRY_EMPTY)
+      break;
+
+    if (rtems_rfs_dir_entry_valid (fs, elength, eino))
+    {
+      if (rtems_rfs_trace (RTEMS_RFS_TRACE_DIR_ADD_ENTRY))
+        printf ("rtems-rfs: dir-index-split: "
+                "bad length or ino for ino %" PRIu32 ": %u/%" PRId32 " @ %04x\n",
+                rtems_rfs_inode_ino (dir), elength, eino, offset);
+      free (sorted);
+      free (copy);
+      return EIO;
+    }
+
+    sorted[count].hash = rtems_rfs_dir_entry_hash (entry);
+    sorted[count].offset = offset;
+    sorted[count].length = elength;
+    count++;
+
+    offset += elength;
+  }
+
+  qsort (sorted, count, sizeof (*sorted), rtems_rfs_dir_index_sort_compare);
+
+  /*
+   * Split near the middle at a change of hash.
+   */
+  split = count / 2;
+  while ((split > 0) && (split < count) &&
+         (sorted[split].hash == sorted[split - 1].hash))
+    split++;
+  if (split >= count)
+  {
+    split = count / 2;
+    while ((split > 0) && (sorted[split].hash == sorted[split - 1].hash))
+      split--;
+  }
+
+  if (split == 0)
+  {
+    if (rtems_rfs_trace (RTEMS_RFS_TRACE_DIR_ADD_ENTRY))
+      printf ("rtems-rfs: dir-index-split: "
+              "cannot split block %" PRIu32 " of ino %" PRIu32 "\n",
+              leaf, rtems_rfs_inode_ino (dir));
+    free (sorted);
+    free (copy);
+    return ENOSPC;
+  }
+
+  hash = sorted[split].hash;
+
+  rc = rtems_rfs_dir_index_grow (fs, map, handle, &bno);
+  if (rc == 0)
+  {
+    data = rtems_rfs_buffer_data (handle);
+    memset (data, 0xff, block_size);
+    for (e = split; e < count; e++)
+    {
+      memcpy (data, copy + sorted[e].offset, sorted[e].length);
+      data += sorted[e].length;
+    }
+    rtems_rfs_buffer_mark_dirty (handle);
+
+    rc = rtems_rfs_dir_index_request (fs, map, handle, leaf);
+    if (rc == 0)
+    {
+      data = rtems_rfs_buffer_data (handle);
+      memset (data, 0xff, block_size);
+      for (e = 0; e < split; e++)
+      {
+        memcpy (data, copy + sorted[e].offset, sorted[e].length);
+        data += sorted[e].length;
+      }
+      rtems_rfs_buffer_mark_dirty (handle);
+    }
+  }
+
+  free (sorted);
+  free (copy);
+
+  if (rc > 0)
+    return rc;
+
+  return rtems_rfs_dir_index_insert (fs, map, handle, path, levels, hash, bno);
+}
+
+/**
+ * Turn a directory of one block into an indexed directory. The entries are
+ * moved to a new block and block 0 becomes the root of the index.
+ */
+static int
+rtems_rfs_dir_index_create (rtems_rfs_file_system*   fs,
+                            rtems_rfs_inode_handle*  dir,
+                            rtems_rfs_block_map*     map,
+                            rtems_rfs_buffer_handle* handle)
+{
+  size_t             block_size = rtems_rfs_fs_block_size (fs);
+  uint8_t*           copy;
+  uint8_t*           data;
+  rtems_rfs_block_no bno;
+  int                rc;
+
+  if (rtems_rfs_trace (RTEMS_RFS_TRACE_DIR_ADD_ENTRY))
+    printf ("rtems-rfs: dir-index-create: dir=%" PRIu32 "\n",
+            rtems_rfs_inode_ino (dir));
+
+  copy = malloc (block_size);
+  if (!copy)
+    return ENOMEM;
+
+  rc = rtems_rfs_dir_index_request (fs, map, handle, 0);
+  if (rc == 0)
+  {
+    memcpy (copy, rtems_rfs_buffer_data (handle), block_size);
+
+    rc = rtems_rfs_dir_index_grow (fs, map, handle, &bno);
+    if (rc == 0)
+    {
+      memcpy (rtems_rfs_buffer_data (handle), copy, block_size);
+      rtems_rfs_buffer_mark_dirty (handle);
+      rc = rtems_rfs_dir_index_request (fs, map, handle, 0);
+    }
+  }
+
+  free (copy);
+
+  if (rc > 0)
+    return rc;
+
+  data = rtems_rfs_buffer_data (handle);
+  rtems_rfs_dir_index_init (fs, data, 0);
+  rtems_rfs_dir_index_set_entry (data, 0, 0, bno);
+  rtems_rfs_dir_index_set_count (data, 1);
+  rtems_rfs_buffer_mark_dirty (handle);
+
+  rtems_rfs_inode_set_flags (dir, (rtems_rfs_inode_get_flags (dir) |
+                                   RTEMS_RFS_INODE_FLAG_DIR_INDEX));
+
+  return 0;
+}
+
+/**
+ * Add an entry to an indexed directory. The block of entries the hash of the
+ * name indexes is split until the entry fits.
+ */
+static int
+rtems_rfs_dir_index_add_entry (rtems_rfs_file_system*   fs,
+                               rtems_rfs_inode_handle*  dir,
+                               rtems_rfs_block_map*     map,
+                               rtems_rfs_buffer_handle* handle,
+                               const char*              name,
+                               size_t                   length,
+                               rtems_rfs_ino            ino)
+{
+  uint32_t hash = rtems_rfs_dir_hash (name, length);
+
+  while (true)
+  {
+    rtems_rfs_dir_index_path path[RTEMS_RFS_DIR_INDEX_MAX_LEVELS];
+    rtems_rfs_block_no       leaf;
+    uint8_t*                 entry;
+    int                      levels;
+    int                      offset;
+    int                      rc;
+
+    rc = rtems_rfs_dir_index_find (fs, dir, map, handle, hash,
+                                   path, &levels, &leaf);
+    if (rc > 0)
+      return rc;
+
+    rc = rtems_rfs_dir_index_request (fs, map, handle, leaf);
+    if (rc > 0)
+      return rc;
+
+    entry  = rtems_rfs_buffer_data (handle);
+    offset = 0;
+
+    while (offset < (rtems_rfs_fs_block_size (fs) - RTEMS_RFS_DIR_ENTRY_SIZE))
+    {
+      rtems_rfs_ino eino;
+      int           elength;
+
+      elength = rtems_rfs_dir_entry_length (entry);
+      eino    = rtems_rfs_dir_entry_ino (entry);
+
+      if (elength == RTEMS_RFS_DIR_ENTRY_EMPTY)
+      {
+        if ((length + RTEMS_RFS_DIR_ENTRY_SIZE) <
+            (rtems_rfs_fs_block_size (fs) - offset))
+        {
+          rtems_rfs_dir_set_entry_hash (entry, hash);
+          rtems_rfs_dir_set_entry_ino (entry, ino);
+          rtems_rfs_dir_set_entry_length (entry,
+                                          RTEMS_RFS_DIR_ENTRY_SIZE + length);
+          memcpy (entry + RTEMS_RFS_DIR_ENTRY_SIZE, name, length);
+          rtems_rfs_buffer_mark_dirty (handle);
+          return 0;
+        }
+
+        break;
+      }
+
+      if (rtems_rfs_dir_entry_valid (fs, elength, eino))
+      {
+        if (rtems_rfs_trace (RTEMS_RFS_TRACE_DIR_ADD_ENTRY))
+          printf ("rtems-rfs: dir-add-entry: "
+                  "bad length or ino for ino %" PRIu32 ": %u/%" PRId32 " @ %04x\n",
+                  rtems_rfs_inode_ino (dir), elength, eino, offset);
+        return EIO;
+      }
+
+      entry  += elength;
+      offset += elength;
+    }
+
+    /*
+     * Check the index can take another block before splitting so a failure
+     * does not leave a block the index does not reference.
+     */
+    if (rtems_rfs_dir_index_full (fs, path, levels))
+    {
+      if (rtems_rfs_trace (RTEMS_RFS_TRACE_DIR_ADD_ENTRY))
+        printf ("rtems-rfs: dir-add-entry: index full for ino %" PRIu32 "\n",
+                rtems_rfs_inode_ino (dir));
+      return ENOSPC;
+    }
+
+    rc = rtems_rfs_dir_index_split (fs, dir, map, handle, path, levels, leaf);
+    if (rc > 0)
+      return rc;
+  }
+}
+
 int
 rtems_rfs_dir_lookup_ino (rtems_rfs_file_system*  fs,
                           rtems_rfs_inode_handle* inode,
@@ -111,6 +772,7 @@ rtems_rfs_dir_lookup_ino (rtems_rfs_file_system*  fs,
   else
   {
     rtems_rfs_block_no block;
+    bool               indexed = rtems_rfs_dir_indexed (inode);
     uint32_t           hash;
 
     /*
@@ -120,9 +782,27 @@ rtems_rfs_dir_lookup_ino (rtems_rfs_file_system*  fs,
 
     /*
      * Locate the first block. The map points to the start after open so just
-     * seek 0. If an error the block will be 0.
+     * seek 0. If an error the block will be 0. An indexed directory only has
+     * the block of entries the index holds for the hash to search.
      */
-    rc = rtems_rfs_block_map_seek (fs, &map, 0, &block);
+    if (indexed)
+    {
+      rtems_rfs_dir_index_path path[RTEMS_RFS_DIR_INDEX_MAX_LEVELS];
+      rtems_rfs_block_pos      bpos;
+      int                      levels;
+
+      rtems_rfs_block_set_bpos_zero (&bpos);
+
+      rc = rtems_rfs_dir_index_find (fs, inode, &map, &entries, hash,
+                                     path, &levels, &bpos.bno);
+      if (rc == 0)
+        rc = rtems_rfs_block_map_find (fs, &map, &bpos, &block);
+    }
+    else
+    {
+      rc = rtems_rfs_block_map_seek (fs, &map, 0, &block);
+    }
+
     if (rc > 0)
     {
       if (rtems_rfs_trace (RTEMS_RFS_TRACE_DIR_LOOKUP_INO))
@@ -211,6 +891,9 @@ rtems_rfs_dir_lookup_ino (rtems_rfs_file_system*  fs,
         entry += elength;
       }
 
+      if ((rc == 0) && indexed)
+        rc = ENOENT;
+
       if (rc == 0)
       {
         rc = rtems_rfs_block_map_next_block (fs, &map, &block);
@@ -273,6 +956,15 @@ rtems_rfs_dir_add_entry (rtems_rfs_file_system*  fs,
     return rc;
   }
 
+  if (rtems_rfs_dir_indexed (dir))
+  {
+    rc = rtems_rfs_dir_index_add_entry (fs, dir, &map, &buffer,
+                                        name, length, ino);
+    rtems_rfs_buffer_handle_close (fs, &buffer);
+    rtems_rfs_block_map_close (fs, &map);
+    return rc;
+  }
+
   /*
    * Search the map from the beginning to find any empty space.
    */
@@ -302,6 +994,19 @@ rtems_rfs_dir_add_entry (rtems_rfs_file_system*  fs,
         break;
       }
 
+      /*
+       * A full directory of one block on a file system with directory indexes
+       * is indexed rather than searched block by block as it grows.
+       */
+      if (rtems_rfs_fs_dir_index (fs) && (bpos.bno == 1))
+      {
+        rc = rtems_rfs_dir_index_create (fs, dir, &map, &buffer);
+        if (rc == 0)
+          rc = rtems_rfs_dir_index_add_entry (fs, dir, &map, &buffer,
+                                              name, length, ino);
+        break;
+      }
+
       /*
        * We have reached the end of the directory so add a block.
        */
@@ -485,7 +1190,9 @@ rtems_rfs_dir_del_entry (rtems_rfs_file_system*  fs,
 
         /*
          * If the remainder of the block is empty and this is the start of the
-         * block and it is the last block in the map shrink the map.
+         * block and it is the last block in the map shrink the map. The
+         * blocks of an indexed directory are referenced by the index and are
+         * not removed.
          *
          * @note We could check again to see if the new end block in the map is
          *       also empty. This way we could clean up an empty directory.
@@ -500,7 +1207,8 @@ rtems_rfs_dir_del_entry (rtems_rfs_file_system*  fs,
                   rtems_rfs_block_map_last (&map) ? "yes" : "no");
 
         if ((elength == RTEMS_RFS_DIR_ENTRY_EMPTY) &&
-            (eoffset == 0) && rtems_rfs_block_map_last (&map))
+            (eoffset == 0) && rtems_rfs_block_map_last (&map) &&
+            !rtems_rfs_dir_indexed (dir))
         {
           rc = rtems_rfs_block_map_shrink (fs, &map, 1);
           if (rc > 0)
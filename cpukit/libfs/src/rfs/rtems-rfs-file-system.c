@@ -131,6 +131,36 @@ rtems_rfs_fs_read_superblock (rtems_rfs_file_system* fs)
     return EIO;
   }
 
+  fs->features = read_sb (RTEMS_RFS_SB_OFFSET_FEATURES);
+  if (fs->features == 0xffffffff)
+    fs->features = 0;
+
+  if ((fs->features & ~RTEMS_RFS_FEATURES_SUPPORTED) != 0)
+  {
+    if (rtems_rfs_trace (RTEMS_RFS_TRACE_OPEN))
+      printf ("rtems-rfs: read-superblock: unsupported features: %08" PRIx32 "\n",
+              fs->features);
+    rtems_rfs_buffer_handle_close (fs, &handle);
+    return EIO;
+  }
+
+  if (rtems_rfs_fs_journal (fs))
+  {
+    fs->journal.start  = read_sb (RTEMS_RFS_SB_OFFSET_JOURNAL_START);
+    fs->journal.blocks = read_sb (RTEMS_RFS_SB_OFFSET_JOURNAL_BLOCKS);
+
+    if ((fs->journal.blocks < RTEMS_RFS_JOURNAL_MIN_BLOCKS) ||
+        ((fs->journal.start + fs->journal.blocks) > fs->blocks))
+    {
+      if (rtems_rfs_trace (RTEMS_RFS_TRACE_OPEN))
+        printf ("rtems-rfs: read-superblock: invalid journal: start=%" PRIu32
+                " blocks=%" PRIu32 "\n",
+                fs->journal.start, fs->journal.blocks);
+      rtems_rfs_buffer_handle_close (fs, &handle);
+      return EIO;
+    }
+  }
+
   fs->bad_blocks      = read_sb (RTEMS_RFS_SB_OFFSET_BAD_BLOCKS);
   fs->max_name_length = read_sb (RTEMS_RFS_SB_OFFSET_MAX_NAME_LENGTH);
   fs->group_count     = read_sb (RTEMS_RFS_SB_OFFSET_GROUPS);
@@ -173,10 +203,27 @@ rtems_rfs_fs_read_superblock (rtems_rfs_file_system* fs)
     return rc;
   }
 
+  /*
+   * Replay the journal before any metadata is read.
+   */
+  if (rtems_rfs_fs_journal (fs))
+  {
+    rc = rtems_rfs_journal_open (fs);
+    if (rc > 0)
+    {
+      rtems_rfs_journal_close (fs);
+      if (rtems_rfs_trace (RTEMS_RFS_TRACE_OPEN))
+        printf ("rtems-rfs: read-superblock: journal open failed: %d: %s\n",
+                rc, strerror (rc));
+      return rc;
+    }
+  }
+
   fs->groups = calloc (fs->group_count, sizeof (rtems_rfs_group));
 
   if (!fs->groups)
   {
+    rtems_rfs_journal_close (fs);
     rtems_rfs_buffer_handle_close (fs, &handle);
     if (rtems_rfs_trace (RTEMS_RFS_TRACE_OPEN))
       printf ("rtems-rfs: read-superblock: no memory for group table\n");
@@ -200,6 +247,7 @@ rtems_rfs_fs_read_superblock (rtems_rfs_file_system* fs)
       int g;
       for (g = 0; g < group; g++)
         rtems_rfs_group_close (fs, &fs->groups[g]);
+      rtems_rfs_journal_close (fs);
       rtems_rfs_buffer_handle_close (fs, &handle);
       if (rtems_rfs_trace (RTEMS_RFS_TRACE_OPEN))
         printf ("rtems-rfs: read-superblock: no memory for group table%d: %s\n",
@@ -336,6 +384,8 @@ rtems_rfs_fs_close (rtems_rfs_file_system* fs)
   for (group = 0; group < fs->group_count; group++)
     rtems_rfs_group_close (fs, &fs->groups[group]);
 
+  rtems_rfs_journal_close (fs);
+
   rtems_rfs_buffer_close (fs);
 
   free (fs);
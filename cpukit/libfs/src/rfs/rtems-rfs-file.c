@@ -343,8 +343,8 @@ rtems_rfs_file_io_end (rtems_rfs_file_handle* handle,
   {
     if (!read)
       rtems_rfs_buffer_mark_dirty (rtems_rfs_file_buffer (handle));
-    rc = rtems_rfs_buffer_handle_release (rtems_rfs_file_fs (handle),
-                                          rtems_rfs_file_buffer (handle));
+    rc = rtems_rfs_buffer_handle_release_data (rtems_rfs_file_fs (handle),
+                                               rtems_rfs_file_buffer (handle));
     if (rc > 0)
     {
       printf (
@@ -417,8 +417,8 @@ rtems_rfs_file_io_release (rtems_rfs_file_handle* handle)
 {
   int rc = 0;
   if (rtems_rfs_buffer_handle_has_block (&handle->buffer))
-    rc = rtems_rfs_buffer_handle_release (rtems_rfs_file_fs (handle),
-                                          rtems_rfs_file_buffer (handle));
+    rc = rtems_rfs_buffer_handle_release_data (rtems_rfs_file_fs (handle),
+                                               rtems_rfs_file_buffer (handle));
   return rc;
 }
 
@@ -464,8 +464,8 @@ rtems_rfs_file_seek (rtems_rfs_file_handle* handle,
         return rc;
       if (rtems_rfs_buffer_bnum (&handle->buffer) != block)
       {
-        rc = rtems_rfs_buffer_handle_release (rtems_rfs_file_fs (handle),
-                                              rtems_rfs_file_buffer (handle));
+        rc = rtems_rfs_buffer_handle_release_data (rtems_rfs_file_fs (handle),
+                                                   rtems_rfs_file_buffer (handle));
         if (rc > 0)
           return rc;
       }
@@ -583,8 +583,8 @@ rtems_rfs_file_set_size (rtems_rfs_file_handle* handle,
 
           rtems_rfs_buffer_mark_dirty (rtems_rfs_file_buffer (handle));
 
-          rc = rtems_rfs_buffer_handle_release (rtems_rfs_file_fs (handle),
-                                                rtems_rfs_file_buffer (handle));
+          rc = rtems_rfs_buffer_handle_release_data (rtems_rfs_file_fs (handle),
+                                                     rtems_rfs_file_buffer (handle));
           if (rc > 0)
             return rc;
 
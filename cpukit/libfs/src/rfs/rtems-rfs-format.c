@@ -200,6 +200,42 @@ rtems_rfs_check_config (rtems_rfs_file_system*         fs,
     fs->max_name_length = 512;
   }
 
+  if (config->extents)
+    fs->features |= RTEMS_RFS_FEATURE_EXTENTS;
+
+  if (config->dir_index)
+    fs->features |= RTEMS_RFS_FEATURE_DIR_INDEX;
+
+  if (config->journal_blocks)
+  {
+    size_t group_size = fs->group_blocks;
+    size_t inode_blocks;
+
+    if ((1 + group_size) > rtems_rfs_fs_blocks (fs))
+      group_size = rtems_rfs_fs_blocks (fs) - 1;
+
+    inode_blocks = rtems_rfs_rup_quotient (fs->group_inodes,
+                                           fs->inodes_per_block);
+
+    /*
+     * The journal follows the inode tables in the first group. Leave some of
+     * the group for the root directory.
+     */
+    if ((config->journal_blocks < RTEMS_RFS_JOURNAL_MIN_BLOCKS) ||
+        ((RTEMS_RFS_GROUP_INODE_BLOCK + inode_blocks +
+          config->journal_blocks) >= (group_size / 2)))
+    {
+      printf ("journal size (%zu) is invalid or larger than half a group\n",
+              config->journal_blocks);
+      return false;
+    }
+
+    fs->journal.start =
+      rtems_rfs_fs_block (fs, 0, RTEMS_RFS_GROUP_INODE_BLOCK + inode_blocks);
+    fs->journal.blocks = config->journal_blocks;
+    fs->features |= RTEMS_RFS_FEATURE_JOURNAL;
+  }
+
   return true;
 }
 
@@ -307,6 +343,15 @@ rtems_rfs_write_group (rtems_rfs_file_system* fs,
   for (b = 0; b < blocks; b++)
     rtems_rfs_bitmap_map_set (&bitmap, b + RTEMS_RFS_GROUP_INODE_BLOCK);
 
+  /*
+   * Forced allocation of the journal which follows the inode blocks in the
+   * first group.
+   */
+  if ((group == 0) && rtems_rfs_fs_journal (fs))
+    for (b = 0; b < (int) fs->journal.blocks; b++)
+      rtems_rfs_bitmap_map_set (&bitmap,
+                                blocks + b + RTEMS_RFS_GROUP_INODE_BLOCK);
+
   /*
    * Close the block bitmap.
    */
@@ -450,6 +495,13 @@ rtems_rfs_write_superblock (rtems_rfs_file_system* fs)
   write_sb (RTEMS_RFS_SB_OFFSET_GROUP_BLOCKS, fs->group_blocks);
   write_sb (RTEMS_RFS_SB_OFFSET_GROUP_INODES, fs->group_inodes);
   write_sb (RTEMS_RFS_SB_OFFSET_INODE_SIZE, RTEMS_RFS_INODE_SIZE);
+  write_sb (RTEMS_RFS_SB_OFFSET_FEATURES, rtems_rfs_fs_features (fs));
+
+  if (rtems_rfs_fs_journal (fs))
+  {
+    write_sb (RTEMS_RFS_SB_OFFSET_JOURNAL_START, fs->journal.start);
+    write_sb (RTEMS_RFS_SB_OFFSET_JOURNAL_BLOCKS, fs->journal.blocks);
+  }
 
   rtems_rfs_buffer_mark_dirty (&handle);
 
@@ -637,6 +689,11 @@ rtems_rfs_format (const char* name, const rtems_rfs_format_config* config)
     printf ("rtems-rfs: format: groups = %u\n", fs.group_count);
     printf ("rtems-rfs: format: group blocks = %zu\n", fs.group_blocks);
     printf ("rtems-rfs: format: group inodes = %zu\n", fs.group_inodes);
+    printf ("rtems-rfs: format: features = %08" PRIx32 "\n",
+            rtems_rfs_fs_features (&fs));
+    if (rtems_rfs_fs_journal (&fs))
+      printf ("rtems-rfs: format: journal = %" PRIu32 " blocks at %" PRIu32 "\n",
+              fs.journal.blocks, fs.journal.start);
   }
 
   rc = rtems_rfs_buffer_setblksize (&fs, rtems_rfs_fs_block_size (&fs));
@@ -668,6 +725,19 @@ rtems_rfs_format (const char* name, const rtems_rfs_format_config* config)
   if (config->verbose)
     printf ("\n");
 
+  if (rtems_rfs_fs_journal (&fs))
+  {
+    rc = rtems_rfs_journal_format (&fs);
+    if (rc != 0)
+    {
+      printf ("rtems-rfs: format: journal write failed: %d: %s\n",
+              rc, strerror (rc));
+
+      errno = rc;
+      return -1;
+    }
+  }
+
   rc = rtems_rfs_buffer_close (&fs);
   if (rc != 0)
   {
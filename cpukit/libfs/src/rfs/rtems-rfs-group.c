@@ -326,6 +326,9 @@ rtems_rfs_group_bitmap_free (rtems_rfs_file_system* fs,
 
   rtems_rfs_bitmap_release_buffer (fs, bitmap);
 
+  if ((rc == 0) && !inode && rtems_rfs_journal_active (fs))
+    rc = rtems_rfs_journal_free (fs, no + RTEMS_RFS_SUPERBLOCK_SIZE);
+
   return rc;
 }
 
@@ -0,0 +1,1176 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/**
+ * @file
+ *
+ * @ingroup rtems_rfs
+ *
+ * @brief RTEMS File System Metadata Journal Routines
+ */
+
+/*
+ * Copyright (C) 2026 On-Line Applications Research Corporation (OAR)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <inttypes.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <rtems/rfs/rtems-rfs-data.h>
+#include <rtems/rfs/rtems-rfs-file-system.h>
+#include <rtems/rfs/rtems-rfs-journal.h>
+#include <rtems/rfs/rtems-rfs-trace.h>
+
+/**
+ * Return the block number a buffer is attached to.
+ */
+#define rtems_rfs_journal_buffer_block(_b) \
+  ((rtems_rfs_buffer_block) ((intptr_t) ((_b)->user)))
+
+/**
+ * Return the data of a buffer.
+ */
+#define rtems_rfs_journal_buffer_data(_b) ((uint8_t*) ((_b)->buffer))
+
+
+/**
+ * A revoke record read when replaying the journal.
+ */
+typedef struct _rtems_rfs_journal_revoke_record
+{
+  rtems_rfs_buffer_block block;    /**< The revoked block. */
+  uint32_t               sequence; /**< The last transaction revoking it. */
+} rtems_rfs_journal_revoke_record;
+
+/**
+ * Checksum the data. The words are rotated and added which is enough to find
+ * a transaction that was not completely written.
+ *
+ * @param[in] checksum is the checksum of the data so far.
+ * @param[in] data is the data.
+ * @param[in] size is the size of the data.
+ * @return uint32_t The checksum.
+ */
+static uint32_t
+rtems_rfs_journal_checksum (uint32_t       checksum,
+                            const uint8_t* data,
+                            size_t         size)
+{
+  size_t w;
+  for (w = 0; w < size; w += sizeof (uint32_t))
+  {
+    checksum = (checksum << 5) | (checksum >> 27);
+    checksum += rtems_rfs_read_u32 (data + w);
+  }
+  return checksum;
+}
+
+/**
+ * Find a buffer on a chain without removing it.
+ *
+ * @param[in] chain is the chain to search.
+ * @param[in] block is the block number.
+ * @retval buffer The buffer if found.
+ * @retval NULL The block is not on the chain.
+ */
+static rtems_rfs_buffer*
+rtems_rfs_journal_find_buffer (rtems_chain_control*   chain,
+                               rtems_rfs_buffer_block block)
+{
+  rtems_chain_node* node = rtems_chain_first (chain);
+  while (!rtems_chain_is_tail (chain, node))
+  {
+    rtems_rfs_buffer* buffer = (rtems_rfs_buffer*) node;
+    if (rtems_rfs_journal_buffer_block (buffer) == block)
+      return buffer;
+    node = rtems_chain_next (node);
+  }
+  return NULL;
+}
+
+/**
+ * Find the entry of a block in the running transaction.
+ *
+ * @param[in] journal is the journal.
+ * @param[in] block is the block number.
+ * @retval index The index of the entry.
+ * @retval -1 The block is not part of the transaction.
+ */
+static int
+rtems_rfs_journal_find_entry (rtems_rfs_journal*     journal,
+                              rtems_rfs_buffer_block block)
+{
+  uint32_t e;
+  for (e = 0; e < journal->count; e++)
+    if (journal->entries[e].block == block)
+      return e;
+  return -1;
+}
+
+/**
+ * Find a block in a table of block numbers.
+ *
+ * @param[in] blocks is the table.
+ * @param[in] count is the number of blocks in the table.
+ * @param[in] block is the block number.
+ * @retval index The index of the block.
+ * @retval -1 The block is not in the table.
+ */
+static int
+rtems_rfs_journal_find_block (const rtems_rfs_buffer_block* blocks,
+                              uint32_t                      count,
+                              rtems_rfs_buffer_block        block)
+{
+  uint32_t b;
+  for (b = 0; b < count; b++)
+    if (blocks[b] == block)
+      return b;
+  return -1;
+}
+
+/**
+ * Remove an entry from the running transaction.
+ *
+ * @param[in] journal is the journal.
+ * @param[in] e is the index of the entry.
+ */
+static void
+rtems_rfs_journal_remove_entry (rtems_rfs_journal* journal, uint32_t e)
+{
+  if (journal->entries[e].carried)
+    journal->carried--;
+  journal->count--;
+  journal->entries[e] = journal->entries[journal->count];
+}
+
+/**
+ * Write the journal header.
+ *
+ * @param[in] fs is the file system data.
+ * @param[in] sequence is the sequence number of the first transaction.
+ * @param[in] tail is the offset of the first transaction.
+ * @retval 0 Successful operation.
+ * @retval error_code An error occurred.
+ */
+static int
+rtems_rfs_journal_write_header (rtems_rfs_file_system* fs,
+                                uint32_t               sequence,
+                                uint32_t               tail)
+{
+  rtems_rfs_buffer* buffer;
+  uint8_t*          data;
+  int               rc;
+
+  rc = rtems_rfs_buffer_io_request (fs, fs->journal.start, false, &buffer);
+  if (rc > 0)
+    return rc;
+
+  data = rtems_rfs_journal_buffer_data (buffer);
+  memset (data, 0, rtems_rfs_fs_block_size (fs));
+  rtems_rfs_write_u32 (data + RTEMS_RFS_JOURNAL_OFFSET_MAGIC,
+                       RTEMS_RFS_JOURNAL_MAGIC);
+  rtems_rfs_write_u32 (data + RTEMS_RFS_JOURNAL_OFFSET_SEQUENCE, sequence);
+  rtems_rfs_write_u32 (data + RTEMS_RFS_JOURNAL_OFFSET_TAIL, tail);
+
+  return rtems_rfs_buffer_io_release (buffer, true);
+}
+
+/**
+ * Find the offset a transaction of a number of journal blocks can be written
+ * at without overwriting the transactions after the tail.
+ *
+ * @param[in] journal is the journal.
+ * @param[in] size is the number of journal blocks.
+ * @retval offset The offset the transaction is written at.
+ * @retval 0 There is no space.
+ */
+static uint32_t
+rtems_rfs_journal_place (rtems_rfs_journal* journal, uint32_t size)
+{
+  if (journal->head >= journal->tail)
+  {
+    if ((journal->head + size) <= journal->blocks)
+      return journal->head;
+    if ((1 + size) < journal->tail)
+      return 1;
+  }
+  else if ((journal->head + size) < journal->tail)
+    return journal->head;
+  return 0;
+}
+
+/**
+ * Write the home locations of the committed transactions to the media and
+ * move the tail. If blocks were held when the last transaction was committed
+ * the journal's copy is the only copy so the last transaction is kept.
+ *
+ * @param[in] fs is the file system data.
+ * @retval 0 Successful operation.
+ * @retval error_code An error occurred.
+ */
+static int
+rtems_rfs_journal_checkpoint (rtems_rfs_file_system* fs)
+{
+  rtems_rfs_journal* journal = &fs->journal;
+  uint32_t           sequence;
+  int                rc;
+
+  if (rtems_rfs_trace (RTEMS_RFS_TRACE_JOURNAL))
+    printf ("rtems-rfs: journal-checkpoint: sequence=%" PRIu32 " head=%" PRIu32
+            " last-carried=%" PRIu32 "\n",
+            journal->sequence, journal->head, journal->last_carried);
+
+  rc = rtems_rfs_buffer_flush (fs);
+  if (rc > 0)
+    return rc;
+
+  if (journal->last_carried > 0)
+  {
+    sequence = journal->sequence - 1;
+    journal->tail = journal->last;
+    if (journal->logged_count > journal->last_count)
+    {
+      memmove (journal->logged,
+               journal->logged + journal->logged_count - journal->last_count,
+               journal->last_count * sizeof (rtems_rfs_buffer_block));
+      journal->logged_count = journal->last_count;
+    }
+  }
+  else
+  {
+    sequence = journal->sequence;
+    journal->tail = 1;
+    journal->head = 1;
+    journal->logged_count = 0;
+  }
+
+  rc = rtems_rfs_journal_write_header (fs, sequence, journal->tail);
+  if (rc > 0)
+    return rc;
+
+  rc = rtems_rfs_buffer_flush (fs);
+  if (rc > 0)
+    return rc;
+
+  journal->stats.checkpoints++;
+
+  return 0;
+}
+
+/**
+ * Read and check a transaction. The transaction is valid if the sequence
+ * number is the expected one and the commit block's checksum matches.
+ *
+ * @param[in] fs is the file system data.
+ * @param[in] offset is the offset of the transaction in the journal.
+ * @param[in] sequence is the expected sequence number.
+ * @param[out] desc is the descriptor's buffer if the transaction is valid
+ *                  else NULL. The caller releases the buffer.
+ * @retval 0 Successful operation.
+ * @retval error_code An error occurred.
+ */
+static int
+rtems_rfs_journal_read_transaction (rtems_rfs_file_system* fs,
+                                    uint32_t               offset,
+                                    uint32_t               sequence,
+                                    rtems_rfs_buffer**     desc)
+{
+  rtems_rfs_journal* journal = &fs->journal;
+  size_t             block_size = rtems_rfs_fs_block_size (fs);
+  rtems_rfs_buffer*  buffer;
+  uint8_t*           data;
+  uint32_t           count;
+  uint32_t           revoked;
+  uint32_t           checksum;
+  uint32_t           b;
+  bool               valid;
+  int                rc;
+
+  *desc = NULL;
+
+  if ((offset + 2) > journal->blocks)
+    return 0;
+
+  rc = rtems_rfs_buffer_io_request (fs, journal->start + offset, true, &buffer);
+  if (rc > 0)
+    return rc;
+
+  data = rtems_rfs_journal_buffer_data (buffer);
+  count = rtems_rfs_read_u32 (data + RTEMS_RFS_JOURNAL_OFFSET_COUNT);
+  revoked = rtems_rfs_read_u32 (data + RTEMS_RFS_JOURNAL_OFFSET_REVOKES);
+
+  if ((rtems_rfs_read_u32 (data + RTEMS_RFS_JOURNAL_OFFSET_MAGIC) !=
+       RTEMS_RFS_JOURNAL_DESC_MAGIC) ||
+      (rtems_rfs_read_u32 (data + RTEMS_RFS_JOURNAL_OFFSET_SEQUENCE) !=
+       sequence) ||
+      (count > journal->max_entries) ||
+      (revoked > (journal->max_entries - count)) ||
+      ((offset + count + 2) > journal->blocks))
+  {
+    rtems_rfs_buffer_io_release (buffer, false);
+    return 0;
+  }
+
+  *desc = buffer;
+
+  /*
+   * Check the transaction is complete before anything is written.
+   */
+  checksum = rtems_rfs_journal_checksum (0, data, block_size);
+
+  for (b = 0; b < count; b++)
+  {
+    rc = rtems_rfs_buffer_io_request (fs, journal->start + offset + 1 + b,
+                                      true, &buffer);
+    if (rc > 0)
+      break;
+    checksum = rtems_rfs_journal_checksum (checksum,
+                                           rtems_rfs_journal_buffer_data (buffer),
+                                           block_size);
+    rtems_rfs_buffer_io_release (buffer, false);
+  }
+
+  if (rc == 0)
+    rc = rtems_rfs_buffer_io_request (fs, journal->start + offset + 1 + count,
+                                      true, &buffer);
+  if (rc > 0)
+  {
+    rtems_rfs_buffer_io_release (*desc, false);
+    *desc = NULL;
+    return rc;
+  }
+
+  data = rtems_rfs_journal_buffer_data (buffer);
+  valid =
+    (rtems_rfs_read_u32 (data + RTEMS_RFS_JOURNAL_OFFSET_MAGIC) ==
+     RTEMS_RFS_JOURNAL_COMMIT_MAGIC) &&
+    (rtems_rfs_read_u32 (data + RTEMS_RFS_JOURNAL_OFFSET_SEQUENCE) ==
+     sequence) &&
+    (rtems_rfs_read_u32 (data + RTEMS_RFS_JOURNAL_OFFSET_COUNT) == count) &&
+    (rtems_rfs_read_u32 (data + RTEMS_RFS_JOURNAL_OFFSET_CHECKSUM) == checksum);
+
+  rtems_rfs_buffer_io_release (buffer, false);
+
+  if (!valid)
+  {
+    rtems_rfs_buffer_io_release (*desc, false);
+    *desc = NULL;
+  }
+
+  return 0;
+}
+
+/**
+ * Replay the committed transactions to their home locations. The
+ * transactions are read from the tail and a transaction not found after the
+ * last is looked for at the start of the journal. The revoke records are
+ * collected first and a copy of a block revoked by a later transaction is not
+ * replayed.
+ *
+ * @param[in] fs is the file system data.
+ * @retval 0 Successful operation.
+ * @retval error_code An error occurred.
+ */
+static int
+rtems_rfs_journal_replay (rtems_rfs_file_system* fs)
+{
+  rtems_rfs_journal*               journal = &fs->journal;
+  size_t                           block_size = rtems_rfs_fs_block_size (fs);
+  rtems_rfs_journal_revoke_record* records = NULL;
+  uint32_t                         record_count = 0;
+  uint32_t                         record_size = 0;
+  uint32_t                         offset = 0;
+  uint32_t                         sequence = 0;
+  int                              pass;
+  int                              rc = 0;
+
+  for (pass = 0; (pass < 2) && (rc == 0); pass++)
+  {
+    offset = journal->tail;
+    sequence = journal->sequence;
+
+    while (true)
+    {
+      rtems_rfs_buffer* desc;
+      uint8_t*          data;
+      uint32_t          count;
+      uint32_t          revoked;
+      uint32_t          b;
+
+      rc = rtems_rfs_journal_read_transaction (fs, offset, sequence, &desc);
+      if (rc > 0)
+        break;
+
+      if (!desc)
+      {
+        if ((pass == 1) && rtems_rfs_trace (RTEMS_RFS_TRACE_JOURNAL))
+          printf ("rtems-rfs: journal-replay: sequence=%" PRIu32 " offset=%" PRIu32
+                  ": not committed\n", sequence, offset);
+        if (offset == 1)
+          break;
+        offset = 1;
+        continue;
+      }
+
+      data = rtems_rfs_journal_buffer_data (desc);
+      count = rtems_rfs_read_u32 (data + RTEMS_RFS_JOURNAL_OFFSET_COUNT);
+      revoked = rtems_rfs_read_u32 (data + RTEMS_RFS_JOURNAL_OFFSET_REVOKES);
+
+      if (pass == 0)
+      {
+        for (b = 0; (b < revoked) && (rc == 0); b++)
+        {
+          rtems_rfs_buffer_block block;
+          uint32_t               r;
+
+          block = rtems_rfs_read_u32 (data + RTEMS_RFS_JOURNAL_OFFSET_BLOCKS +
+                                      ((count + b) * sizeof (uint32_t)));
+
+          for (r = 0; r < record_count; r++)
+            if (records[r].block == block)
+              break;
+
+          if (r == record_size)
+          {
+            rtems_rfs_journal_revoke_record* more;
+            more = realloc (records, (record_size + journal->max_entries) *
+                            sizeof (rtems_rfs_journal_revoke_record));
+            if (!more)
+            {
+              rc = ENOMEM;
+              break;
+            }
+            records = more;
+            record_size += journal->max_entries;
+          }
+
+          if (r == record_count)
+          {
+            records[r].block = block;
+            record_count++;
+          }
+
+          records[r].sequence = sequence;
+        }
+      }
+      else
+      {
+        if (rtems_rfs_trace (RTEMS_RFS_TRACE_JOURNAL))
+          printf ("rtems-rfs: journal-replay: sequence=%" PRIu32 " offset=%" PRIu32
+                  " blocks=%" PRIu32 " revoked=%" PRIu32 "\n",
+                  sequence, offset, count, revoked);
+
+        for (b = 0; b < count; b++)
+        {
+          rtems_rfs_buffer_block home;
+          rtems_rfs_buffer*      copy;
+          rtems_rfs_buffer*      buffer;
+          uint32_t               r;
+
+          home = rtems_rfs_read_u32 (data + RTEMS_RFS_JOURNAL_OFFSET_BLOCKS +
+                                     (b * sizeof (uint32_t)));
+          if ((home == 0) || (home >= rtems_rfs_fs_blocks (fs)))
+          {
+            rc = EIO;
+            break;
+          }
+
+          for (r = 0; r < record_count; r++)
+            if ((records[r].block == home) && (records[r].sequence > sequence))
+              break;
+          if (r < record_count)
+            continue;
+
+          rc = rtems_rfs_buffer_io_request (fs, journal->start + offset + 1 + b,
+                                            true, &copy);
+          if (rc > 0)
+            break;
+
+          rc = rtems_rfs_buffer_io_request (fs, home, false, &buffer);
+          if (rc > 0)
+          {
+            rtems_rfs_buffer_io_release (copy, false);
+            break;
+          }
+
+          memcpy (rtems_rfs_journal_buffer_data (buffer),
+                  rtems_rfs_journal_buffer_data (copy),
+                  block_size);
+
+          rtems_rfs_buffer_io_release (copy, false);
+          rc = rtems_rfs_buffer_io_release (buffer, true);
+          if (rc > 0)
+            break;
+        }
+
+        journal->stats.replayed++;
+        journal->stats.replayed_blocks += count;
+      }
+
+      rtems_rfs_buffer_io_release (desc, false);
+
+      if (rc > 0)
+        break;
+
+      offset += count + 2;
+      sequence++;
+    }
+  }
+
+  free (records);
+
+  if (rc > 0)
+    return rc;
+
+  journal->sequence = sequence;
+  journal->head = offset;
+
+  return 0;
+}
+
+/**
+ * Add a block to the running transaction. If the transaction is full it is
+ * committed first.
+ *
+ * @param[in] fs is the file system data.
+ * @param[in] block is the block number.
+ * @retval 0 Successful operation.
+ * @retval error_code An error occurred.
+ */
+static int
+rtems_rfs_journal_add_entry (rtems_rfs_file_system* fs,
+                             rtems_rfs_buffer_block block)
+{
+  rtems_rfs_journal* journal = &fs->journal;
+  int                e;
+
+  e = rtems_rfs_journal_find_entry (journal, block);
+  if (e >= 0)
+  {
+    if (journal->entries[e].carried)
+    {
+      journal->entries[e].carried = false;
+      journal->carried--;
+      if (journal->count == (journal->carried + 1))
+        journal->started = rtems_clock_get_ticks_since_boot ();
+    }
+    return 0;
+  }
+
+  if ((journal->count + journal->revoked) >= journal->max_entries)
+  {
+    int rc;
+
+    if (rtems_rfs_trace (RTEMS_RFS_TRACE_JOURNAL))
+      printf ("rtems-rfs: journal-add: transaction full: %" PRIu32 "\n",
+              journal->count);
+
+    journal->stats.forced++;
+
+    rc = rtems_rfs_journal_commit (fs);
+    if (rc > 0)
+      return rc;
+
+    if ((journal->count + journal->revoked) >= journal->max_entries)
+      return ENOSPC;
+  }
+
+  /*
+   * The copy in this transaction replaces the copies the revoke was for.
+   */
+  e = rtems_rfs_journal_find_block (journal->revokes, journal->revoked, block);
+  if (e >= 0)
+  {
+    journal->revoked--;
+    journal->revokes[e] = journal->revokes[journal->revoked];
+  }
+
+  if ((journal->count == journal->carried) && (journal->revoked == 0))
+    journal->started = rtems_clock_get_ticks_since_boot ();
+
+  journal->entries[journal->count].block = block;
+  journal->entries[journal->count].carried = false;
+  journal->count++;
+
+  return 0;
+}
+
+/**
+ * Remove a block from the running transaction and revoke it if there is a
+ * copy in the journal.
+ *
+ * @param[in] fs is the file system data.
+ * @param[in] block is the block number.
+ * @retval 0 Successful operation.
+ * @retval error_code An error occurred.
+ */
+static int
+rtems_rfs_journal_forget (rtems_rfs_file_system* fs,
+                          rtems_rfs_buffer_block block)
+{
+  rtems_rfs_journal* journal = &fs->journal;
+  int                e;
+
+  e = rtems_rfs_journal_find_entry (journal, block);
+  if (e >= 0)
+    rtems_rfs_journal_remove_entry (journal, e);
+
+  if ((rtems_rfs_journal_find_block (journal->logged,
+                                     journal->logged_count, block) < 0) ||
+      (rtems_rfs_journal_find_block (journal->revokes,
+                                     journal->revoked, block) >= 0))
+    return 0;
+
+  if (rtems_rfs_trace (RTEMS_RFS_TRACE_JOURNAL))
+    printf ("rtems-rfs: journal-revoke: block=%" PRIu32 "\n", block);
+
+  if ((journal->count + journal->revoked) >= journal->max_entries)
+  {
+    int rc;
+
+    journal->stats.forced++;
+
+    rc = rtems_rfs_journal_commit (fs);
+    if (rc > 0)
+      return rc;
+
+    if ((journal->count + journal->revoked) >= journal->max_entries)
+      return ENOSPC;
+  }
+
+  if ((journal->count == journal->carried) && (journal->revoked == 0))
+    journal->started = rtems_clock_get_ticks_since_boot ();
+
+  journal->revokes[journal->revoked] = block;
+  journal->revoked++;
+
+  return 0;
+}
+
+int
+rtems_rfs_journal_format (rtems_rfs_file_system* fs)
+{
+  uint32_t b;
+  int      rc;
+
+  rc = rtems_rfs_journal_write_header (fs, 1, 1);
+  if (rc > 0)
+    return rc;
+
+  /*
+   * Clear the journal so a transaction left by an earlier file system with the
+   * same sequence number is not replayed.
+   */
+  for (b = 1; b < fs->journal.blocks; b++)
+  {
+    rtems_rfs_buffer* buffer;
+
+    rc = rtems_rfs_buffer_io_request (fs, fs->journal.start + b, false, &buffer);
+    if (rc > 0)
+      return rc;
+
+    memset (rtems_rfs_journal_buffer_data (buffer), 0,
+            rtems_rfs_fs_block_size (fs));
+
+    rc = rtems_rfs_buffer_io_release (buffer, true);
+    if (rc > 0)
+      return rc;
+  }
+
+  return 0;
+}
+
+int
+rtems_rfs_journal_open (rtems_rfs_file_system* fs)
+{
+  rtems_rfs_journal* journal = &fs->journal;
+  rtems_rfs_buffer*  buffer;
+  uint8_t*           data;
+  int                rc;
+
+  rtems_chain_initialize_empty (&journal->transaction);
+  journal->transaction_count = 0;
+  journal->count = 0;
+  journal->carried = 0;
+  journal->revoked = 0;
+  journal->logged_count = 0;
+  journal->freed = 0;
+  journal->last_count = 0;
+  journal->last_carried = 0;
+
+  /*
+   * The descriptor has to fit in a block and the last transaction and a new
+   * transaction in the space left when the journal is full.
+   */
+  journal->max_entries =
+    (rtems_rfs_fs_block_size (fs) - RTEMS_RFS_JOURNAL_OFFSET_BLOCKS) /
+    sizeof (uint32_t);
+  if (journal->max_entries > (((journal->blocks - 1) / 3) - 2))
+    journal->max_entries = ((journal->blocks - 1) / 3) - 2;
+
+  journal->commit_blocks = RTEMS_RFS_JOURNAL_COMMIT_BLOCKS;
+  if (journal->commit_blocks > journal->max_entries)
+    journal->commit_blocks = journal->max_entries;
+  journal->commit_interval =
+    RTEMS_MILLISECONDS_TO_TICKS (RTEMS_RFS_JOURNAL_COMMIT_INTERVAL);
+
+  rc = rtems_rfs_buffer_io_request (fs, journal->start, true, &buffer);
+  if (rc > 0)
+    return rc;
+
+  data = rtems_rfs_journal_buffer_data (buffer);
+
+  journal->sequence =
+    rtems_rfs_read_u32 (data + RTEMS_RFS_JOURNAL_OFFSET_SEQUENCE);
+  journal->tail = rtems_rfs_read_u32 (data + RTEMS_RFS_JOURNAL_OFFSET_TAIL);
+
+  if ((rtems_rfs_read_u32 (data + RTEMS_RFS_JOURNAL_OFFSET_MAGIC) !=
+       RTEMS_RFS_JOURNAL_MAGIC) ||
+      (journal->tail == 0) || (journal->tail >= journal->blocks))
+  {
+    if (rtems_rfs_trace (RTEMS_RFS_TRACE_JOURNAL))
+      printf ("rtems-rfs: journal-open: invalid header\n");
+    rtems_rfs_buffer_io_release (buffer, false);
+    return EIO;
+  }
+
+  rtems_rfs_buffer_io_release (buffer, false);
+
+  if (rtems_rfs_trace (RTEMS_RFS_TRACE_JOURNAL))
+    printf ("rtems-rfs: journal-open: start=%" PRIu32 " blocks=%" PRIu32
+            " sequence=%" PRIu32 " tail=%" PRIu32 "\n",
+            journal->start, journal->blocks, journal->sequence, journal->tail);
+
+  rc = rtems_rfs_journal_replay (fs);
+  if (rc > 0)
+    return rc;
+
+  /*
+   * The replayed blocks are written to their home locations before the
+   * journal is emptied.
+   */
+  if ((journal->head != 1) || (journal->tail != 1))
+  {
+    rc = rtems_rfs_journal_checkpoint (fs);
+    if (rc > 0)
+      return rc;
+  }
+
+  /*
+   * Bitmaps held across requests are not released modified until the file
+   * system is unmounted so would not be part of the transactions.
+   */
+  fs->flags &= ~RTEMS_RFS_FS_BITMAPS_HOLD;
+
+  journal->revokes = calloc (journal->max_entries,
+                             sizeof (rtems_rfs_buffer_block));
+  journal->logged = calloc (journal->blocks, sizeof (rtems_rfs_buffer_block));
+  journal->entries = calloc (journal->max_entries,
+                             sizeof (rtems_rfs_journal_entry));
+  if (!journal->revokes || !journal->logged || !journal->entries)
+  {
+    free (journal->revokes);
+    free (journal->logged);
+    free (journal->entries);
+    journal->entries = NULL;
+    return ENOMEM;
+  }
+
+  return 0;
+}
+
+int
+rtems_rfs_journal_close (rtems_rfs_file_system* fs)
+{
+  rtems_rfs_journal* journal = &fs->journal;
+  int                rrc = 0;
+  int                rc;
+
+  if (!rtems_rfs_journal_active (fs))
+    return 0;
+
+  rc = rtems_rfs_journal_commit (fs);
+  if ((rc > 0) && (rrc == 0))
+    rrc = rc;
+
+  if ((journal->head != 1) || (journal->tail != 1))
+  {
+    rc = rtems_rfs_journal_checkpoint (fs);
+    if ((rc > 0) && (rrc == 0))
+      rrc = rc;
+  }
+
+  free (journal->revokes);
+  free (journal->logged);
+  free (journal->entries);
+  journal->entries = NULL;
+
+  return rrc;
+}
+
+void
+rtems_rfs_journal_set_commit (rtems_rfs_file_system* fs,
+                              uint32_t               blocks,
+                              uint32_t               interval)
+{
+  rtems_rfs_journal* journal = &fs->journal;
+
+  if (!rtems_rfs_journal_active (fs))
+    return;
+
+  if (blocks)
+  {
+    if (blocks > journal->max_entries)
+      blocks = journal->max_entries;
+    journal->commit_blocks = blocks;
+  }
+
+  if (interval)
+    journal->commit_interval = RTEMS_MILLISECONDS_TO_TICKS (interval);
+}
+
+int
+rtems_rfs_journal_add (rtems_rfs_file_system* fs,
+                       rtems_rfs_buffer*      buffer)
+{
+  rtems_rfs_journal* journal = &fs->journal;
+  int                rc;
+
+  rc = rtems_rfs_journal_add_entry (fs, rtems_rfs_journal_buffer_block (buffer));
+  if (rc > 0)
+  {
+    buffer->user = (void*) 0;
+    rtems_rfs_buffer_io_release (buffer, true);
+    return rc;
+  }
+
+  rtems_chain_append_unprotected (&journal->transaction, &buffer->link);
+  journal->transaction_count++;
+
+  return 0;
+}
+
+int
+rtems_rfs_journal_mark (rtems_rfs_file_system* fs,
+                        rtems_rfs_buffer_block block)
+{
+  return rtems_rfs_journal_add_entry (fs, block);
+}
+
+bool
+rtems_rfs_journal_logged (rtems_rfs_file_system* fs,
+                          rtems_rfs_buffer_block block)
+{
+  return rtems_rfs_journal_find_entry (&fs->journal, block) >= 0;
+}
+
+rtems_rfs_buffer*
+rtems_rfs_journal_scan (rtems_rfs_file_system* fs,
+                        rtems_rfs_buffer_block block)
+{
+  rtems_rfs_journal* journal = &fs->journal;
+  rtems_rfs_buffer*  buffer;
+
+  if (journal->transaction_count == 0)
+    return NULL;
+
+  buffer = rtems_rfs_journal_find_buffer (&journal->transaction, block);
+  if (buffer)
+  {
+    rtems_chain_extract_unprotected (&buffer->link);
+    rtems_chain_set_off_chain (&buffer->link);
+    journal->transaction_count--;
+  }
+
+  return buffer;
+}
+
+int
+rtems_rfs_journal_free (rtems_rfs_file_system* fs,
+                        rtems_rfs_buffer_block block)
+{
+  fs->journal.freed++;
+  return rtems_rfs_journal_forget (fs, block);
+}
+
+int
+rtems_rfs_journal_revoke (rtems_rfs_file_system* fs,
+                          rtems_rfs_buffer_block block)
+{
+  rtems_rfs_journal* journal = &fs->journal;
+  int                rc;
+
+  rc = rtems_rfs_journal_forget (fs, block);
+  if (rc > 0)
+    return rc;
+
+  if ((journal->freed == 0) &&
+      (rtems_rfs_journal_find_block (journal->revokes,
+                                     journal->revoked, block) < 0))
+    return 0;
+
+  return rtems_rfs_journal_commit (fs);
+}
+
+int
+rtems_rfs_journal_release (rtems_rfs_file_system* fs)
+{
+  rtems_rfs_journal* journal = &fs->journal;
+  uint32_t           modified;
+
+  if (!rtems_rfs_journal_active (fs))
+    return 0;
+
+  modified = journal->count - journal->carried + journal->revoked;
+
+  if ((modified >= journal->commit_blocks) ||
+      ((modified > 0) &&
+       ((rtems_clock_get_ticks_since_boot () - journal->started) >=
+        journal->commit_interval)))
+    return rtems_rfs_journal_commit (fs);
+
+  return 0;
+}
+
+int
+rtems_rfs_journal_commit (rtems_rfs_file_system* fs)
+{
+  rtems_rfs_journal* journal = &fs->journal;
+  size_t             block_size = rtems_rfs_fs_block_size (fs);
+  rtems_rfs_buffer*  desc;
+  rtems_rfs_buffer*  commit;
+  uint8_t*           data;
+  uint32_t           offset;
+  uint32_t           checksum;
+  uint32_t           e;
+  int                rc;
+
+  if (!rtems_rfs_journal_active (fs) ||
+      ((journal->count == journal->carried) && (journal->revoked == 0)))
+  {
+    journal->freed = 0;
+    return 0;
+  }
+
+  /*
+   * Drop any block no longer held. It cannot be logged.
+   */
+  e = 0;
+  while (e < journal->count)
+  {
+    rtems_rfs_buffer_block block = journal->entries[e].block;
+    if (!rtems_rfs_journal_find_buffer (&journal->transaction, block) &&
+        !rtems_rfs_journal_find_buffer (&fs->buffers, block))
+    {
+      if (rtems_rfs_trace (RTEMS_RFS_TRACE_JOURNAL))
+        printf ("rtems-rfs: journal-commit: block not held: %" PRIu32 "\n",
+                block);
+      rtems_rfs_journal_remove_entry (journal, e);
+    }
+    else
+      e++;
+  }
+
+  if ((journal->count == 0) && (journal->revoked == 0))
+  {
+    journal->freed = 0;
+    return 0;
+  }
+
+  /*
+   * There is always space as the journal is synced after a commit leaves no
+   * space for the largest transaction.
+   */
+  offset = rtems_rfs_journal_place (journal, journal->count + 2);
+  if (offset == 0)
+    return ENOSPC;
+
+  if (rtems_rfs_trace (RTEMS_RFS_TRACE_JOURNAL))
+    printf ("rtems-rfs: journal-commit: sequence=%" PRIu32 " offset=%" PRIu32
+            " blocks=%" PRIu32 " revoked=%" PRIu32 "\n",
+            journal->sequence, offset, journal->count, journal->revoked);
+
+  /*
+   * Write the descriptor and a copy of each block then make sure they are on
+   * the media before the commit block is written.
+   */
+  rc = rtems_rfs_buffer_io_request (fs, journal->start + offset, false, &desc);
+  if (rc > 0)
+    return rc;
+
+  data = rtems_rfs_journal_buffer_data (desc);
+  memset (data, 0, block_size);
+  rtems_rfs_write_u32 (data + RTEMS_RFS_JOURNAL_OFFSET_MAGIC,
+                       RTEMS_RFS_JOURNAL_DESC_MAGIC);
+  rtems_rfs_write_u32 (data + RTEMS_RFS_JOURNAL_OFFSET_SEQUENCE,
+                       journal->sequence);
+  rtems_rfs_write_u32 (data + RTEMS_RFS_JOURNAL_OFFSET_COUNT, journal->count);
+  rtems_rfs_write_u32 (data + RTEMS_RFS_JOURNAL_OFFSET_REVOKES,
+                       journal->revoked);
+  for (e = 0; e < journal->count; e++)
+    rtems_rfs_write_u32 (data + RTEMS_RFS_JOURNAL_OFFSET_BLOCKS +
+                         (e * sizeof (uint32_t)),
+                         journal->entries[e].block);
+  for (e = 0; e < journal->revoked; e++)
+    rtems_rfs_write_u32 (data + RTEMS_RFS_JOURNAL_OFFSET_BLOCKS +
+                         ((journal->count + e) * sizeof (uint32_t)),
+                         journal->revokes[e]);
+
+  checksum = rtems_rfs_journal_checksum (0, data, block_size);
+
+  rc = rtems_rfs_buffer_io_release (desc, true);
+  if (rc > 0)
+    return rc;
+
+  for (e = 0; e < journal->count; e++)
+  {
+    rtems_rfs_buffer_block block = journal->entries[e].block;
+    rtems_rfs_buffer*      buffer;
+    rtems_rfs_buffer*      copy;
+
+    buffer = rtems_rfs_journal_find_buffer (&journal->transaction, block);
+    if (!buffer)
+      buffer = rtems_rfs_journal_find_buffer (&fs->buffers, block);
+
+    rc = rtems_rfs_buffer_io_request (fs, journal->start + offset + 1 + e,
+                                      false, &copy);
+    if (rc > 0)
+      return rc;
+
+    memcpy (rtems_rfs_journal_buffer_data (copy),
+            rtems_rfs_journal_buffer_data (buffer),
+            block_size);
+
+    checksum = rtems_rfs_journal_checksum (checksum,
+                                           rtems_rfs_journal_buffer_data (copy),
+                                           block_size);
+
+    rc = rtems_rfs_buffer_io_release (copy, true);
+    if (rc > 0)
+      return rc;
+  }
+
+  rc = rtems_rfs_buffer_flush (fs);
+  if (rc > 0)
+    return rc;
+
+  rc = rtems_rfs_buffer_io_request (fs,
+                                    journal->start + offset + 1 + journal->count,
+                                    false, &commit);
+  if (rc > 0)
+    return rc;
+
+  data = rtems_rfs_journal_buffer_data (commit);
+  memset (data, 0, block_size);
+  rtems_rfs_write_u32 (data + RTEMS_RFS_JOURNAL_OFFSET_MAGIC,
+                       RTEMS_RFS_JOURNAL_COMMIT_MAGIC);
+  rtems_rfs_write_u32 (data + RTEMS_RFS_JOURNAL_OFFSET_SEQUENCE,
+                       journal->sequence);
+  rtems_rfs_write_u32 (data + RTEMS_RFS_JOURNAL_OFFSET_COUNT, journal->count);
+  rtems_rfs_write_u32 (data + RTEMS_RFS_JOURNAL_OFFSET_CHECKSUM, checksum);
+
+  rc = rtems_rfs_buffer_io_release (commit, true);
+  if (rc > 0)
+    return rc;
+
+  rc = rtems_rfs_buffer_flush (fs);
+  if (rc > 0)
+    return rc;
+
+  /*
+   * The transaction is committed. The revoked blocks have no copies in the
+   * journal that can be replayed and the logged blocks have.
+   */
+  journal->stats.commits++;
+  journal->stats.blocks += journal->count;
+  journal->stats.revokes += journal->revoked;
+
+  for (e = 0; e < journal->revoked; e++)
+  {
+    int l = rtems_rfs_journal_find_block (journal->logged,
+                                          journal->logged_count,
+                                          journal->revokes[e]);
+    while (l >= 0)
+    {
+      journal->logged[l] = 0;
+      l = rtems_rfs_journal_find_block (journal->logged,
+                                        journal->logged_count,
+                                        journal->revokes[e]);
+    }
+  }
+
+  for (e = 0; (e < journal->count) &&
+         (journal->logged_count < journal->blocks); e++)
+    journal->logged[journal->logged_count++] = journal->entries[e].block;
+
+  journal->last = offset;
+  journal->last_count = journal->count;
+  journal->head = offset + journal->count + 2;
+  journal->sequence++;
+  journal->revoked = 0;
+  journal->freed = 0;
+
+  /*
+   * The buffers can be written to their home locations by the cache.
+   */
+  while (!rtems_chain_is_empty (&journal->transaction))
+  {
+    rtems_rfs_buffer* buffer;
+    buffer = (rtems_rfs_buffer*) rtems_chain_get_unprotected (&journal->transaction);
+    buffer->user = (void*) 0;
+    rtems_rfs_buffer_io_release (buffer, true);
+  }
+  journal->transaction_count = 0;
+
+  /*
+   * Blocks still held are written when released so carry them into the next
+   * transaction.
+   */
+  journal->carried = 0;
+  for (e = 0; e < journal->count; e++)
+  {
+    if (rtems_rfs_journal_find_buffer (&fs->buffers, journal->entries[e].block))
+    {
+      journal->entries[journal->carried].block = journal->entries[e].block;
+      journal->entries[journal->carried].carried = true;
+      journal->carried++;
+    }
+  }
+  journal->count = journal->carried;
+  journal->last_carried = journal->carried;
+
+  /*
+   * Sync the journal now if the next transaction may not fit. The buffers of
+   * the committed transaction are in the cache and can be written to their
+   * home locations. Blocks modified later are held until they are committed.
+   */
+  if (rtems_rfs_journal_place (journal, journal->max_entries + 2) == 0)
+    return rtems_rfs_journal_checkpoint (fs);
+
+  return 0;
+}
@@ -771,6 +771,8 @@ rtems_rfs_rtems_initialise (rtems_filesystem_mount_table_entry_t* mt_entry,
   rtems_rfs_file_system*   fs;
   uint32_t                 flags = 0;
   uint32_t                 max_held_buffers = RTEMS_RFS_FS_MAX_HELD_BUFFERS;
+  uint32_t                 journal_commit = 0;
+  uint32_t                 journal_interval = 0;
   const char*              options = data;
   int                      rc;
 
@@ -791,6 +793,16 @@ rtems_rfs_rtems_initialise (rtems_filesystem_mount_table_entry_t* mt_entry,
     {
       max_held_buffers = strtoul (options + sizeof ("max-held-bufs"), 0, 0);
     }
+    else if (strncmp (options, "journal-commit",
+                      sizeof ("journal-commit") - 1) == 0)
+    {
+      journal_commit = strtoul (options + sizeof ("journal-commit"), 0, 0);
+    }
+    else if (strncmp (options, "journal-interval",
+                      sizeof ("journal-interval") - 1) == 0)
+    {
+      journal_interval = strtoul (options + sizeof ("journal-interval"), 0, 0);
+    }
     else
       return rtems_rfs_rtems_error ("initialise: invalid option", EINVAL);
 
@@ -833,6 +845,8 @@ rtems_rfs_rtems_initialise (rtems_filesystem_mount_table_entry_t* mt_entry,
     return rtems_rfs_rtems_error ("initialise: open", errno);
   }
 
+  rtems_rfs_journal_set_commit (fs, journal_commit, journal_interval);
+
   mt_entry->fs_info                          = fs;
   mt_entry->ops                              = &rtems_rfs_ops;
   mt_entry->mt_fs_root->location.node_access = (void*) RTEMS_RFS_ROOT_INO;
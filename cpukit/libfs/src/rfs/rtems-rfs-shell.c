@@ -153,6 +153,10 @@ rtems_rfs_shell_data (rtems_rfs_file_system* fs, int argc, char *argv[])
   printf ("  media block size: %" PRIu32 "\n",   rtems_rfs_fs_media_block_size (fs));
   printf ("        media size: %" PRIu64 "\n",   rtems_rfs_fs_media_size (fs));
   printf ("            inodes: %" PRIu32 "\n",   rtems_rfs_fs_inodes (fs));
+  printf ("          features: %08" PRIx32 "%s%s%s\n", rtems_rfs_fs_features (fs),
+          rtems_rfs_fs_extents (fs) ? " extents" : "",
+          rtems_rfs_fs_dir_index (fs) ? " dir-index" : "",
+          rtems_rfs_fs_journal (fs) ? " journal" : "");
   printf ("        bad blocks: %" PRIu32 "\n",   fs->bad_blocks);
   printf ("  max. name length: %" PRIu32 "\n",   rtems_rfs_fs_max_name (fs));
   printf ("            groups: %d\n",            fs->group_count);
@@ -164,6 +168,19 @@ rtems_rfs_shell_data (rtems_rfs_file_system* fs, int argc, char *argv[])
   printf ("    doublly blocks: %zd\n",           fs->block_map_doubly_blocks);
   printf (" max. held buffers: %" PRId32 "\n",   fs->max_held_buffers);
 
+  if (rtems_rfs_fs_journal (fs))
+  {
+    printf ("           journal: %" PRIu32 " blocks at %" PRIu32 "\n",
+            fs->journal.blocks, fs->journal.start);
+    printf ("   journal commits: %" PRIu32 " (%" PRIu32 " blocks, %" PRIu32
+            " forced)\n", fs->journal.stats.commits, fs->journal.stats.blocks,
+            fs->journal.stats.forced);
+    printf ("       checkpoints: %" PRIu32 "\n", fs->journal.stats.checkpoints);
+    printf ("           revokes: %" PRIu32 "\n", fs->journal.stats.revokes);
+    printf ("          replayed: %" PRIu32 " (%" PRIu32 " blocks)\n",
+            fs->journal.stats.replayed, fs->journal.stats.replayed_blocks);
+  }
+
   rtems_rfs_shell_lock_rfs (fs);
 
   rtems_rfs_group_usage (fs, &blocks, &inodes);
@@ -411,14 +428,42 @@ rtems_rfs_shell_inode (rtems_rfs_file_system* fs, int argc, char *argv[])
             type = "REG";
           else if (RTEMS_RFS_S_ISLNK (mode))
             type = "LNK";
-          printf ("links=%03i mode=%04x (%s/%03o) bo=%04u bc=%04" PRIu32 " b=[",
+          printf ("links=%03i mode=%04x (%s/%03o) bo=%04u bc=%04" PRIu32,
                   rtems_rfs_inode_get_links (&inode),
                   mode, type, mode & ((1 << 10) - 1),
                   rtems_rfs_inode_get_block_offset (&inode),
                   rtems_rfs_inode_get_block_count (&inode));
-          for (b = 0; b < (RTEMS_RFS_INODE_BLOCKS - 1); b++)
-            printf ("%" PRIu32 " ", rtems_rfs_inode_get_block (&inode, b));
-          printf ("%" PRIu32 "]\n", rtems_rfs_inode_get_block (&inode, b));
+          if (((rtems_rfs_inode_get_flags (&inode) &
+                RTEMS_RFS_INODE_FLAG_EXTENTS) != 0) &&
+              (rtems_rfs_inode_get_block_count (&inode) != 0))
+          {
+            uint32_t extents;
+            extents = rtems_rfs_inode_get_block (&inode,
+                                                 RTEMS_RFS_BLOCK_EXTENT_COUNT_SLOT);
+            if (extents <= RTEMS_RFS_BLOCK_INODE_EXTENTS)
+            {
+              printf (" e=[");
+              for (b = 0; b < extents; b++)
+                printf ("%s%" PRIu32 "+%" PRIu32, b == 0 ? "" : " ",
+                        rtems_rfs_inode_get_block (&inode, b * 2),
+                        rtems_rfs_inode_get_block (&inode, (b * 2) + 1));
+            }
+            else
+            {
+              printf (" x=[");
+              for (b = 0; b < (RTEMS_RFS_BLOCK_EXTENT_BLOCKS - 1); b++)
+                printf ("%" PRIu32 " ", rtems_rfs_inode_get_block (&inode, b));
+              printf ("%" PRIu32, rtems_rfs_inode_get_block (&inode, b));
+            }
+            printf ("] extents=%" PRIu32 "\n", extents);
+          }
+          else
+          {
+            printf (" b=[");
+            for (b = 0; b < (RTEMS_RFS_INODE_BLOCKS - 1); b++)
+              printf ("%" PRIu32 " ", rtems_rfs_inode_get_block (&inode, b));
+            printf ("%" PRIu32 "]\n", rtems_rfs_inode_get_block (&inode, b));
+          }
         }
       }
 
@@ -732,6 +777,24 @@ rtems_shell_rfs_format (int argc, char* argv[])
           config.initialise_inodes = true;
           break;
 
+        case 'e':
+          config.extents = true;
+          break;
+
+        case 'd':
+          config.dir_index = true;
+          break;
+
+        case 'j':
+          arg++;
+          if (arg >= argc)
+          {
+            printf ("error: journal block count needs an argument\n");
+            return 1;
+          }
+          config.journal_blocks = strtoul (argv[arg], 0, 0);
+          break;
+
         case 'o':
           arg++;
           if (arg >= argc)
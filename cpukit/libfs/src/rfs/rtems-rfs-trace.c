@@ -110,7 +110,8 @@ rtems_rfs_trace_shell_command (int argc, char *argv[])
     "file-open",
     "file-close",
     "file-io",
-    "file-set"
+    "file-set",
+    "journal"
   };
 
   rtems_rfs_trace_mask set_value = 0;
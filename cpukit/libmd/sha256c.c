@@ -30,6 +30,7 @@ __FBSDID("$FreeBSD$");
 #include <sys/endian.h>
 #include <sys/types.h>
 
+#include <stdint.h>
 #include <string.h>
 
 #include "sha224.h"
@@ -41,10 +42,6 @@ __FBSDID("$FreeBSD$");
 #define be32enc_vect(dst, src, len)	\
 	memcpy((void *)dst, (const void *)src, (size_t)len)
 
-/* Copy a vector of bytes into a vector of big-endian uint32_t */
-#define be32dec_vect(dst, src, len)	\
-	memcpy((void *)dst, (const void *)src, (size_t)len)
-
 #else /* BYTE_ORDER != BIG_ENDIAN */
 
 /*
@@ -60,19 +57,6 @@ be32enc_vect(unsigned char *dst, const uint32_t *src, size_t len)
 		be32enc(dst + i * 4, src[i]);
 }
 
-/*
- * Decode a big-endian length len vector of (unsigned char) into a length
- * len/4 vector of (uint32_t).  Assumes len is a multiple of 4.
- */
-static void
-be32dec_vect(uint32_t *dst, const unsigned char *src, size_t len)
-{
-	size_t i;
-
-	for (i = 0; i < len / 4; i++)
-		dst[i] = be32dec(src + i * 4);
-}
-
 #endif /* BYTE_ORDER != BIG_ENDIAN */
 
 /* SHA256 round constants. */
@@ -123,65 +107,90 @@ static const uint32_t K[64] = {
 #define MSCH(W, ii, i)				\
 	W[i + ii + 16] = s1(W[i + ii + 14]) + W[i + ii + 9] + s0(W[i + ii + 1]) + W[i + ii]
 
+/*
+ * Decode a block into the first part of the message schedule W.  The block
+ * is copied word-wise regardless of its alignment and the words are then
+ * converted in place, instead of assembling each word byte-wise.
+ */
+static inline void
+SHA256_Decode(uint32_t *W, const unsigned char *block)
+{
+	int i;
+
+	memcpy(W, block, 64);
+	for (i = 0; i < 16; i++)
+		W[i] = be32toh(W[i]);
+}
+
 /*
  * SHA256 block compression function.  The 256-bit state is transformed via
- * the 512-bit input block to produce a new state.
+ * the 512-bit input blocks to produce a new state.  The state stays in
+ * local variables across consecutive blocks.
  */
 static void
-SHA256_Transform(uint32_t * state, const unsigned char block[64])
+SHA256_Transform(uint32_t * state, const unsigned char *block, size_t n)
 {
 	uint32_t W[64];
 	uint32_t S[8];
+	uint32_t H[8];
 	int i;
 
-	/* 1. Prepare the first part of the message schedule W. */
-	be32dec_vect(W, block, 64);
-
-	/* 2. Initialize working variables. */
-	memcpy(S, state, 32);
-
-	/* 3. Mix. */
-	for (i = 0; i < 64; i += 16) {
-		RNDr(S, W, 0, i);
-		RNDr(S, W, 1, i);
-		RNDr(S, W, 2, i);
-		RNDr(S, W, 3, i);
-		RNDr(S, W, 4, i);
-		RNDr(S, W, 5, i);
-		RNDr(S, W, 6, i);
-		RNDr(S, W, 7, i);
-		RNDr(S, W, 8, i);
-		RNDr(S, W, 9, i);
-		RNDr(S, W, 10, i);
-		RNDr(S, W, 11, i);
-		RNDr(S, W, 12, i);
-		RNDr(S, W, 13, i);
-		RNDr(S, W, 14, i);
-		RNDr(S, W, 15, i);
-
-		if (i == 48)
-			break;
-		MSCH(W, 0, i);
-		MSCH(W, 1, i);
-		MSCH(W, 2, i);
-		MSCH(W, 3, i);
-		MSCH(W, 4, i);
-		MSCH(W, 5, i);
-		MSCH(W, 6, i);
-		MSCH(W, 7, i);
-		MSCH(W, 8, i);
-		MSCH(W, 9, i);
-		MSCH(W, 10, i);
-		MSCH(W, 11, i);
-		MSCH(W, 12, i);
-		MSCH(W, 13, i);
-		MSCH(W, 14, i);
-		MSCH(W, 15, i);
-	}
-
-	/* 4. Mix local working variables into global state */
-	for (i = 0; i < 8; i++)
-		state[i] += S[i];
+	memcpy(H, state, 32);
+
+	do {
+		/* 1. Prepare the first part of the message schedule W. */
+		SHA256_Decode(W, block);
+
+		/* 2. Initialize working variables. */
+		memcpy(S, H, 32);
+
+		/* 3. Mix. */
+		for (i = 0; i < 64; i += 16) {
+			RNDr(S, W, 0, i);
+			RNDr(S, W, 1, i);
+			RNDr(S, W, 2, i);
+			RNDr(S, W, 3, i);
+			RNDr(S, W, 4, i);
+			RNDr(S, W, 5, i);
+			RNDr(S, W, 6, i);
+			RNDr(S, W, 7, i);
+			RNDr(S, W, 8, i);
+			RNDr(S, W, 9, i);
+			RNDr(S, W, 10, i);
+			RNDr(S, W, 11, i);
+			RNDr(S, W, 12, i);
+			RNDr(S, W, 13, i);
+			RNDr(S, W, 14, i);
+			RNDr(S, W, 15, i);
+
+			if (i == 48)
+				break;
+			MSCH(W, 0, i);
+			MSCH(W, 1, i);
+			MSCH(W, 2, i);
+			MSCH(W, 3, i);
+			MSCH(W, 4, i);
+			MSCH(W, 5, i);
+			MSCH(W, 6, i);
+			MSCH(W, 7, i);
+			MSCH(W, 8, i);
+			MSCH(W, 9, i);
+			MSCH(W, 10, i);
+			MSCH(W, 11, i);
+			MSCH(W, 12, i);
+			MSCH(W, 13, i);
+			MSCH(W, 14, i);
+			MSCH(W, 15, i);
+		}
+
+		/* 4. Mix local working variables into the state */
+		for (i = 0; i < 8; i++)
+			H[i] += S[i];
+
+		block += 64;
+	} while (--n > 0);
+
+	memcpy(state, H, 32);
 }
 
 static const unsigned char PAD[64] = {
@@ -207,7 +216,7 @@ SHA256_Pad(SHA256_CTX * ctx)
 	} else {
 		/* Finish the current block and mix. */
 		memcpy(&ctx->buf[r], PAD, 64 - r);
-		SHA256_Transform(ctx->state, ctx->buf);
+		SHA256_Transform(ctx->state, ctx->buf, 1);
 
 		/* The start of the final block is all zeroes. */
 		memset(&ctx->buf[0], 0, 56);
@@ -217,7 +226,7 @@ SHA256_Pad(SHA256_CTX * ctx)
 	be64enc(&ctx->buf[56], ctx->count);
 
 	/* Mix in the final block. */
-	SHA256_Transform(ctx->state, ctx->buf);
+	SHA256_Transform(ctx->state, ctx->buf, 1);
 }
 
 /* SHA-256 initialization.  Begins a SHA-256 operation. */
@@ -263,16 +272,18 @@ SHA256_Update(SHA256_CTX * ctx, const void *in, size_t len)
 	}
 
 	/* Finish the current block */
-	memcpy(&ctx->buf[r], src, 64 - r);
-	SHA256_Transform(ctx->state, ctx->buf);
-	src += 64 - r;
-	len -= 64 - r;
-
-	/* Perform complete blocks */
-	while (len >= 64) {
-		SHA256_Transform(ctx->state, src);
-		src += 64;
-		len -= 64;
+	if (r != 0) {
+		memcpy(&ctx->buf[r], src, 64 - r);
+		SHA256_Transform(ctx->state, ctx->buf, 1);
+		src += 64 - r;
+		len -= 64 - r;
+	}
+
+	/* Perform complete blocks directly from the input */
+	if (len >= 64) {
+		SHA256_Transform(ctx->state, src, len / 64);
+		src += len & ~(size_t)(64 - 1);
+		len &= 64 - 1;
 	}
 
 	/* Copy left over data into buffer */
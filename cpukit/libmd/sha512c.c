@@ -31,6 +31,7 @@ __FBSDID("$FreeBSD$");
 #include <sys/endian.h>
 #include <sys/types.h>
 
+#include <stdint.h>
 #include <string.h>
 
 #include "sha512.h"
@@ -43,10 +44,6 @@ __FBSDID("$FreeBSD$");
 #define be64enc_vect(dst, src, len)	\
 	memcpy((void *)dst, (const void *)src, (size_t)len)
 
-/* Copy a vector of bytes into a vector of big-endian uint64_t */
-#define be64dec_vect(dst, src, len)	\
-	memcpy((void *)dst, (const void *)src, (size_t)len)
-
 #else /* BYTE_ORDER != BIG_ENDIAN */
 
 /*
@@ -65,19 +62,6 @@ be64enc_vect(unsigned char *dst, const uint64_t *src, size_t len)
 		be32enc(dst + i * 8, src[i] >> 32);
 }
 
-/*
- * Decode a big-endian length len vector of (unsigned char) into a length
- * len/8 vector of (uint64_t).  Assumes len is a multiple of 8.
- */
-static inline void
-be64dec_vect(uint64_t *dst, const unsigned char *src, size_t len)
-{
-	size_t i;
-
-	for (i = 0; i < len / 8; i++)
-		dst[i] = be64dec(src + i * 8);
-}
-
 #endif /* BYTE_ORDER != BIG_ENDIAN */
 
 /* SHA512 round constants. */
@@ -152,65 +136,90 @@ static const uint64_t K[80] = {
 #define MSCH(W, ii, i)				\
 	W[i + ii + 16] = s1(W[i + ii + 14]) + W[i + ii + 9] + s0(W[i + ii + 1]) + W[i + ii]
 
+/*
+ * Decode a block into the first part of the message schedule W.  The block
+ * is copied word-wise regardless of its alignment and the words are then
+ * converted in place, instead of assembling each word byte-wise.
+ */
+static inline void
+SHA512_Decode(uint64_t *W, const unsigned char *block)
+{
+	int i;
+
+	memcpy(W, block, SHA512_BLOCK_LENGTH);
+	for (i = 0; i < 16; i++)
+		W[i] = be64toh(W[i]);
+}
+
 /*
  * SHA512 block compression function.  The 512-bit state is transformed via
- * the 512-bit input block to produce a new state.
+ * the 1024-bit input blocks to produce a new state.  The state stays in
+ * local variables across consecutive blocks.
  */
 static void
-SHA512_Transform(uint64_t * state, const unsigned char block[SHA512_BLOCK_LENGTH])
+SHA512_Transform(uint64_t * state, const unsigned char *block, size_t n)
 {
 	uint64_t W[80];
 	uint64_t S[8];
+	uint64_t H[8];
 	int i;
 
-	/* 1. Prepare the first part of the message schedule W. */
-	be64dec_vect(W, block, SHA512_BLOCK_LENGTH);
-
-	/* 2. Initialize working variables. */
-	memcpy(S, state, SHA512_DIGEST_LENGTH);
-
-	/* 3. Mix. */
-	for (i = 0; i < 80; i += 16) {
-		RNDr(S, W, 0, i);
-		RNDr(S, W, 1, i);
-		RNDr(S, W, 2, i);
-		RNDr(S, W, 3, i);
-		RNDr(S, W, 4, i);
-		RNDr(S, W, 5, i);
-		RNDr(S, W, 6, i);
-		RNDr(S, W, 7, i);
-		RNDr(S, W, 8, i);
-		RNDr(S, W, 9, i);
-		RNDr(S, W, 10, i);
-		RNDr(S, W, 11, i);
-		RNDr(S, W, 12, i);
-		RNDr(S, W, 13, i);
-		RNDr(S, W, 14, i);
-		RNDr(S, W, 15, i);
-
-		if (i == 64)
-			break;
-		MSCH(W, 0, i);
-		MSCH(W, 1, i);
-		MSCH(W, 2, i);
-		MSCH(W, 3, i);
-		MSCH(W, 4, i);
-		MSCH(W, 5, i);
-		MSCH(W, 6, i);
-		MSCH(W, 7, i);
-		MSCH(W, 8, i);
-		MSCH(W, 9, i);
-		MSCH(W, 10, i);
-		MSCH(W, 11, i);
-		MSCH(W, 12, i);
-		MSCH(W, 13, i);
-		MSCH(W, 14, i);
-		MSCH(W, 15, i);
-	}
-
-	/* 4. Mix local working variables into global state */
-	for (i = 0; i < 8; i++)
-		state[i] += S[i];
+	memcpy(H, state, SHA512_DIGEST_LENGTH);
+
+	do {
+		/* 1. Prepare the first part of the message schedule W. */
+		SHA512_Decode(W, block);
+
+		/* 2. Initialize working variables. */
+		memcpy(S, H, SHA512_DIGEST_LENGTH);
+
+		/* 3. Mix. */
+		for (i = 0; i < 80; i += 16) {
+			RNDr(S, W, 0, i);
+			RNDr(S, W, 1, i);
+			RNDr(S, W, 2, i);
+			RNDr(S, W, 3, i);
+			RNDr(S, W, 4, i);
+			RNDr(S, W, 5, i);
+			RNDr(S, W, 6, i);
+			RNDr(S, W, 7, i);
+			RNDr(S, W, 8, i);
+			RNDr(S, W, 9, i);
+			RNDr(S, W, 10, i);
+			RNDr(S, W, 11, i);
+			RNDr(S, W, 12, i);
+			RNDr(S, W, 13, i);
+			RNDr(S, W, 14, i);
+			RNDr(S, W, 15, i);
+
+			if (i == 64)
+				break;
+			MSCH(W, 0, i);
+			MSCH(W, 1, i);
+			MSCH(W, 2, i);
+			MSCH(W, 3, i);
+			MSCH(W, 4, i);
+			MSCH(W, 5, i);
+			MSCH(W, 6, i);
+			MSCH(W, 7, i);
+			MSCH(W, 8, i);
+			MSCH(W, 9, i);
+			MSCH(W, 10, i);
+			MSCH(W, 11, i);
+			MSCH(W, 12, i);
+			MSCH(W, 13, i);
+			MSCH(W, 14, i);
+			MSCH(W, 15, i);
+		}
+
+		/* 4. Mix local working variables into the state */
+		for (i = 0; i < 8; i++)
+			H[i] += S[i];
+
+		block += SHA512_BLOCK_LENGTH;
+	} while (--n > 0);
+
+	memcpy(state, H, SHA512_DIGEST_LENGTH);
 }
 
 static const unsigned char PAD[SHA512_BLOCK_LENGTH] = {
@@ -240,7 +249,7 @@ SHA512_Pad(SHA512_CTX * ctx)
 	} else {
 		/* Finish the current block and mix. */
 		memcpy(&ctx->buf[r], PAD, 128 - r);
-		SHA512_Transform(ctx->state, ctx->buf);
+		SHA512_Transform(ctx->state, ctx->buf, 1);
 
 		/* The start of the final block is all zeroes. */
 		memset(&ctx->buf[0], 0, 112);
@@ -250,7 +259,7 @@ SHA512_Pad(SHA512_CTX * ctx)
 	be64enc_vect(&ctx->buf[112], ctx->count, 16);
 
 	/* Mix in the final block. */
-	SHA512_Transform(ctx->state, ctx->buf);
+	SHA512_Transform(ctx->state, ctx->buf, 1);
 }
 
 /* SHA-512 initialization.  Begins a SHA-512 operation. */
@@ -299,16 +308,18 @@ SHA512_Update(SHA512_CTX * ctx, const void *in, size_t len)
 	}
 
 	/* Finish the current block */
-	memcpy(&ctx->buf[r], src, SHA512_BLOCK_LENGTH - r);
-	SHA512_Transform(ctx->state, ctx->buf);
-	src += SHA512_BLOCK_LENGTH - r;
-	len -= SHA512_BLOCK_LENGTH - r;
-
-	/* Perform complete blocks */
-	while (len >= SHA512_BLOCK_LENGTH) {
-		SHA512_Transform(ctx->state, src);
-		src += SHA512_BLOCK_LENGTH;
-		len -= SHA512_BLOCK_LENGTH;
+	if (r != 0) {
+		memcpy(&ctx->buf[r], src, SHA512_BLOCK_LENGTH - r);
+		SHA512_Transform(ctx->state, ctx->buf, 1);
+		src += SHA512_BLOCK_LENGTH - r;
+		len -= SHA512_BLOCK_LENGTH - r;
+	}
+
+	/* Perform complete blocks directly from the input */
+	if (len >= SHA512_BLOCK_LENGTH) {
+		SHA512_Transform(ctx->state, src, len / SHA512_BLOCK_LENGTH);
+		src += len & ~(size_t)(SHA512_BLOCK_LENGTH - 1);
+		len &= SHA512_BLOCK_LENGTH - 1;
 	}
 
 	/* Copy left over data into buffer */
@@ -0,0 +1,307 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/**
+ * @file
+ *
+ * @ingroup RTEMSHashService
+ *
+ * @brief This source file contains the implementation of the hash service.
+ */
+
+/*
+ * Copyright (C) 2026 On-Line Applications Research Corporation (OAR)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/hashservice.h>
+#include <rtems.h>
+
+#include <errno.h>
+#include <fcntl.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <sha256.h>
+
+typedef struct {
+  void ( *update )( void *, const void *, size_t );
+  void ( *final )( unsigned char *, void * );
+  union {
+    SHA256_CTX sha256;
+    SHA512_CTX sha512;
+  } ctx;
+} hash_context;
+
+static void hash_sha256_update( void *ctx, const void *in, size_t len )
+{
+  SHA256_Update( ctx, in, len );
+}
+
+static void hash_sha256_final( unsigned char *digest, void *ctx )
+{
+  SHA256_Final( digest, ctx );
+}
+
+static void hash_sha512_update( void *ctx, const void *in, size_t len )
+{
+  SHA512_Update( ctx, in, len );
+}
+
+static void hash_sha512_final( unsigned char *digest, void *ctx )
+{
+  SHA512_Final( digest, ctx );
+}
+
+static void hash_init( hash_context *hash, rtems_hash_algorithm algorithm )
+{
+  if ( algorithm == RTEMS_HASH_SHA512 ) {
+    SHA512_Init( &hash->ctx.sha512 );
+    hash->update = hash_sha512_update;
+    hash->final = hash_sha512_final;
+  } else {
+    SHA256_Init( &hash->ctx.sha256 );
+    hash->update = hash_sha256_update;
+    hash->final = hash_sha256_final;
+  }
+}
+
+static int hash_file(
+  rtems_hash_service *service,
+  hash_context       *hash,
+  const char         *path
+)
+{
+  ssize_t n;
+  int     fd;
+  int     eno;
+
+  fd = open( path, O_RDONLY );
+  if ( fd < 0 ) {
+    return errno;
+  }
+
+  eno = 0;
+
+  while ( true ) {
+    n = read( fd, service->chunk, service->chunk_size );
+    if ( n <= 0 ) {
+      if ( n < 0 ) {
+        eno = errno;
+      }
+
+      break;
+    }
+
+    ( *hash->update )( &hash->ctx, service->chunk, (size_t) n );
+  }
+
+  (void) close( fd );
+  return eno;
+}
+
+static void hash_process( rtems_hash_service *service, rtems_hash_request *req )
+{
+  hash_context hash;
+
+  hash_init( &hash, req->algorithm );
+
+  if ( req->path != NULL ) {
+    req->status = hash_file( service, &hash, req->path );
+  } else {
+    ( *hash.update )( &hash.ctx, req->buffer, req->size );
+    req->status = 0;
+  }
+
+  ( *hash.final )( req->digest, &hash.ctx );
+}
+
+static rtems_task hash_service_task( rtems_task_argument arg )
+{
+  rtems_hash_service *service;
+  rtems_hash_request *req;
+
+  service = (rtems_hash_service *) arg;
+
+  while ( true ) {
+    rtems_counting_semaphore_wait( &service->pending );
+
+    rtems_mutex_lock( &service->mutex );
+    req = (rtems_hash_request *)
+      rtems_chain_get_unprotected( &service->todo );
+    rtems_mutex_unlock( &service->mutex );
+
+    /* The stop request is the only wake up without a request */
+    if ( req == NULL ) {
+      break;
+    }
+
+    hash_process( service, req );
+    rtems_binary_semaphore_post( &req->done );
+  }
+
+  rtems_binary_semaphore_post( &service->stopped );
+  rtems_task_exit();
+}
+
+static void hash_request_initialize(
+  rtems_hash_request   *request,
+  rtems_hash_algorithm  algorithm
+)
+{
+  memset( request, 0, sizeof( *request ) );
+  rtems_chain_set_off_chain( &request->node );
+  request->algorithm = algorithm;
+  request->digest_size = algorithm == RTEMS_HASH_SHA512 ?
+    SHA512_DIGEST_LENGTH : SHA256_DIGEST_LENGTH;
+  rtems_binary_semaphore_init( &request->done, "Hash Request" );
+}
+
+void rtems_hash_request_initialize_buffer(
+  rtems_hash_request   *request,
+  rtems_hash_algorithm  algorithm,
+  const void           *buffer,
+  size_t                size
+)
+{
+  hash_request_initialize( request, algorithm );
+  request->buffer = buffer;
+  request->size = size;
+}
+
+void rtems_hash_request_initialize_file(
+  rtems_hash_request   *request,
+  rtems_hash_algorithm  algorithm,
+  const char           *path
+)
+{
+  hash_request_initialize( request, algorithm );
+  request->path = path;
+}
+
+int rtems_hash_request_wait( rtems_hash_request *request )
+{
+  rtems_binary_semaphore_wait( &request->done );
+  return request->status;
+}
+
+void rtems_hash_request_destroy( rtems_hash_request *request )
+{
+  rtems_binary_semaphore_destroy( &request->done );
+}
+
+static int hash_service_status_to_errno( rtems_status_code sc )
+{
+  switch ( sc ) {
+    case RTEMS_INVALID_PRIORITY:
+      return EINVAL;
+    case RTEMS_TOO_MANY:
+      return EAGAIN;
+    case RTEMS_UNSATISFIED:
+      return ENOMEM;
+    default:
+      return rtems_status_code_to_errno( sc );
+  }
+}
+
+int rtems_hash_service_start(
+  rtems_hash_service  *service,
+  rtems_task_priority  priority,
+  size_t               stack_size,
+  size_t               chunk_size
+)
+{
+  rtems_status_code sc;
+
+  if ( chunk_size == 0 ) {
+    return EINVAL;
+  }
+
+  memset( service, 0, sizeof( *service ) );
+  service->chunk_size = chunk_size;
+  service->chunk = malloc( chunk_size );
+  if ( service->chunk == NULL ) {
+    return ENOMEM;
+  }
+
+  rtems_mutex_init( &service->mutex, "Hash Service" );
+  rtems_chain_initialize_empty( &service->todo );
+  rtems_counting_semaphore_init( &service->pending, "Hash Service", 0 );
+  rtems_binary_semaphore_init( &service->stopped, "Hash Service" );
+
+  sc = rtems_task_create(
+    rtems_build_name( 'H', 'A', 'S', 'H' ),
+    priority,
+    stack_size,
+    RTEMS_DEFAULT_MODES,
+    RTEMS_DEFAULT_ATTRIBUTES,
+    &service->task
+  );
+  if ( sc == RTEMS_SUCCESSFUL ) {
+    sc = rtems_task_start(
+      service->task,
+      hash_service_task,
+      (rtems_task_argument) service
+    );
+    if ( sc != RTEMS_SUCCESSFUL ) {
+      (void) rtems_task_delete( service->task );
+    }
+  }
+
+  if ( sc != RTEMS_SUCCESSFUL ) {
+    rtems_binary_semaphore_destroy( &service->stopped );
+    rtems_counting_semaphore_destroy( &service->pending );
+    rtems_mutex_destroy( &service->mutex );
+    free( service->chunk );
+    return hash_service_status_to_errno( sc );
+  }
+
+  return 0;
+}
+
+void rtems_hash_service_submit(
+  rtems_hash_service *service,
+  rtems_hash_request *request
+)
+{
+  rtems_mutex_lock( &service->mutex );
+  rtems_chain_append_unprotected( &service->todo, &request->node );
+  rtems_mutex_unlock( &service->mutex );
+  rtems_counting_semaphore_post( &service->pending );
+}
+
+void rtems_hash_service_stop( rtems_hash_service *service )
+{
+  /* Wake up the task without a request, it ends after the pending requests */
+  rtems_counting_semaphore_post( &service->pending );
+  rtems_binary_semaphore_wait( &service->stopped );
+
+  rtems_binary_semaphore_destroy( &service->stopped );
+  rtems_counting_semaphore_destroy( &service->pending );
+  rtems_mutex_destroy( &service->mutex );
+  free( service->chunk );
+}
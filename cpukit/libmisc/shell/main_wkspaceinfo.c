@@ -29,6 +29,33 @@ void rtems_shell_print_unified_work_area_message(void)
   );
 }
 
+static void rtems_shell_print_workspace_slab_info( void )
+{
+  Workspace_Slab_information info[ WORKSPACE_SLAB_CLASS_COUNT ];
+  size_t                     i;
+
+  _Workspace_Slab_get_information( info );
+
+  printf(
+    "\nslab size  per slab  slabs  empty   used cached allocations reclaimed\n"
+  );
+
+  for ( i = 0; i < WORKSPACE_SLAB_CLASS_COUNT; ++i ) {
+    printf(
+      "%9" PRIu32 " %9" PRIu32 " %6" PRIu32 " %6" PRIu32 " %6" PRIu32
+        " %6" PRIu32 " %11" PRIu32 " %9" PRIu32 "\n",
+      info[ i ].object_size,
+      info[ i ].objects_per_slab,
+      info[ i ].slab_count,
+      info[ i ].empty_slab_count,
+      info[ i ].used_object_count,
+      info[ i ].cached_object_count,
+      info[ i ].allocation_count,
+      info[ i ].reclaimed_slab_count
+    );
+  }
+}
+
 static int rtems_shell_main_wkspace_info(
   int   argc RTEMS_UNUSED,
   char *argv[] RTEMS_UNUSED
@@ -42,6 +69,7 @@ static int rtems_shell_main_wkspace_info(
   rtems_shell_print_heap_info( "free", &info.Free );
   rtems_shell_print_heap_info( "used", &info.Used );
   rtems_shell_print_heap_stats( &info.Stats );
+  rtems_shell_print_workspace_slab_info();
 
   return 0;
 }
@@ -48,6 +48,10 @@
 #include <errno.h>
 #include <sys/stat.h>
 #include <fcntl.h>
+#include <stdint.h>
+#include <rtems.h>
+#include <rtems/imfs.h>
+#include <rtems/thread.h>
 #include <rtems/untar.h>
 #include <rtems/bspIo.h>
 
@@ -92,6 +96,28 @@
  */
 #define TAR_WORK_BLOCKS          16
 
+/*
+ * Ring of buffers between the task which provides the tar data and the writer
+ * task.  The producer fills the buffer at the head, the writer task processes
+ * the buffer at the tail.  A buffer of size zero ends the writer task.
+ */
+typedef struct Untar_ChunkPipeline {
+  Untar_ChunkContext       *context;
+  char                     *buffers;
+  size_t                   *sizes;
+  size_t                    buffer_count;
+  size_t                    buffer_size;
+  size_t                    head;
+  size_t                    tail;
+  size_t                    fill;
+  bool                      acquired;
+  volatile int              status;
+  rtems_counting_semaphore  free;
+  rtems_counting_semaphore  full;
+  rtems_binary_semaphore    done;
+  rtems_id                  task;
+} Untar_ChunkPipeline;
+
 static int _rtems_tar_header_checksum(const char *bufr);
 
 /*
@@ -276,6 +302,118 @@ Untar_ProcessHeader(
   return retval;
 }
 
+/*
+ * Function: Untar_FromMemory_Options
+ *
+ * Description:
+ *
+ *    This is a simple subroutine used to rip links, directories, and
+ *    files out of a block of memory.
+ *
+ *
+ * Inputs:
+ *
+ *    void *  tar_buf    - Pointer to TAR buffer.
+ *    size_t  size       - Length of TAR buffer.
+ *    int     options    - Untar options.
+ *
+ *
+ * Output:
+ *
+ *    int - UNTAR_SUCCESSFUL (0)    on successful completion.
+ *          UNTAR_FAIL              for a faulty step within the process.
+ *          UNTAR_INVALID_CHECKSUM  for an invalid header checksum.
+ *          UNTAR_INVALID_HEADER    for an invalid header.
+ *
+ */
+int
+Untar_FromMemory_Options(
+  void                *tar_buf,
+  size_t               size,
+  int                  options,
+  const rtems_printer *printer
+)
+{
+  int                  fd;
+  const char          *tar_ptr = (const char *)tar_buf;
+  const char          *bufr;
+  char                 buf[UNTAR_FILE_NAME_SIZE];
+  Untar_HeaderContext  ctx;
+  int                  retval = UNTAR_SUCCESSFUL;
+  unsigned long        ptr;
+
+  ctx.file_path = buf;
+  ctx.file_name = buf;
+  ctx.printer = printer;
+  rtems_printf(printer, "untar: memory at %p (%zu)\n", tar_buf, size);
+
+  ptr = 0;
+  while (true) {
+    if (ptr + TAR_BLOCK_SIZE > size) {
+      retval = UNTAR_SUCCESSFUL;
+      break;
+    }
+
+    /* Read the header */
+    bufr = &tar_ptr[ptr];
+    ptr += TAR_BLOCK_SIZE;
+
+    retval = Untar_ProcessHeader(&ctx, bufr);
+
+    if (retval != UNTAR_SUCCESSFUL)
+      break;
+
+    if (ctx.linkflag == REGTYPE) {
+      if (ptr + ctx.file_size > size) {
+        rtems_printf(printer, "untar: %s: truncated file data\n",
+                     ctx.file_path);
+        retval = UNTAR_FAIL;
+        break;
+      }
+
+      if ((options & UNTAR_MAP_IMFS) != 0 &&
+          IMFS_make_linearfile(ctx.file_path, ctx.mode, &tar_ptr[ptr],
+                               ctx.file_size) == 0) {
+        /* The file references its data in the tar image */
+      } else if ((fd = open(ctx.file_path,
+                            O_TRUNC | O_CREAT | O_WRONLY, ctx.mode)) == -1) {
+        Print_Error(printer, "open", ctx.file_path);
+      } else {
+        /*
+         * The file data is contiguous in memory, so write it out at once.
+         * There are nblocks of data where nblocks is the file_size rounded to
+         * the nearest 512-byte boundary.
+         */
+        const char *data = &tar_ptr[ptr];
+        size_t file_size = ctx.file_size;
+
+        if ((options & UNTAR_PREALLOCATE) != 0) {
+          (void) ftruncate(fd, (off_t) file_size);
+        }
+
+        while (file_size > 0) {
+          ssize_t n = write(fd, data, file_size);
+          if (n <= 0) {
+            Print_Error(printer, "write", ctx.file_path);
+            retval  = UNTAR_FAIL;
+            break;
+          }
+          data += n;
+          file_size -= n;
+        }
+        close(fd);
+
+        if (retval != UNTAR_SUCCESSFUL)
+          break;
+      }
+
+      ptr += TAR_BLOCK_SIZE * ctx.nblocks;
+    }
+  }
+
+  return retval;
+}
+
 /*
  * Function: Untar_FromMemory
  *
@@ -501,28 +639,25 @@ void Untar_ChunkContext_Init(Untar_ChunkContext *context)
   context->state = UNTAR_CHUNK_HEADER;
   context->done_bytes = 0;
   context->out_fd = -1;
+  context->options = 0;
+  context->pipeline = NULL;
 }
 
-int Untar_FromChunk_Print(
+static int Untar_ProcessChunk(
   Untar_ChunkContext *context,
-  void *chunk,
-  size_t chunk_size,
-  const rtems_printer* printer
+  const char *buf,
+  size_t chunk_size
 )
 {
-  char *buf;
   size_t done;
   size_t todo;
   size_t remaining;
   size_t consume;
   int retval;
 
-  buf = chunk;
   done = 0;
   todo = chunk_size;
 
-  context->base.printer = printer;
-
   while (todo > 0) {
     switch (context->state) {
       case UNTAR_CHUNK_HEADER:
@@ -547,6 +682,10 @@ int Untar_FromChunk_Print(
                                     context->base.mode);
 
             if (context->out_fd >= 0) {
+              if ((context->options & UNTAR_PREALLOCATE) != 0) {
+                (void) ftruncate(context->out_fd,
+                                 (off_t) context->base.file_size);
+              }
               context->state = UNTAR_CHUNK_WRITE;
               context->done_bytes = 0;
             } else {
@@ -598,6 +737,217 @@ int Untar_FromChunk_Print(
   return UNTAR_SUCCESSFUL;
 }
 
+static rtems_task Untar_Pipeline_Writer(rtems_task_argument arg)
+{
+  Untar_ChunkPipeline *pipeline;
+  size_t size;
+
+  pipeline = (Untar_ChunkPipeline *) arg;
+
+  while (true) {
+    rtems_counting_semaphore_wait(&pipeline->full);
+    size = pipeline->sizes[pipeline->tail];
+    if (size == 0) {
+      break;
+    }
+
+    /* After an error, the remaining tar data is discarded */
+    if (pipeline->status == UNTAR_SUCCESSFUL) {
+      pipeline->status = Untar_ProcessChunk(
+        pipeline->context,
+        &pipeline->buffers[pipeline->tail * pipeline->buffer_size],
+        size
+      );
+    }
+
+    pipeline->tail = (pipeline->tail + 1) % pipeline->buffer_count;
+    rtems_counting_semaphore_post(&pipeline->free);
+  }
+
+  rtems_binary_semaphore_post(&pipeline->done);
+  rtems_task_exit();
+}
+
+static void Untar_Pipeline_Submit(Untar_ChunkPipeline *pipeline)
+{
+  pipeline->sizes[pipeline->head] = pipeline->fill;
+  pipeline->head = (pipeline->head + 1) % pipeline->buffer_count;
+  pipeline->acquired = false;
+  rtems_counting_semaphore_post(&pipeline->full);
+}
+
+static void Untar_Pipeline_Destroy(Untar_ChunkPipeline *pipeline)
+{
+  rtems_counting_semaphore_destroy(&pipeline->free);
+  rtems_counting_semaphore_destroy(&pipeline->full);
+  rtems_binary_semaphore_destroy(&pipeline->done);
+  free(pipeline->sizes);
+  free(pipeline->buffers);
+  free(pipeline);
+}
+
+int Untar_ChunkContext_Start_pipeline(
+  Untar_ChunkContext *context,
+  size_t buffer_count,
+  size_t buffer_size,
+  rtems_task_priority priority,
+  size_t stack_size,
+  const rtems_printer* printer
+)
+{
+  Untar_ChunkPipeline *pipeline;
+  rtems_status_code sc;
+
+  if (context->pipeline != NULL || buffer_count < 2 || buffer_size == 0 ||
+      buffer_size > SIZE_MAX / buffer_count) {
+    return UNTAR_FAIL;
+  }
+
+  pipeline = calloc(1, sizeof(*pipeline));
+  if (pipeline == NULL) {
+    return UNTAR_FAIL;
+  }
+
+  pipeline->context = context;
+  pipeline->buffer_count = buffer_count;
+  pipeline->buffer_size = buffer_size;
+  pipeline->status = UNTAR_SUCCESSFUL;
+  rtems_counting_semaphore_init(&pipeline->free, "Untar", buffer_count);
+  rtems_counting_semaphore_init(&pipeline->full, "Untar", 0);
+  rtems_binary_semaphore_init(&pipeline->done, "Untar");
+
+  pipeline->buffers = malloc(buffer_count * buffer_size);
+  pipeline->sizes = calloc(buffer_count, sizeof(pipeline->sizes[0]));
+  if (pipeline->buffers == NULL || pipeline->sizes == NULL) {
+    Untar_Pipeline_Destroy(pipeline);
+    return UNTAR_FAIL;
+  }
+
+  context->base.printer = printer;
+
+  sc = rtems_task_create(
+    rtems_build_name('U', 'T', 'A', 'R'),
+    priority,
+    stack_size,
+    RTEMS_DEFAULT_MODES,
+    RTEMS_FLOATING_POINT,
+    &pipeline->task
+  );
+  if (sc != RTEMS_SUCCESSFUL) {
+    Untar_Pipeline_Destroy(pipeline);
+    return UNTAR_FAIL;
+  }
+
+  sc = rtems_task_start(
+    pipeline->task,
+    Untar_Pipeline_Writer,
+    (rtems_task_argument) pipeline
+  );
+  if (sc != RTEMS_SUCCESSFUL) {
+    (void) rtems_task_delete(pipeline->task);
+    Untar_Pipeline_Destroy(pipeline);
+    return UNTAR_FAIL;
+  }
+
+  context->pipeline = pipeline;
+  return UNTAR_SUCCESSFUL;
+}
+
+void *Untar_ChunkContext_Get_buffer(Untar_ChunkContext *context, size_t *size)
+{
+  Untar_ChunkPipeline *pipeline;
+
+  pipeline = context->pipeline;
+
+  if (!pipeline->acquired) {
+    rtems_counting_semaphore_wait(&pipeline->free);
+    pipeline->acquired = true;
+    pipeline->fill = 0;
+  }
+
+  *size = pipeline->buffer_size - pipeline->fill;
+  return &pipeline->buffers[pipeline->head * pipeline->buffer_size
+    + pipeline->fill];
+}
+
+int Untar_ChunkContext_Put_buffer(Untar_ChunkContext *context, size_t size)
+{
+  Untar_ChunkPipeline *pipeline;
+
+  pipeline = context->pipeline;
+  pipeline->fill += size;
+
+  if (pipeline->fill == pipeline->buffer_size) {
+    Untar_Pipeline_Submit(pipeline);
+  }
+
+  return pipeline->status;
+}
+
+int Untar_ChunkContext_Finish(Untar_ChunkContext *context)
+{
+  Untar_ChunkPipeline *pipeline;
+  int retval;
+
+  pipeline = context->pipeline;
+  if (pipeline == NULL) {
+    return UNTAR_SUCCESSFUL;
+  }
+
+  if (pipeline->acquired && pipeline->fill > 0) {
+    Untar_Pipeline_Submit(pipeline);
+  }
+
+  /* Submit an empty buffer to end the writer task */
+  if (!pipeline->acquired) {
+    rtems_counting_semaphore_wait(&pipeline->free);
+  }
+  pipeline->fill = 0;
+  Untar_Pipeline_Submit(pipeline);
+
+  rtems_binary_semaphore_wait(&pipeline->done);
+
+  retval = pipeline->status;
+  context->pipeline = NULL;
+  Untar_Pipeline_Destroy(pipeline);
+
+  return retval;
+}
+
+int Untar_FromChunk_Print(
+  Untar_ChunkContext *context,
+  void *chunk,
+  size_t chunk_size,
+  const rtems_printer* printer
+)
+{
+  const char *src;
+  void *dst;
+  size_t size;
+  int retval;
+
+  if (context->pipeline == NULL) {
+    context->base.printer = printer;
+    return Untar_ProcessChunk(context, chunk, chunk_size);
+  }
+
+  /* The context belongs to the writer task, copy the data into the ring */
+  src = chunk;
+  while (chunk_size > 0) {
+    dst = Untar_ChunkContext_Get_buffer(context, &size);
+    size = MIN(size, chunk_size);
+    memcpy(dst, src, size);
+    retval = Untar_ChunkContext_Put_buffer(context, size);
+    if (retval != UNTAR_SUCCESSFUL) {
+      return retval;
+    }
+    src += size;
+    chunk_size -= size;
+  }
+
+  return UNTAR_SUCCESSFUL;
+}
+
 /*
  * Function: Untar_FromFile
  *
@@ -62,21 +62,34 @@ int Untar_FromGzChunk_Print(
 {
   int untar_succesful;
   int status;
+  void *out;
+  size_t out_size;
 
   ctx->strm.next_in = (Bytef *)chunk;
   ctx->strm.avail_in = (size_t)chunk_size;
 
     /* Inflate until output buffer is not full */
   do {
-    ctx->strm.next_out = (Bytef *) ctx->inflateBuffer;
-    ctx->strm.avail_out = ctx->inflateBufferSize;
+    /* With a pipeline, inflate directly into the ring buffers */
+    if (ctx->base.pipeline != NULL) {
+      out = Untar_ChunkContext_Get_buffer(&ctx->base, &out_size);
+    } else {
+      out = ctx->inflateBuffer;
+      out_size = ctx->inflateBufferSize;
+    }
+    ctx->strm.next_out = (Bytef *) out;
+    ctx->strm.avail_out = out_size;
 
     status = inflate(&ctx->strm, Z_NO_FLUSH);
     if (status == Z_OK || status == Z_STREAM_END) {
-      size_t inflated_size =
-        ctx->inflateBufferSize - ctx->strm.avail_out;
-      untar_succesful = Untar_FromChunk_Print(&ctx->base,
-        ctx->inflateBuffer, inflated_size, NULL);
+      size_t inflated_size = out_size - ctx->strm.avail_out;
+      if (ctx->base.pipeline != NULL) {
+        untar_succesful = Untar_ChunkContext_Put_buffer(&ctx->base,
+          inflated_size);
+      } else {
+        untar_succesful = Untar_FromChunk_Print(&ctx->base,
+          out, inflated_size, NULL);
+      }
       if (untar_succesful != UNTAR_SUCCESSFUL){
         return untar_succesful;
       }
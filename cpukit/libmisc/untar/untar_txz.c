@@ -29,8 +29,78 @@
 #include "config.h"
 #endif
 
+#include <stdlib.h>
+#include <string.h>
+
+#include <rtems.h>
+#include <rtems/thread.h>
 #include <rtems/untar.h>
 
+#define TAR_XZ_INFLATE_BUFFER_SIZE (64 * 1024)
+
+/*
+ * Ring of slots between the decoder tasks and the task which extracts the
+ * files.  Block i is decoded into slot i % slot_count.  A decoder task takes
+ * the next block only if its slot was consumed, so that the blocks are
+ * extracted in order while up to slot_count blocks are decoded ahead.
+ */
+typedef struct {
+  bool                      ready;
+  enum xz_ret               status;
+} Untar_XzSlot;
+
+typedef struct {
+  rtems_mutex               mutex;
+  rtems_condition_variable  changed;
+  rtems_counting_semaphore  done;
+  const uint8_t            *in;
+  const struct xz_block    *blocks;
+  size_t                    block_count;
+  size_t                    next;
+  size_t                    consumed;
+  bool                      stop;
+  Untar_XzSlot             *slots;
+  size_t                    slot_count;
+  size_t                    slot_size;
+  uint8_t                  *slot_buffers;
+} Untar_XzParallel;
+
+typedef struct {
+  Untar_XzParallel         *parallel;
+  struct xz_dec            *strm;
+  rtems_id                  task;
+} Untar_XzWorker;
+
+static void Untar_XzPrintError(enum xz_ret status, const rtems_printer *printer)
+{
+  switch (status) {
+  case XZ_OK:
+  case XZ_STREAM_END:
+    break;
+  case XZ_UNSUPPORTED_CHECK:
+    rtems_printf(printer, "XZ unsupported check\n");
+    break;
+  case XZ_MEM_ERROR:
+    rtems_printf(printer, "XZ memory allocation error\n");
+    break;
+  case XZ_MEMLIMIT_ERROR:
+    rtems_printf(printer, "XZ memory usage limit reached\n");
+    break;
+  case XZ_FORMAT_ERROR:
+    rtems_printf(printer, "Not a XZ file\n");
+    break;
+  case XZ_OPTIONS_ERROR:
+    rtems_printf(printer, "Unsupported options in XZ header\n");
+    break;
+  case XZ_DATA_ERROR:
+    rtems_printf(printer, "XZ file is corrupt (data)\n");
+    break;
+  case XZ_BUF_ERROR:
+    rtems_printf(printer, "XZ file is corrupt (buffer)\n");
+    break;
+  }
+}
+
 int Untar_XzChunkContext_Init(
   Untar_XzChunkContext *ctx,
   enum xz_mode mode,
@@ -54,6 +124,28 @@ int Untar_XzChunkContext_Init(
   return status;
 }
 
+int Untar_XzChunkContext_Init_pool(
+  Untar_XzChunkContext *ctx,
+  struct xz_dict_pool *pool,
+  void *inflateBuffer,
+  size_t inflateBufferSize
+)
+{
+  int status = UNTAR_SUCCESSFUL;
+
+  xz_crc32_init();
+
+  Untar_ChunkContext_Init(&ctx->base);
+  ctx->inflateBuffer = inflateBuffer;
+  ctx->inflateBufferSize = inflateBufferSize;
+  ctx->strm = xz_dec_init_pool(pool);
+  if (ctx->strm == NULL) {
+    status = UNTAR_FAIL;
+  }
+
+  return status;
+}
+
 int Untar_FromXzChunk_Print(
   Untar_XzChunkContext *ctx,
   const void *chunk,
@@ -71,19 +163,30 @@ int Untar_FromXzChunk_Print(
   ctx->buf.in_pos = 0;
   ctx->buf.in_size = chunk_size;
   ctx->buf.out = (uint8_t *) ctx->inflateBuffer;
+  ctx->buf.out_size = ctx->inflateBufferSize;
 
   /* Inflate until output buffer is not full */
   do {
+    /* With a pipeline, inflate directly into the ring buffers */
+    if (ctx->base.pipeline != NULL) {
+      ctx->buf.out = (uint8_t *) Untar_ChunkContext_Get_buffer(&ctx->base,
+                                                   &ctx->buf.out_size);
+    }
     ctx->buf.out_pos = 0;
-    ctx->buf.out_size = ctx->inflateBufferSize;
     status = xz_dec_run(ctx->strm, &ctx->buf);
     if (status == XZ_OPTIONS_ERROR)
       status = XZ_OK;
-    if (status == XZ_OK && ctx->buf.out_pos != 0) {
-      untar_status = Untar_FromChunk_Print(&ctx->base,
-                                           ctx->inflateBuffer,
-                                           ctx->buf.out_pos,
-                                           NULL);
+    if ((status == XZ_OK || status == XZ_STREAM_END) &&
+        ctx->buf.out_pos != 0) {
+      if (ctx->base.pipeline != NULL) {
+        untar_status = Untar_ChunkContext_Put_buffer(&ctx->base,
+                                                     ctx->buf.out_pos);
+      } else {
+        untar_status = Untar_FromChunk_Print(&ctx->base,
+                                             ctx->inflateBuffer,
+                                             ctx->buf.out_pos,
+                                             NULL);
+      }
       if (untar_status != UNTAR_SUCCESSFUL) {
         break;
       }
@@ -93,36 +196,338 @@ int Untar_FromXzChunk_Print(
   if (status != XZ_OK) {
     xz_dec_end(ctx->strm);
     ctx->strm = NULL;
-    if (untar_status == UNTAR_SUCCESSFUL) {
-      switch (status) {
-      case XZ_OK:
-      case XZ_STREAM_END:
-        break;
-      case XZ_UNSUPPORTED_CHECK:
-        rtems_printf(printer, "XZ unsupported check\n");
-        break;
-      case XZ_MEM_ERROR:
-        rtems_printf(printer, "XZ memory allocation error\n");
-        break;
-      case XZ_MEMLIMIT_ERROR:
-        rtems_printf(printer, "XZ memory usage limit reached\n");
-        break;
-      case XZ_FORMAT_ERROR:
-        rtems_printf(printer, "Not a XZ file\n");
-        break;
-      case XZ_OPTIONS_ERROR:
-        rtems_printf(printer, "Unsupported options in XZ header\n");
-        break;
-      case XZ_DATA_ERROR:
-        rtems_printf(printer, "XZ file is corrupt (data)\n");
-        break;
-      case XZ_BUF_ERROR:
-        rtems_printf(printer, "XZ file is corrupt (buffer)\n");
-        break;
-      }
+    if (untar_status == UNTAR_SUCCESSFUL && status != XZ_STREAM_END) {
+      Untar_XzPrintError(status, printer);
       untar_status = UNTAR_FAIL;
     }
   }
 
   return untar_status;
 }
+
+static rtems_task Untar_XzDecoder(rtems_task_argument arg)
+{
+  Untar_XzWorker *worker;
+  Untar_XzParallel *parallel;
+  size_t i;
+  size_t slot;
+  enum xz_ret status;
+
+  worker = (Untar_XzWorker *) arg;
+  parallel = worker->parallel;
+
+  rtems_mutex_lock(&parallel->mutex);
+
+  while (true) {
+    while (!parallel->stop && parallel->next < parallel->block_count &&
+           parallel->next - parallel->consumed >= parallel->slot_count) {
+      rtems_condition_variable_wait(&parallel->changed, &parallel->mutex);
+    }
+
+    if (parallel->stop || parallel->next >= parallel->block_count) {
+      break;
+    }
+
+    i = parallel->next;
+    ++parallel->next;
+    rtems_mutex_unlock(&parallel->mutex);
+
+    slot = i % parallel->slot_count;
+    status = xz_dec_block(
+      worker->strm,
+      parallel->in,
+      &parallel->blocks[i],
+      &parallel->slot_buffers[slot * parallel->slot_size]
+    );
+
+    rtems_mutex_lock(&parallel->mutex);
+    parallel->slots[slot].status = status;
+    parallel->slots[slot].ready = true;
+    rtems_condition_variable_broadcast(&parallel->changed);
+  }
+
+  rtems_mutex_unlock(&parallel->mutex);
+  rtems_counting_semaphore_post(&parallel->done);
+  rtems_task_exit();
+}
+
+/*
+ * Decodes the streams one after the other on the calling task.  This is used
+ * for concatenated streams and for streams with only one block.
+ */
+static int Untar_FromXzMemory_Sequential(
+  const uint8_t *in,
+  size_t size,
+  struct xz_dict_pool *pool,
+  const rtems_printer *printer
+)
+{
+  Untar_XzChunkContext ctx;
+  void *buffer;
+  size_t offset;
+  int status;
+
+  buffer = malloc(TAR_XZ_INFLATE_BUFFER_SIZE);
+  if (buffer == NULL) {
+    return UNTAR_FAIL;
+  }
+
+  offset = 0;
+  status = Untar_XzChunkContext_Init_pool(
+    &ctx,
+    pool,
+    buffer,
+    TAR_XZ_INFLATE_BUFFER_SIZE
+  );
+
+  while (status == UNTAR_SUCCESSFUL) {
+    status = Untar_FromXzChunk_Print(
+      &ctx,
+      &in[offset],
+      size - offset,
+      printer
+    );
+
+    /* The decoder is ended at the end of the stream and on errors */
+    if (ctx.strm != NULL) {
+      xz_dec_end(ctx.strm);
+      if (status == UNTAR_SUCCESSFUL) {
+        rtems_printf(printer, "XZ file is truncated\n");
+        status = UNTAR_FAIL;
+      }
+      break;
+    }
+
+    if (status != UNTAR_SUCCESSFUL) {
+      break;
+    }
+
+    /* Skip the stream padding */
+    offset += ctx.buf.in_pos;
+    while (offset < size && in[offset] == 0) {
+      ++offset;
+    }
+
+    if (offset == size) {
+      break;
+    }
+
+    ctx.strm = xz_dec_init_pool(pool);
+    if (ctx.strm == NULL) {
+      status = UNTAR_FAIL;
+    }
+  }
+
+  free(buffer);
+  return status;
+}
+
+int Untar_FromXzMemory_Parallel(
+  const void *xz_buf,
+  size_t size,
+  struct xz_dict_pool *pool,
+  uint32_t worker_count,
+  rtems_task_priority priority,
+  size_t stack_size,
+  size_t slot_memory_max,
+  const rtems_printer *printer
+)
+{
+  Untar_XzParallel parallel;
+  Untar_XzWorker *workers;
+  Untar_ChunkContext ctx;
+  struct xz_block *blocks;
+  size_t block_count;
+  uint32_t started;
+  uint32_t w;
+  size_t i;
+  enum xz_ret xz_status;
+  rtems_status_code sc;
+  int status;
+
+  if (worker_count == 0) {
+    return UNTAR_FAIL;
+  }
+
+  xz_crc32_init();
+
+  xz_status = xz_dec_index(xz_buf, size, NULL, &block_count);
+  if (xz_status == XZ_OPTIONS_ERROR || (xz_status == XZ_OK &&
+      block_count <= 1)) {
+    return Untar_FromXzMemory_Sequential(xz_buf, size, pool, printer);
+  }
+
+  if (xz_status != XZ_OK) {
+    Untar_XzPrintError(xz_status, printer);
+    return UNTAR_FAIL;
+  }
+
+  blocks = calloc(block_count, sizeof(*blocks));
+  if (blocks == NULL) {
+    return UNTAR_FAIL;
+  }
+
+  (void) xz_dec_index(xz_buf, size, blocks, &block_count);
+
+  memset(&parallel, 0, sizeof(parallel));
+  parallel.in = xz_buf;
+  parallel.blocks = blocks;
+  parallel.block_count = block_count;
+
+  for (i = 0; i < block_count; ++i) {
+    if (blocks[i].uncompressed_size > parallel.slot_size) {
+      parallel.slot_size = blocks[i].uncompressed_size;
+    }
+  }
+
+  /*
+   * Use less slots if the ring would exceed the memory limit.  A decoder
+   * task without a slot would only wait, so there are no more decoder tasks
+   * than slots.  If not even one block fits, then decode on the calling task
+   * which needs only the inflate buffer.
+   */
+  if (parallel.slot_size == 0 ||
+      slot_memory_max / parallel.slot_size == 0) {
+    free(blocks);
+    return Untar_FromXzMemory_Sequential(xz_buf, size, pool, printer);
+  }
+
+  if (worker_count > block_count) {
+    worker_count = (uint32_t) block_count;
+  }
+
+  parallel.slot_count = 2 * (size_t) worker_count;
+  if (parallel.slot_count > slot_memory_max / parallel.slot_size) {
+    parallel.slot_count = slot_memory_max / parallel.slot_size;
+  }
+
+  if (worker_count > parallel.slot_count) {
+    worker_count = (uint32_t) parallel.slot_count;
+  }
+
+  workers = calloc(worker_count, sizeof(*workers));
+  if (workers == NULL) {
+    free(blocks);
+    return UNTAR_FAIL;
+  }
+
+  /* Each decoder needs a dictionary of the pool */
+  for (w = 0; w < worker_count; ++w) {
+    workers[w].parallel = &parallel;
+    workers[w].strm = xz_dec_init_pool(pool);
+    if (workers[w].strm == NULL) {
+      break;
+    }
+  }
+
+  worker_count = w;
+
+  if (worker_count > 0) {
+    parallel.slots = calloc(parallel.slot_count, sizeof(*parallel.slots));
+    parallel.slot_buffers = malloc(parallel.slot_count * parallel.slot_size);
+  }
+
+  if (worker_count == 0 || parallel.slots == NULL ||
+      parallel.slot_buffers == NULL) {
+    for (w = 0; w < worker_count; ++w) {
+      xz_dec_end(workers[w].strm);
+    }
+    free(parallel.slot_buffers);
+    free(parallel.slots);
+    free(workers);
+    free(blocks);
+    return UNTAR_FAIL;
+  }
+
+  rtems_mutex_init(&parallel.mutex, "Untar");
+  rtems_condition_variable_init(&parallel.changed, "Untar");
+  rtems_counting_semaphore_init(&parallel.done, "Untar", 0);
+
+  for (started = 0; started < worker_count; ++started) {
+    sc = rtems_task_create(
+      rtems_build_name('U', 'T', 'X', 'Z'),
+      priority,
+      stack_size,
+      RTEMS_DEFAULT_MODES,
+      RTEMS_DEFAULT_ATTRIBUTES,
+      &workers[started].task
+    );
+    if (sc != RTEMS_SUCCESSFUL) {
+      break;
+    }
+
+    sc = rtems_task_start(
+      workers[started].task,
+      Untar_XzDecoder,
+      (rtems_task_argument) &workers[started]
+    );
+    if (sc != RTEMS_SUCCESSFUL) {
+      (void) rtems_task_delete(workers[started].task);
+      break;
+    }
+  }
+
+  status = started > 0 ? UNTAR_SUCCESSFUL : UNTAR_FAIL;
+  Untar_ChunkContext_Init(&ctx);
+
+  /* Extract the blocks in order while the decoder tasks work ahead */
+  for (i = 0; i < block_count && status == UNTAR_SUCCESSFUL; ++i) {
+    Untar_XzSlot *slot;
+
+    slot = &parallel.slots[i % parallel.slot_count];
+
+    rtems_mutex_lock(&parallel.mutex);
+    while (!slot->ready) {
+      rtems_condition_variable_wait(&parallel.changed, &parallel.mutex);
+    }
+    xz_status = slot->status;
+    rtems_mutex_unlock(&parallel.mutex);
+
+    if (xz_status != XZ_STREAM_END) {
+      /* The decoder stopped before the end of the block */
+      if (xz_status == XZ_OK) {
+        rtems_printf(printer, "XZ block is truncated\n");
+      } else {
+        Untar_XzPrintError(xz_status, printer);
+      }
+      status = UNTAR_FAIL;
+      break;
+    }
+
+    status = Untar_FromChunk_Print(
+      &ctx,
+      &parallel.slot_buffers[(i % parallel.slot_count) * parallel.slot_size],
+      blocks[i].uncompressed_size,
+      printer
+    );
+
+    rtems_mutex_lock(&parallel.mutex);
+    slot->ready = false;
+    ++parallel.consumed;
+    rtems_condition_variable_broadcast(&parallel.changed);
+    rtems_mutex_unlock(&parallel.mutex);
+  }
+
+  rtems_mutex_lock(&parallel.mutex);
+  parallel.stop = true;
+  rtems_condition_variable_broadcast(&parallel.changed);
+  rtems_mutex_unlock(&parallel.mutex);
+
+  for (w = 0; w < started; ++w) {
+    rtems_counting_semaphore_wait(&parallel.done);
+  }
+
+  for (w = 0; w < worker_count; ++w) {
+    xz_dec_end(workers[w].strm);
+  }
+
+  rtems_counting_semaphore_destroy(&parallel.done);
+  rtems_condition_variable_destroy(&parallel.changed);
+  rtems_mutex_destroy(&parallel.mutex);
+  free(parallel.slot_buffers);
+  free(parallel.slots);
+  free(workers);
+  free(blocks);
+
+  return status;
+}
@@ -0,0 +1,284 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/*
+ * Copyright (C) 2026 On-Line Applications Research Corporation (OAR)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * Random access to the Blocks of a .xz Stream
+ *
+ * The Blocks of a .xz Stream are independent of each other. Their
+ * locations are given by the Index at the end of the Stream. A single
+ * Block is decoded by feeding the Stream decoder a synthetic Stream made
+ * of the original Stream Header, the Block, and an Index and Stream Footer
+ * describing only this Block. This keeps all integrity checks of the
+ * Stream decoder in place.
+ */
+
+#include "xz_private.h"
+#include "xz_stream.h"
+
+#define STREAM_FOOTER_SIZE 12
+
+/* Index Indicator, Number of Records, one Record, Padding, and CRC32 */
+#define BLOCK_INDEX_SIZE_MAX (1 + 1 + 2 * VLI_BYTES_MAX + 3 + 4)
+
+static enum xz_ret get_vli(const uint8_t *in, size_t *in_pos, size_t in_size,
+			   vli_type *vli)
+{
+	uint32_t shift = 0;
+	uint8_t byte;
+
+	*vli = 0;
+
+	while (*in_pos < in_size) {
+		byte = in[*in_pos];
+		++*in_pos;
+
+		*vli |= (vli_type)(byte & 0x7F) << shift;
+
+		if ((byte & 0x80) == 0) {
+			/* Don't allow non-minimal encodings. */
+			if (byte == 0 && shift != 0)
+				return XZ_DATA_ERROR;
+
+			return XZ_OK;
+		}
+
+		shift += 7;
+		if (shift == 7 * VLI_BYTES_MAX)
+			return XZ_DATA_ERROR;
+	}
+
+	return XZ_DATA_ERROR;
+}
+
+static size_t put_vli(uint8_t *out, vli_type vli)
+{
+	size_t i = 0;
+
+	while (vli >= 0x80) {
+		out[i++] = (uint8_t)vli | 0x80;
+		vli >>= 7;
+	}
+
+	out[i++] = (uint8_t)vli;
+	return i;
+}
+
+static bool size_is_valid(vli_type vli)
+{
+	return vli <= VLI_MAX && vli == (vli_type)(size_t)vli;
+}
+
+XZ_EXTERN enum xz_ret xz_dec_index(const uint8_t *in, size_t in_size,
+				   struct xz_block *blocks, size_t *count)
+{
+	const uint8_t *footer;
+	size_t backward_size;
+	size_t index_start;
+	size_t index_pos;
+	size_t index_end;
+	size_t block_pos;
+	size_t out_pos;
+	vli_type records;
+	vli_type unpadded;
+	vli_type uncompressed;
+	size_t i;
+	enum xz_ret ret;
+
+	/* Skip the Stream Padding */
+	while (in_size >= STREAM_HEADER_SIZE + STREAM_FOOTER_SIZE + 4
+			&& in_size % 4 == 0
+			&& get_le32(in + in_size - 4) == 0)
+		in_size -= 4;
+
+	if (in_size < STREAM_HEADER_SIZE + STREAM_FOOTER_SIZE
+			|| !memeq(in, HEADER_MAGIC, HEADER_MAGIC_SIZE))
+		return XZ_FORMAT_ERROR;
+
+	if (xz_crc32(in + HEADER_MAGIC_SIZE, 2, 0)
+			!= get_le32(in + HEADER_MAGIC_SIZE + 2))
+		return XZ_DATA_ERROR;
+
+	footer = in + in_size - STREAM_FOOTER_SIZE;
+
+	if (!memeq(footer + 10, FOOTER_MAGIC, FOOTER_MAGIC_SIZE))
+		return XZ_DATA_ERROR;
+
+	if (xz_crc32(footer + 4, 6, 0) != get_le32(footer))
+		return XZ_DATA_ERROR;
+
+	if (!memeq(footer + 8, in + HEADER_MAGIC_SIZE, 2))
+		return XZ_DATA_ERROR;
+
+	backward_size = ((size_t)get_le32(footer + 4) + 1) * 4;
+	if (backward_size > in_size - STREAM_HEADER_SIZE - STREAM_FOOTER_SIZE)
+		return XZ_DATA_ERROR;
+
+	index_end = in_size - STREAM_FOOTER_SIZE;
+	index_start = index_end - backward_size;
+	index_pos = index_start;
+
+	if (xz_crc32(in + index_pos, backward_size - 4, 0)
+			!= get_le32(in + index_end - 4))
+		return XZ_DATA_ERROR;
+
+	index_end -= 4;
+
+	if (in[index_pos] != 0x00)
+		return XZ_DATA_ERROR;
+
+	++index_pos;
+
+	ret = get_vli(in, &index_pos, index_end, &records);
+	if (ret != XZ_OK)
+		return ret;
+
+	if (blocks != NULL && records > *count)
+		return XZ_BUF_ERROR;
+
+	block_pos = STREAM_HEADER_SIZE;
+	out_pos = 0;
+
+	for (i = 0; i < records; ++i) {
+		ret = get_vli(in, &index_pos, index_end, &unpadded);
+		if (ret != XZ_OK)
+			return ret;
+
+		ret = get_vli(in, &index_pos, index_end, &uncompressed);
+		if (ret != XZ_OK)
+			return ret;
+
+		if (!size_is_valid(unpadded) || !size_is_valid(uncompressed)
+				|| (size_t)uncompressed > SIZE_MAX - out_pos)
+			return XZ_MEMLIMIT_ERROR;
+
+		if (unpadded == 0 || unpadded > index_start - block_pos)
+			return XZ_DATA_ERROR;
+
+		if (blocks != NULL) {
+			blocks[i].in_pos = block_pos;
+			blocks[i].unpadded_size = (size_t)unpadded;
+			blocks[i].uncompressed_size = (size_t)uncompressed;
+			blocks[i].out_pos = out_pos;
+		}
+
+		block_pos += ((size_t)unpadded + 3) & ~(size_t)3;
+		out_pos += (size_t)uncompressed;
+
+		if (block_pos > index_start)
+			return XZ_DATA_ERROR;
+	}
+
+	/* Index Padding */
+	while (index_pos < index_end) {
+		if (in[index_pos] != 0x00)
+			return XZ_DATA_ERROR;
+
+		++index_pos;
+	}
+
+	/*
+	 * The Blocks are followed directly by the Index. If there is data
+	 * in front of the Blocks, then this is the last Stream of
+	 * concatenated Streams.
+	 */
+	if (block_pos != index_start)
+		return XZ_OPTIONS_ERROR;
+
+	*count = (size_t)records;
+	return XZ_OK;
+}
+
+static enum xz_ret dec_feed(struct xz_dec *s, struct xz_buf *b,
+			    const uint8_t *in, size_t in_size)
+{
+	enum xz_ret ret;
+
+	b->in = in;
+	b->in_pos = 0;
+	b->in_size = in_size;
+
+	do {
+		ret = xz_dec_run(s, b);
+	} while (ret == XZ_OK && b->in_pos < b->in_size);
+
+	return ret;
+}
+
+XZ_EXTERN enum xz_ret xz_dec_block(struct xz_dec *s, const uint8_t *in,
+				   const struct xz_block *block, uint8_t *out)
+{
+	uint8_t index[BLOCK_INDEX_SIZE_MAX];
+	uint8_t footer[STREAM_FOOTER_SIZE];
+	struct xz_buf b;
+	size_t index_size;
+	enum xz_ret ret;
+
+	index[0] = 0x00;
+	index[1] = 0x01;
+	index_size = 2;
+	index_size += put_vli(index + index_size, block->unpadded_size);
+	index_size += put_vli(index + index_size, block->uncompressed_size);
+
+	while (index_size % 4 != 0)
+		index[index_size++] = 0x00;
+
+	put_unaligned_le32(xz_crc32(index, index_size, 0), index + index_size);
+	index_size += 4;
+
+	put_unaligned_le32(index_size / 4 - 1, footer + 4);
+	memcpy(footer + 8, in + HEADER_MAGIC_SIZE, 2);
+	put_unaligned_le32(xz_crc32(footer + 4, 6, 0), footer);
+	memcpy(footer + 10, FOOTER_MAGIC, FOOTER_MAGIC_SIZE);
+
+	xz_dec_reset(s);
+
+	b.out = out;
+	b.out_pos = 0;
+	b.out_size = block->uncompressed_size;
+
+	ret = dec_feed(s, &b, in, STREAM_HEADER_SIZE);
+	if (ret != XZ_OK)
+		return ret;
+
+	ret = dec_feed(s, &b, in + block->in_pos,
+		       (block->unpadded_size + 3) & ~(size_t)3);
+	if (ret != XZ_OK)
+		return ret;
+
+	ret = dec_feed(s, &b, index, index_size);
+	if (ret != XZ_OK)
+		return ret;
+
+	ret = dec_feed(s, &b, footer, sizeof(footer));
+	if (ret == XZ_OK)
+		ret = XZ_DATA_ERROR;
+
+	if (ret == XZ_STREAM_END && b.out_pos != block->uncompressed_size)
+		ret = XZ_DATA_ERROR;
+
+	return ret;
+}
@@ -87,6 +87,12 @@ struct dictionary {
 	 */
 	uint32_t allocated;
 
+	/*
+	 * Pool which provided the dictionary buffer or NULL. This is used
+	 * only with XZ_PREALLOC.
+	 */
+	struct xz_dict_pool *pool;
+
 	/* Operation mode */
 	enum xz_mode mode;
 };
@@ -1121,6 +1127,7 @@ XZ_EXTERN struct xz_dec_lzma2 *xz_dec_lzma2_create(enum xz_mode mode,
 
 	s->dict.mode = mode;
 	s->dict.size_max = dict_max;
+	s->dict.pool = NULL;
 
 	if (DEC_IS_PREALLOC(mode)) {
 		s->dict.buf = vmalloc(dict_max);
@@ -1136,6 +1143,28 @@ XZ_EXTERN struct xz_dec_lzma2 *xz_dec_lzma2_create(enum xz_mode mode,
 	return s;
 }
 
+#ifdef XZ_DEC_PREALLOC
+XZ_EXTERN struct xz_dec_lzma2 *xz_dec_lzma2_create_pool(
+		struct xz_dict_pool *pool)
+{
+	struct xz_dec_lzma2 *s = kmalloc(sizeof(*s), GFP_KERNEL);
+	if (s == NULL)
+		return NULL;
+
+	s->dict.buf = xz_dict_pool_get(pool);
+	if (s->dict.buf == NULL) {
+		kfree(s);
+		return NULL;
+	}
+
+	s->dict.mode = XZ_PREALLOC;
+	s->dict.size_max = xz_dict_pool_dict_size(pool);
+	s->dict.pool = pool;
+
+	return s;
+}
+#endif
+
 XZ_EXTERN enum xz_ret xz_dec_lzma2_reset(struct xz_dec_lzma2 *s, uint8_t props)
 {
 	/* This limits dictionary size to 3 GiB to keep parsing simpler. */
@@ -1175,6 +1204,11 @@ XZ_EXTERN enum xz_ret xz_dec_lzma2_reset(struct xz_dec_lzma2 *s, uint8_t props)
 
 XZ_EXTERN void xz_dec_lzma2_end(struct xz_dec_lzma2 *s)
 {
+#ifdef XZ_DEC_PREALLOC
+	if (DEC_IS_PREALLOC(s->dict.mode) && s->dict.pool != NULL)
+		xz_dict_pool_put(s->dict.pool, s->dict.buf);
+	else
+#endif
 	if (DEC_IS_MULTI(s->dict.mode))
 		vfree(s->dict.buf);
 
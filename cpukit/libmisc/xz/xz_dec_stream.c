@@ -793,7 +793,8 @@ XZ_EXTERN enum xz_ret xz_dec_run(struct xz_dec *s, struct xz_buf *b)
 	return ret;
 }
 
-XZ_EXTERN struct xz_dec *xz_dec_init(enum xz_mode mode, uint32_t dict_max)
+static struct xz_dec *dec_init(enum xz_mode mode, uint32_t dict_max,
+			       struct xz_dict_pool *pool)
 {
 	struct xz_dec *s = kmalloc(sizeof(*s), GFP_KERNEL);
 	if (s == NULL)
@@ -807,7 +808,13 @@ XZ_EXTERN struct xz_dec *xz_dec_init(enum xz_mode mode, uint32_t dict_max)
 		goto error_bcj;
 #endif
 
-	s->lzma2 = xz_dec_lzma2_create(mode, dict_max);
+#ifdef XZ_DEC_PREALLOC
+	if (pool != NULL)
+		s->lzma2 = xz_dec_lzma2_create_pool(pool);
+	else
+#endif
+		s->lzma2 = xz_dec_lzma2_create(mode, dict_max);
+
 	if (s->lzma2 == NULL)
 		goto error_lzma2;
 
@@ -823,6 +830,18 @@ error_bcj:
 	return NULL;
 }
 
+XZ_EXTERN struct xz_dec *xz_dec_init(enum xz_mode mode, uint32_t dict_max)
+{
+	return dec_init(mode, dict_max, NULL);
+}
+
+#ifdef XZ_DEC_PREALLOC
+XZ_EXTERN struct xz_dec *xz_dec_init_pool(struct xz_dict_pool *pool)
+{
+	return dec_init(XZ_PREALLOC, 0, pool);
+}
+#endif
+
 XZ_EXTERN void xz_dec_reset(struct xz_dec *s)
 {
 	s->sequence = SEQ_STREAM_HEADER;
@@ -0,0 +1,120 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/*
+ * Copyright (C) 2026 On-Line Applications Research Corporation (OAR)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * Pool of LZMA2 dictionary buffers
+ *
+ * The buffers are carved out of one allocation, so that creating and
+ * freeing decoders does not fragment the heap with large blocks. The free
+ * buffers are kept on a stack protected by a mutex, so that the pool can
+ * be shared by decoders running in different tasks.
+ */
+
+#include <rtems/thread.h>
+
+#include "xz_private.h"
+
+/* The pool is only used by decoders in XZ_PREALLOC mode */
+#ifdef XZ_DEC_PREALLOC
+
+struct xz_dict_pool {
+	rtems_mutex mutex;
+	uint32_t dict_size;
+	unsigned int free_count;
+	uint8_t *bufs;
+	uint8_t *free[];
+};
+
+XZ_EXTERN struct xz_dict_pool *xz_dict_pool_create(uint32_t dict_size,
+						   unsigned int count)
+{
+	struct xz_dict_pool *pool;
+	unsigned int i;
+
+	if (dict_size == 0 || count == 0
+			|| (size_t)count > SIZE_MAX / dict_size)
+		return NULL;
+
+	pool = kmalloc(sizeof(*pool) + count * sizeof(pool->free[0]),
+		       GFP_KERNEL);
+	if (pool == NULL)
+		return NULL;
+
+	pool->bufs = vmalloc((size_t)count * dict_size);
+	if (pool->bufs == NULL) {
+		kfree(pool);
+		return NULL;
+	}
+
+	rtems_mutex_init(&pool->mutex, "XZ Dictionary Pool");
+	pool->dict_size = dict_size;
+	pool->free_count = count;
+
+	for (i = 0; i < count; ++i)
+		pool->free[i] = pool->bufs + (size_t)(count - 1 - i) * dict_size;
+
+	return pool;
+}
+
+XZ_EXTERN void xz_dict_pool_destroy(struct xz_dict_pool *pool)
+{
+	if (pool != NULL) {
+		rtems_mutex_destroy(&pool->mutex);
+		vfree(pool->bufs);
+		kfree(pool);
+	}
+}
+
+XZ_EXTERN uint8_t *xz_dict_pool_get(struct xz_dict_pool *pool)
+{
+	uint8_t *buf = NULL;
+
+	rtems_mutex_lock(&pool->mutex);
+
+	if (pool->free_count > 0) {
+		--pool->free_count;
+		buf = pool->free[pool->free_count];
+	}
+
+	rtems_mutex_unlock(&pool->mutex);
+	return buf;
+}
+
+XZ_EXTERN void xz_dict_pool_put(struct xz_dict_pool *pool, uint8_t *buf)
+{
+	rtems_mutex_lock(&pool->mutex);
+	pool->free[pool->free_count] = buf;
+	++pool->free_count;
+	rtems_mutex_unlock(&pool->mutex);
+}
+
+XZ_EXTERN uint32_t xz_dict_pool_dict_size(const struct xz_dict_pool *pool)
+{
+	return pool->dict_size;
+}
+
+#endif /* XZ_DEC_PREALLOC */
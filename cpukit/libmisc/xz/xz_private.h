@@ -109,6 +109,25 @@
 XZ_EXTERN struct xz_dec_lzma2 *xz_dec_lzma2_create(enum xz_mode mode,
 						   uint32_t dict_max);
 
+#ifdef XZ_DEC_PREALLOC
+/*
+ * Allocate memory for LZMA2 decoder in XZ_PREALLOC mode. The dictionary
+ * buffer is taken from the pool and given back by xz_dec_lzma2_end().
+ * NULL is returned if the pool has no free dictionary buffer.
+ */
+XZ_EXTERN struct xz_dec_lzma2 *xz_dec_lzma2_create_pool(
+		struct xz_dict_pool *pool);
+
+/* Take a dictionary buffer from the pool. Return NULL if none is free. */
+XZ_EXTERN uint8_t *xz_dict_pool_get(struct xz_dict_pool *pool);
+
+/* Give a dictionary buffer back to the pool. */
+XZ_EXTERN void xz_dict_pool_put(struct xz_dict_pool *pool, uint8_t *buf);
+
+/* Get the size of the dictionary buffers of the pool. */
+XZ_EXTERN uint32_t xz_dict_pool_dict_size(const struct xz_dict_pool *pool);
+#endif
+
 /*
  * Decode the LZMA2 properties (one byte) and reset the decoder. Return
  * XZ_OK on success, XZ_MEMLIMIT_ERROR if the preallocated dictionary is not
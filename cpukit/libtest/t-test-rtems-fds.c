@@ -34,20 +34,7 @@ static int T_open_fds;
 static int
 T_count_open_fds(void)
 {
-	int free_count;
-	rtems_libio_t *iop;
-
-	free_count = 0;
-	rtems_libio_lock();
-
-	iop = rtems_libio_iop_free_head;
-	while (iop != NULL) {
-		++free_count;
-		iop = iop->data1;
-	}
-
-	rtems_libio_unlock();
-	return (int)rtems_libio_number_iops - free_count;
+	return (int)rtems_libio_number_iops - (int)rtems_libio_count_free();
 }
 
 static void
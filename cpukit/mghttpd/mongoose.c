@@ -23,6 +23,8 @@
 #endif
 
 #if defined(__rtems__)
+#include <sys/mman.h>
+#include <rtems/libio_.h>
 #include <md5.h>
 #define HAVE_MD5
 #define NO_CGI
@@ -475,7 +477,7 @@ enum {
   GLOBAL_PASSWORDS_FILE, INDEX_FILES, ENABLE_KEEP_ALIVE, ACCESS_CONTROL_LIST,
   EXTRA_MIME_TYPES, LISTENING_PORTS, DOCUMENT_ROOT, SSL_CERTIFICATE,
   NUM_THREADS, RUN_AS_USER, REWRITE, HIDE_FILES, REQUEST_TIMEOUT,
-  THREAD_STACK_SIZE, THREAD_PRIORITY, THREAD_POLICY,
+  THREAD_STACK_SIZE, THREAD_PRIORITY, THREAD_POLICY, ENABLE_EVENT_LOOP,
   NUM_OPTIONS
 };
 
@@ -508,6 +510,7 @@ static const char *config_options[] = {
   "thread_stack_size", NULL,
   "thread_priority", NULL,
   "thread_policy", NULL,
+  "enable_event_loop", "no",
   NULL
 };
 
@@ -530,6 +533,13 @@ struct mg_context {
   volatile int sq_tail;      // Tail of the socket queue
   pthread_cond_t sq_full;    // Signaled when socket is produced
   pthread_cond_t sq_empty;   // Signaled when socket is consumed
+
+  // In event loop mode, the master thread polls idle connections.
+  int event_loop;                   // Non-zero if event loop mode is enabled
+  SOCKET wakeup_sock;               // Loopback socket to wake up the master
+  struct mg_connection *ready_head; // Connections with pending input
+  struct mg_connection *ready_tail;
+  struct mg_connection *parking;    // Idle connections handed to the master
 };
 
 struct mg_connection {
@@ -552,6 +562,8 @@ struct mg_connection {
   int throttle;               // Throttling, bytes/sec. <= 0 means no throttle
   time_t last_throttle_time;  // Last time throttled data was sent
   int64_t last_throttle_bytes;// Bytes sent this second
+  struct mg_connection *next; // Next connection in event loop lists
+  time_t idle_time;           // Time when connection became idle
 };
 
 // Directory entry
@@ -2970,6 +2982,50 @@ static void handle_directory_request(struct mg_connection *conn,
   conn->status_code = 200;
 }
 
+#if defined(__rtems__)
+// Send len bytes from a shared mapping of the opened file. Only IMFS linear
+// files provide a mapping handler, the mapping references the file data, so
+// that the data is sent without copying it through a buffer. The mapping is
+// not tried for other files since mmap() would fail after an fstat() and
+// lseek() of the file.
+// Return 1 if the data was sent, 0 if the file cannot be mapped, or -1 if
+// the data could not be sent.
+static int send_mapped_file_data(struct mg_connection *conn,
+                                 struct file *filep,
+                                 int64_t offset, int64_t len) {
+  int fd = fileno(filep->fp);
+  long page_size = sysconf(_SC_PAGESIZE);
+  int64_t start;
+  int num_written;
+  size_t size;
+  char *p;
+
+  if (fd < 0 || page_size <= 0 || len > INT_MAX ||
+      rtems_libio_iop(fd)->pathinfo.handlers->mmap_h ==
+      rtems_filesystem_default_mmap) {
+    return 0;
+  }
+
+  start = offset - offset % page_size;
+  size = (size_t) (offset + len - start);
+  // RTEMS cannot protect memory and rejects read-only mappings
+  p = (char *) mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd,
+                    (off_t) start);
+  if (p == MAP_FAILED) {
+    return 0;
+  }
+
+  num_written = mg_write(conn, p + (offset - start), (size_t) len);
+  (void) munmap(p, size);
+
+  if (num_written > 0) {
+    conn->num_bytes_sent += num_written;
+  }
+
+  return num_written == (int) len ? 1 : -1;
+}
+#endif // __rtems__
+
 // Send len bytes from the opened file to the client.
 static void send_file_data(struct mg_connection *conn, struct file *filep,
                            int64_t offset, int64_t len) {
@@ -2985,6 +3041,14 @@ static void send_file_data(struct mg_connection *conn, struct file *filep,
     }
     mg_write(conn, filep->membuf + offset, (size_t) len);
   } else if (len > 0 && filep->fp != NULL) {
+    if (len > filep->size - offset) {
+      len = filep->size - offset;
+    }
+#if defined(__rtems__)
+    if (len > 0 && send_mapped_file_data(conn, filep, offset, len) != 0) {
+      return;
+    }
+#endif
     fseeko(filep->fp, offset, SEEK_SET);
     while (len > 0) {
       // Calculate how much to read from the file in the buffer
@@ -5156,61 +5220,179 @@ struct mg_connection *mg_download(const char *host, int port, int use_ssl,
   return conn;
 }
 
-static void process_new_connection(struct mg_connection *conn) {
+// Read and handle one request. Return non-zero if the connection should be
+// kept alive for the next request.
+static int process_request(struct mg_connection *conn) {
   struct mg_request_info *ri = &conn->request_info;
   int keep_alive_enabled, keep_alive, discard_len;
   char ebuf[100];
 
   keep_alive_enabled = !strcmp(conn->ctx->config[ENABLE_KEEP_ALIVE], "yes");
-  keep_alive = 0;
 
+  if (!getreq(conn, ebuf, sizeof(ebuf))) {
+    send_http_error(conn, 500, "Server Error", "%s", ebuf);
+    conn->must_close = 1;
+  } else if (!is_valid_uri(conn->request_info.uri)) {
+    snprintf(ebuf, sizeof(ebuf), "Invalid URI: [%s]", ri->uri);
+    send_http_error(conn, 400, "Bad Request", "%s", ebuf);
+  } else if (strcmp(ri->http_version, "1.0") &&
+             strcmp(ri->http_version, "1.1")) {
+    snprintf(ebuf, sizeof(ebuf), "Bad HTTP version: [%s]", ri->http_version);
+    send_http_error(conn, 505, "Bad HTTP version", "%s", ebuf);
+  }
+
+  if (ebuf[0] == '\0') {
+    handle_request(conn);
+    if (conn->ctx->callbacks.end_request != NULL) {
+      conn->ctx->callbacks.end_request(conn, conn->status_code);
+    }
+    log_access(conn);
+  }
+  if (ri->remote_user != NULL) {
+    free((void *) ri->remote_user);
+    // Important! When having connections with and without auth
+    // would cause double free and then crash
+    ri->remote_user = NULL;
+  }
+
+  // NOTE(lsm): order is important here. should_keep_alive() call
+  // is using parsed request, which will be invalid after memmove's below.
+  // Therefore, memorize should_keep_alive() result now for later use
+  // as the return value.
+  keep_alive = conn->ctx->stop_flag == 0 && keep_alive_enabled &&
+    conn->content_len >= 0 && should_keep_alive(conn);
+
+  // Discard all buffered data for this request
+  discard_len = conn->content_len >= 0 && conn->request_len > 0 &&
+    conn->request_len + conn->content_len < (int64_t) conn->data_len ?
+    (int) (conn->request_len + conn->content_len) : conn->data_len;
+  assert(discard_len >= 0);
+  memmove(conn->buf, conn->buf + discard_len, conn->data_len - discard_len);
+  conn->data_len -= discard_len;
+  assert(conn->data_len >= 0);
+  assert(conn->data_len <= conn->buf_size);
+
+  return keep_alive;
+}
+
+static void process_new_connection(struct mg_connection *conn) {
   // Important: on new connection, reset the receiving buffer. Credit goes
   // to crule42.
   conn->data_len = 0;
-  do {
-    if (!getreq(conn, ebuf, sizeof(ebuf))) {
-      send_http_error(conn, 500, "Server Error", "%s", ebuf);
-      conn->must_close = 1;
-    } else if (!is_valid_uri(conn->request_info.uri)) {
-      snprintf(ebuf, sizeof(ebuf), "Invalid URI: [%s]", ri->uri);
-      send_http_error(conn, 400, "Bad Request", "%s", ebuf);
-    } else if (strcmp(ri->http_version, "1.0") &&
-               strcmp(ri->http_version, "1.1")) {
-      snprintf(ebuf, sizeof(ebuf), "Bad HTTP version: [%s]", ri->http_version);
-      send_http_error(conn, 505, "Bad HTTP version", "%s", ebuf);
+  while (process_request(conn)) {
+  }
+}
+
+// Fill in IP, port info early so even if SSL setup fails, error handler
+// would have the corresponding info.
+// Thanks to Johannes Winkelmann for the patch.
+// TODO(lsm): Fix IPv6 case
+static void init_connection_info(struct mg_connection *conn) {
+  conn->birth_time = time(NULL);
+  conn->request_info.remote_port = ntohs(conn->client.rsa.sin.sin_port);
+  memcpy(&conn->request_info.remote_ip,
+         &conn->client.rsa.sin.sin_addr.s_addr, 4);
+  conn->request_info.remote_ip = ntohl(conn->request_info.remote_ip);
+  conn->request_info.is_ssl = conn->client.is_ssl;
+}
+
+// Event loop mode: master thread adds connection with pending input to the
+// ready list
+static void queue_connection(struct mg_context *ctx,
+                             struct mg_connection *conn) {
+  (void) pthread_mutex_lock(&ctx->mutex);
+  conn->next = NULL;
+  if (ctx->ready_tail != NULL) {
+    ctx->ready_tail->next = conn;
+  } else {
+    ctx->ready_head = conn;
+  }
+  ctx->ready_tail = conn;
+  (void) pthread_cond_signal(&ctx->sq_full);
+  (void) pthread_mutex_unlock(&ctx->mutex);
+}
+
+// Event loop mode: worker threads take connections from the ready list.
+// Return NULL if we're stopping.
+static struct mg_connection *consume_connection(struct mg_context *ctx) {
+  struct mg_connection *conn = NULL;
+
+  (void) pthread_mutex_lock(&ctx->mutex);
+  while (ctx->ready_head == NULL && ctx->stop_flag == 0) {
+    pthread_cond_wait(&ctx->sq_full, &ctx->mutex);
+  }
+  if (ctx->stop_flag == 0) {
+    conn = ctx->ready_head;
+    ctx->ready_head = conn->next;
+    if (ctx->ready_head == NULL) {
+      ctx->ready_tail = NULL;
     }
+  }
+  (void) pthread_mutex_unlock(&ctx->mutex);
+
+  return conn;
+}
+
+// Event loop mode: hand idle connection over to the master thread, which
+// polls it together with the listening sockets. Idle connection does not
+// hold a request buffer.
+static void park_connection(struct mg_context *ctx,
+                            struct mg_connection *conn) {
+  conn->buf = NULL;
+  conn->buf_size = 0;
+  conn->idle_time = time(NULL);
 
-    if (ebuf[0] == '\0') {
-      handle_request(conn);
-      if (conn->ctx->callbacks.end_request != NULL) {
-        conn->ctx->callbacks.end_request(conn, conn->status_code);
+  (void) pthread_mutex_lock(&ctx->mutex);
+  conn->next = ctx->parking;
+  ctx->parking = conn;
+  (void) pthread_mutex_unlock(&ctx->mutex);
+
+  // Make master poll the parked connection without waiting for a timeout
+  if (ctx->wakeup_sock != INVALID_SOCKET) {
+    (void) send(ctx->wakeup_sock, "", 1, MSG_NOSIGNAL);
+  }
+}
+
+// Event loop mode: serve ready connections with a request buffer owned by
+// the worker thread.
+static void serve_connections(struct mg_context *ctx) {
+  struct mg_connection *conn;
+  char *buf;
+  int keep_alive;
+
+  if ((buf = (char *) malloc(MAX_REQUEST_SIZE)) == NULL) {
+    cry(fc(ctx), "%s", "Cannot create request buffer, OOM");
+    return;
+  }
+
+  while ((conn = consume_connection(ctx)) != NULL) {
+    conn->buf = buf;
+    conn->buf_size = MAX_REQUEST_SIZE;
+    conn->data_len = 0;
+
+    if (!conn->client.is_ssl) {
+      // Serve pipelined requests before the connection goes idle
+      do {
+        keep_alive = process_request(conn);
+      } while (keep_alive && conn->data_len > 0);
+
+      if (keep_alive) {
+        park_connection(ctx, conn);
+        continue;
       }
-      log_access(conn);
     }
-    if (ri->remote_user != NULL) {
-      free((void *) ri->remote_user);
-      // Important! When having connections with and without auth
-      // would cause double free and then crash
-      ri->remote_user = NULL;
+#ifndef NO_SSL
+    // SSL layer may buffer input, so SSL connections are not parked
+    else if (sslize(conn, ctx->ssl_ctx, SSL_accept)) {
+      process_new_connection(conn);
     }
+#endif
 
-    // NOTE(lsm): order is important here. should_keep_alive() call
-    // is using parsed request, which will be invalid after memmove's below.
-    // Therefore, memorize should_keep_alive() result now for later use
-    // in loop exit condition.
-    keep_alive = conn->ctx->stop_flag == 0 && keep_alive_enabled &&
-      conn->content_len >= 0 && should_keep_alive(conn);
-
-    // Discard all buffered data for this request
-    discard_len = conn->content_len >= 0 && conn->request_len > 0 &&
-      conn->request_len + conn->content_len < (int64_t) conn->data_len ?
-      (int) (conn->request_len + conn->content_len) : conn->data_len;
-    assert(discard_len >= 0);
-    memmove(conn->buf, conn->buf + discard_len, conn->data_len - discard_len);
-    conn->data_len -= discard_len;
-    assert(conn->data_len >= 0);
-    assert(conn->data_len <= conn->buf_size);
-  } while (keep_alive);
+    close_connection(conn);
+    free(conn);
+  }
+
+  free(buf);
 }
 
 // Worker threads take accepted socket from the queue
@@ -5247,10 +5429,15 @@ static void *worker_thread(void *thread_func_param) {
   struct mg_context *ctx = (struct mg_context *) thread_func_param;
   struct mg_connection *conn;
 
-  conn = (struct mg_connection *) calloc(1, sizeof(*conn) + MAX_REQUEST_SIZE);
-  if (conn == NULL) {
+  if (ctx->event_loop) {
+    serve_connections(ctx);
+    conn = NULL;
+  } else if ((conn = (struct mg_connection *)
+              calloc(1, sizeof(*conn) + MAX_REQUEST_SIZE)) == NULL) {
     cry(fc(ctx), "%s", "Cannot create new connection struct, OOM");
-  } else {
+  }
+
+  if (conn != NULL) {
     conn->buf_size = MAX_REQUEST_SIZE;
     conn->buf = (char *) (conn + 1);
     conn->ctx = ctx;
@@ -5259,17 +5446,7 @@ static void *worker_thread(void *thread_func_param) {
     // Call consume_socket() even when ctx->stop_flag > 0, to let it signal
     // sq_empty condvar to wake up the master waiting in produce_socket()
     while (consume_socket(ctx, &conn->client)) {
-      conn->birth_time = time(NULL);
-
-      // Fill in IP, port info early so even if SSL setup below fails,
-      // error handler would have the corresponding info.
-      // Thanks to Johannes Winkelmann for the patch.
-      // TODO(lsm): Fix IPv6 case
-      conn->request_info.remote_port = ntohs(conn->client.rsa.sin.sin_port);
-      memcpy(&conn->request_info.remote_ip,
-             &conn->client.rsa.sin.sin_addr.s_addr, 4);
-      conn->request_info.remote_ip = ntohl(conn->request_info.remote_ip);
-      conn->request_info.is_ssl = conn->client.is_ssl;
+      init_connection_info(conn);
 
       if (!conn->client.is_ssl
 #ifndef NO_SSL
@@ -5328,6 +5505,58 @@ static int set_sock_timeout(SOCKET sock, int milliseconds) {
     setsockopt(sock, SOL_SOCKET, SO_SNDTIMEO, (void *) &t, sizeof(t));
 }
 
+// Event loop mode: master thread creates the connection for an accepted
+// socket. The connection has no request buffer until a worker serves it.
+static void add_new_connection(struct mg_context *ctx,
+                               const struct socket *sp) {
+  struct mg_connection *conn;
+
+  if ((conn = (struct mg_connection *) calloc(1, sizeof(*conn))) == NULL) {
+    cry(fc(ctx), "%s", "Cannot create new connection struct, OOM");
+    closesocket(sp->sock);
+  } else {
+    conn->ctx = ctx;
+    conn->client = *sp;
+    conn->request_info.user_data = ctx->user_data;
+    init_connection_info(conn);
+    if (conn->client.is_ssl) {
+      queue_connection(ctx, conn);
+    } else {
+      // Poll for the first request like for an idle keep-alive connection
+      conn->idle_time = conn->birth_time;
+      (void) pthread_mutex_lock(&ctx->mutex);
+      conn->next = ctx->parking;
+      ctx->parking = conn;
+      (void) pthread_mutex_unlock(&ctx->mutex);
+    }
+  }
+}
+
+// Event loop mode: create a non-blocking UDP socket connected to itself.
+// Sending a datagram to it wakes up the master thread in poll().
+static SOCKET open_wakeup_socket(void) {
+  union usa sa;
+  socklen_t len = sizeof(sa.sin);
+  SOCKET sock;
+
+  memset(&sa, 0, sizeof(sa));
+  sa.sin.sin_family = AF_INET;
+  sa.sin.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+
+  if ((sock = socket(AF_INET, SOCK_DGRAM, 0)) == INVALID_SOCKET) {
+  } else if (bind(sock, &sa.sa, len) != 0 ||
+             getsockname(sock, &sa.sa, &len) != 0 ||
+             connect(sock, &sa.sa, len) != 0) {
+    closesocket(sock);
+    sock = INVALID_SOCKET;
+  } else {
+    set_close_on_exec(sock);
+    set_non_blocking_mode(sock);
+  }
+
+  return sock;
+}
+
 static void accept_new_connection(const struct socket *listener,
                                   struct mg_context *ctx) {
   struct socket so;
@@ -5355,7 +5584,134 @@ static void accept_new_connection(const struct socket *listener,
     // Thanks to Igor Klopov who suggested the patch.
     setsockopt(so.sock, SOL_SOCKET, SO_KEEPALIVE, (void *) &on, sizeof(on));
     set_sock_timeout(so.sock, atoi(ctx->config[REQUEST_TIMEOUT]));
-    produce_socket(ctx, &so);
+    if (ctx->event_loop) {
+      add_new_connection(ctx, &so);
+    } else {
+      produce_socket(ctx, &so);
+    }
+  }
+}
+
+// Event loop mode: master thread polls the listening sockets, the idle
+// connections and the wakeup socket. Idle connections with pending input are
+// queued for the workers, idle connections which exceed the request timeout
+// are closed.
+static void event_loop(struct mg_context *ctx) {
+  struct mg_connection **idle = NULL, **new_idle, *conn, *parked;
+  struct pollfd *pfd = NULL, *new_pfd;
+  int num_idle = 0, max_idle = 0, num_fds, i;
+  time_t now, timeout;
+  char buf[16];
+
+  timeout = atoi(ctx->config[REQUEST_TIMEOUT]) / 1000;
+  num_fds = ctx->num_listening_sockets + 1;
+  pfd = (struct pollfd *) calloc(num_fds, sizeof(pfd[0]));
+
+  while (pfd != NULL && ctx->stop_flag == 0) {
+    // Take over the connections parked by the workers
+    (void) pthread_mutex_lock(&ctx->mutex);
+    parked = ctx->parking;
+    ctx->parking = NULL;
+    (void) pthread_mutex_unlock(&ctx->mutex);
+
+    while ((conn = parked) != NULL) {
+      parked = conn->next;
+      if (num_idle == max_idle) {
+        max_idle = max_idle * 2 + 16;
+        new_idle = (struct mg_connection **)
+          realloc(idle, max_idle * sizeof(idle[0]));
+        new_pfd = (struct pollfd *)
+          realloc(pfd, (num_fds + max_idle) * sizeof(pfd[0]));
+        if (new_idle != NULL) {
+          idle = new_idle;
+        }
+        if (new_pfd != NULL) {
+          pfd = new_pfd;
+        }
+        if (new_idle == NULL || new_pfd == NULL) {
+          max_idle = num_idle;
+          cry(fc(ctx), "%s", "Cannot poll idle connection, OOM");
+          close_connection(conn);
+          free(conn);
+          continue;
+        }
+      }
+      idle[num_idle++] = conn;
+    }
+
+    num_fds = 0;
+    for (i = 0; i < ctx->num_listening_sockets; i++) {
+      pfd[num_fds].fd = ctx->listening_sockets[i].sock;
+      pfd[num_fds++].events = POLLIN;
+    }
+    if (ctx->wakeup_sock != INVALID_SOCKET) {
+      pfd[num_fds].fd = ctx->wakeup_sock;
+      pfd[num_fds++].events = POLLIN;
+    }
+    for (i = 0; i < num_idle; i++) {
+      pfd[num_fds + i].fd = idle[i]->client.sock;
+      pfd[num_fds + i].events = POLLIN;
+      pfd[num_fds + i].revents = 0;
+    }
+
+    // Without the wakeup socket, poll often to pick up parked connections
+    if (poll(pfd, num_fds + num_idle,
+             ctx->wakeup_sock != INVALID_SOCKET ? 200 : 10) > 0) {
+      for (i = 0; i < ctx->num_listening_sockets; i++) {
+        if (ctx->stop_flag == 0 && (pfd[i].revents & POLLIN)) {
+          accept_new_connection(&ctx->listening_sockets[i], ctx);
+        }
+      }
+      if (ctx->wakeup_sock != INVALID_SOCKET &&
+          (pfd[ctx->num_listening_sockets].revents & POLLIN)) {
+        while (recv(ctx->wakeup_sock, buf, sizeof(buf), 0) > 0) {
+        }
+      }
+    }
+
+    // Iterate backwards, so that a removed entry is replaced by an entry
+    // which is already visited. Closed connections report readability.
+    now = time(NULL);
+    for (i = num_idle - 1; i >= 0; i--) {
+      conn = idle[i];
+      if (pfd[num_fds + i].revents != 0) {
+        idle[i] = idle[--num_idle];
+        queue_connection(ctx, conn);
+      } else if (now - conn->idle_time > timeout) {
+        idle[i] = idle[--num_idle];
+        close_connection(conn);
+        free(conn);
+      }
+    }
+    num_fds = ctx->num_listening_sockets + 1;
+  }
+
+  for (i = 0; i < num_idle; i++) {
+    close_connection(idle[i]);
+    free(idle[i]);
+  }
+  free(idle);
+  free(pfd);
+}
+
+static void close_connection_list(struct mg_connection *conn) {
+  struct mg_connection *next;
+
+  for (; conn != NULL; conn = next) {
+    next = conn->next;
+    close_connection(conn);
+    free(conn);
+  }
+}
+
+static void close_pending_connections(struct mg_context *ctx) {
+  close_connection_list(ctx->ready_head);
+  close_connection_list(ctx->parking);
+  ctx->ready_head = ctx->ready_tail = ctx->parking = NULL;
+
+  if (ctx->wakeup_sock != INVALID_SOCKET) {
+    closesocket(ctx->wakeup_sock);
+    ctx->wakeup_sock = INVALID_SOCKET;
   }
 }
 
@@ -5375,7 +5731,12 @@ static void *master_thread(void *thread_func_param) {
   pthread_setschedparam(pthread_self(), SCHED_RR, &sched_param);
 #endif
 
-  pfd = (struct pollfd *) calloc(ctx->num_listening_sockets, sizeof(pfd[0]));
+  if (ctx->event_loop) {
+    event_loop(ctx);
+  }
+
+  pfd = ctx->event_loop ? NULL :
+    (struct pollfd *) calloc(ctx->num_listening_sockets, sizeof(pfd[0]));
   while (pfd != NULL && ctx->stop_flag == 0) {
     for (i = 0; i < ctx->num_listening_sockets; i++) {
       pfd[i].fd = ctx->listening_sockets[i].sock;
@@ -5416,6 +5777,9 @@ static void *master_thread(void *thread_func_param) {
   }
   (void) pthread_mutex_unlock(&ctx->mutex);
 
+  // Close connections which were not served by the workers
+  close_pending_connections(ctx);
+
   // All threads exited, no sync is needed. Destroy mutex and condvars
   (void) pthread_mutex_destroy(&ctx->mutex);
   (void) pthread_cond_destroy(&ctx->cond);
@@ -5547,6 +5911,12 @@ struct mg_context *mg_start(const struct mg_callbacks *callbacks,
   (void) pthread_cond_init(&ctx->sq_empty, NULL);
   (void) pthread_cond_init(&ctx->sq_full, NULL);
 
+  ctx->event_loop = !strcmp(ctx->config[ENABLE_EVENT_LOOP], "yes");
+  ctx->wakeup_sock = ctx->event_loop ? open_wakeup_socket() : INVALID_SOCKET;
+  if (ctx->event_loop && ctx->wakeup_sock == INVALID_SOCKET) {
+    cry(fc(ctx), "Cannot create wakeup socket: %ld", (long) ERRNO);
+  }
+
   // Start master (listening) thread
   mg_start_thread(master_thread, ctx);
 
@@ -73,15 +73,6 @@ int pthread_key_create(
 
 Freechain_Control _POSIX_Keys_Keypool;
 
-static uint32_t _POSIX_Keys_Get_keypool_bump_count( void )
-{
-  uint32_t max;
-
-  max = _POSIX_Keys_Key_value_pair_maximum;
-  return _Objects_Is_unlimited( max ) ?
-    _Objects_Maximum_per_allocation( max ) : 0;
-}
-
 static uint32_t _POSIX_Keys_Get_initial_keypool_size( void )
 {
   uint32_t max;
@@ -102,57 +93,116 @@ static void _POSIX_Keys_Initialize_keypool( void )
 
 POSIX_Keys_Key_value_pair * _POSIX_Keys_Key_value_allocate( void )
 {
-  return (POSIX_Keys_Key_value_pair *) _Freechain_Get(
+  POSIX_Keys_Key_value_pair *key_value_pair;
+
+  key_value_pair = _Freechain_Get(
     &_POSIX_Keys_Keypool,
     _Workspace_Allocate,
-    _POSIX_Keys_Get_keypool_bump_count(),
-    sizeof( POSIX_Keys_Key_value_pair )
+    0,
+    sizeof( *key_value_pair )
   );
+
+  /*
+   * In unlimited mode, the additional key value pairs are allocated from a
+   * workspace slab, so that they can be returned to the workspace.
+   */
+  if (
+    key_value_pair == NULL
+      && _Objects_Is_unlimited( _POSIX_Keys_Key_value_pair_maximum )
+  ) {
+    key_value_pair = _Workspace_Slab_allocate( sizeof( *key_value_pair ) );
+  }
+
+  return key_value_pair;
 }
 
-static void _POSIX_Keys_Run_destructors( Thread_Control *the_thread )
+static bool _POSIX_Keys_Run_direct_destructor( Thread_Control *the_thread )
 {
-  while ( true ) {
-    ISR_lock_Context  lock_context;
-    RBTree_Node      *node;
-
-    _Objects_Allocator_lock();
-    _POSIX_Keys_Key_value_acquire( the_thread, &lock_context );
-
-    node = _RBTree_Root( &the_thread->Keys.Key_value_pairs );
-    if ( node != NULL ) {
-      POSIX_Keys_Key_value_pair *key_value_pair;
-      pthread_key_t              key;
-      void                      *value;
-      POSIX_Keys_Control        *the_key;
-      void                    ( *destructor )( void * );
-
-      key_value_pair = POSIX_KEYS_RBTREE_NODE_TO_KEY_VALUE_PAIR( node );
-      key = key_value_pair->key;
-      value = key_value_pair->value;
-      _RBTree_Extract(
-        &the_thread->Keys.Key_value_pairs,
-        &key_value_pair->Lookup_node
-      );
-
-      _POSIX_Keys_Key_value_release( the_thread, &lock_context );
-      _POSIX_Keys_Key_value_free( key_value_pair );
-
-      the_key = _POSIX_Keys_Get( key );
+  uint32_t index;
+
+  _Objects_Allocator_lock();
+
+  for ( index = 0; index < _POSIX_Keys_Direct_maximum; ++index ) {
+    void *value;
+
+    value = the_thread->Keys.Direct_values[ index ];
+    if ( value != NULL ) {
+      POSIX_Keys_Control *the_key;
+      void             ( *destructor )( void * );
+
+      the_thread->Keys.Direct_values[ index ] = NULL;
+
+      the_key = _POSIX_Keys_Get( _POSIX_Keys_Get_direct_key( index ) );
       _Assert( the_key != NULL );
       destructor = the_key->destructor;
 
       _Objects_Allocator_unlock();
 
-      if ( destructor != NULL && value != NULL ) {
+      if ( destructor != NULL ) {
         ( *destructor )( value );
       }
-    } else {
-      _POSIX_Keys_Key_value_release( the_thread, &lock_context );
-      _Objects_Allocator_unlock();
-      break;
+
+      return true;
     }
   }
+
+  _Objects_Allocator_unlock();
+  return false;
+}
+
+static bool _POSIX_Keys_Run_tree_destructor( Thread_Control *the_thread )
+{
+  ISR_lock_Context  lock_context;
+  RBTree_Node      *node;
+
+  _Objects_Allocator_lock();
+  _POSIX_Keys_Key_value_acquire( the_thread, &lock_context );
+
+  node = _RBTree_Root( &the_thread->Keys.Key_value_pairs );
+  if ( node != NULL ) {
+    POSIX_Keys_Key_value_pair *key_value_pair;
+    pthread_key_t              key;
+    void                      *value;
+    POSIX_Keys_Control        *the_key;
+    void                    ( *destructor )( void * );
+
+    key_value_pair = POSIX_KEYS_RBTREE_NODE_TO_KEY_VALUE_PAIR( node );
+    key = key_value_pair->key;
+    value = key_value_pair->value;
+    _RBTree_Extract(
+      &the_thread->Keys.Key_value_pairs,
+      &key_value_pair->Lookup_node
+    );
+
+    _POSIX_Keys_Key_value_release( the_thread, &lock_context );
+    _POSIX_Keys_Key_value_free( key_value_pair );
+
+    the_key = _POSIX_Keys_Get( key );
+    _Assert( the_key != NULL );
+    destructor = the_key->destructor;
+
+    _Objects_Allocator_unlock();
+
+    if ( destructor != NULL && value != NULL ) {
+      ( *destructor )( value );
+    }
+
+    return true;
+  }
+
+  _POSIX_Keys_Key_value_release( the_thread, &lock_context );
+  _Objects_Allocator_unlock();
+  return false;
+}
+
+static void _POSIX_Keys_Run_destructors( Thread_Control *the_thread )
+{
+  while (
+    _POSIX_Keys_Run_direct_destructor( the_thread )
+      || _POSIX_Keys_Run_tree_destructor( the_thread )
+  ) {
+    /* Destructors may set new values, so start again */
+  }
 }
 
 static void _POSIX_Keys_Restart_run_destructors(
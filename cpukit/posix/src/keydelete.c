@@ -40,13 +40,38 @@
 #endif
 
 #include <rtems/posix/keyimpl.h>
+#include <rtems/score/threadimpl.h>
 
 #include <errno.h>
 
+static bool _POSIX_Keys_Clear_direct_value(
+  Thread_Control *the_thread,
+  void           *arg
+)
+{
+  const uint32_t *index;
+
+  index = arg;
+  the_thread->Keys.Direct_values[ *index ] = NULL;
+
+  return false;
+}
+
 static void _POSIX_Keys_Destroy( POSIX_Keys_Control *the_key )
 {
+  uint32_t index;
+
   _Objects_Close( &_POSIX_Keys_Information, &the_key->Object );
 
+  /*
+   * A key created later may get the same identifier, so make sure that its
+   * initial value is NULL in all threads.
+   */
+  index = _POSIX_Keys_Get_direct_index( the_key->Object.id );
+  if ( index < _POSIX_Keys_Direct_maximum ) {
+    _Thread_Iterate( _POSIX_Keys_Clear_direct_value, &index );
+  }
+
   while ( !_Chain_Is_empty( &the_key->Key_value_pairs ) ) {
     POSIX_Keys_Key_value_pair *key_value_pair;
     ISR_lock_Context           lock_context;
@@ -54,8 +54,15 @@ void *pthread_getspecific(
   ISR_lock_Context           lock_context;
   POSIX_Keys_Key_value_pair *key_value_pair;
   void                      *value;
+  uint32_t                   index;
 
   executing = _Thread_Get_executing();
+  index = _POSIX_Keys_Get_direct_index( key );
+
+  if ( index < _POSIX_Keys_Direct_maximum ) {
+    return executing->Keys.Direct_values[ index ];
+  }
+
   _POSIX_Keys_Key_value_acquire( executing, &lock_context );
 
   key_value_pair = _POSIX_Keys_Key_value_find( key, executing );
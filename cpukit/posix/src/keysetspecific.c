@@ -54,6 +54,22 @@ static int _POSIX_Keys_Set_value(
   return 0;
 }
 
+static int _POSIX_Keys_Set_direct_value(
+  pthread_key_t   key,
+  uint32_t        index,
+  const void     *value,
+  Thread_Control *executing
+)
+{
+  if ( _POSIX_Keys_Get( key ) == NULL ) {
+    return EINVAL;
+  }
+
+  executing->Keys.Direct_values[ index ] = RTEMS_DECONST( void *, value );
+
+  return 0;
+}
+
 static int _POSIX_Keys_Create_value(
   pthread_key_t       key,
   const void         *value,
@@ -154,8 +170,14 @@ int pthread_setspecific(
 {
   Thread_Control   *executing;
   int               eno;
+  uint32_t          index;
 
   executing = _Thread_Get_executing();
+  index = _POSIX_Keys_Get_direct_index( key );
+
+  if ( index < _POSIX_Keys_Direct_maximum ) {
+    return _POSIX_Keys_Set_direct_value( key, index, value, executing );
+  }
 
   if ( value != NULL ) {
     ISR_lock_Context           lock_context;
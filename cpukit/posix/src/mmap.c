@@ -176,11 +176,12 @@ void *mmap(
       return MAP_FAILED;
     }
 
-    /* Check to see if the mapping is valid for a regular file. */
+    /*
+     * Check to see if the mapping is valid for a regular file. A region
+     * ending at the end of the file is valid.
+     */
     if ( S_ISREG( sb.st_mode )
-    /* FIXME: Should this be using strict inequality (>) comparisons? It would
-     * be valid to map a region exactly equal to the st_size, e.g. see below. */
-         && (( off >= sb.st_size ) || (( off + len ) >= sb.st_size ))) {
+         && (( off >= sb.st_size ) || (( off + len ) > sb.st_size ))) {
       errno = EOVERFLOW;
       return MAP_FAILED;
     }
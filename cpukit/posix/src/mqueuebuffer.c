@@ -0,0 +1,231 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/**
+ * @file
+ *
+ * @ingroup POSIX_MQUEUE
+ *
+ * @brief This source file contains the implementation of
+ *   mq_obtain_buffer_np(), mq_send_buffer_np(), mq_receive_buffer_np(), and
+ *   mq_release_buffer_np().
+ */
+
+/*
+ * Copyright (C) 2026 On-Line Applications Research Corporation (OAR)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/posix/mqueueimpl.h>
+#include <rtems/posix/posixapi.h>
+
+#include <fcntl.h>
+
+static POSIX_Message_queue_Control *_POSIX_Message_queue_Get_loan(
+  mqd_t                  mqdes,
+  int                    denied_access,
+  const struct timespec *abstime,
+  Thread_queue_Context  *queue_context
+)
+{
+  POSIX_Message_queue_Control *the_mq;
+
+  the_mq = _POSIX_Message_queue_Get( mqdes, queue_context );
+
+  if ( the_mq == NULL ) {
+    rtems_set_errno_and_return_value( EBADF, NULL );
+  }
+
+  if ( ( the_mq->oflag & O_ACCMODE ) == denied_access ) {
+    _ISR_lock_ISR_enable( &queue_context->Lock_context.Lock_context );
+    rtems_set_errno_and_return_value( EBADF, NULL );
+  }
+
+  if ( abstime != NULL ) {
+    _Thread_queue_Context_set_enqueue_callout(
+      queue_context,
+      _Thread_queue_Add_timeout_realtime_timespec
+    );
+    _Thread_queue_Context_set_timeout_argument( queue_context, abstime, true );
+  } else {
+    _Thread_queue_Context_set_enqueue_do_nothing_extra( queue_context );
+  }
+
+  _CORE_message_queue_Acquire_critical( &the_mq->Message_queue, queue_context );
+
+  if ( the_mq->open_count == 0 ) {
+    _CORE_message_queue_Release( &the_mq->Message_queue, queue_context );
+    rtems_set_errno_and_return_value( EBADF, NULL );
+  }
+
+  return the_mq;
+}
+
+int mq_obtain_buffer_np(
+  mqd_t                  mqdes,
+  void                 **msg_ptr,
+  const struct timespec *abstime
+)
+{
+  POSIX_Message_queue_Control *the_mq;
+  Thread_queue_Context         queue_context;
+  Status_Control               status;
+
+  if ( msg_ptr == NULL ) {
+    rtems_set_errno_and_return_minus_one( EFAULT );
+  }
+
+  the_mq = _POSIX_Message_queue_Get_loan(
+    mqdes,
+    O_RDONLY,
+    abstime,
+    &queue_context
+  );
+
+  if ( the_mq == NULL ) {
+    return -1;
+  }
+
+  status = _CORE_message_queue_Obtain_buffer(
+    &the_mq->Message_queue,
+    _Thread_Executing,
+    msg_ptr,
+    ( the_mq->oflag & O_NONBLOCK ) == 0,
+    &queue_context
+  );
+  return _POSIX_Zero_or_minus_one_plus_errno( status );
+}
+
+int mq_send_buffer_np(
+  mqd_t         mqdes,
+  void         *msg_ptr,
+  size_t        msg_len,
+  unsigned int  msg_prio
+)
+{
+  POSIX_Message_queue_Control *the_mq;
+  Thread_queue_Context         queue_context;
+  Status_Control               status;
+
+  if ( msg_prio > MQ_PRIO_MAX ) {
+    rtems_set_errno_and_return_minus_one( EINVAL );
+  }
+
+  the_mq = _POSIX_Message_queue_Get_loan(
+    mqdes,
+    O_RDONLY,
+    NULL,
+    &queue_context
+  );
+
+  if ( the_mq == NULL ) {
+    return -1;
+  }
+
+  status = _CORE_message_queue_Submit_buffer(
+    &the_mq->Message_queue,
+    msg_ptr,
+    msg_len,
+    _POSIX_Message_queue_Priority_to_core( msg_prio ),
+    &queue_context
+  );
+  return _POSIX_Zero_or_minus_one_plus_errno( status );
+}
+
+ssize_t mq_receive_buffer_np(
+  mqd_t                  mqdes,
+  void                 **msg_ptr,
+  unsigned int          *msg_prio,
+  const struct timespec *abstime
+)
+{
+  POSIX_Message_queue_Control *the_mq;
+  Thread_queue_Context         queue_context;
+  size_t                       length_out;
+  Thread_Control              *executing;
+  Status_Control               status;
+
+  if ( msg_ptr == NULL ) {
+    rtems_set_errno_and_return_minus_one( EFAULT );
+  }
+
+  the_mq = _POSIX_Message_queue_Get_loan(
+    mqdes,
+    O_WRONLY,
+    abstime,
+    &queue_context
+  );
+
+  if ( the_mq == NULL ) {
+    return -1;
+  }
+
+  executing = _Thread_Executing;
+  status = _CORE_message_queue_Seize_buffer(
+    &the_mq->Message_queue,
+    executing,
+    msg_ptr,
+    &length_out,
+    ( the_mq->oflag & O_NONBLOCK ) == 0,
+    &queue_context
+  );
+
+  if ( status != STATUS_SUCCESSFUL ) {
+    rtems_set_errno_and_return_minus_one( _POSIX_Get_error( status ) );
+  }
+
+  if ( msg_prio != NULL ) {
+    *msg_prio = _POSIX_Message_queue_Priority_from_core(
+      executing->Wait.count
+    );
+  }
+
+  return (ssize_t) length_out;
+}
+
+int mq_release_buffer_np(
+  mqd_t  mqdes,
+  void  *msg_ptr
+)
+{
+  POSIX_Message_queue_Control *the_mq;
+  Thread_queue_Context         queue_context;
+  Status_Control               status;
+
+  /* Any access mode may give a message buffer back */
+  the_mq = _POSIX_Message_queue_Get_loan( mqdes, -1, NULL, &queue_context );
+
+  if ( the_mq == NULL ) {
+    return -1;
+  }
+
+  status = _CORE_message_queue_Release_buffer(
+    &the_mq->Message_queue,
+    msg_ptr,
+    &queue_context
+  );
+  return _POSIX_Zero_or_minus_one_plus_errno( status );
+}
@@ -100,7 +100,7 @@ static mqd_t _POSIX_Message_queue_Create(
    * Make a copy of the user's string for name just in case it was
    * dynamically constructed.
    */
-  name = _Workspace_String_duplicate( name_arg, name_len );
+  name = _Workspace_Slab_string_duplicate( name_arg, name_len );
   if ( !name ) {
     _POSIX_Message_queue_Free( the_mq );
     rtems_set_errno_and_return_value( ENOMEM, MQ_OPEN_FAILED );
@@ -128,7 +128,7 @@ static mqd_t _POSIX_Message_queue_Create(
 
   if ( status != STATUS_SUCCESSFUL ) {
     _POSIX_Message_queue_Free( the_mq );
-    _Workspace_Free( name );
+    _Workspace_Slab_string_free( name );
     rtems_set_errno_and_return_value( ENOSPC, MQ_OPEN_FAILED );
   }
 
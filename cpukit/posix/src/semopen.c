@@ -63,14 +63,14 @@ static sem_t *_POSIX_Semaphore_Create_support(
    * Make a copy of the user's string for name just in case it was
    * dynamically constructed.
    */
-  name = _Workspace_String_duplicate( name_arg, name_len );
+  name = _Workspace_Slab_string_duplicate( name_arg, name_len );
   if ( name == NULL ) {
     rtems_set_errno_and_return_value( ENOMEM, SEM_FAILED );
   }
 
   the_semaphore = _POSIX_Semaphore_Allocate_unprotected();
   if ( the_semaphore == NULL ) {
-    _Workspace_Free( name );
+    _Workspace_Slab_string_free( name );
     rtems_set_errno_and_return_value( ENOSPC, SEM_FAILED );
   }
 
@@ -179,7 +179,7 @@ static inline POSIX_Shm_Control *shm_allocate(
     return NULL;
   }
 
-  name = _Workspace_String_duplicate( name_arg, name_len );
+  name = _Workspace_Slab_string_duplicate( name_arg, name_len );
   if ( name == NULL ) {
     *error = ENOSPC;
     return NULL;
@@ -187,7 +187,7 @@ static inline POSIX_Shm_Control *shm_allocate(
 
   shm = _POSIX_Shm_Allocate_unprotected();
   if ( shm == NULL ) {
-    _Workspace_Free( name );
+    _Workspace_Slab_string_free( name );
     *error = ENFILE;
     return NULL;
   }
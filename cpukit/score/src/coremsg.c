@@ -67,10 +67,16 @@ Status_Control _CORE_message_queue_Initialize(
     return STATUS_MESSAGE_QUEUE_INVALID_SIZE;
   }
 
-  buffer_size = RTEMS_ALIGN_UP( maximum_message_size, sizeof( uintptr_t ) );
-  _Assert( buffer_size >= maximum_message_size );
+  /*
+   * A thread waiting to send a message uses the message size as the thread
+   * wait option, so it must not clash with the other thread wait options.
+   */
+  if ( maximum_message_size >= CORE_MESSAGE_QUEUE_WAIT_OBTAIN_BUFFER ) {
+    return STATUS_MESSAGE_QUEUE_INVALID_SIZE;
+  }
 
-  buffer_size += sizeof( CORE_message_queue_Buffer );
+  buffer_size = _CORE_message_queue_Buffer_size( maximum_message_size );
+  _Assert( buffer_size >= maximum_message_size );
   _Assert( buffer_size >= sizeof( CORE_message_queue_Buffer ) );
 
   /* Make sure the memory allocation size computation does not overflow */
@@ -0,0 +1,384 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/**
+ * @file
+ *
+ * @ingroup RTEMSScoreMessageQueue
+ *
+ * @brief This source file contains the implementation of
+ *   _CORE_message_queue_Obtain_buffer(), _CORE_message_queue_Submit_buffer(),
+ *   _CORE_message_queue_Seize_buffer(), and
+ *   _CORE_message_queue_Release_buffer().
+ */
+
+/*
+ * Copyright (C) 2026 On-Line Applications Research Corporation (OAR)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/score/coremsgimpl.h>
+#include <rtems/score/isr.h>
+#include <rtems/score/threadimpl.h>
+#include <rtems/score/statesimpl.h>
+
+/*
+ * Threads waiting to receive a message and threads waiting for a message
+ * buffer can only be enqueued at the same time if all message buffers are on
+ * loan.  In this state, a message buffer on loan which is submitted or
+ * released may belong to either kind of waiting thread and the first waiting
+ * thread does not tell us which one.  All waiting threads are woken up to
+ * retry their operation in this case.
+ */
+static Thread_Control *_CORE_message_queue_Flush_retry(
+  Thread_Control       *the_thread,
+  Thread_queue_Queue   *queue,
+  Thread_queue_Context *queue_context
+)
+{
+  the_thread->Wait.return_code = STATUS_MESSAGE_QUEUE_RETRY;
+
+  (void) queue;
+  (void) queue_context;
+  return the_thread;
+}
+
+static void _CORE_message_queue_Retry_waiters(
+  CORE_message_queue_Control *the_message_queue,
+  Thread_queue_Context       *queue_context
+)
+{
+  _Thread_queue_Flush_critical(
+    &the_message_queue->Wait_queue.Queue,
+    the_message_queue->operations,
+    _CORE_message_queue_Flush_retry,
+    queue_context
+  );
+}
+
+static void _CORE_message_queue_Give_back_buffer(
+  CORE_message_queue_Control *the_message_queue,
+  CORE_message_queue_Buffer  *the_message,
+  Thread_queue_Context       *queue_context
+)
+{
+  Thread_Control *the_thread;
+
+  the_thread = _CORE_message_queue_First_waiter( the_message_queue );
+
+  /*
+   *  If all message buffers are on loan and a thread waits to receive, then
+   *  threads waiting for a message buffer may be enqueued behind it.
+   */
+  if (
+    the_thread != NULL
+      && _CORE_message_queue_Is_receiver( the_thread )
+      && _Chain_Is_empty( &the_message_queue->Inactive_messages )
+  ) {
+    _CORE_message_queue_Free_message_buffer( the_message_queue, the_message );
+    _CORE_message_queue_Retry_waiters( the_message_queue, queue_context );
+    return;
+  }
+
+  _CORE_message_queue_Surrender_buffer(
+    the_message_queue,
+    the_message,
+    queue_context
+  );
+}
+
+static Status_Control _CORE_message_queue_Wait_for_buffer(
+  CORE_message_queue_Control *the_message_queue,
+  Thread_Control             *executing,
+  uint32_t                    option,
+  void                      **buffer,
+  size_t                     *size_p,
+  Thread_queue_Context       *queue_context
+)
+{
+  executing->Wait.return_argument_second.mutable_object = buffer;
+  executing->Wait.return_argument = size_p;
+  executing->Wait.option = option;
+
+  _Thread_queue_Context_set_thread_state(
+    queue_context,
+    STATES_WAITING_FOR_MESSAGE
+  );
+  _Thread_queue_Enqueue(
+    &the_message_queue->Wait_queue.Queue,
+    the_message_queue->operations,
+    executing,
+    queue_context
+  );
+  return _Thread_Wait_get_status( executing );
+}
+
+Status_Control _CORE_message_queue_Obtain_buffer(
+  CORE_message_queue_Control *the_message_queue,
+  Thread_Control             *executing,
+  void                      **buffer,
+  bool                        wait,
+  Thread_queue_Context       *queue_context
+)
+{
+  CORE_message_queue_Buffer *the_message;
+  Status_Control             status;
+  Watchdog_Interval          deadline;
+
+  deadline = _CORE_message_queue_Get_deadline( queue_context );
+
+  while ( true ) {
+    the_message =
+      _CORE_message_queue_Allocate_message_buffer( the_message_queue );
+    if ( the_message != NULL ) {
+      *buffer = _CORE_message_queue_Lend_buffer( the_message );
+      _CORE_message_queue_Release( the_message_queue, queue_context );
+      return STATUS_SUCCESSFUL;
+    }
+
+    if ( !wait ) {
+      _CORE_message_queue_Release( the_message_queue, queue_context );
+      return STATUS_TOO_MANY;
+    }
+
+    /*
+     *  Do NOT block if the caller is in an ISR.  It is deadly to block in an
+     *  ISR.
+     */
+    if ( _ISR_Is_in_progress() ) {
+      _CORE_message_queue_Release( the_message_queue, queue_context );
+      return STATUS_MESSAGE_QUEUE_WAIT_IN_ISR;
+    }
+
+    status = _CORE_message_queue_Wait_for_buffer(
+      the_message_queue,
+      executing,
+      CORE_MESSAGE_QUEUE_WAIT_OBTAIN_BUFFER,
+      buffer,
+      NULL,
+      queue_context
+    );
+
+    if ( status != STATUS_MESSAGE_QUEUE_RETRY ) {
+      return status;
+    }
+
+    if (
+      !_CORE_message_queue_Set_remaining_timeout( queue_context, deadline )
+    ) {
+      return STATUS_TIMEOUT;
+    }
+
+    _CORE_message_queue_Acquire( the_message_queue, queue_context );
+  }
+}
+
+Status_Control _CORE_message_queue_Submit_buffer(
+  CORE_message_queue_Control      *the_message_queue,
+  void                            *buffer,
+  size_t                           size,
+  CORE_message_queue_Submit_types  submit_type,
+  Thread_queue_Context            *queue_context
+)
+{
+  CORE_message_queue_Buffer *the_message;
+  Thread_Control            *the_thread;
+
+  the_message = _CORE_message_queue_Get_buffer( the_message_queue, buffer );
+  if ( the_message == NULL ) {
+    _CORE_message_queue_Release( the_message_queue, queue_context );
+    return STATUS_INVALID_ADDRESS;
+  }
+
+  if ( size > the_message_queue->maximum_message_size ) {
+    _CORE_message_queue_Release( the_message_queue, queue_context );
+    return STATUS_MESSAGE_INVALID_SIZE;
+  }
+
+  if ( the_message_queue->number_of_pending_messages == 0 ) {
+    the_thread = _CORE_message_queue_First_waiter( the_message_queue );
+  } else {
+    the_thread = NULL;
+  }
+
+  if ( the_thread != NULL && _CORE_message_queue_Is_receiver( the_thread ) ) {
+    the_thread = ( *the_message_queue->operations->surrender )(
+      &the_message_queue->Wait_queue.Queue,
+      the_message_queue->Wait_queue.Queue.heads,
+      NULL,
+      queue_context
+    );
+
+    *(size_t *) the_thread->Wait.return_argument = size;
+    the_thread->Wait.count = (uint32_t) submit_type;
+
+    if ( the_thread->Wait.option == CORE_MESSAGE_QUEUE_WAIT_RECEIVE_BUFFER ) {
+      /* Hand over the message buffer, this is the zero-copy path */
+      the_message->size = size;
+      *(void **) the_thread->Wait.return_argument_second.mutable_object =
+        buffer;
+      _Thread_queue_Resume(
+        &the_message_queue->Wait_queue.Queue,
+        the_thread,
+        queue_context
+      );
+      return STATUS_SUCCESSFUL;
+    }
+
+    _CORE_message_queue_Copy_buffer(
+      buffer,
+      the_thread->Wait.return_argument_second.mutable_object,
+      size
+    );
+    _Thread_queue_Resume(
+      &the_message_queue->Wait_queue.Queue,
+      the_thread,
+      queue_context
+    );
+
+    _CORE_message_queue_Acquire( the_message_queue, queue_context );
+    _CORE_message_queue_Give_back_buffer(
+      the_message_queue,
+      the_message,
+      queue_context
+    );
+    return STATUS_SUCCESSFUL;
+  }
+
+  _CORE_message_queue_Insert_message(
+    the_message_queue,
+    the_message,
+    buffer,
+    size,
+    submit_type
+  );
+
+  /*
+   *  If the queue was empty and a thread waits for a message buffer, then
+   *  threads waiting to receive may be enqueued behind it.
+   */
+  if ( the_thread != NULL ) {
+    _CORE_message_queue_Retry_waiters( the_message_queue, queue_context );
+    return STATUS_SUCCESSFUL;
+  }
+
+#if defined(RTEMS_SCORE_COREMSG_ENABLE_NOTIFICATION)
+  if (
+    the_message_queue->number_of_pending_messages == 1
+      && the_message_queue->notify_handler != NULL
+  ) {
+    ( *the_message_queue->notify_handler )(
+      the_message_queue,
+      queue_context
+    );
+  } else {
+    _CORE_message_queue_Release( the_message_queue, queue_context );
+  }
+#else
+  _CORE_message_queue_Release( the_message_queue, queue_context );
+#endif
+
+  return STATUS_SUCCESSFUL;
+}
+
+Status_Control _CORE_message_queue_Seize_buffer(
+  CORE_message_queue_Control *the_message_queue,
+  Thread_Control             *executing,
+  void                      **buffer,
+  size_t                     *size_p,
+  bool                        wait,
+  Thread_queue_Context       *queue_context
+)
+{
+  CORE_message_queue_Buffer *the_message;
+  Status_Control             status;
+  Watchdog_Interval          deadline;
+
+  deadline = _CORE_message_queue_Get_deadline( queue_context );
+
+  while ( true ) {
+    the_message = _CORE_message_queue_Get_pending_message( the_message_queue );
+    if ( the_message != NULL ) {
+      the_message_queue->number_of_pending_messages -= 1;
+      *buffer = _CORE_message_queue_Lend_buffer( the_message );
+      _CORE_message_queue_Release( the_message_queue, queue_context );
+
+      *size_p = the_message->size;
+      executing->Wait.count =
+        _CORE_message_queue_Get_message_priority( the_message );
+      return STATUS_SUCCESSFUL;
+    }
+
+    if ( !wait ) {
+      _CORE_message_queue_Release( the_message_queue, queue_context );
+      return STATUS_UNSATISFIED;
+    }
+
+    /* Wait.count will be filled in with the message priority */
+    status = _CORE_message_queue_Wait_for_buffer(
+      the_message_queue,
+      executing,
+      CORE_MESSAGE_QUEUE_WAIT_RECEIVE_BUFFER,
+      buffer,
+      size_p,
+      queue_context
+    );
+
+    if ( status != STATUS_MESSAGE_QUEUE_RETRY ) {
+      return status;
+    }
+
+    if (
+      !_CORE_message_queue_Set_remaining_timeout( queue_context, deadline )
+    ) {
+      return STATUS_TIMEOUT;
+    }
+
+    _CORE_message_queue_Acquire( the_message_queue, queue_context );
+  }
+}
+
+Status_Control _CORE_message_queue_Release_buffer(
+  CORE_message_queue_Control *the_message_queue,
+  void                       *buffer,
+  Thread_queue_Context       *queue_context
+)
+{
+  CORE_message_queue_Buffer *the_message;
+
+  the_message = _CORE_message_queue_Get_buffer( the_message_queue, buffer );
+  if ( the_message == NULL ) {
+    _CORE_message_queue_Release( the_message_queue, queue_context );
+    return STATUS_INVALID_ADDRESS;
+  }
+
+  _CORE_message_queue_Give_back_buffer(
+    the_message_queue,
+    the_message,
+    queue_context
+  );
+  return STATUS_SUCCESSFUL;
+}
@@ -0,0 +1,427 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/**
+ * @file
+ *
+ * @ingroup RTEMSScoreMessageQueue
+ *
+ * @brief This source file contains the implementation of
+ *   _CORE_message_queue_Submit_many() and _CORE_message_queue_Seize_many().
+ */
+
+/*
+ * Copyright (C) 2026 On-Line Applications Research Corporation (OAR)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/score/coremsgimpl.h>
+#include <rtems/score/threadimpl.h>
+#include <rtems/score/statesimpl.h>
+
+#include <sys/uio.h>
+
+static CORE_message_queue_Control *_CORE_message_queue_Of_queue(
+  Thread_queue_Queue *queue
+)
+{
+  return RTEMS_CONTAINER_OF(
+    queue,
+    CORE_message_queue_Control,
+    Wait_queue.Queue
+  );
+}
+
+/*
+ *  Delivers the next message of the batch to the first waiting thread if it
+ *  waits to receive a message.  The queue is empty in this case.
+ */
+static Thread_Control *_CORE_message_queue_Deliver(
+  Thread_Control       *the_thread,
+  Thread_queue_Queue   *queue,
+  Thread_queue_Context *queue_context
+)
+{
+  CORE_message_queue_Batch_context *context;
+  CORE_message_queue_Control       *the_message_queue;
+  const struct iovec               *message;
+
+  context = RTEMS_CONTAINER_OF(
+    queue_context,
+    CORE_message_queue_Batch_context,
+    Queue_context
+  );
+  the_message_queue = _CORE_message_queue_Of_queue( queue );
+
+  if (
+    context->index == context->count
+      || the_message_queue->number_of_pending_messages != 0
+      || !_CORE_message_queue_Is_receiver( the_thread )
+  ) {
+    return NULL;
+  }
+
+  message = &context->messages[ context->index ];
+
+  if ( the_thread->Wait.option == CORE_MESSAGE_QUEUE_WAIT_RECEIVE_BUFFER ) {
+    CORE_message_queue_Buffer *the_message;
+
+    the_message =
+      _CORE_message_queue_Allocate_message_buffer( the_message_queue );
+    if ( the_message == NULL ) {
+      return NULL;
+    }
+
+    the_message->size = message->iov_len;
+    _CORE_message_queue_Copy_buffer(
+      message->iov_base,
+      the_message->buffer,
+      message->iov_len
+    );
+    *(void **) the_thread->Wait.return_argument_second.mutable_object =
+      _CORE_message_queue_Lend_buffer( the_message );
+  } else {
+    _CORE_message_queue_Copy_buffer(
+      message->iov_base,
+      the_thread->Wait.return_argument_second.mutable_object,
+      message->iov_len
+    );
+  }
+
+  *(size_t *) the_thread->Wait.return_argument = message->iov_len;
+  the_thread->Wait.count = (uint32_t) context->submit_type;
+  ++context->index;
+  return the_thread;
+}
+
+Status_Control _CORE_message_queue_Submit_many(
+  CORE_message_queue_Control       *the_message_queue,
+  const struct iovec               *messages,
+  uint32_t                          count,
+  uint32_t                         *submitted,
+  CORE_message_queue_Submit_types   submit_type,
+  CORE_message_queue_Batch_context *context
+)
+{
+  Per_CPU_Control *cpu_self;
+  Status_Control   status;
+  uint32_t         i;
+
+  /*
+   *  The batch ends before the first message which is too big.
+   */
+  status = STATUS_SUCCESSFUL;
+
+  for ( i = 0; i < count; ++i ) {
+    if ( messages[ i ].iov_len > the_message_queue->maximum_message_size ) {
+      status = STATUS_MESSAGE_INVALID_SIZE;
+      break;
+    }
+  }
+
+  context->messages = messages;
+  context->index = 0;
+  context->count = i;
+  context->submit_type = submit_type;
+  cpu_self = NULL;
+
+  while ( true ) {
+    Thread_Control *the_thread;
+
+    if ( context->index == context->count ) {
+      _CORE_message_queue_Release(
+        the_message_queue,
+        &context->Queue_context
+      );
+      break;
+    }
+
+    /*
+     *  Deliver the messages to the waiting receivers.  They are unblocked
+     *  after a single release of the message queue.  A receiver may enqueue
+     *  itself after the flush, so check again.
+     */
+    if ( the_message_queue->number_of_pending_messages == 0 ) {
+      the_thread = _CORE_message_queue_First_waiter( the_message_queue );
+    } else {
+      the_thread = NULL;
+    }
+
+    if ( the_thread != NULL && _CORE_message_queue_Is_receiver( the_thread ) ) {
+      uint32_t index;
+
+      /*
+       *  Keep the receivers from running until the rest of the batch is
+       *  enqueued, so that they pick it up after a single wakeup.
+       */
+      if ( cpu_self == NULL ) {
+        cpu_self = _Thread_Dispatch_disable_critical(
+          &context->Queue_context.Lock_context.Lock_context
+        );
+      }
+
+      index = context->index;
+      _Thread_queue_Flush_critical(
+        &the_message_queue->Wait_queue.Queue,
+        the_message_queue->operations,
+        _CORE_message_queue_Deliver,
+        &context->Queue_context
+      );
+
+      if ( context->index == index ) {
+        /*
+         *  The first receiver waits for a message buffer on loan and all
+         *  message buffers are in use.
+         */
+        status = STATUS_TOO_MANY;
+        break;
+      }
+
+      _CORE_message_queue_Acquire(
+        the_message_queue,
+        &context->Queue_context
+      );
+      continue;
+    }
+
+    /*
+     *  Enqueue the rest of the batch for a future receive.
+     */
+    while ( context->index < context->count ) {
+      CORE_message_queue_Buffer *the_message;
+      const struct iovec        *message;
+
+      the_message =
+        _CORE_message_queue_Allocate_message_buffer( the_message_queue );
+      if ( the_message == NULL ) {
+        status = STATUS_TOO_MANY;
+        break;
+      }
+
+      message = &messages[ context->index ];
+      _CORE_message_queue_Insert_message(
+        the_message_queue,
+        the_message,
+        message->iov_base,
+        message->iov_len,
+        submit_type
+      );
+      ++context->index;
+    }
+
+    _CORE_message_queue_Release( the_message_queue, &context->Queue_context );
+    break;
+  }
+
+  if ( cpu_self != NULL ) {
+    _Thread_Dispatch_enable( cpu_self );
+  }
+
+  *submitted = context->index;
+  return status;
+}
+
+/*
+ *  Hands over a free message buffer to the first waiting thread if it waits
+ *  to send a message or for a message buffer.
+ */
+static Thread_Control *_CORE_message_queue_Refill(
+  Thread_Control       *the_thread,
+  Thread_queue_Queue   *queue,
+  Thread_queue_Context *queue_context
+)
+{
+  CORE_message_queue_Control *the_message_queue;
+  CORE_message_queue_Buffer  *the_message;
+
+  (void) queue_context;
+  the_message_queue = _CORE_message_queue_Of_queue( queue );
+
+  if ( _CORE_message_queue_Is_receiver( the_thread ) ) {
+    return NULL;
+  }
+
+  the_message =
+    _CORE_message_queue_Allocate_message_buffer( the_message_queue );
+  if ( the_message == NULL ) {
+    return NULL;
+  }
+
+  if ( the_thread->Wait.option == CORE_MESSAGE_QUEUE_WAIT_OBTAIN_BUFFER ) {
+    *(void **) the_thread->Wait.return_argument_second.mutable_object =
+      _CORE_message_queue_Lend_buffer( the_message );
+  } else {
+    _CORE_message_queue_Insert_message(
+      the_message_queue,
+      the_message,
+      the_thread->Wait.return_argument_second.immutable_object,
+      (size_t) the_thread->Wait.option,
+      (CORE_message_queue_Submit_types) the_thread->Wait.count
+    );
+  }
+
+  return the_thread;
+}
+
+static uint32_t _CORE_message_queue_Drain(
+  CORE_message_queue_Control *the_message_queue,
+  Thread_Control             *executing,
+  struct iovec               *messages,
+  uint32_t                    count,
+  Thread_queue_Context       *queue_context
+)
+{
+  uint32_t i;
+
+  for ( i = 0; i < count; ++i ) {
+    CORE_message_queue_Buffer *the_message;
+
+    the_message = _CORE_message_queue_Get_pending_message( the_message_queue );
+    if ( the_message == NULL ) {
+      break;
+    }
+
+    the_message_queue->number_of_pending_messages -= 1;
+    messages[ i ].iov_len = the_message->size;
+    executing->Wait.count =
+      _CORE_message_queue_Get_message_priority( the_message );
+    _CORE_message_queue_Copy_buffer(
+      the_message->buffer,
+      messages[ i ].iov_base,
+      the_message->size
+    );
+    _CORE_message_queue_Free_message_buffer( the_message_queue, the_message );
+  }
+
+  /*
+   *  The freed message buffers are handed over to the waiting threads which
+   *  are unblocked after a single release of the message queue.
+   */
+  if ( i > 0 && the_message_queue->Wait_queue.Queue.heads != NULL ) {
+    _Thread_queue_Flush_critical(
+      &the_message_queue->Wait_queue.Queue,
+      the_message_queue->operations,
+      _CORE_message_queue_Refill,
+      queue_context
+    );
+  } else {
+    _CORE_message_queue_Release( the_message_queue, queue_context );
+  }
+
+  return i;
+}
+
+Status_Control _CORE_message_queue_Seize_many(
+  CORE_message_queue_Control *the_message_queue,
+  Thread_Control             *executing,
+  struct iovec               *messages,
+  uint32_t                    count,
+  uint32_t                   *seized,
+  bool                        wait,
+  Thread_queue_Context       *queue_context
+)
+{
+  Status_Control    status;
+  uint32_t          n;
+  Watchdog_Interval deadline;
+
+  deadline = _CORE_message_queue_Get_deadline( queue_context );
+
+  while ( true ) {
+    if ( the_message_queue->number_of_pending_messages != 0 ) {
+      *seized = _CORE_message_queue_Drain(
+        the_message_queue,
+        executing,
+        messages,
+        count,
+        queue_context
+      );
+      return STATUS_SUCCESSFUL;
+    }
+
+    if ( !wait ) {
+      _CORE_message_queue_Release( the_message_queue, queue_context );
+      *seized = 0;
+      return STATUS_UNSATISFIED;
+    }
+
+    executing->Wait.return_argument_second.mutable_object =
+      messages[ 0 ].iov_base;
+    executing->Wait.return_argument = &messages[ 0 ].iov_len;
+    executing->Wait.option = CORE_MESSAGE_QUEUE_WAIT_RECEIVE;
+    /* Wait.count will be filled in with the message priority */
+
+    _Thread_queue_Context_set_thread_state(
+      queue_context,
+      STATES_WAITING_FOR_MESSAGE
+    );
+    _Thread_queue_Enqueue(
+      &the_message_queue->Wait_queue.Queue,
+      the_message_queue->operations,
+      executing,
+      queue_context
+    );
+    status = _Thread_Wait_get_status( executing );
+
+    if ( status == STATUS_SUCCESSFUL ) {
+      break;
+    }
+
+    if ( status != STATUS_MESSAGE_QUEUE_RETRY ) {
+      *seized = 0;
+      return status;
+    }
+
+    if (
+      !_CORE_message_queue_Set_remaining_timeout( queue_context, deadline )
+    ) {
+      *seized = 0;
+      return STATUS_TIMEOUT;
+    }
+
+    _CORE_message_queue_Acquire( the_message_queue, queue_context );
+  }
+
+  /*
+   *  The first message was delivered while the executing thread was blocked.
+   *  Take the messages which arrived with it in the same batch.
+   */
+  n = 1;
+
+  if ( count > 1 ) {
+    _CORE_message_queue_Acquire( the_message_queue, queue_context );
+    n += _CORE_message_queue_Drain(
+      the_message_queue,
+      executing,
+      &messages[ 1 ],
+      count - 1,
+      queue_context
+    );
+  }
+
+  *seized = n;
+  return STATUS_SUCCESSFUL;
+}
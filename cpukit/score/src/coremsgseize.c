@@ -6,7 +6,7 @@
  * @ingroup RTEMSScoreMessageQueue
  *
  * @brief This source file contains the implementation of
- *   _CORE_message_queue_Seize().
+ *   _CORE_message_queue_Seize() and _CORE_message_queue_Surrender_buffer().
  */
 
 /*
@@ -45,6 +45,58 @@
 #include <rtems/score/threadimpl.h>
 #include <rtems/score/statesimpl.h>
 
+void _CORE_message_queue_Surrender_buffer(
+  CORE_message_queue_Control *the_message_queue,
+  CORE_message_queue_Buffer  *the_message,
+  Thread_queue_Context       *queue_context
+)
+{
+  Thread_Control *the_thread;
+
+  /*
+   *  There could be a thread waiting to send a message or to obtain a
+   *  message buffer.  If there is not, then we can go ahead and free the
+   *  buffer.
+   */
+  the_thread = _CORE_message_queue_First_waiter( the_message_queue );
+  if ( the_thread == NULL || _CORE_message_queue_Is_receiver( the_thread ) ) {
+    _CORE_message_queue_Free_message_buffer( the_message_queue, the_message );
+    _CORE_message_queue_Release( the_message_queue, queue_context );
+    return;
+  }
+
+  the_thread = ( *the_message_queue->operations->surrender )(
+    &the_message_queue->Wait_queue.Queue,
+    the_message_queue->Wait_queue.Queue.heads,
+    NULL,
+    queue_context
+  );
+
+  if ( the_thread->Wait.option == CORE_MESSAGE_QUEUE_WAIT_OBTAIN_BUFFER ) {
+    *(void **) the_thread->Wait.return_argument_second.mutable_object =
+      _CORE_message_queue_Lend_buffer( the_message );
+  } else {
+    /*
+     *  There was a thread waiting to send a message.  This code
+     *  puts the messages in the message queue on behalf of the
+     *  waiting task.
+     */
+    _CORE_message_queue_Insert_message(
+      the_message_queue,
+      the_message,
+      the_thread->Wait.return_argument_second.immutable_object,
+      (size_t) the_thread->Wait.option,
+      (CORE_message_queue_Submit_types) the_thread->Wait.count
+    );
+  }
+
+  _Thread_queue_Resume(
+    &the_message_queue->Wait_queue.Queue,
+    the_thread,
+    queue_context
+  );
+}
+
 Status_Control _CORE_message_queue_Seize(
   CORE_message_queue_Control *the_message_queue,
   Thread_Control             *executing,
@@ -55,93 +107,73 @@ Status_Control _CORE_message_queue_Seize(
 )
 {
   CORE_message_queue_Buffer *the_message;
+  Status_Control             status;
+  Watchdog_Interval          deadline;
 
-  the_message = _CORE_message_queue_Get_pending_message( the_message_queue );
-  if ( the_message != NULL ) {
-    the_message_queue->number_of_pending_messages -= 1;
-
-    *size_p = the_message->size;
-    executing->Wait.count =
-      _CORE_message_queue_Get_message_priority( the_message );
-    _CORE_message_queue_Copy_buffer( the_message->buffer, buffer, *size_p );
-
-    #if !defined(RTEMS_SCORE_COREMSG_ENABLE_BLOCKING_SEND)
-      /*
-       *  There is not an API with blocking sends enabled.
-       *  So return immediately.
-       */
-      _CORE_message_queue_Free_message_buffer(the_message_queue, the_message);
-      _CORE_message_queue_Release( the_message_queue, queue_context );
-      return STATUS_SUCCESSFUL;
-    #else
-    {
-      Thread_queue_Heads *heads;
-      Thread_Control     *the_thread;
-
-      /*
-       *  There could be a thread waiting to send a message.  If there
-       *  is not, then we can go ahead and free the buffer.
-       *
-       *  NOTE: If we note that the queue was not full before this receive,
-       *  then we can avoid this dequeue.
-       */
-      heads = the_message_queue->Wait_queue.Queue.heads;
-      if ( heads == NULL ) {
+  deadline = _CORE_message_queue_Get_deadline( queue_context );
+
+  while ( true ) {
+    the_message = _CORE_message_queue_Get_pending_message( the_message_queue );
+    if ( the_message != NULL ) {
+      the_message_queue->number_of_pending_messages -= 1;
+
+      *size_p = the_message->size;
+      executing->Wait.count =
+        _CORE_message_queue_Get_message_priority( the_message );
+      _CORE_message_queue_Copy_buffer( the_message->buffer, buffer, *size_p );
+
+      #if !defined(RTEMS_SCORE_COREMSG_ENABLE_BLOCKING_SEND)
+        /*
+         *  There is not an API with blocking sends enabled.
+         *  So return immediately.
+         */
         _CORE_message_queue_Free_message_buffer(
           the_message_queue,
           the_message
         );
         _CORE_message_queue_Release( the_message_queue, queue_context );
-        return STATUS_SUCCESSFUL;
-      }
-
-      the_thread = ( *the_message_queue->operations->surrender )(
-        &the_message_queue->Wait_queue.Queue,
-        heads,
-        NULL,
-        queue_context
-      );
-
-      /*
-       *  There was a thread waiting to send a message.  This code
-       *  puts the messages in the message queue on behalf of the
-       *  waiting task.
-       */
-      _CORE_message_queue_Insert_message(
-        the_message_queue,
-        the_message,
-        the_thread->Wait.return_argument_second.immutable_object,
-        (size_t) the_thread->Wait.option,
-        (CORE_message_queue_Submit_types) the_thread->Wait.count
-      );
-      _Thread_queue_Resume(
-        &the_message_queue->Wait_queue.Queue,
-        the_thread,
-        queue_context
-      );
+      #else
+        _CORE_message_queue_Surrender_buffer(
+          the_message_queue,
+          the_message,
+          queue_context
+        );
+      #endif
       return STATUS_SUCCESSFUL;
     }
-    #endif
-  }
 
-  if ( !wait ) {
-    _CORE_message_queue_Release( the_message_queue, queue_context );
-    return STATUS_UNSATISFIED;
-  }
+    if ( !wait ) {
+      _CORE_message_queue_Release( the_message_queue, queue_context );
+      return STATUS_UNSATISFIED;
+    }
 
-  executing->Wait.return_argument_second.mutable_object = buffer;
-  executing->Wait.return_argument = size_p;
-  /* Wait.count will be filled in with the message priority */
+    executing->Wait.return_argument_second.mutable_object = buffer;
+    executing->Wait.return_argument = size_p;
+    executing->Wait.option = CORE_MESSAGE_QUEUE_WAIT_RECEIVE;
+    /* Wait.count will be filled in with the message priority */
 
-  _Thread_queue_Context_set_thread_state(
-    queue_context,
-    STATES_WAITING_FOR_MESSAGE
-  );
-  _Thread_queue_Enqueue(
-    &the_message_queue->Wait_queue.Queue,
-    the_message_queue->operations,
-    executing,
-    queue_context
-  );
-  return _Thread_Wait_get_status( executing );
+    _Thread_queue_Context_set_thread_state(
+      queue_context,
+      STATES_WAITING_FOR_MESSAGE
+    );
+    _Thread_queue_Enqueue(
+      &the_message_queue->Wait_queue.Queue,
+      the_message_queue->operations,
+      executing,
+      queue_context
+    );
+    status = _Thread_Wait_get_status( executing );
+
+    if ( status != STATUS_MESSAGE_QUEUE_RETRY ) {
+      return status;
+    }
+
+    if (
+      !_CORE_message_queue_Set_remaining_timeout( queue_context, deadline )
+    ) {
+      return STATUS_TIMEOUT;
+    }
+
+    _CORE_message_queue_Acquire( the_message_queue, queue_context );
+  }
 }
@@ -52,5 +52,5 @@ void _Objects_Namespace_remove_string(
   _Assert( _Objects_Has_string_name( information ) );
   name = RTEMS_DECONST( char *, the_object->name.name_p );
   the_object->name.name_p = NULL;
-  _Workspace_Free( name );
+  _Workspace_Slab_string_free( name );
 }
@@ -55,12 +55,12 @@ Status_Control _Objects_Set_name(
     char   *dup;
 
     length = strnlen( name, information->name_length );
-    dup = _Workspace_String_duplicate( name, length );
+    dup = _Workspace_Slab_string_duplicate( name, length );
     if ( dup == NULL ) {
       return STATUS_NO_MEMORY;
     }
 
-    _Workspace_Free( RTEMS_DECONST( char *, the_object->name.name_p ) );
+    _Workspace_Slab_string_free( the_object->name.name_p );
     the_object->name.name_p = dup;
   } else {
     char c[ 4 ];
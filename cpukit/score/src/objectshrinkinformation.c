@@ -117,7 +117,13 @@ void _Objects_Shrink_information(
   for ( block = 1; block < block_count; block++ ) {
     if ( information->inactive_per_block[ block ] == objects_per_block ) {
       _Objects_Free_objects_block( information, block );
-      return;
+      break;
     }
   }
+
+  /*
+   * Objects of unlimited classes may own workspace slab objects, for example
+   * names, so return the empty slabs to the workspace as well.
+   */
+  _Workspace_Slab_reclaim();
 }
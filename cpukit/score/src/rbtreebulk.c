@@ -0,0 +1,294 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/**
+ * @file
+ *
+ * @ingroup RTEMSScoreRBTree
+ *
+ * @brief This source file contains the implementation of
+ *   _RBTree_Build_sorted() and _RBTree_Extract_range().
+ */
+
+/*
+ * Copyright (C) 2026 On-Line Applications Research Corporation (OAR)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/score/rbtreeimpl.h>
+
+#include <limits.h>
+
+/*
+ * The bulk operations use lists of nodes linked through the right child
+ * pointer of the nodes.
+ */
+
+static size_t _RBTree_Red_depth( size_t count )
+{
+  size_t depth;
+
+  depth = 0;
+
+  while ( count > 1 ) {
+    count /= 2;
+    ++depth;
+  }
+
+  /* The root shall be black */
+  return depth > 0 ? depth : SIZE_MAX;
+}
+
+/*
+ * Builds a subtree of minimal height from the first count nodes of the list.
+ * The sizes of the subtrees of each node differ by at most one, so all levels
+ * except the deepest level are complete.  Colouring the nodes of the deepest
+ * level red and all other nodes black yields a valid red-black tree.
+ */
+static RBTree_Node *_RBTree_Build_from_list(
+  RBTree_Node **list,
+  size_t        count,
+  size_t        depth,
+  size_t        red_depth
+)
+{
+  RBTree_Node *left;
+  RBTree_Node *node;
+  RBTree_Node *right;
+  size_t       left_count;
+
+  if ( count == 0 ) {
+    return NULL;
+  }
+
+  left_count = count / 2;
+  left = _RBTree_Build_from_list( list, left_count, depth + 1, red_depth );
+  node = *list;
+  *list = RB_RIGHT( node, Node );
+  right = _RBTree_Build_from_list(
+    list,
+    count - left_count - 1,
+    depth + 1,
+    red_depth
+  );
+
+  RB_LEFT( node, Node ) = left;
+  RB_RIGHT( node, Node ) = right;
+  RB_COLOR( node, Node ) = ( depth == red_depth ) ? RB_RED : RB_BLACK;
+
+  if ( left != NULL ) {
+    RB_PARENT( left, Node ) = node;
+  }
+
+  if ( right != NULL ) {
+    RB_PARENT( right, Node ) = node;
+  }
+
+  return node;
+}
+
+static void _RBTree_Build_from_list_root(
+  RBTree_Control *the_rbtree,
+  RBTree_Node    *list,
+  size_t          count
+)
+{
+  RBTree_Node *root;
+
+  root = _RBTree_Build_from_list(
+    &list,
+    count,
+    0,
+    _RBTree_Red_depth( count )
+  );
+
+  if ( root != NULL ) {
+    RB_PARENT( root, Node ) = NULL;
+  }
+
+  RB_ROOT( the_rbtree ) = root;
+}
+
+/*
+ * Converts the tree into a sorted list by right rotations in linear time
+ * (first phase of the Day-Stout-Warren algorithm).  The parent pointers and
+ * colours are invalid afterwards.
+ */
+static RBTree_Node *_RBTree_To_list( RBTree_Node *root )
+{
+  RBTree_Node  head;
+  RBTree_Node *tail;
+  RBTree_Node *rest;
+
+  tail = &head;
+  rest = root;
+
+  while ( rest != NULL ) {
+    RBTree_Node *left;
+
+    left = RB_LEFT( rest, Node );
+
+    if ( left == NULL ) {
+      RB_RIGHT( tail, Node ) = rest;
+      tail = rest;
+      rest = RB_RIGHT( rest, Node );
+    } else {
+      RB_LEFT( rest, Node ) = RB_RIGHT( left, Node );
+      RB_RIGHT( left, Node ) = rest;
+      rest = left;
+    }
+  }
+
+  RB_RIGHT( tail, Node ) = NULL;
+  return RB_RIGHT( &head, Node );
+}
+
+void _RBTree_Build_sorted(
+  RBTree_Control    *the_rbtree,
+  RBTree_Node *const nodes[],
+  size_t             count
+)
+{
+  size_t i;
+
+  _Assert( _RBTree_Is_empty( the_rbtree ) );
+
+  if ( count == 0 ) {
+    return;
+  }
+
+  for ( i = 1; i < count; ++i ) {
+    RB_RIGHT( nodes[ i - 1 ], Node ) = nodes[ i ];
+  }
+
+  _RBTree_Build_from_list_root( the_rbtree, nodes[ 0 ], count );
+}
+
+static bool _RBTree_Is_range_small(
+  const RBTree_Control *the_rbtree,
+  size_t                range_count
+)
+{
+  const RBTree_Node *node;
+  size_t             black_height;
+
+  black_height = 0;
+  node = RB_ROOT( the_rbtree );
+
+  while ( node != NULL ) {
+    if ( RB_COLOR( node, Node ) == RB_BLACK ) {
+      ++black_height;
+    }
+
+    node = RB_LEFT( node, Node );
+  }
+
+  /*
+   * The tree has at least 2^black_height - 1 nodes.  Extracting a node costs
+   * about 2 * black_height steps, rebuilding the tree costs some steps per
+   * node.
+   */
+  if ( black_height >= sizeof( size_t ) * CHAR_BIT ) {
+    return true;
+  }
+
+  return 2 * range_count < ( (size_t) 1 << black_height ) - 1;
+}
+
+size_t _RBTree_Extract_range(
+  RBTree_Control         *the_rbtree,
+  RBTree_Node            *first,
+  RBTree_Node            *last,
+  RBTree_Extract_visitor  visitor,
+  void                   *visitor_arg
+)
+{
+  RBTree_Node *node;
+  RBTree_Node *next;
+  RBTree_Node  head;
+  RBTree_Node *previous;
+  size_t       range_count;
+  size_t       count;
+
+  range_count = 1;
+
+  for ( node = first; node != last; node = _RBTree_Successor( node ) ) {
+    _Assert( node != NULL );
+    ++range_count;
+  }
+
+  if ( _RBTree_Is_range_small( the_rbtree, range_count ) ) {
+    next = first;
+
+    do {
+      node = next;
+      next = _RBTree_Successor( node );
+      _RBTree_Extract( the_rbtree, node );
+      _RBTree_Set_off_tree( node );
+
+      if ( visitor != NULL ) {
+        ( *visitor )( node, visitor_arg );
+      }
+    } while ( node != last );
+
+    return range_count;
+  }
+
+  RB_RIGHT( &head, Node ) = _RBTree_To_list( RB_ROOT( the_rbtree ) );
+  previous = &head;
+  count = 0;
+
+  while ( RB_RIGHT( previous, Node ) != first ) {
+    previous = RB_RIGHT( previous, Node );
+    ++count;
+  }
+
+  RB_RIGHT( previous, Node ) = RB_RIGHT( last, Node );
+  RB_RIGHT( last, Node ) = NULL;
+
+  while ( RB_RIGHT( previous, Node ) != NULL ) {
+    previous = RB_RIGHT( previous, Node );
+    ++count;
+  }
+
+  RB_ROOT( the_rbtree ) = NULL;
+  _RBTree_Build_from_list_root( the_rbtree, RB_RIGHT( &head, Node ), count );
+
+  node = first;
+
+  while ( node != NULL ) {
+    next = RB_RIGHT( node, Node );
+    _RBTree_Set_off_tree( node );
+
+    if ( visitor != NULL ) {
+      ( *visitor )( node, visitor_arg );
+    }
+
+    node = next;
+  }
+
+  return range_count;
+}
@@ -0,0 +1,466 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/**
+ * @file
+ *
+ * @ingroup RTEMSScoreRBTree
+ *
+ * @brief This source file contains the implementation of the compact
+ *   red-black tree.
+ */
+
+/*
+ * Copyright (C) 2026 On-Line Applications Research Corporation (OAR)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/score/rbtreecompact.h>
+
+static void _RBTree_Compact_Set_parent(
+  RBTree_Compact_node *the_node,
+  RBTree_Compact_node *parent
+)
+{
+  the_node->parent_and_color = (uintptr_t) parent |
+    ( the_node->parent_and_color & RBTREE_COMPACT_RED );
+}
+
+static void _RBTree_Compact_Set_red( RBTree_Compact_node *the_node )
+{
+  the_node->parent_and_color |= RBTREE_COMPACT_RED;
+}
+
+static void _RBTree_Compact_Set_black( RBTree_Compact_node *the_node )
+{
+  the_node->parent_and_color &= ~RBTREE_COMPACT_RED;
+}
+
+static void _RBTree_Compact_Replace_child(
+  RBTree_Compact_control *the_rbtree,
+  RBTree_Compact_node    *parent,
+  RBTree_Compact_node    *old_child,
+  RBTree_Compact_node    *new_child
+)
+{
+  if ( parent == NULL ) {
+    the_rbtree->root = new_child;
+  } else if ( parent->left == old_child ) {
+    parent->left = new_child;
+  } else {
+    parent->right = new_child;
+  }
+}
+
+static void _RBTree_Compact_Rotate_left(
+  RBTree_Compact_control *the_rbtree,
+  RBTree_Compact_node    *the_node,
+  RBTree_Compact_augment  augment
+)
+{
+  RBTree_Compact_node *right;
+  RBTree_Compact_node *parent;
+
+  right = the_node->right;
+  the_node->right = right->left;
+
+  if ( right->left != NULL ) {
+    _RBTree_Compact_Set_parent( right->left, the_node );
+  }
+
+  parent = _RBTree_Compact_Parent( the_node );
+  _RBTree_Compact_Set_parent( right, parent );
+  _RBTree_Compact_Replace_child( the_rbtree, parent, the_node, right );
+  right->left = the_node;
+  _RBTree_Compact_Set_parent( the_node, right );
+
+  if ( augment != NULL ) {
+    ( *augment )( the_node );
+    ( *augment )( right );
+  }
+}
+
+static void _RBTree_Compact_Rotate_right(
+  RBTree_Compact_control *the_rbtree,
+  RBTree_Compact_node    *the_node,
+  RBTree_Compact_augment  augment
+)
+{
+  RBTree_Compact_node *left;
+  RBTree_Compact_node *parent;
+
+  left = the_node->left;
+  the_node->left = left->right;
+
+  if ( left->right != NULL ) {
+    _RBTree_Compact_Set_parent( left->right, the_node );
+  }
+
+  parent = _RBTree_Compact_Parent( the_node );
+  _RBTree_Compact_Set_parent( left, parent );
+  _RBTree_Compact_Replace_child( the_rbtree, parent, the_node, left );
+  left->right = the_node;
+  _RBTree_Compact_Set_parent( the_node, left );
+
+  if ( augment != NULL ) {
+    ( *augment )( the_node );
+    ( *augment )( left );
+  }
+}
+
+void _RBTree_Compact_Insert_color(
+  RBTree_Compact_control *the_rbtree,
+  RBTree_Compact_node    *the_node,
+  RBTree_Compact_augment  augment
+)
+{
+  RBTree_Compact_node *parent;
+
+  while (
+    ( parent = _RBTree_Compact_Parent( the_node ) ) != NULL
+      && _RBTree_Compact_Is_red( parent )
+  ) {
+    RBTree_Compact_node *grandparent;
+    RBTree_Compact_node *uncle;
+
+    /* A red parent is not the root, so the grandparent exists */
+    grandparent = _RBTree_Compact_Parent( parent );
+
+    if ( parent == grandparent->left ) {
+      uncle = grandparent->right;
+
+      if ( _RBTree_Compact_Is_red( uncle ) ) {
+        _RBTree_Compact_Set_black( uncle );
+        _RBTree_Compact_Set_black( parent );
+        _RBTree_Compact_Set_red( grandparent );
+        the_node = grandparent;
+        continue;
+      }
+
+      if ( the_node == parent->right ) {
+        _RBTree_Compact_Rotate_left( the_rbtree, parent, augment );
+        parent = the_node;
+      }
+
+      _RBTree_Compact_Set_black( parent );
+      _RBTree_Compact_Set_red( grandparent );
+      _RBTree_Compact_Rotate_right( the_rbtree, grandparent, augment );
+    } else {
+      uncle = grandparent->left;
+
+      if ( _RBTree_Compact_Is_red( uncle ) ) {
+        _RBTree_Compact_Set_black( uncle );
+        _RBTree_Compact_Set_black( parent );
+        _RBTree_Compact_Set_red( grandparent );
+        the_node = grandparent;
+        continue;
+      }
+
+      if ( the_node == parent->left ) {
+        _RBTree_Compact_Rotate_right( the_rbtree, parent, augment );
+        parent = the_node;
+      }
+
+      _RBTree_Compact_Set_black( parent );
+      _RBTree_Compact_Set_red( grandparent );
+      _RBTree_Compact_Rotate_left( the_rbtree, grandparent, augment );
+    }
+
+    break;
+  }
+
+  _RBTree_Compact_Set_black( the_rbtree->root );
+}
+
+/*
+ * Restores the red-black properties after the extraction of a black node.
+ * The child node which took the place of the extracted node may be NULL, so
+ * its parent is passed separately.
+ */
+static void _RBTree_Compact_Extract_color(
+  RBTree_Compact_control *the_rbtree,
+  RBTree_Compact_node    *child,
+  RBTree_Compact_node    *parent,
+  RBTree_Compact_augment  augment
+)
+{
+  while ( child != the_rbtree->root && !_RBTree_Compact_Is_red( child ) ) {
+    RBTree_Compact_node *sibling;
+
+    if ( child == parent->left ) {
+      sibling = parent->right;
+
+      if ( _RBTree_Compact_Is_red( sibling ) ) {
+        _RBTree_Compact_Set_black( sibling );
+        _RBTree_Compact_Set_red( parent );
+        _RBTree_Compact_Rotate_left( the_rbtree, parent, augment );
+        sibling = parent->right;
+      }
+
+      if (
+        !_RBTree_Compact_Is_red( sibling->left )
+          && !_RBTree_Compact_Is_red( sibling->right )
+      ) {
+        _RBTree_Compact_Set_red( sibling );
+        child = parent;
+        parent = _RBTree_Compact_Parent( child );
+        continue;
+      }
+
+      if ( !_RBTree_Compact_Is_red( sibling->right ) ) {
+        _RBTree_Compact_Set_black( sibling->left );
+        _RBTree_Compact_Set_red( sibling );
+        _RBTree_Compact_Rotate_right( the_rbtree, sibling, augment );
+        sibling = parent->right;
+      }
+
+      if ( _RBTree_Compact_Is_red( parent ) ) {
+        _RBTree_Compact_Set_red( sibling );
+      } else {
+        _RBTree_Compact_Set_black( sibling );
+      }
+
+      _RBTree_Compact_Set_black( parent );
+      _RBTree_Compact_Set_black( sibling->right );
+      _RBTree_Compact_Rotate_left( the_rbtree, parent, augment );
+    } else {
+      sibling = parent->left;
+
+      if ( _RBTree_Compact_Is_red( sibling ) ) {
+        _RBTree_Compact_Set_black( sibling );
+        _RBTree_Compact_Set_red( parent );
+        _RBTree_Compact_Rotate_right( the_rbtree, parent, augment );
+        sibling = parent->left;
+      }
+
+      if (
+        !_RBTree_Compact_Is_red( sibling->left )
+          && !_RBTree_Compact_Is_red( sibling->right )
+      ) {
+        _RBTree_Compact_Set_red( sibling );
+        child = parent;
+        parent = _RBTree_Compact_Parent( child );
+        continue;
+      }
+
+      if ( !_RBTree_Compact_Is_red( sibling->left ) ) {
+        _RBTree_Compact_Set_black( sibling->right );
+        _RBTree_Compact_Set_red( sibling );
+        _RBTree_Compact_Rotate_left( the_rbtree, sibling, augment );
+        sibling = parent->left;
+      }
+
+      if ( _RBTree_Compact_Is_red( parent ) ) {
+        _RBTree_Compact_Set_red( sibling );
+      } else {
+        _RBTree_Compact_Set_black( sibling );
+      }
+
+      _RBTree_Compact_Set_black( parent );
+      _RBTree_Compact_Set_black( sibling->left );
+      _RBTree_Compact_Rotate_right( the_rbtree, parent, augment );
+    }
+
+    child = the_rbtree->root;
+  }
+
+  if ( child != NULL ) {
+    _RBTree_Compact_Set_black( child );
+  }
+}
+
+void _RBTree_Compact_Extract(
+  RBTree_Compact_control *the_rbtree,
+  RBTree_Compact_node    *the_node,
+  RBTree_Compact_augment  augment
+)
+{
+  RBTree_Compact_node *child;
+  RBTree_Compact_node *parent;
+  bool                 is_black;
+
+  _Assert( !_RBTree_Compact_Is_node_off_tree( the_node ) );
+
+  if ( the_node->left == NULL || the_node->right == NULL ) {
+    child = the_node->left != NULL ? the_node->left : the_node->right;
+    parent = _RBTree_Compact_Parent( the_node );
+    is_black = !_RBTree_Compact_Is_red( the_node );
+    _RBTree_Compact_Replace_child( the_rbtree, parent, the_node, child );
+
+    if ( child != NULL ) {
+      _RBTree_Compact_Set_parent( child, parent );
+    }
+  } else {
+    RBTree_Compact_node *successor;
+
+    successor = the_node->right;
+
+    while ( successor->left != NULL ) {
+      successor = successor->left;
+    }
+
+    child = successor->right;
+    is_black = !_RBTree_Compact_Is_red( successor );
+
+    if ( _RBTree_Compact_Parent( successor ) == the_node ) {
+      parent = successor;
+    } else {
+      parent = _RBTree_Compact_Parent( successor );
+      parent->left = child;
+
+      if ( child != NULL ) {
+        _RBTree_Compact_Set_parent( child, parent );
+      }
+
+      successor->right = the_node->right;
+      _RBTree_Compact_Set_parent( successor->right, successor );
+    }
+
+    successor->left = the_node->left;
+    _RBTree_Compact_Set_parent( successor->left, successor );
+    _RBTree_Compact_Replace_child(
+      the_rbtree,
+      _RBTree_Compact_Parent( the_node ),
+      the_node,
+      successor
+    );
+    successor->parent_and_color = the_node->parent_and_color;
+  }
+
+  if ( augment != NULL ) {
+    RBTree_Compact_node *update;
+
+    /*
+     * The subtrees of all nodes from the parent of the removed position up to
+     * the root lost one node.  In case a successor took the place of the
+     * extracted node, it is on this path.
+     */
+    for (
+      update = parent;
+      update != NULL;
+      update = _RBTree_Compact_Parent( update )
+    ) {
+      ( *augment )( update );
+    }
+  }
+
+  if ( is_black ) {
+    _RBTree_Compact_Extract_color( the_rbtree, child, parent, augment );
+  }
+
+  _RBTree_Compact_Set_off_tree( the_node );
+}
+
+RBTree_Compact_node *_RBTree_Compact_Minimum(
+  const RBTree_Compact_control *the_rbtree
+)
+{
+  RBTree_Compact_node *node;
+
+  node = the_rbtree->root;
+
+  if ( node != NULL ) {
+    while ( node->left != NULL ) {
+      node = node->left;
+    }
+  }
+
+  return node;
+}
+
+RBTree_Compact_node *_RBTree_Compact_Maximum(
+  const RBTree_Compact_control *the_rbtree
+)
+{
+  RBTree_Compact_node *node;
+
+  node = the_rbtree->root;
+
+  if ( node != NULL ) {
+    while ( node->right != NULL ) {
+      node = node->right;
+    }
+  }
+
+  return node;
+}
+
+RBTree_Compact_node *_RBTree_Compact_Successor(
+  const RBTree_Compact_node *the_node
+)
+{
+  RBTree_Compact_node *node;
+  RBTree_Compact_node *parent;
+
+  node = the_node->right;
+
+  if ( node != NULL ) {
+    while ( node->left != NULL ) {
+      node = node->left;
+    }
+
+    return node;
+  }
+
+  node = RTEMS_DECONST( RBTree_Compact_node *, the_node );
+  parent = _RBTree_Compact_Parent( node );
+
+  while ( parent != NULL && node == parent->right ) {
+    node = parent;
+    parent = _RBTree_Compact_Parent( node );
+  }
+
+  return parent;
+}
+
+RBTree_Compact_node *_RBTree_Compact_Predecessor(
+  const RBTree_Compact_node *the_node
+)
+{
+  RBTree_Compact_node *node;
+  RBTree_Compact_node *parent;
+
+  node = the_node->left;
+
+  if ( node != NULL ) {
+    while ( node->right != NULL ) {
+      node = node->right;
+    }
+
+    return node;
+  }
+
+  node = RTEMS_DECONST( RBTree_Compact_node *, the_node );
+  parent = _RBTree_Compact_Parent( node );
+
+  while ( parent != NULL && node == parent->left ) {
+    node = parent;
+    parent = _RBTree_Compact_Parent( node );
+  }
+
+  return parent;
+}
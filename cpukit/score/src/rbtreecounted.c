@@ -0,0 +1,99 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/**
+ * @file
+ *
+ * @ingroup RTEMSScoreRBTree
+ *
+ * @brief This source file contains the implementation of
+ *   _RBTree_Counted_Augment(), _RBTree_Counted_Nth(), and
+ *   _RBTree_Counted_Rank().
+ */
+
+/*
+ * Copyright (C) 2026 On-Line Applications Research Corporation (OAR)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/score/rbtreecompact.h>
+
+void _RBTree_Counted_Augment( RBTree_Compact_node *the_node )
+{
+  _RBTree_Counted_Node( the_node )->count = 1 +
+    _RBTree_Counted_Subtree_count( the_node->left ) +
+    _RBTree_Counted_Subtree_count( the_node->right );
+}
+
+RBTree_Counted_node *_RBTree_Counted_Nth(
+  const RBTree_Compact_control *the_rbtree,
+  size_t                        index
+)
+{
+  const RBTree_Compact_node *node;
+
+  node = the_rbtree->root;
+
+  while ( node != NULL ) {
+    size_t left_count;
+
+    left_count = _RBTree_Counted_Subtree_count( node->left );
+
+    if ( index < left_count ) {
+      node = node->left;
+    } else if ( index == left_count ) {
+      return _RBTree_Counted_Node( node );
+    } else {
+      index -= left_count + 1;
+      node = node->right;
+    }
+  }
+
+  return NULL;
+}
+
+size_t _RBTree_Counted_Rank( const RBTree_Counted_node *the_node )
+{
+  const RBTree_Compact_node *node;
+  const RBTree_Compact_node *parent;
+  size_t                     rank;
+
+  node = &the_node->Node;
+  rank = _RBTree_Counted_Subtree_count( node->left );
+  parent = _RBTree_Compact_Parent( node );
+
+  while ( parent != NULL ) {
+    if ( node == parent->right ) {
+      rank += _RBTree_Counted_Subtree_count( parent->left ) + 1;
+    }
+
+    node = parent;
+    parent = _RBTree_Compact_Parent( node );
+  }
+
+  return rank;
+}
@@ -0,0 +1,586 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/**
+ * @file
+ *
+ * @ingroup RTEMSScoreWorkspace
+ *
+ * @brief This source file contains the implementation of
+ *   _Workspace_Slab_allocate(), _Workspace_Slab_free(),
+ *   _Workspace_Slab_reclaim(), and _Workspace_Slab_get_information().
+ */
+
+/*
+ * Copyright (C) 2026 On-Line Applications Research Corporation (OAR)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/score/wkspace.h>
+#include <rtems/score/assert.h>
+#include <rtems/score/chainimpl.h>
+#include <rtems/score/heapimpl.h>
+#include <rtems/score/isrlock.h>
+#include <rtems/score/objectimpl.h>
+#include <rtems/score/percpudata.h>
+#include <rtems/score/smp.h>
+#include <rtems/score/sysstate.h>
+#include <rtems/sysinit.h>
+
+#include <string.h>
+
+/*
+ * A slab is an area of WORKSPACE_SLAB_SIZE bytes allocated from the workspace
+ * with an alignment of WORKSPACE_SLAB_SIZE bytes.  It starts with the slab
+ * control followed by the objects of one size class.  The slab of an object
+ * is obtained by masking the object address.
+ *
+ * The slabs of a size class with free objects are on the partial chain,
+ * slabs without used objects are on the empty chain, and full slabs are off
+ * chain.  The slab chains are protected by the slab lock.
+ *
+ * Free objects are cached per processor in magazines.  A processor cache is
+ * protected by its own ISR lock which is normally only acquired by the owner
+ * processor.  The magazines exchange batches of objects with the slabs.
+ */
+
+#define WORKSPACE_SLAB_CACHE_BATCH 8
+
+#define WORKSPACE_SLAB_CACHE_MAXIMUM ( 2 * WORKSPACE_SLAB_CACHE_BATCH )
+
+#define WORKSPACE_SLAB_OBJECTS_OFFSET \
+  RTEMS_ALIGN_UP( sizeof( Workspace_Slab ), CPU_HEAP_ALIGNMENT )
+
+typedef struct {
+  Chain_Node  Node;
+  void       *free_objects;
+  uint32_t    used_objects;
+  uint32_t    class_index;
+} Workspace_Slab;
+
+typedef struct {
+  Chain_Control Partial;
+  Chain_Control Empty;
+  uint32_t      slab_count;
+  uint32_t      empty_slab_count;
+  uint32_t      used_object_count;
+  uint32_t      allocation_count;
+  uint32_t      reclaimed_slab_count;
+} Workspace_Slab_class;
+
+typedef struct {
+  uint32_t  count;
+  uint32_t  allocation_count;
+  void     *objects[ WORKSPACE_SLAB_CACHE_MAXIMUM ];
+} Workspace_Slab_magazine;
+
+typedef struct {
+  Workspace_Slab_magazine Magazines[ WORKSPACE_SLAB_CLASS_COUNT ];
+  ISR_LOCK_MEMBER( Lock )
+} Workspace_Slab_cache;
+
+RTEMS_STATIC_ASSERT(
+  WORKSPACE_SLAB_OBJECTS_OFFSET + WORKSPACE_SLAB_MAXIMUM_OBJECT_SIZE
+    <= WORKSPACE_SLAB_SIZE,
+  WORKSPACE_SLAB_SIZE
+);
+
+ISR_LOCK_DEFINE( static, _Workspace_Slab_lock, "Workspace Slab" )
+
+static Workspace_Slab_class _Workspace_Slab_classes[
+  WORKSPACE_SLAB_CLASS_COUNT
+] = {
+#define WORKSPACE_SLAB_CLASS_INITIALIZER( index ) \
+  { \
+    CHAIN_INITIALIZER_EMPTY( _Workspace_Slab_classes[ index ].Partial ), \
+    CHAIN_INITIALIZER_EMPTY( _Workspace_Slab_classes[ index ].Empty ), \
+    0, 0, 0, 0, 0 \
+  }
+  WORKSPACE_SLAB_CLASS_INITIALIZER( 0 ),
+  WORKSPACE_SLAB_CLASS_INITIALIZER( 1 ),
+  WORKSPACE_SLAB_CLASS_INITIALIZER( 2 ),
+  WORKSPACE_SLAB_CLASS_INITIALIZER( 3 ),
+  WORKSPACE_SLAB_CLASS_INITIALIZER( 4 )
+};
+
+RTEMS_STATIC_ASSERT(
+  WORKSPACE_SLAB_CLASS_COUNT == 5,
+  WORKSPACE_SLAB_CLASS_COUNT
+);
+
+PER_CPU_DATA_NEED_INITIALIZATION();
+
+static PER_CPU_DATA_ITEM( Workspace_Slab_cache, _Workspace_Slab_caches );
+
+static uint32_t _Workspace_Slab_class_index( size_t size )
+{
+  uint32_t index;
+  size_t   object_size;
+
+  index = 0;
+  object_size = WORKSPACE_SLAB_MINIMUM_OBJECT_SIZE;
+
+  while ( object_size < size ) {
+    object_size <<= 1;
+    ++index;
+  }
+
+  return index;
+}
+
+static uint32_t _Workspace_Slab_object_size( uint32_t class_index )
+{
+  return RTEMS_ALIGN_UP(
+    WORKSPACE_SLAB_MINIMUM_OBJECT_SIZE << class_index,
+    CPU_HEAP_ALIGNMENT
+  );
+}
+
+static uint32_t _Workspace_Slab_objects_per_slab( uint32_t class_index )
+{
+  return ( WORKSPACE_SLAB_SIZE - WORKSPACE_SLAB_OBJECTS_OFFSET )
+    / _Workspace_Slab_object_size( class_index );
+}
+
+static Workspace_Slab *_Workspace_Slab_of_object( const void *object )
+{
+  return (Workspace_Slab *)
+    ( (uintptr_t) object & ~( (uintptr_t) WORKSPACE_SLAB_SIZE - 1 ) );
+}
+
+static Workspace_Slab_cache *_Workspace_Slab_get_cache(
+  const Per_CPU_Control *cpu
+)
+{
+  Workspace_Slab_cache *cache;
+
+  cache = PER_CPU_DATA_GET(
+    cpu,
+    Workspace_Slab_cache,
+    _Workspace_Slab_caches
+  );
+  return cache;
+}
+
+static Workspace_Slab_cache *_Workspace_Slab_cache_acquire(
+  ISR_lock_Context *lock_context
+)
+{
+  Workspace_Slab_cache *cache;
+
+  _ISR_lock_ISR_disable( lock_context );
+  cache = _Workspace_Slab_get_cache( _Per_CPU_Get() );
+  _ISR_lock_Acquire( &cache->Lock, lock_context );
+  return cache;
+}
+
+static void _Workspace_Slab_cache_release(
+  Workspace_Slab_cache *cache,
+  ISR_lock_Context     *lock_context
+)
+{
+  _ISR_lock_Release_and_ISR_enable( &cache->Lock, lock_context );
+}
+
+static void *_Workspace_Slab_take( Workspace_Slab_class *slab_class )
+{
+  Workspace_Slab *slab;
+  void           *object;
+
+  if ( !_Chain_Is_empty( &slab_class->Partial ) ) {
+    slab = (Workspace_Slab *) _Chain_First( &slab_class->Partial );
+  } else if ( !_Chain_Is_empty( &slab_class->Empty ) ) {
+    slab = (Workspace_Slab *) _Chain_Get_first_unprotected(
+      &slab_class->Empty
+    );
+    --slab_class->empty_slab_count;
+    _Chain_Prepend_unprotected( &slab_class->Partial, &slab->Node );
+  } else {
+    return NULL;
+  }
+
+  object = slab->free_objects;
+  _Assert( object != NULL );
+  slab->free_objects = *(void **) object;
+  ++slab->used_objects;
+  ++slab_class->used_object_count;
+
+  if ( slab->free_objects == NULL ) {
+    _Chain_Extract_unprotected( &slab->Node );
+    _Chain_Set_off_chain( &slab->Node );
+  }
+
+  return object;
+}
+
+static void _Workspace_Slab_give(
+  Workspace_Slab_class *slab_class,
+  void                 *object
+)
+{
+  Workspace_Slab *slab;
+
+  slab = _Workspace_Slab_of_object( object );
+  _Assert( slab->used_objects > 0 );
+  _Assert( slab_class == &_Workspace_Slab_classes[ slab->class_index ] );
+
+  if ( slab->free_objects == NULL ) {
+    _Chain_Prepend_unprotected( &slab_class->Partial, &slab->Node );
+  }
+
+  *(void **) object = slab->free_objects;
+  slab->free_objects = object;
+  --slab->used_objects;
+  --slab_class->used_object_count;
+
+  if ( slab->used_objects == 0 ) {
+    _Chain_Extract_unprotected( &slab->Node );
+    _Chain_Append_unprotected( &slab_class->Empty, &slab->Node );
+    ++slab_class->empty_slab_count;
+  }
+}
+
+static void _Workspace_Slab_flush(
+  Workspace_Slab_class    *slab_class,
+  Workspace_Slab_magazine *magazine,
+  uint32_t                 count
+)
+{
+  while ( magazine->count > count ) {
+    --magazine->count;
+    _Workspace_Slab_give( slab_class, magazine->objects[ magazine->count ] );
+  }
+}
+
+static void *_Workspace_Slab_cache_get( uint32_t class_index )
+{
+  Workspace_Slab_cache    *cache;
+  Workspace_Slab_magazine *magazine;
+  ISR_lock_Context         lock_context;
+  void                    *object;
+
+  cache = _Workspace_Slab_cache_acquire( &lock_context );
+  magazine = &cache->Magazines[ class_index ];
+
+  if ( magazine->count == 0 ) {
+    Workspace_Slab_class *slab_class;
+    ISR_lock_Context      slab_lock_context;
+
+    slab_class = &_Workspace_Slab_classes[ class_index ];
+    _ISR_lock_Acquire( &_Workspace_Slab_lock, &slab_lock_context );
+
+    while ( magazine->count < WORKSPACE_SLAB_CACHE_BATCH ) {
+      object = _Workspace_Slab_take( slab_class );
+
+      if ( object == NULL ) {
+        break;
+      }
+
+      magazine->objects[ magazine->count ] = object;
+      ++magazine->count;
+    }
+
+    _ISR_lock_Release( &_Workspace_Slab_lock, &slab_lock_context );
+  }
+
+  if ( magazine->count > 0 ) {
+    --magazine->count;
+    ++magazine->allocation_count;
+    object = magazine->objects[ magazine->count ];
+  } else {
+    object = NULL;
+  }
+
+  _Workspace_Slab_cache_release( cache, &lock_context );
+  return object;
+}
+
+static void *_Workspace_Slab_grow( uint32_t class_index )
+{
+  Workspace_Slab       *slab;
+  Workspace_Slab_class *slab_class;
+  ISR_lock_Context      lock_context;
+  uint32_t              object_size;
+  uint32_t              objects_per_slab;
+  char                 *object;
+  uint32_t              i;
+
+  _Assert(
+    _Objects_Allocator_is_owner()
+      || !_System_state_Is_up( _System_state_Get() )
+  );
+
+  slab = _Heap_Allocate_aligned(
+    &_Workspace_Area,
+    WORKSPACE_SLAB_SIZE,
+    WORKSPACE_SLAB_SIZE
+  );
+  if ( slab == NULL ) {
+    return NULL;
+  }
+
+  object_size = _Workspace_Slab_object_size( class_index );
+  objects_per_slab = _Workspace_Slab_objects_per_slab( class_index );
+  object = (char *) slab + WORKSPACE_SLAB_OBJECTS_OFFSET;
+  slab->free_objects = object;
+  slab->used_objects = 0;
+  slab->class_index = class_index;
+
+  for ( i = 1; i < objects_per_slab; ++i ) {
+    *(void **) object = object + object_size;
+    object += object_size;
+  }
+
+  *(void **) object = NULL;
+
+  slab_class = &_Workspace_Slab_classes[ class_index ];
+  _ISR_lock_ISR_disable_and_acquire( &_Workspace_Slab_lock, &lock_context );
+  ++slab_class->slab_count;
+  ++slab_class->allocation_count;
+  _Chain_Append_unprotected( &slab_class->Partial, &slab->Node );
+  object = _Workspace_Slab_take( slab_class );
+  _ISR_lock_Release_and_ISR_enable( &_Workspace_Slab_lock, &lock_context );
+
+  return object;
+}
+
+void *_Workspace_Slab_allocate( size_t size )
+{
+  uint32_t  class_index;
+  void     *object;
+
+  if ( size > WORKSPACE_SLAB_MAXIMUM_OBJECT_SIZE ) {
+    return _Workspace_Allocate( size );
+  }
+
+  class_index = _Workspace_Slab_class_index( size );
+  object = _Workspace_Slab_cache_get( class_index );
+
+  if ( object == NULL ) {
+    object = _Workspace_Slab_grow( class_index );
+  }
+
+  return object;
+}
+
+void _Workspace_Slab_free( void *object, size_t size )
+{
+  uint32_t                 class_index;
+  Workspace_Slab_cache    *cache;
+  Workspace_Slab_magazine *magazine;
+  ISR_lock_Context         lock_context;
+
+  if ( object == NULL ) {
+    return;
+  }
+
+  if ( size > WORKSPACE_SLAB_MAXIMUM_OBJECT_SIZE ) {
+    _Workspace_Free( object );
+    return;
+  }
+
+  class_index = _Workspace_Slab_class_index( size );
+  _Assert( _Workspace_Slab_of_object( object )->class_index == class_index );
+
+  cache = _Workspace_Slab_cache_acquire( &lock_context );
+  magazine = &cache->Magazines[ class_index ];
+
+  if ( magazine->count == WORKSPACE_SLAB_CACHE_MAXIMUM ) {
+    ISR_lock_Context slab_lock_context;
+
+    _ISR_lock_Acquire( &_Workspace_Slab_lock, &slab_lock_context );
+    _Workspace_Slab_flush(
+      &_Workspace_Slab_classes[ class_index ],
+      magazine,
+      WORKSPACE_SLAB_CACHE_BATCH
+    );
+    _ISR_lock_Release( &_Workspace_Slab_lock, &slab_lock_context );
+  }
+
+  magazine->objects[ magazine->count ] = object;
+  ++magazine->count;
+  _Workspace_Slab_cache_release( cache, &lock_context );
+}
+
+uint32_t _Workspace_Slab_reclaim( void )
+{
+  Chain_Control    reclaimed;
+  Chain_Node      *node;
+  ISR_lock_Context lock_context;
+  uint32_t         cpu_index;
+  uint32_t         cpu_max;
+  uint32_t         class_index;
+  uint32_t         count;
+
+  _Assert( _Objects_Allocator_is_owner() );
+
+  cpu_max = _SMP_Get_processor_maximum();
+
+  for ( cpu_index = 0; cpu_index < cpu_max; ++cpu_index ) {
+    Workspace_Slab_cache *cache;
+    ISR_lock_Context      slab_lock_context;
+
+    cache = _Workspace_Slab_get_cache( _Per_CPU_Get_by_index( cpu_index ) );
+    _ISR_lock_ISR_disable_and_acquire( &cache->Lock, &lock_context );
+    _ISR_lock_Acquire( &_Workspace_Slab_lock, &slab_lock_context );
+
+    for (
+      class_index = 0;
+      class_index < WORKSPACE_SLAB_CLASS_COUNT;
+      ++class_index
+    ) {
+      _Workspace_Slab_flush(
+        &_Workspace_Slab_classes[ class_index ],
+        &cache->Magazines[ class_index ],
+        0
+      );
+    }
+
+    _ISR_lock_Release( &_Workspace_Slab_lock, &slab_lock_context );
+    _ISR_lock_Release_and_ISR_enable( &cache->Lock, &lock_context );
+  }
+
+  _Chain_Initialize_empty( &reclaimed );
+  count = 0;
+
+  _ISR_lock_ISR_disable_and_acquire( &_Workspace_Slab_lock, &lock_context );
+
+  for (
+    class_index = 0;
+    class_index < WORKSPACE_SLAB_CLASS_COUNT;
+    ++class_index
+  ) {
+    Workspace_Slab_class *slab_class;
+
+    slab_class = &_Workspace_Slab_classes[ class_index ];
+
+    while ( slab_class->empty_slab_count > 1 ) {
+      node = _Chain_Get_first_unprotected( &slab_class->Empty );
+      _Chain_Append_unprotected( &reclaimed, node );
+      --slab_class->empty_slab_count;
+      --slab_class->slab_count;
+      ++slab_class->reclaimed_slab_count;
+      ++count;
+    }
+  }
+
+  _ISR_lock_Release_and_ISR_enable( &_Workspace_Slab_lock, &lock_context );
+
+  while ( ( node = _Chain_Get_unprotected( &reclaimed ) ) != NULL ) {
+    _Workspace_Free( node );
+  }
+
+  return count;
+}
+
+void _Workspace_Slab_get_information(
+  Workspace_Slab_information info[ WORKSPACE_SLAB_CLASS_COUNT ]
+)
+{
+  ISR_lock_Context lock_context;
+  uint32_t         cpu_index;
+  uint32_t         cpu_max;
+  uint32_t         class_index;
+
+  memset( info, 0, WORKSPACE_SLAB_CLASS_COUNT * sizeof( *info ) );
+  cpu_max = _SMP_Get_processor_maximum();
+
+  for ( cpu_index = 0; cpu_index < cpu_max; ++cpu_index ) {
+    Workspace_Slab_cache *cache;
+
+    cache = _Workspace_Slab_get_cache( _Per_CPU_Get_by_index( cpu_index ) );
+    _ISR_lock_ISR_disable_and_acquire( &cache->Lock, &lock_context );
+
+    for (
+      class_index = 0;
+      class_index < WORKSPACE_SLAB_CLASS_COUNT;
+      ++class_index
+    ) {
+      const Workspace_Slab_magazine *magazine;
+
+      magazine = &cache->Magazines[ class_index ];
+      info[ class_index ].cached_object_count += magazine->count;
+      info[ class_index ].allocation_count += magazine->allocation_count;
+    }
+
+    _ISR_lock_Release_and_ISR_enable( &cache->Lock, &lock_context );
+  }
+
+  _ISR_lock_ISR_disable_and_acquire( &_Workspace_Slab_lock, &lock_context );
+
+  for (
+    class_index = 0;
+    class_index < WORKSPACE_SLAB_CLASS_COUNT;
+    ++class_index
+  ) {
+    const Workspace_Slab_class *slab_class;
+    Workspace_Slab_information *class_info;
+
+    slab_class = &_Workspace_Slab_classes[ class_index ];
+    class_info = &info[ class_index ];
+    class_info->object_size = _Workspace_Slab_object_size( class_index );
+    class_info->objects_per_slab =
+      _Workspace_Slab_objects_per_slab( class_index );
+    class_info->slab_count = slab_class->slab_count;
+    class_info->empty_slab_count = slab_class->empty_slab_count;
+    class_info->allocation_count += slab_class->allocation_count;
+    class_info->reclaimed_slab_count = slab_class->reclaimed_slab_count;
+
+    /*
+     * The objects in the processor caches are used from the view of the
+     * slabs.  The caches may have changed in the meantime, so this is only an
+     * approximation.
+     */
+    if ( slab_class->used_object_count > class_info->cached_object_count ) {
+      class_info->used_object_count =
+        slab_class->used_object_count - class_info->cached_object_count;
+    }
+  }
+
+  _ISR_lock_Release_and_ISR_enable( &_Workspace_Slab_lock, &lock_context );
+}
+
+static void _Workspace_Slab_initialize( void )
+{
+  uint32_t cpu_index;
+  uint32_t cpu_max;
+
+  cpu_max = _SMP_Get_processor_maximum();
+
+  for ( cpu_index = 0; cpu_index < cpu_max; ++cpu_index ) {
+    _ISR_lock_Initialize(
+      &_Workspace_Slab_get_cache( _Per_CPU_Get_by_index( cpu_index ) )->Lock,
+      "Workspace Slab Cache"
+    );
+  }
+}
+
+RTEMS_SYSINIT_ITEM(
+  _Workspace_Slab_initialize,
+  RTEMS_SYSINIT_WORKSPACE,
+  RTEMS_SYSINIT_ORDER_LAST
+);
@@ -6,7 +6,8 @@
  * @ingroup RTEMSScoreWorkspace
  *
  * @brief This source file contains the implementation of
- *   _Workspace_String_duplicate().
+ *   _Workspace_String_duplicate(), _Workspace_Slab_string_duplicate(), and
+ *   _Workspace_Slab_string_free().
  */
 
 /*
@@ -57,3 +58,31 @@ char *_Workspace_String_duplicate(
   dup[ len ] = '\0';
   return memcpy( dup, string, len );
 }
+
+char *_Workspace_Slab_string_duplicate(
+  const char *string,
+  size_t      len
+)
+{
+  char *dup;
+
+  /* The string length determines the slab size class in the free */
+  len = strnlen( string, len );
+  dup = _Workspace_Slab_allocate( len + 1 );
+  if ( dup == NULL ) {
+    return NULL;
+  }
+
+  dup[ len ] = '\0';
+  return memcpy( dup, string, len );
+}
+
+void _Workspace_Slab_string_free( const char *string )
+{
+  if ( string != NULL ) {
+    _Workspace_Slab_free(
+      RTEMS_DECONST( char *, string ),
+      strlen( string ) + 1
+    );
+  }
+}
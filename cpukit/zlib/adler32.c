@@ -7,6 +7,23 @@
 
 #define local static
 
+/* Find a four-byte integer type for the word-at-a-time sums. */
+#ifndef NOBYFOUR
+#  ifdef STDC           /* need ANSI C limits.h to determine sizes */
+#    include <limits.h>
+#    define BYFOUR
+#    if (UINT_MAX == 0xffffffffUL)
+       typedef unsigned int u4;
+#    else
+#      if (ULONG_MAX == 0xffffffffUL)
+         typedef unsigned long u4;
+#      else
+#        undef BYFOUR     /* can't find a four-byte integer type! */
+#      endif
+#    endif
+#  endif /* STDC */
+#endif /* !NOBYFOUR */
+
 local uLong adler32_combine_(uLong adler1, uLong adler2, z_off64_t len2);
 
 #define BASE 65521UL    /* largest prime smaller than 65536 */
@@ -54,6 +71,58 @@ local uLong adler32_combine_(uLong adler1, uLong adler2, z_off64_t len2);
 #  define MOD4(a) a %= BASE
 #endif
 
+#ifdef BYFOUR
+
+/* ========================================================================= */
+#define WORDBLOCK 16
+/* The sums of WORDBLOCK words fit into the 16-bit lanes used by DOWORD */
+
+#define LANES(x) (((x) & 0xffff) + ((x) >> 16))
+
+#define DOWORD {w = *buf4++; prev_lo += lo; prev_hi += hi; \
+                lo += w & 0x00ff00ffUL; hi += (w >> 8) & 0x00ff00ffUL;}
+#define DOWORD4  DOWORD; DOWORD; DOWORD; DOWORD;
+#define DOWORD16 DOWORD4; DOWORD4; DOWORD4; DOWORD4;
+
+/*
+  Process 4 * WORDBLOCK aligned bytes with two 16-bit lanes in each of the
+  lo and hi words.  The lo lanes sum up the bytes 0 and 2 of each word, the
+  hi lanes sum up the bytes 1 and 3.  The prev lanes sum up the lanes before
+  each word, so that sum2 gets the word-wise adler sums without a dependency
+  on the preceding bytes.  The byte positions within a word determine the
+  remaining weights of the word-wise sum2 update.
+*/
+local const u4 FAR *adler32_words(adler, sum2, buf4)
+    unsigned long *adler;
+    unsigned long *sum2;
+    const u4 FAR *buf4;
+{
+    u4 endian;
+    u4 w;
+    u4 lo = 0;
+    u4 hi = 0;
+    u4 prev_lo = 0;
+    u4 prev_hi = 0;
+    unsigned long a = *adler;
+    unsigned long s;
+
+    DOWORD16;
+
+    s = 4 * (WORDBLOCK * a + LANES(prev_lo) + LANES(prev_hi));
+    endian = 1;
+    if (*((unsigned char *)(&endian)))
+        s += 4 * (lo & 0xffff) + 2 * (lo >> 16) +
+             3 * (hi & 0xffff) + (hi >> 16);
+    else
+        s += (lo & 0xffff) + 3 * (lo >> 16) +
+             2 * (hi & 0xffff) + 4 * (hi >> 16);
+    *sum2 += s;
+    *adler = a + LANES(lo) + LANES(hi);
+    return buf4;
+}
+
+#endif /* BYFOUR */
+
 /* ========================================================================= */
 uLong ZEXPORT adler32(adler, buf, len)
     uLong adler;
@@ -94,6 +163,44 @@ uLong ZEXPORT adler32(adler, buf, len)
         return adler | (sum2 << 16);
     }
 
+#ifdef BYFOUR
+    /* align the buffer for the word-at-a-time sums */
+    if ((ptrdiff_t)buf & 3) {
+        while ((ptrdiff_t)buf & 3) {
+            adler += *buf++;
+            sum2 += adler;
+            len--;
+        }
+        if (adler >= BASE)
+            adler -= BASE;
+        MOD4(sum2);
+    }
+
+    /* do length NMAX blocks -- requires just one modulo operation */
+    while (len >= NMAX) {
+        len -= NMAX;
+        n = NMAX / (4 * WORDBLOCK);
+        do {
+            buf = (const Bytef *)
+                adler32_words(&adler, &sum2, (const u4 FAR *)buf);
+        } while (--n);
+        n = NMAX % (4 * WORDBLOCK);
+        do {
+            DO16(buf);
+            buf += 16;
+        } while (n -= 16);      /* the remainder is divisible by 16 */
+        MOD(adler);
+        MOD(sum2);
+    }
+
+    /* do remaining bytes (less than NMAX, still just one modulo) */
+    if (len) {                  /* avoid modulos if none remaining */
+        while (len >= 4 * WORDBLOCK) {
+            len -= 4 * WORDBLOCK;
+            buf = (const Bytef *)
+                adler32_words(&adler, &sum2, (const u4 FAR *)buf);
+        }
+#else
     /* do length NMAX blocks -- requires just one modulo operation */
     while (len >= NMAX) {
         len -= NMAX;
@@ -108,6 +215,7 @@ uLong ZEXPORT adler32(adler, buf, len)
 
     /* do remaining bytes (less than NMAX, still just one modulo) */
     if (len) {                  /* avoid modulos if none remaining */
+#endif /* BYFOUR */
         while (len >= 16) {
             len -= 16;
             DO16(buf);
@@ -125,6 +233,33 @@ uLong ZEXPORT adler32(adler, buf, len)
     return adler | (sum2 << 16);
 }
 
+/* ========================================================================= */
+#define COPYBLOCK 1024
+
+/* ========================================================================= */
+uLong ZEXPORT adler32_copy(adler, dst, src, len)
+    uLong adler;
+    Bytef *dst;
+    const Bytef *src;
+    uInt len;
+{
+    uInt n;
+
+    if (src == Z_NULL)
+        return 1L;
+
+    /* checksum each block while it is still in the data cache */
+    while (len > 0) {
+        n = len > COPYBLOCK ? COPYBLOCK : len;
+        zmemcpy(dst, src, n);
+        adler = adler32(adler, dst, n);
+        dst += n;
+        src += n;
+        len -= n;
+    }
+    return adler;
+}
+
 /* ========================================================================= */
 local uLong adler32_combine_(adler1, adler2, len2)
     uLong adler1;
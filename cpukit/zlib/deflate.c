@@ -1000,14 +1000,16 @@ local int read_buf(strm, buf, size)
     strm->avail_in  -= len;
 
     if (strm->state->wrap == 1) {
-        strm->adler = adler32(strm->adler, strm->next_in, len);
+        strm->adler = adler32_copy(strm->adler, buf, strm->next_in, len);
     }
 #ifdef GZIP
     else if (strm->state->wrap == 2) {
-        strm->adler = crc32(strm->adler, strm->next_in, len);
+        strm->adler = crc32_copy(strm->adler, buf, strm->next_in, len);
     }
 #endif
-    zmemcpy(buf, strm->next_in, len);
+    else {
+        zmemcpy(buf, strm->next_in, len);
+    }
     strm->next_in  += len;
     strm->total_in += len;
 
@@ -0,0 +1,406 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/*
+ * Copyright (C) 2026 On-Line Applications Research Corporation (OAR)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "tmacros.h"
+
+#include <errno.h>
+#include <fcntl.h>
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <rtems/counter.h>
+#include <rtems/jffs2.h>
+#include <rtems/libio.h>
+
+const char rtems_test_name[] = "FSJFFS2GC 2";
+
+#define MOUNT_DIR "/mnt"
+
+#define BLOCK_SIZE (16UL * 1024UL)
+
+#define FLASH_SIZE (32UL * BLOCK_SIZE)
+
+/*
+ * Simulated time to erase a flash block.  The simulated erase keeps the
+ * processor busy like a polled NOR flash driver.
+ */
+#define ERASE_DELAY_NS 2000000
+
+#define FILES 8
+
+#define CHUNK_SIZE 1024
+
+#define CHUNKS_PER_FILE 24
+
+#define WRITES 2000
+
+/*
+ * The writer sleeps for one clock tick after this count of writes to give
+ * the background garbage collection some idle time.
+ */
+#define WRITES_PER_BURST 8
+
+#define GC_TARGET_FREE_BLOCKS 8
+
+typedef struct {
+  const char *mode;
+  uint32_t gc_target_free_blocks;
+} test_sample;
+
+static const test_sample samples[] = {
+  { "inline", 0 },
+  { "background", GC_TARGET_FREE_BLOCKS }
+};
+
+typedef struct {
+  rtems_jffs2_flash_control super;
+  unsigned char area[FLASH_SIZE];
+} flash_control;
+
+static flash_control *get_flash_control(rtems_jffs2_flash_control *super)
+{
+  return (flash_control *) super;
+}
+
+static int flash_read(
+  rtems_jffs2_flash_control *super,
+  uint32_t offset,
+  unsigned char *buffer,
+  size_t size_of_buffer
+)
+{
+  flash_control *self = get_flash_control(super);
+  unsigned char *chunk = &self->area[offset];
+
+  memcpy(buffer, chunk, size_of_buffer);
+
+  return 0;
+}
+
+static int flash_write(
+  rtems_jffs2_flash_control *super,
+  uint32_t offset,
+  const unsigned char *buffer,
+  size_t size_of_buffer
+)
+{
+  flash_control *self = get_flash_control(super);
+  unsigned char *chunk = &self->area[offset];
+  size_t i;
+
+  for (i = 0; i < size_of_buffer; ++i) {
+    chunk[i] &= buffer[i];
+  }
+
+  return 0;
+}
+
+static int flash_erase(
+  rtems_jffs2_flash_control *super,
+  uint32_t offset
+)
+{
+  flash_control *self = get_flash_control(super);
+  unsigned char *chunk = &self->area[offset];
+
+  rtems_counter_delay_nanoseconds(ERASE_DELAY_NS);
+  memset(chunk, 0xff, BLOCK_SIZE);
+
+  return 0;
+}
+
+static flash_control flash_instance = {
+  .super = {
+    .block_size = BLOCK_SIZE,
+    .flash_size = FLASH_SIZE,
+    .read = flash_read,
+    .write = flash_write,
+    .erase = flash_erase
+  }
+};
+
+static uint8_t versions[FILES][CHUNKS_PER_FILE];
+
+static unsigned char chunk_buffer[CHUNK_SIZE];
+
+static uint64_t latencies[WRITES];
+
+static uint32_t simple_random(uint32_t v)
+{
+  v *= 1664525;
+  v += 1013904223;
+
+  return v;
+}
+
+static void fill_chunk(unsigned char *buf, int file, int chunk, uint8_t version)
+{
+  uint32_t v;
+  size_t i;
+
+  v = ((uint32_t) file << 16) | ((uint32_t) chunk << 8) | version;
+
+  for (i = 0; i < CHUNK_SIZE; ++i) {
+    v = simple_random(v);
+    buf[i] = (unsigned char) (v >> 23);
+  }
+}
+
+static void write_chunk(int fd, int file, int chunk)
+{
+  off_t off;
+  ssize_t n;
+
+  fill_chunk(chunk_buffer, file, chunk, versions[file][chunk]);
+
+  off = lseek(fd, (off_t) chunk * CHUNK_SIZE, SEEK_SET);
+  rtems_test_assert(off == (off_t) chunk * CHUNK_SIZE);
+
+  n = write(fd, chunk_buffer, CHUNK_SIZE);
+  rtems_test_assert(n == CHUNK_SIZE);
+}
+
+static void verify_files(void)
+{
+  static unsigned char expected[CHUNK_SIZE];
+  char name[32];
+  int file;
+
+  for (file = 0; file < FILES; ++file) {
+    int chunk;
+    int fd;
+    int rv;
+
+    snprintf(name, sizeof(name), "%s/file-%d", MOUNT_DIR, file);
+    fd = open(name, O_RDONLY);
+    rtems_test_assert(fd >= 0);
+
+    for (chunk = 0; chunk < CHUNKS_PER_FILE; ++chunk) {
+      ssize_t n;
+
+      fill_chunk(expected, file, chunk, versions[file][chunk]);
+      n = read(fd, chunk_buffer, CHUNK_SIZE);
+      rtems_test_assert(n == CHUNK_SIZE);
+      rtems_test_assert(memcmp(chunk_buffer, expected, CHUNK_SIZE) == 0);
+    }
+
+    rv = close(fd);
+    rtems_test_assert(rv == 0);
+  }
+}
+
+static int compare_latencies(const void *a, const void *b)
+{
+  uint64_t x = *(const uint64_t *) a;
+  uint64_t y = *(const uint64_t *) b;
+
+  return (x > y) - (x < y);
+}
+
+static void mount_flash(const test_sample *sample)
+{
+  rtems_jffs2_mount_data mount_data;
+  int rv;
+
+  memset(&mount_data, 0, sizeof(mount_data));
+  mount_data.flash_control = &flash_instance.super;
+  mount_data.gc_target_free_blocks = sample->gc_target_free_blocks;
+
+  rv = mount(
+    NULL,
+    MOUNT_DIR,
+    RTEMS_FILESYSTEM_TYPE_JFFS2,
+    RTEMS_FILESYSTEM_READ_WRITE,
+    &mount_data
+  );
+  rtems_test_assert(rv == 0);
+}
+
+static void print_sample(const rtems_jffs2_gc_stats *stats)
+{
+  qsort(latencies, WRITES, sizeof(latencies[0]), compare_latencies);
+
+  printf(
+    "    <WriteLatency unit=\"ns\" p50=\"%" PRIu64 "\" p99=\"%" PRIu64 "\""
+    " max=\"%" PRIu64 "\">%i</WriteLatency>\n"
+    "    <GCPasses background=\"%" PRIu32 "\" foreground=\"%" PRIu32 "\"/>\n"
+    "    <Erases background=\"%" PRIu32 "\" foreground=\"%" PRIu32 "\"/>\n"
+    "    <WriteStalls unit=\"ns\" time=\"%" PRIu64 "\">%" PRIu32
+    "</WriteStalls>\n",
+    latencies[WRITES / 2],
+    latencies[(WRITES * 99) / 100],
+    latencies[WRITES - 1],
+    WRITES,
+    stats->background_passes,
+    stats->foreground_passes,
+    stats->background_erases,
+    stats->foreground_erases,
+    stats->write_stall_time,
+    stats->write_stalls
+  );
+}
+
+static void test_sample_run(const test_sample *sample)
+{
+  rtems_jffs2_gc_stats stats;
+  int fds[FILES];
+  uint32_t v;
+  int file;
+  int chunk;
+  int i;
+  int rv;
+
+  memset(&flash_instance.area[0], 0xff, FLASH_SIZE);
+  memset(versions, 0, sizeof(versions));
+  mount_flash(sample);
+
+  for (file = 0; file < FILES; ++file) {
+    char name[32];
+
+    snprintf(name, sizeof(name), "%s/file-%d", MOUNT_DIR, file);
+    fds[file] = open(name, O_RDWR | O_CREAT | O_TRUNC, S_IRWXU);
+    rtems_test_assert(fds[file] >= 0);
+
+    for (chunk = 0; chunk < CHUNKS_PER_FILE; ++chunk) {
+      write_chunk(fds[file], file, chunk);
+    }
+  }
+
+  rv = ioctl(fds[0], RTEMS_JFFS2_RESET_GC_STATS);
+  rtems_test_assert(rv == 0);
+
+  printf("  <Sample>\n    <Mode>%s</Mode>\n", sample->mode);
+
+  v = 1;
+
+  for (i = 0; i < WRITES; ++i) {
+    uint64_t t0;
+    uint64_t t1;
+
+    v = simple_random(v);
+    file = (int) ((v >> 8) % FILES);
+    chunk = (int) ((v >> 16) % CHUNKS_PER_FILE);
+    ++versions[file][chunk];
+
+    t0 = rtems_clock_get_uptime_nanoseconds();
+    write_chunk(fds[file], file, chunk);
+    t1 = rtems_clock_get_uptime_nanoseconds();
+    latencies[i] = t1 - t0;
+
+    if ((i % WRITES_PER_BURST) == WRITES_PER_BURST - 1) {
+      rtems_status_code sc;
+
+      sc = rtems_task_wake_after(1);
+      rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+    }
+  }
+
+  rv = ioctl(fds[0], RTEMS_JFFS2_GET_GC_STATS, &stats);
+  rtems_test_assert(rv == 0);
+  rtems_test_assert(stats.writes == WRITES);
+  rtems_test_assert(stats.foreground_passes + stats.background_passes > 0);
+
+  if (sample->gc_target_free_blocks == 0) {
+    rtems_test_assert(stats.background_passes == 0);
+    rtems_test_assert(stats.background_erases == 0);
+  } else {
+    rtems_test_assert(stats.background_passes > 0);
+  }
+
+  print_sample(&stats);
+  printf("  </Sample>\n");
+
+  for (file = 0; file < FILES; ++file) {
+    rv = close(fds[file]);
+    rtems_test_assert(rv == 0);
+  }
+
+  verify_files();
+
+  rv = unmount(MOUNT_DIR);
+  rtems_test_assert(rv == 0);
+
+  mount_flash(sample);
+  verify_files();
+
+  rv = unmount(MOUNT_DIR);
+  rtems_test_assert(rv == 0);
+}
+
+static void Init(rtems_task_argument arg)
+{
+  size_t i;
+  int rv;
+
+  TEST_BEGIN();
+
+  rv = mkdir(MOUNT_DIR, S_IRWXU | S_IRWXG | S_IRWXO);
+  rtems_test_assert(rv == 0);
+
+  printf("<FSJFFS2GC02>\n");
+
+  for (i = 0; i < RTEMS_ARRAY_SIZE(samples); ++i) {
+    test_sample_run(&samples[i]);
+  }
+
+  printf("</FSJFFS2GC02>\n");
+
+  TEST_END();
+  rtems_test_exit(0);
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+
+#define CONFIGURE_FILESYSTEM_JFFS2
+
+#define CONFIGURE_MAXIMUM_FILE_DESCRIPTORS 16
+
+/*
+ * The init task, the JFFS2 delayed work task, and the background garbage
+ * collection task.
+ */
+#define CONFIGURE_MAXIMUM_TASKS 3
+
+#define CONFIGURE_INIT_TASK_STACK_SIZE (32 * 1024)
+#define CONFIGURE_INIT_TASK_ATTRIBUTES RTEMS_FLOATING_POINT
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
@@ -0,0 +1,352 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/*
+ * Copyright (C) 2026 On-Line Applications Research Corporation (OAR)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "tmacros.h"
+
+#include <dirent.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <rtems/blkdev.h>
+#include <rtems/libio.h>
+#include <rtems/rtems-rfs-format.h>
+#include <rtems/sparse-disk.h>
+
+const char rtems_test_name[] = "FSRFSDIRINDEX 1";
+
+#define DEV_NAME "/dev/sda"
+
+#define MOUNT_DIR "/mnt"
+
+#define DIR_NAME "/mnt/dir"
+
+#define MEDIA_BLOCK_SIZE 512
+
+#define MEDIA_BLOCK_COUNT (128 * 1024)
+
+#define MEDIA_BLOCKS_WITH_BUFFER (16 * 1024)
+
+#define FS_BLOCK_SIZE 1024
+
+#define FS_INODE_OVERHEAD 10
+
+#define MAX_ENTRIES 50000
+
+typedef struct {
+  const char *layout;
+  bool dir_index;
+  int entries;
+} test_sample;
+
+static const test_sample samples[] = {
+  { "linear", false, 5000 },
+  { "indexed", true, 5000 },
+  { "indexed", true, MAX_ENTRIES }
+};
+
+static void entry_name(char *name, size_t size, int entry)
+{
+  snprintf(name, size, "%s/entry-%05d", DIR_NAME, entry);
+}
+
+static void reset_device_stats(void)
+{
+  int fd;
+  int rv;
+
+  fd = open(DEV_NAME, O_RDONLY);
+  rtems_test_assert(fd >= 0);
+
+  rv = ioctl(fd, RTEMS_BLKIO_SYNCDEV);
+  rtems_test_assert(rv == 0);
+
+  rv = ioctl(fd, RTEMS_BLKIO_PURGEDEV);
+  rtems_test_assert(rv == 0);
+
+  rv = ioctl(fd, RTEMS_BLKIO_RESETDEVSTATS);
+  rtems_test_assert(rv == 0);
+
+  rv = close(fd);
+  rtems_test_assert(rv == 0);
+}
+
+static uint32_t device_read_blocks(void)
+{
+  rtems_blkdev_stats stats;
+  int fd;
+  int rv;
+
+  fd = open(DEV_NAME, O_RDONLY);
+  rtems_test_assert(fd >= 0);
+
+  rv = ioctl(fd, RTEMS_BLKIO_GETDEVSTATS, &stats);
+  rtems_test_assert(rv == 0);
+
+  rv = close(fd);
+  rtems_test_assert(rv == 0);
+
+  return stats.read_blocks;
+}
+
+static void print_sample(const char *name, int entries, uint64_t ns)
+{
+  printf(
+    "    <%s unit=\"ns\" perEntry=\"%" PRIu64 "\" readBlocks=\"%" PRIu32 "\">"
+    "%" PRIu64 "</%s>\n",
+    name,
+    ns / (uint64_t) entries,
+    device_read_blocks(),
+    ns,
+    name
+  );
+}
+
+static void create_entries(int entries)
+{
+  char name[32];
+  uint64_t t0;
+  uint64_t t1;
+  int entry;
+
+  reset_device_stats();
+  t0 = rtems_clock_get_uptime_nanoseconds();
+
+  for (entry = 0; entry < entries; ++entry) {
+    int fd;
+    int rv;
+
+    entry_name(name, sizeof(name), entry);
+    fd = open(name, O_WRONLY | O_CREAT | O_EXCL, S_IRWXU);
+    rtems_test_assert(fd >= 0);
+
+    rv = close(fd);
+    rtems_test_assert(rv == 0);
+  }
+
+  t1 = rtems_clock_get_uptime_nanoseconds();
+  print_sample("Create", entries, t1 - t0);
+}
+
+static void lookup_entries(int entries)
+{
+  char name[32];
+  uint64_t t0;
+  uint64_t t1;
+  int entry;
+
+  reset_device_stats();
+  t0 = rtems_clock_get_uptime_nanoseconds();
+
+  /*
+   * Visit the entries in a different order than they were created.
+   */
+  for (entry = 0; entry < entries; ++entry) {
+    struct stat st;
+    int rv;
+
+    entry_name(name, sizeof(name), (int) ((entry * 7919L) % entries));
+    rv = stat(name, &st);
+    rtems_test_assert(rv == 0);
+    rtems_test_assert(S_ISREG(st.st_mode));
+  }
+
+  t1 = rtems_clock_get_uptime_nanoseconds();
+  print_sample("Lookup", entries, t1 - t0);
+}
+
+static void check_missing(int entries)
+{
+  char name[32];
+  struct stat st;
+  int rv;
+
+  entry_name(name, sizeof(name), entries);
+  errno = 0;
+  rv = stat(name, &st);
+  rtems_test_assert(rv == -1);
+  rtems_test_assert(errno == ENOENT);
+}
+
+static void check_readdir(int entries)
+{
+  DIR *dir;
+  struct dirent *de;
+  int count;
+  int rv;
+
+  dir = opendir(DIR_NAME);
+  rtems_test_assert(dir != NULL);
+
+  count = 0;
+  while ((de = readdir(dir)) != NULL) {
+    ++count;
+  }
+
+  rv = closedir(dir);
+  rtems_test_assert(rv == 0);
+
+  /*
+   * The current and parent directory entries are included.
+   */
+  rtems_test_assert(count == entries + 2);
+}
+
+static void unlink_entries(int entries)
+{
+  char name[32];
+  uint64_t t0;
+  uint64_t t1;
+  int entry;
+
+  reset_device_stats();
+  t0 = rtems_clock_get_uptime_nanoseconds();
+
+  for (entry = 0; entry < entries; ++entry) {
+    int rv;
+
+    entry_name(name, sizeof(name), (int) ((entry * 7919L) % entries));
+    rv = unlink(name);
+    rtems_test_assert(rv == 0);
+  }
+
+  t1 = rtems_clock_get_uptime_nanoseconds();
+  print_sample("Unlink", entries, t1 - t0);
+}
+
+static void test_sample_run(const test_sample *sample)
+{
+  rtems_rfs_format_config config;
+  rtems_status_code sc;
+  int rv;
+
+  sc = rtems_sparse_disk_create_and_register(
+    DEV_NAME,
+    MEDIA_BLOCK_SIZE,
+    MEDIA_BLOCKS_WITH_BUFFER,
+    MEDIA_BLOCK_COUNT,
+    0
+  );
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  memset(&config, 0, sizeof(config));
+  config.block_size = FS_BLOCK_SIZE;
+  config.inode_overhead = FS_INODE_OVERHEAD;
+  config.dir_index = sample->dir_index;
+
+  rv = rtems_rfs_format(DEV_NAME, &config);
+  rtems_test_assert(rv == 0);
+
+  rv = mount(
+    DEV_NAME,
+    MOUNT_DIR,
+    RTEMS_FILESYSTEM_TYPE_RFS,
+    RTEMS_FILESYSTEM_READ_WRITE,
+    NULL
+  );
+  rtems_test_assert(rv == 0);
+
+  rv = mkdir(DIR_NAME, S_IRWXU);
+  rtems_test_assert(rv == 0);
+
+  printf(
+    "  <Sample>\n    <Layout>%s</Layout>\n    <Entries>%i</Entries>\n",
+    sample->layout,
+    sample->entries
+  );
+
+  create_entries(sample->entries);
+  lookup_entries(sample->entries);
+  check_missing(sample->entries);
+  check_readdir(sample->entries);
+  unlink_entries(sample->entries);
+  check_readdir(0);
+
+  printf("  </Sample>\n");
+
+  rv = rmdir(DIR_NAME);
+  rtems_test_assert(rv == 0);
+
+  rv = unmount(MOUNT_DIR);
+  rtems_test_assert(rv == 0);
+
+  rv = unlink(DEV_NAME);
+  rtems_test_assert(rv == 0);
+}
+
+static void Init(rtems_task_argument arg)
+{
+  size_t i;
+  int rv;
+
+  TEST_BEGIN();
+
+  rv = mkdir(MOUNT_DIR, S_IRWXU | S_IRWXG | S_IRWXO);
+  rtems_test_assert(rv == 0);
+
+  printf("<FSRFSDirIndex01>\n");
+
+  for (i = 0; i < RTEMS_ARRAY_SIZE(samples); ++i) {
+    test_sample_run(&samples[i]);
+  }
+
+  printf("</FSRFSDirIndex01>\n");
+
+  TEST_END();
+  rtems_test_exit(0);
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_LIBBLOCK
+
+#define CONFIGURE_FILESYSTEM_RFS
+
+#define CONFIGURE_MAXIMUM_FILE_DESCRIPTORS 8
+
+#define CONFIGURE_UNLIMITED_OBJECTS
+#define CONFIGURE_UNIFIED_WORK_AREAS
+
+#define CONFIGURE_INIT_TASK_STACK_SIZE (32 * 1024)
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_BDBUF_BUFFER_MAX_SIZE (4 * 1024)
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
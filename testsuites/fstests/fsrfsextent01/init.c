@@ -0,0 +1,476 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/*
+ * Copyright (C) 2026 On-Line Applications Research Corporation (OAR)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "tmacros.h"
+
+#include <sys/stat.h>
+#include <sys/statvfs.h>
+#include <fcntl.h>
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <rtems/blkdev.h>
+#include <rtems/libio.h>
+#include <rtems/rtems-rfs-format.h>
+#include <rtems/rfs/rtems-rfs-block.h>
+#include <rtems/sparse-disk.h>
+
+const char rtems_test_name[] = "FSRFSEXTENT 1";
+
+#define DEV_NAME "/dev/sda"
+
+#define MOUNT_DIR "/mnt"
+
+#define FILE_NAME "/mnt/large"
+
+#define OTHER_FILE_NAME "/mnt/other"
+
+#define MEDIA_BLOCK_SIZE 512
+
+#define MEDIA_BLOCK_COUNT (8 * 1024)
+
+#define FS_BLOCK_SIZE 512
+
+#define FILE_SIZE (1024 * 1024)
+
+#define CHUNK_SIZE (8 * 1024)
+
+#define RANDOM_READS 2000
+
+#define RANDOM_READ_SIZE 512
+
+/*
+ * The interleaved writes give each block of the fragmented files an extent of
+ * its own.  The extent blocks of the inode slots hold 4 * 42 extents with 512
+ * byte blocks, so the map of the fragmented file needs a table of extent
+ * blocks.
+ */
+#define FRAGMENT_BLOCKS 512
+
+#define FRAGMENT_SIZE (FRAGMENT_BLOCKS * FS_BLOCK_SIZE)
+
+static uint8_t chunk[CHUNK_SIZE];
+
+static uint32_t random_state;
+
+static uint8_t pattern(off_t pos)
+{
+  return (uint8_t) ((pos >> 9) ^ (pos & 0xff));
+}
+
+static void fill_chunk(off_t pos, size_t size)
+{
+  size_t i;
+
+  for (i = 0; i < size; ++i) {
+    chunk[i] = pattern(pos + (off_t) i);
+  }
+}
+
+static void check_chunk(off_t pos, size_t size)
+{
+  size_t i;
+
+  for (i = 0; i < size; ++i) {
+    rtems_test_assert(chunk[i] == pattern(pos + (off_t) i));
+  }
+}
+
+static uint32_t next_random(void)
+{
+  random_state = random_state * 1103515245 + 12345;
+  return random_state >> 8;
+}
+
+static void reset_device_stats(void)
+{
+  int fd;
+  int rv;
+
+  fd = open(DEV_NAME, O_RDONLY);
+  rtems_test_assert(fd >= 0);
+
+  rv = ioctl(fd, RTEMS_BLKIO_SYNCDEV);
+  rtems_test_assert(rv == 0);
+
+  rv = ioctl(fd, RTEMS_BLKIO_PURGEDEV);
+  rtems_test_assert(rv == 0);
+
+  rv = ioctl(fd, RTEMS_BLKIO_RESETDEVSTATS);
+  rtems_test_assert(rv == 0);
+
+  rv = close(fd);
+  rtems_test_assert(rv == 0);
+}
+
+static uint32_t device_read_blocks(void)
+{
+  rtems_blkdev_stats stats;
+  int fd;
+  int rv;
+
+  fd = open(DEV_NAME, O_RDONLY);
+  rtems_test_assert(fd >= 0);
+
+  rv = ioctl(fd, RTEMS_BLKIO_GETDEVSTATS, &stats);
+  rtems_test_assert(rv == 0);
+
+  rv = close(fd);
+  rtems_test_assert(rv == 0);
+
+  return stats.read_blocks;
+}
+
+static void print_sample(
+  const char *name,
+  uint64_t bytes,
+  uint64_t ns,
+  uint32_t read_blocks
+)
+{
+  uint64_t kib_per_s;
+
+  if (ns == 0) {
+    ns = 1;
+  }
+
+  kib_per_s = (bytes * UINT64_C(1000000000)) / (ns * UINT64_C(1024));
+
+  printf(
+    "    <%s unit=\"KiB/s\" readBlocks=\"%" PRIu32 "\">%" PRIu64 "</%s>\n",
+    name,
+    read_blocks,
+    kib_per_s,
+    name
+  );
+}
+
+static void write_file(const char *name, off_t size, bool report)
+{
+  uint64_t t0;
+  uint64_t t1;
+  off_t pos;
+  int fd;
+  int rv;
+
+  fd = open(name, O_RDWR | O_CREAT | O_TRUNC, S_IRWXU);
+  rtems_test_assert(fd >= 0);
+
+  t0 = rtems_clock_get_uptime_nanoseconds();
+
+  for (pos = 0; pos < size; pos += CHUNK_SIZE) {
+    ssize_t n;
+
+    fill_chunk(pos, CHUNK_SIZE);
+    n = write(fd, chunk, CHUNK_SIZE);
+    rtems_test_assert(n == CHUNK_SIZE);
+  }
+
+  rv = fsync(fd);
+  rtems_test_assert(rv == 0);
+
+  t1 = rtems_clock_get_uptime_nanoseconds();
+
+  rv = close(fd);
+  rtems_test_assert(rv == 0);
+
+  if (report) {
+    print_sample("SequentialWrite", (uint64_t) size, t1 - t0, 0);
+  }
+}
+
+static void read_sequential(void)
+{
+  uint64_t t0;
+  uint64_t t1;
+  off_t pos;
+  int fd;
+  int rv;
+
+  reset_device_stats();
+
+  fd = open(FILE_NAME, O_RDONLY);
+  rtems_test_assert(fd >= 0);
+
+  t0 = rtems_clock_get_uptime_nanoseconds();
+
+  for (pos = 0; pos < FILE_SIZE; pos += CHUNK_SIZE) {
+    ssize_t n;
+
+    n = read(fd, chunk, CHUNK_SIZE);
+    rtems_test_assert(n == CHUNK_SIZE);
+    check_chunk(pos, CHUNK_SIZE);
+  }
+
+  t1 = rtems_clock_get_uptime_nanoseconds();
+
+  rv = close(fd);
+  rtems_test_assert(rv == 0);
+
+  print_sample("SequentialRead", FILE_SIZE, t1 - t0, device_read_blocks());
+}
+
+static void read_random(void)
+{
+  uint64_t t0;
+  uint64_t t1;
+  int fd;
+  int rv;
+  int i;
+
+  reset_device_stats();
+  random_state = 1;
+
+  fd = open(FILE_NAME, O_RDONLY);
+  rtems_test_assert(fd >= 0);
+
+  t0 = rtems_clock_get_uptime_nanoseconds();
+
+  for (i = 0; i < RANDOM_READS; ++i) {
+    off_t pos;
+    ssize_t n;
+
+    pos = (off_t) (next_random() % (FILE_SIZE / RANDOM_READ_SIZE))
+      * RANDOM_READ_SIZE;
+    n = pread(fd, chunk, RANDOM_READ_SIZE, pos);
+    rtems_test_assert(n == RANDOM_READ_SIZE);
+    check_chunk(pos, RANDOM_READ_SIZE);
+  }
+
+  t1 = rtems_clock_get_uptime_nanoseconds();
+
+  rv = close(fd);
+  rtems_test_assert(rv == 0);
+
+  print_sample(
+    "RandomRead",
+    (uint64_t) RANDOM_READS * RANDOM_READ_SIZE,
+    t1 - t0,
+    device_read_blocks()
+  );
+}
+
+static void check_fragmented_file(off_t size)
+{
+  struct stat st;
+  off_t pos;
+  int fd;
+  int rv;
+
+  rv = stat(FILE_NAME, &st);
+  rtems_test_assert(rv == 0);
+  rtems_test_assert(st.st_size == size);
+
+  fd = open(FILE_NAME, O_RDONLY);
+  rtems_test_assert(fd >= 0);
+
+  for (pos = 0; pos < size; pos += FS_BLOCK_SIZE) {
+    size_t todo;
+    ssize_t n;
+
+    todo = size - pos < FS_BLOCK_SIZE ? (size_t) (size - pos) : FS_BLOCK_SIZE;
+    n = read(fd, chunk, todo);
+    rtems_test_assert(n == (ssize_t) todo);
+    check_chunk(pos, todo);
+  }
+
+  rv = close(fd);
+  rtems_test_assert(rv == 0);
+}
+
+static void check_truncate(void)
+{
+  int rv;
+
+  /*
+   * Shrinking the fragmented file frees blocks from the end of the map.  With
+   * extents, the map moves from the table of extent blocks back to the extent
+   * blocks of the inode slots, and then back into the inode.
+   */
+  rv = truncate(FILE_NAME, FRAGMENT_SIZE / 4 + 1);
+  rtems_test_assert(rv == 0);
+  check_fragmented_file(FRAGMENT_SIZE / 4 + 1);
+
+  rv = truncate(FILE_NAME, FS_BLOCK_SIZE + 1);
+  rtems_test_assert(rv == 0);
+  check_fragmented_file(FS_BLOCK_SIZE + 1);
+
+  rv = truncate(FILE_NAME, 0);
+  rtems_test_assert(rv == 0);
+
+  rv = unlink(FILE_NAME);
+  rtems_test_assert(rv == 0);
+
+  rv = unlink(OTHER_FILE_NAME);
+  rtems_test_assert(rv == 0);
+}
+
+static void test_layout(const char *name, bool extents)
+{
+  rtems_rfs_format_config config;
+  rtems_status_code sc;
+  struct statvfs before;
+  struct statvfs after;
+  fsblkcnt_t map_blocks;
+  int fd_a;
+  int fd_b;
+  off_t pos;
+  int rv;
+
+  sc = rtems_sparse_disk_create_and_register(
+    DEV_NAME,
+    MEDIA_BLOCK_SIZE,
+    MEDIA_BLOCK_COUNT,
+    MEDIA_BLOCK_COUNT,
+    0
+  );
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  memset(&config, 0, sizeof(config));
+  config.block_size = FS_BLOCK_SIZE;
+  config.extents = extents;
+
+  rv = rtems_rfs_format(DEV_NAME, &config);
+  rtems_test_assert(rv == 0);
+
+  rv = mount(
+    DEV_NAME,
+    MOUNT_DIR,
+    RTEMS_FILESYSTEM_TYPE_RFS,
+    RTEMS_FILESYSTEM_READ_WRITE,
+    NULL
+  );
+  rtems_test_assert(rv == 0);
+
+  printf("  <Sample>\n    <Layout>%s</Layout>\n", name);
+
+  write_file(FILE_NAME, FILE_SIZE, true);
+  read_sequential();
+  read_random();
+
+  /*
+   * Interleave the writes of two files so the maps are fragmented and a file
+   * with extents needs extent blocks.
+   */
+  rv = unlink(FILE_NAME);
+  rtems_test_assert(rv == 0);
+
+  rv = statvfs(MOUNT_DIR, &before);
+  rtems_test_assert(rv == 0);
+
+  fd_a = open(FILE_NAME, O_RDWR | O_CREAT | O_TRUNC, S_IRWXU);
+  rtems_test_assert(fd_a >= 0);
+
+  fd_b = open(OTHER_FILE_NAME, O_RDWR | O_CREAT | O_TRUNC, S_IRWXU);
+  rtems_test_assert(fd_b >= 0);
+
+  for (pos = 0; pos < FRAGMENT_SIZE; pos += FS_BLOCK_SIZE) {
+    ssize_t n;
+
+    fill_chunk(pos, FS_BLOCK_SIZE);
+    n = write(fd_a, chunk, FS_BLOCK_SIZE);
+    rtems_test_assert(n == FS_BLOCK_SIZE);
+    n = write(fd_b, chunk, FS_BLOCK_SIZE);
+    rtems_test_assert(n == FS_BLOCK_SIZE);
+  }
+
+  rv = close(fd_a);
+  rtems_test_assert(rv == 0);
+
+  rv = close(fd_b);
+  rtems_test_assert(rv == 0);
+
+  rv = statvfs(MOUNT_DIR, &after);
+  rtems_test_assert(rv == 0);
+
+  /*
+   * Without the table of extent blocks, each map would need at most
+   * RTEMS_RFS_BLOCK_EXTENT_BLOCKS blocks.
+   */
+  map_blocks = before.f_bfree - after.f_bfree - 2 * FRAGMENT_BLOCKS;
+  if (extents) {
+    rtems_test_assert(map_blocks > 2 * (RTEMS_RFS_BLOCK_EXTENT_BLOCKS + 1));
+  }
+
+  check_fragmented_file(FRAGMENT_SIZE);
+  check_truncate();
+
+  printf("  </Sample>\n");
+
+  rv = unmount(MOUNT_DIR);
+  rtems_test_assert(rv == 0);
+
+  rv = unlink(DEV_NAME);
+  rtems_test_assert(rv == 0);
+}
+
+static void Init(rtems_task_argument arg)
+{
+  int rv;
+
+  TEST_BEGIN();
+
+  rv = mkdir(MOUNT_DIR, S_IRWXU | S_IRWXG | S_IRWXO);
+  rtems_test_assert(rv == 0);
+
+  printf("<FSRFSExtent01>\n");
+  test_layout("indirect", false);
+  test_layout("extents", true);
+  printf("</FSRFSExtent01>\n");
+
+  TEST_END();
+  rtems_test_exit(0);
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_LIBBLOCK
+
+#define CONFIGURE_FILESYSTEM_RFS
+
+#define CONFIGURE_MAXIMUM_FILE_DESCRIPTORS 8
+
+#define CONFIGURE_UNLIMITED_OBJECTS
+#define CONFIGURE_UNIFIED_WORK_AREAS
+
+#define CONFIGURE_INIT_TASK_STACK_SIZE (32 * 1024)
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_BDBUF_BUFFER_MAX_SIZE (4 * 1024)
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
@@ -0,0 +1,506 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/*
+ * Copyright (C) 2026 On-Line Applications Research Corporation (OAR)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "tmacros.h"
+
+#include <dirent.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <sys/statvfs.h>
+#include <unistd.h>
+
+#include <rtems/blkdev.h>
+#include <rtems/libio.h>
+#include <rtems/ramdisk.h>
+#include <rtems/rtems-rfs-format.h>
+
+const char rtems_test_name[] = "FSRFSJOURNAL 1";
+
+#define DEV_NAME "/dev/rda"
+
+#define MOUNT_DIR "/mnt"
+
+#define MEDIA_BLOCK_SIZE 512
+
+#define MEDIA_BLOCK_COUNT (16 * 1024)
+
+#define FS_BLOCK_SIZE 1024
+
+#define FS_INODE_OVERHEAD 10
+
+#define JOURNAL_BLOCKS 256
+
+#define FILES 200
+
+#define CRASH_FILES 100
+
+typedef struct {
+  const char *mode;
+  size_t journal_blocks;
+  bool sync;
+} test_sample;
+
+static const test_sample samples[] = {
+  { "sync", 0, true },
+  { "journal", JOURNAL_BLOCKS, false }
+};
+
+static const uint32_t crash_budgets[] = { 16, 64, 256, 1024 };
+
+static ramdisk *rd;
+
+/*
+ * The number of media blocks written before the device stops writing. The
+ * writes are dropped but reported as done to simulate a power loss. It is
+ * UINT32_MAX if the device is not to crash.
+ */
+static uint32_t write_budget = UINT32_MAX;
+
+static int crash_disk_ioctl(rtems_disk_device *dd, uint32_t req, void *argp)
+{
+  if (req == RTEMS_BLKIO_REQUEST) {
+    rtems_blkdev_request *r = argp;
+
+    if (r->req == RTEMS_BLKDEV_REQ_WRITE && write_budget != UINT32_MAX) {
+      if (write_budget < r->bufnum) {
+        write_budget = 0;
+        rtems_blkdev_request_done(r, RTEMS_SUCCESSFUL);
+        return 0;
+      }
+
+      write_budget -= r->bufnum;
+    }
+  }
+
+  return ramdisk_ioctl(dd, req, argp);
+}
+
+static void device_ioctl(uint32_t req, void *argp)
+{
+  int fd;
+  int rv;
+
+  fd = open(DEV_NAME, O_RDONLY);
+  rtems_test_assert(fd >= 0);
+
+  rv = ioctl(fd, req, argp);
+  rtems_test_assert(rv == 0);
+
+  rv = close(fd);
+  rtems_test_assert(rv == 0);
+}
+
+static void reset_device_stats(void)
+{
+  device_ioctl(RTEMS_BLKIO_SYNCDEV, NULL);
+  device_ioctl(RTEMS_BLKIO_RESETDEVSTATS, NULL);
+}
+
+static uint32_t device_write_blocks(void)
+{
+  rtems_blkdev_stats stats;
+
+  device_ioctl(RTEMS_BLKIO_GETDEVSTATS, &stats);
+
+  return stats.write_blocks;
+}
+
+static void file_name(char *name, size_t size, int file)
+{
+  snprintf(name, size, "%s/file-%04d", MOUNT_DIR, file);
+}
+
+static size_t file_size(int file)
+{
+  return (size_t) ((file * 977) % 4600);
+}
+
+static uint8_t file_data(int file, size_t offset)
+{
+  return (uint8_t) (file * 7 + offset * 13 + (offset >> 8));
+}
+
+static void create_file(int file, bool sync)
+{
+  char name[32];
+  uint8_t buf[256];
+  size_t size;
+  size_t offset;
+  int fd;
+  int rv;
+
+  file_name(name, sizeof(name), file);
+  fd = open(name, O_WRONLY | O_CREAT | O_EXCL, S_IRWXU);
+  rtems_test_assert(fd >= 0);
+
+  size = file_size(file);
+  offset = 0;
+  while (offset < size) {
+    size_t chunk = size - offset;
+    size_t i;
+    ssize_t n;
+
+    if (chunk > sizeof(buf)) {
+      chunk = sizeof(buf);
+    }
+
+    for (i = 0; i < chunk; ++i) {
+      buf[i] = file_data(file, offset + i);
+    }
+
+    n = write(fd, buf, chunk);
+    rtems_test_assert(n == (ssize_t) chunk);
+    offset += chunk;
+  }
+
+  if (sync) {
+    rv = fsync(fd);
+    rtems_test_assert(rv == 0);
+  }
+
+  rv = close(fd);
+  rtems_test_assert(rv == 0);
+}
+
+static void unlink_file(int file, bool sync)
+{
+  char name[32];
+  int rv;
+
+  file_name(name, sizeof(name), file);
+  rv = unlink(name);
+  rtems_test_assert(rv == 0);
+
+  if (sync) {
+    int fd;
+
+    fd = open(MOUNT_DIR, O_RDONLY);
+    rtems_test_assert(fd >= 0);
+
+    rv = fsync(fd);
+    rtems_test_assert(rv == 0);
+
+    rv = close(fd);
+    rtems_test_assert(rv == 0);
+  }
+}
+
+/*
+ * Check the file has the size and data it was created with. A file being
+ * created when the device crashed can be empty.
+ */
+static bool check_file(int file)
+{
+  char name[32];
+  uint8_t buf[256];
+  struct stat st;
+  size_t offset;
+  int fd;
+  int rv;
+
+  file_name(name, sizeof(name), file);
+  rv = stat(name, &st);
+  rtems_test_assert(rv == 0);
+  rtems_test_assert(S_ISREG(st.st_mode));
+
+  if (st.st_size == 0 && file_size(file) != 0) {
+    return false;
+  }
+
+  rtems_test_assert((size_t) st.st_size == file_size(file));
+
+  fd = open(name, O_RDONLY);
+  rtems_test_assert(fd >= 0);
+
+  offset = 0;
+  while (offset < (size_t) st.st_size) {
+    ssize_t n;
+    ssize_t i;
+
+    n = read(fd, buf, sizeof(buf));
+    rtems_test_assert(n > 0);
+
+    for (i = 0; i < n; ++i) {
+      rtems_test_assert(buf[i] == file_data(file, offset + (size_t) i));
+    }
+
+    offset += (size_t) n;
+  }
+
+  rv = close(fd);
+  rtems_test_assert(rv == 0);
+
+  return true;
+}
+
+static void format_and_mount(size_t journal_blocks)
+{
+  rtems_rfs_format_config config;
+  int rv;
+
+  memset(&config, 0, sizeof(config));
+  config.block_size = FS_BLOCK_SIZE;
+  config.inode_overhead = FS_INODE_OVERHEAD;
+  config.journal_blocks = journal_blocks;
+
+  rv = rtems_rfs_format(DEV_NAME, &config);
+  rtems_test_assert(rv == 0);
+
+  rv = mount(
+    DEV_NAME,
+    MOUNT_DIR,
+    RTEMS_FILESYSTEM_TYPE_RFS,
+    RTEMS_FILESYSTEM_READ_WRITE,
+    NULL
+  );
+  rtems_test_assert(rv == 0);
+}
+
+static void print_sample(const char *name, uint64_t ns)
+{
+  printf(
+    "    <%s unit=\"ns\" perFile=\"%" PRIu64 "\" writeBlocks=\"%" PRIu32 "\">"
+    "%" PRIu64 "</%s>\n",
+    name,
+    ns / FILES,
+    device_write_blocks(),
+    ns,
+    name
+  );
+}
+
+static void test_sample_run(const test_sample *sample)
+{
+  uint64_t t0;
+  uint64_t t1;
+  int file;
+  int rv;
+
+  format_and_mount(sample->journal_blocks);
+
+  printf("  <Sample>\n    <Mode>%s</Mode>\n", sample->mode);
+
+  reset_device_stats();
+  t0 = rtems_clock_get_uptime_nanoseconds();
+
+  for (file = 0; file < FILES; ++file) {
+    create_file(file, sample->sync);
+  }
+
+  sync();
+  t1 = rtems_clock_get_uptime_nanoseconds();
+  print_sample("Create", t1 - t0);
+
+  reset_device_stats();
+  t0 = rtems_clock_get_uptime_nanoseconds();
+
+  for (file = 0; file < FILES; ++file) {
+    unlink_file(file, sample->sync);
+  }
+
+  sync();
+  t1 = rtems_clock_get_uptime_nanoseconds();
+  print_sample("Unlink", t1 - t0);
+
+  printf("  </Sample>\n");
+
+  rv = unmount(MOUNT_DIR);
+  rtems_test_assert(rv == 0);
+}
+
+/*
+ * Unlink and create files until the device stops writing, unmount and purge
+ * the cache then mount the file system again to replay the journal. The files
+ * synced before the crash are checked and every file found has to be complete
+ * or empty if it was being written. An inode cannot be lost or leaked.
+ */
+static void test_crash(uint32_t budget)
+{
+  struct statvfs stvfs;
+  struct dirent *de;
+  DIR *dir;
+  int entries;
+  int partial;
+  int file;
+  int rv;
+
+  format_and_mount(JOURNAL_BLOCKS);
+
+  for (file = 0; file < CRASH_FILES; ++file) {
+    create_file(file, false);
+  }
+
+  sync();
+
+  write_budget = budget;
+
+  for (file = 0; file < CRASH_FILES; file += 2) {
+    unlink_file(file, false);
+    create_file(CRASH_FILES + file, false);
+  }
+
+  rv = unmount(MOUNT_DIR);
+  rtems_test_assert(rv == 0);
+
+  device_ioctl(RTEMS_BLKIO_PURGEDEV, NULL);
+  write_budget = UINT32_MAX;
+
+  rv = mount(
+    DEV_NAME,
+    MOUNT_DIR,
+    RTEMS_FILESYSTEM_TYPE_RFS,
+    RTEMS_FILESYSTEM_READ_WRITE,
+    NULL
+  );
+  rtems_test_assert(rv == 0);
+
+  for (file = 1; file < CRASH_FILES; file += 2) {
+    rtems_test_assert(check_file(file));
+  }
+
+  dir = opendir(MOUNT_DIR);
+  rtems_test_assert(dir != NULL);
+
+  entries = 0;
+  partial = 0;
+  while ((de = readdir(dir)) != NULL) {
+    if (de->d_name[0] == '.') {
+      continue;
+    }
+
+    ++entries;
+    if (!check_file(atoi(de->d_name + 5))) {
+      ++partial;
+    }
+  }
+
+  rv = closedir(dir);
+  rtems_test_assert(rv == 0);
+
+  rtems_test_assert(partial <= 1);
+
+  rv = statvfs(MOUNT_DIR, &stvfs);
+  rtems_test_assert(rv == 0);
+  rtems_test_assert(stvfs.f_files - stvfs.f_ffree == (fsfilcnt_t) entries + 1);
+
+  printf(
+    "  <Crash>\n    <WriteBudget>%" PRIu32 "</WriteBudget>\n"
+    "    <Files>%i</Files>\n    <Partial>%i</Partial>\n  </Crash>\n",
+    budget,
+    entries,
+    partial
+  );
+
+  /*
+   * The file system is usable after the replay.
+   */
+  create_file(2 * CRASH_FILES, false);
+  rtems_test_assert(check_file(2 * CRASH_FILES));
+
+  rv = unmount(MOUNT_DIR);
+  rtems_test_assert(rv == 0);
+}
+
+static void Init(rtems_task_argument arg)
+{
+  rtems_status_code sc;
+  size_t i;
+  int rv;
+
+  TEST_BEGIN();
+
+  rd = ramdisk_allocate(NULL, MEDIA_BLOCK_SIZE, MEDIA_BLOCK_COUNT, false);
+  rtems_test_assert(rd != NULL);
+
+  sc = rtems_blkdev_create(
+    DEV_NAME,
+    MEDIA_BLOCK_SIZE,
+    MEDIA_BLOCK_COUNT,
+    crash_disk_ioctl,
+    rd
+  );
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  rv = mkdir(MOUNT_DIR, S_IRWXU | S_IRWXG | S_IRWXO);
+  rtems_test_assert(rv == 0);
+
+  printf("<FSRFSJournal01>\n");
+
+  for (i = 0; i < RTEMS_ARRAY_SIZE(samples); ++i) {
+    test_sample_run(&samples[i]);
+  }
+
+  for (i = 0; i < RTEMS_ARRAY_SIZE(crash_budgets); ++i) {
+    test_crash(crash_budgets[i]);
+  }
+
+  printf("</FSRFSJournal01>\n");
+
+  rv = unlink(DEV_NAME);
+  rtems_test_assert(rv == 0);
+
+  TEST_END();
+  rtems_test_exit(0);
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_LIBBLOCK
+
+#define CONFIGURE_FILESYSTEM_RFS
+
+#define CONFIGURE_MAXIMUM_FILE_DESCRIPTORS 8
+
+#define CONFIGURE_UNLIMITED_OBJECTS
+#define CONFIGURE_UNIFIED_WORK_AREAS
+
+#define CONFIGURE_INIT_TASK_STACK_SIZE (32 * 1024)
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_BDBUF_BUFFER_MAX_SIZE (4 * 1024)
+
+/*
+ * The cache has to hold the buffers of a transaction.
+ */
+#define CONFIGURE_BDBUF_CACHE_MEMORY_SIZE (256 * 1024)
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
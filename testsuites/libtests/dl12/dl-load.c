@@ -0,0 +1,187 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/*
+ * Copyright (C) 2026 On-Line Applications Research Corporation (OAR)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <inttypes.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#include <dlfcn.h>
+
+#include <rtems.h>
+
+#include "dl-load.h"
+#include "dl12-o1.h"
+
+#include <rtems/rtl/rtl-shell.h>
+#include <rtems/rtl/rtl-trace.h>
+
+#define TEST_TRACE 0
+#if TEST_TRACE
+ #define DL_DEBUG_TRACE (RTEMS_RTL_TRACE_DETAIL | \
+                         RTEMS_RTL_TRACE_WARNING | \
+                         RTEMS_RTL_TRACE_LOAD | \
+                         RTEMS_RTL_TRACE_UNLOAD | \
+                         RTEMS_RTL_TRACE_GLOBAL_SYM)
+ #define DL_RTL_CMDS    1
+#else
+ #define DL_DEBUG_TRACE 0
+ #define DL_RTL_CMDS    0
+#endif
+
+static void dl_load_dump (void)
+{
+#if DL_RTL_CMDS
+  char* status[] = { "rtl", "status", NULL };
+  printf ("RTL Status:\n");
+  rtems_rtl_shell_command (2, status);
+#endif
+}
+
+static void dl_sym_name (char* name, size_t size, int index)
+{
+  snprintf (name, size, "dl12_sym_%c%04d", 'a' + index / 10000, index % 10000);
+}
+
+static void dl_print_time (const char* label, uint64_t ns, int count)
+{
+  printf ("%s: %" PRIu64 " ns", label, ns);
+  if (count > 1)
+    printf (", %" PRIu64 " ns per symbol", ns / count);
+  printf ("\n");
+}
+
+typedef int (*int_call_t)(void);
+
+int dl_load_test(void)
+{
+  void*      handle;
+  int_call_t int_call;
+  int        unresolved;
+  char*      message = "loaded";
+  char       name[32];
+  void*      previous;
+  uint64_t   start;
+  uint64_t   ns;
+  int        i;
+
+#if DL_DEBUG_TRACE
+  rtems_rtl_trace_set_mask (DL_DEBUG_TRACE);
+#endif
+
+  printf("load: /dl12-o1.o\n");
+
+  start = rtems_clock_get_uptime_nanoseconds ();
+  handle = dlopen ("/dl12-o1.o", RTLD_NOW | RTLD_GLOBAL);
+  ns = rtems_clock_get_uptime_nanoseconds () - start;
+  if (!handle)
+  {
+    printf("dlopen failed: %s\n", dlerror());
+    return 1;
+  }
+
+  dl_print_time ("dlopen", ns, 1);
+
+  if (dlinfo (handle, RTLD_DI_UNRESOLVED, &unresolved) < 0)
+    message = "dlinfo error checking unresolved status";
+  else if (unresolved)
+    message = "has unresolved externals";
+
+  printf ("handle: %p %s\n", handle, message);
+
+  dl_load_dump ();
+
+  int_call = dlsym (handle, "dl12_sym_count");
+  if (int_call == NULL)
+  {
+    printf("dlsym failed: symbol dl12_sym_count not found\n");
+    return 1;
+  }
+
+  if (int_call () != DL12_SYM_COUNT)
+  {
+    printf("dlsym int_call failed: ret value bad\n");
+    return 1;
+  }
+
+  /*
+   * Look up all the symbols in the global symbol table. The symbols are
+   * variables laid out in the bss section so each address is different.
+   */
+  previous = NULL;
+  start = rtems_clock_get_uptime_nanoseconds ();
+  for (i = 0; i < DL12_SYM_COUNT; ++i)
+  {
+    void* sym;
+    dl_sym_name (name, sizeof (name), i);
+    sym = dlsym (RTLD_DEFAULT, name);
+    if (sym == NULL || sym == previous)
+    {
+      printf("dlsym failed: symbol %s not found\n", name);
+      return 1;
+    }
+    previous = sym;
+  }
+  ns = rtems_clock_get_uptime_nanoseconds () - start;
+
+  dl_print_time ("dlsym global", ns, DL12_SYM_COUNT);
+
+  start = rtems_clock_get_uptime_nanoseconds ();
+  for (i = 0; i < DL12_SYM_COUNT; ++i)
+  {
+    dl_sym_name (name, sizeof (name), i);
+    name[9] = 'z';
+    if (dlsym (RTLD_DEFAULT, name) != NULL)
+    {
+      printf("dlsym failed: symbol %s found\n", name);
+      return 1;
+    }
+  }
+  ns = rtems_clock_get_uptime_nanoseconds () - start;
+
+  dl_print_time ("dlsym missing", ns, DL12_SYM_COUNT);
+
+  start = rtems_clock_get_uptime_nanoseconds ();
+  if (dlclose (handle) < 0)
+  {
+    printf("dlclose failed: %s\n", dlerror());
+    return 1;
+  }
+  ns = rtems_clock_get_uptime_nanoseconds () - start;
+
+  dl_print_time ("dlclose", ns, 1);
+
+  dl_sym_name (name, sizeof (name), 0);
+  if (dlsym (RTLD_DEFAULT, name) != NULL)
+  {
+    printf("dlsym failed: symbol %s found after dlclose\n", name);
+    return 1;
+  }
+
+  printf ("handle: %p closed\n", handle);
+
+  return 0;
+}
@@ -0,0 +1,68 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/*
+ * Copyright (C) 2026 On-Line Applications Research Corporation (OAR)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * An object file with a large number of global symbols to measure the global
+ * symbol table. The symbols are named dl12_sym_a0000 to dl12_sym_e9999.
+ */
+
+#include "dl12-o1.h"
+
+#define DL12_SYM(n) int dl12_sym_##n;
+
+#define DL12_SYM_10(p) \
+  DL12_SYM(p##0) DL12_SYM(p##1) DL12_SYM(p##2) DL12_SYM(p##3) \
+  DL12_SYM(p##4) DL12_SYM(p##5) DL12_SYM(p##6) DL12_SYM(p##7) \
+  DL12_SYM(p##8) DL12_SYM(p##9)
+
+#define DL12_SYM_100(p) \
+  DL12_SYM_10(p##0) DL12_SYM_10(p##1) DL12_SYM_10(p##2) DL12_SYM_10(p##3) \
+  DL12_SYM_10(p##4) DL12_SYM_10(p##5) DL12_SYM_10(p##6) DL12_SYM_10(p##7) \
+  DL12_SYM_10(p##8) DL12_SYM_10(p##9)
+
+#define DL12_SYM_1000(p) \
+  DL12_SYM_100(p##0) DL12_SYM_100(p##1) DL12_SYM_100(p##2) \
+  DL12_SYM_100(p##3) DL12_SYM_100(p##4) DL12_SYM_100(p##5) \
+  DL12_SYM_100(p##6) DL12_SYM_100(p##7) DL12_SYM_100(p##8) \
+  DL12_SYM_100(p##9)
+
+#define DL12_SYM_10000(p) \
+  DL12_SYM_1000(p##0) DL12_SYM_1000(p##1) DL12_SYM_1000(p##2) \
+  DL12_SYM_1000(p##3) DL12_SYM_1000(p##4) DL12_SYM_1000(p##5) \
+  DL12_SYM_1000(p##6) DL12_SYM_1000(p##7) DL12_SYM_1000(p##8) \
+  DL12_SYM_1000(p##9)
+
+DL12_SYM_10000(a)
+DL12_SYM_10000(b)
+DL12_SYM_10000(c)
+DL12_SYM_10000(d)
+DL12_SYM_10000(e)
+
+int dl12_sym_count (void)
+{
+  return DL12_SYM_COUNT;
+}
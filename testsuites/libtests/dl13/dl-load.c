@@ -0,0 +1,154 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/*
+ * Copyright (C) 2026 On-Line Applications Research Corporation (OAR)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <inttypes.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#include <dlfcn.h>
+
+#include <rtems.h>
+
+#include "dl-load.h"
+#include "dl13-o.h"
+
+#include <rtems/rtl/rtl-shell.h>
+#include <rtems/rtl/rtl-trace.h>
+
+#define TEST_TRACE 0
+#if TEST_TRACE
+ #define DL_DEBUG_TRACE (RTEMS_RTL_TRACE_DETAIL | \
+                         RTEMS_RTL_TRACE_WARNING | \
+                         RTEMS_RTL_TRACE_LOAD | \
+                         RTEMS_RTL_TRACE_UNRESOLVED | \
+                         RTEMS_RTL_TRACE_DEPENDENCY)
+ #define DL_RTL_CMDS    1
+#else
+ #define DL_DEBUG_TRACE 0
+ #define DL_RTL_CMDS    0
+#endif
+
+static void dl_load_dump (void)
+{
+#if DL_RTL_CMDS
+  char* list[] = { "rtl", "list", NULL };
+  char* status[] = { "rtl", "status", NULL };
+  printf ("RTL List:\n");
+  rtems_rtl_shell_command (2, list);
+  printf ("RTL Status:\n");
+  rtems_rtl_shell_command (2, status);
+#endif
+}
+
+static void dl_print_time (const char* label, uint64_t ns, int count)
+{
+  printf ("%s: %" PRIu64 " ns", label, ns);
+  if (count > 1)
+    printf (", %" PRIu64 " ns per object", ns / count);
+  printf ("\n");
+}
+
+typedef int (*int_call_t)(void);
+
+int dl_load_test(void)
+{
+  void*      handles[DL13_OBJ_COUNT];
+  int_call_t int_call;
+  int        unresolved;
+  char       name[32];
+  uint64_t   start;
+  uint64_t   ns;
+  int        i;
+
+#if DL_DEBUG_TRACE
+  rtems_rtl_trace_set_mask (DL_DEBUG_TRACE);
+#endif
+
+  printf("load: /dl13-o00.o to /dl13-o%02d.o\n", DL13_OBJ_COUNT - 1);
+
+  /*
+   * Each object file references all the object files so the references to
+   * the object files loaded later are held in the unresolved table until the
+   * object file defining the symbol is loaded.
+   */
+  start = rtems_clock_get_uptime_nanoseconds ();
+  for (i = 0; i < DL13_OBJ_COUNT; ++i)
+  {
+    snprintf (name, sizeof (name), "/dl13-o%02d.o", i);
+    handles[i] = dlopen (name, RTLD_NOW | RTLD_GLOBAL);
+    if (handles[i] == NULL)
+    {
+      printf("dlopen failed: %s: %s\n", name, dlerror());
+      return 1;
+    }
+  }
+  ns = rtems_clock_get_uptime_nanoseconds () - start;
+
+  dl_print_time ("dlopen", ns, DL13_OBJ_COUNT);
+
+  dl_load_dump ();
+
+  for (i = 0; i < DL13_OBJ_COUNT; ++i)
+  {
+    if (dlinfo (handles[i], RTLD_DI_UNRESOLVED, &unresolved) < 0)
+    {
+      printf("dlinfo failed: %s\n", dlerror());
+      return 1;
+    }
+    if (unresolved)
+    {
+      printf("object %d has unresolved externals\n", i);
+      return 1;
+    }
+  }
+
+  printf ("handles: loaded\n");
+
+  for (i = 0; i < DL13_OBJ_COUNT; ++i)
+  {
+    snprintf (name, sizeof (name), "dl13_sum_%02d", i);
+    int_call = dlsym (handles[i], name);
+    if (int_call == NULL)
+    {
+      printf("dlsym failed: symbol %s not found\n", name);
+      return 1;
+    }
+    if (int_call () != DL13_VALUE_SUM)
+    {
+      printf("dlsym int_call failed: %s ret value bad\n", name);
+      return 1;
+    }
+  }
+
+  printf ("sums: ok\n");
+
+  /*
+   * The object files reference each other so they cannot be unloaded.
+   */
+
+  return 0;
+}
@@ -0,0 +1,55 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/*
+ * Copyright (C) 2026 On-Line Applications Research Corporation (OAR)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * One of a set of object files referencing each other. Each object file is
+ * built with DL13_OBJ set to its two digit number and DL13_INDEX set to its
+ * index. An object file references the value of every object file in the set
+ * so loading the set in order leaves the references to the object files
+ * loaded later unresolved until they are loaded.
+ */
+
+#include "dl13-o.h"
+
+#define DL13_CAT_(a, b) a##b
+#define DL13_CAT(a, b)  DL13_CAT_(a, b)
+
+#define DL13_EXTERN(n) extern int dl13_value_##n;
+#define DL13_ADD(n)    sum += dl13_value_##n;
+
+DL13_OBJS(DL13_EXTERN)
+
+int DL13_CAT(dl13_value_, DL13_OBJ) = DL13_INDEX + 1;
+
+int DL13_CAT(dl13_sum_, DL13_OBJ) (void);
+
+int DL13_CAT(dl13_sum_, DL13_OBJ) (void)
+{
+  int sum = 0;
+  DL13_OBJS(DL13_ADD)
+  return sum;
+}
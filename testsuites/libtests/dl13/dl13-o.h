@@ -0,0 +1,48 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/*
+ * Copyright (C) 2026 On-Line Applications Research Corporation (OAR)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#if !defined(_DL13_O_H_)
+#define _DL13_O_H_
+
+#define DL13_OBJ_COUNT 100
+
+/*
+ * The sum of the values of all the object files.
+ */
+#define DL13_VALUE_SUM ((DL13_OBJ_COUNT * (DL13_OBJ_COUNT + 1)) / 2)
+
+#define DL13_OBJS_10(M, t) \
+  M(t##0) M(t##1) M(t##2) M(t##3) M(t##4) \
+  M(t##5) M(t##6) M(t##7) M(t##8) M(t##9)
+
+#define DL13_OBJS(M) \
+  DL13_OBJS_10(M, 0) DL13_OBJS_10(M, 1) DL13_OBJS_10(M, 2) \
+  DL13_OBJS_10(M, 3) DL13_OBJS_10(M, 4) DL13_OBJS_10(M, 5) \
+  DL13_OBJS_10(M, 6) DL13_OBJS_10(M, 7) DL13_OBJS_10(M, 8) \
+  DL13_OBJS_10(M, 9)
+
+#endif
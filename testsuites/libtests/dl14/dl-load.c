@@ -0,0 +1,243 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/*
+ * Copyright (C) 2026 On-Line Applications Research Corporation (OAR)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <errno.h>
+#include <fcntl.h>
+#include <inttypes.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <dlfcn.h>
+
+#include <rtems.h>
+#include <rtems/libcsupport.h>
+
+#include "dl-load.h"
+#include "dl14-o1.h"
+
+#include <rtems/rtl/rtl-shell.h>
+#include <rtems/rtl/rtl-trace.h>
+
+#define TEST_TRACE 0
+#if TEST_TRACE
+ #define DL_DEBUG_TRACE (RTEMS_RTL_TRACE_DETAIL | \
+                         RTEMS_RTL_TRACE_WARNING | \
+                         RTEMS_RTL_TRACE_LOAD | \
+                         RTEMS_RTL_TRACE_UNLOAD | \
+                         RTEMS_RTL_TRACE_LOAD_SECT)
+ #define DL_RTL_CMDS    1
+#else
+ #define DL_DEBUG_TRACE 0
+ #define DL_RTL_CMDS    0
+#endif
+
+static void dl_load_dump (void)
+{
+#if DL_RTL_CMDS
+  char* list[] = { "rtl", "list", "-l", NULL };
+  printf ("RTL List:\n");
+  rtems_rtl_shell_command (3, list);
+#endif
+}
+
+static uintptr_t dl_heap_used (void)
+{
+  Heap_Information_block info;
+  malloc_info (&info);
+  return info.Used.total;
+}
+
+static uint32_t dl_table_value (int index)
+{
+  uint32_t value = 0;
+  int      shift = 0;
+  while (index != 0)
+  {
+    value |= (uint32_t) (index % 10) << shift;
+    index /= 10;
+    shift += 4;
+  }
+  return value;
+}
+
+static int dl_copy (const char* from, const char* to)
+{
+  char buf[512];
+  int  in;
+  int  out;
+  int  r = 0;
+
+  in = open (from, O_RDONLY);
+  if (in < 0)
+    return -1;
+
+  out = open (to, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+  if (out < 0)
+  {
+    close (in);
+    return -1;
+  }
+
+  while (true)
+  {
+    ssize_t len = read (in, buf, sizeof (buf));
+    if (len <= 0)
+    {
+      r = len < 0 ? -1 : 0;
+      break;
+    }
+    if (write (out, buf, len) != len)
+    {
+      r = -1;
+      break;
+    }
+  }
+
+  close (out);
+  close (in);
+
+  return r;
+}
+
+typedef uint32_t (*uint32_call_t)(void);
+
+static int dl_load_object (const char* name,
+                           const void* image,
+                           size_t      size,
+                           bool        in_image)
+{
+  void*           handle;
+  const uint32_t* table;
+  uint32_call_t   table_sum;
+  uint32_t        sum;
+  uintptr_t       used;
+  uint64_t        start;
+  uint64_t        ns;
+  bool            mapped;
+  int             unresolved;
+  int             i;
+
+  printf("load: %s\n", name);
+
+  used = dl_heap_used ();
+  start = rtems_clock_get_uptime_nanoseconds ();
+  handle = dlopen (name, RTLD_NOW | RTLD_GLOBAL);
+  ns = rtems_clock_get_uptime_nanoseconds () - start;
+  used = dl_heap_used () - used;
+  if (!handle)
+  {
+    printf("dlopen failed: %s\n", dlerror());
+    return 1;
+  }
+
+  printf ("dlopen: %" PRIu64 " ns, heap: %" PRIuPTR " bytes\n", ns, used);
+
+  if (dlinfo (handle, RTLD_DI_UNRESOLVED, &unresolved) < 0 || unresolved)
+  {
+    printf("dlinfo failed or unresolved externals\n");
+    return 1;
+  }
+
+  dl_load_dump ();
+
+  table = dlsym (handle, "dl14_table");
+  table_sum = dlsym (handle, "dl14_table_sum");
+  if (table == NULL || table_sum == NULL)
+  {
+    printf("dlsym failed: %s\n", dlerror());
+    return 1;
+  }
+
+  /*
+   * The table is used in place if the file is mapped.
+   */
+  mapped = (const uint8_t*) table >= (const uint8_t*) image &&
+           (const uint8_t*) table < (const uint8_t*) image + size;
+  if (mapped != in_image)
+  {
+    printf("table %p is %sin the image\n", table, mapped ? "" : "not ");
+    return 1;
+  }
+
+  printf ("table: %s\n", mapped ? "mapped" : "copied");
+
+  sum = 0;
+  for (i = 0; i < DL14_TABLE_SIZE; ++i)
+  {
+    if (table[i] != dl_table_value (i))
+    {
+      printf("table: bad value at %d\n", i);
+      return 1;
+    }
+    sum += table[i];
+  }
+
+  if (table_sum () != sum)
+  {
+    printf("dl14_table_sum failed: ret value bad\n");
+    return 1;
+  }
+
+  if (dlclose (handle) < 0)
+  {
+    printf("dlclose failed: %s\n", dlerror());
+    return 1;
+  }
+
+  printf ("handle: %p closed\n", handle);
+
+  return 0;
+}
+
+int dl_load_test(const void* image, size_t size)
+{
+  int ret;
+
+#if DL_DEBUG_TRACE
+  rtems_rtl_trace_set_mask (DL_DEBUG_TRACE);
+#endif
+
+  /*
+   * The object file in the tar file system is a linear file which can be
+   * mapped. Its copy is a memory file which cannot be mapped and is loaded
+   * by reading the file.
+   */
+  ret = dl_load_object ("/dl14-o1.o", image, size, true);
+  if (ret != 0)
+    return ret;
+
+  if (dl_copy ("/dl14-o1.o", "/dl14-o1-copy.o") != 0)
+  {
+    printf("copy failed: %s\n", strerror (errno));
+    return 1;
+  }
+
+  return dl_load_object ("/dl14-o1-copy.o", image, size, false);
+}
@@ -0,0 +1,75 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/*
+ * Copyright (C) 2026 On-Line Applications Research Corporation (OAR)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * An object file with a large constant table and a function using it. The
+ * table has no relocations so it can be used in place if the object file is
+ * mapped into memory. The function references the table so it is relocated.
+ */
+
+#include "dl14-o1.h"
+
+#define DL14_V(n) 0x##n##U,
+
+#define DL14_V_10(p) \
+  DL14_V(p##0) DL14_V(p##1) DL14_V(p##2) DL14_V(p##3) DL14_V(p##4) \
+  DL14_V(p##5) DL14_V(p##6) DL14_V(p##7) DL14_V(p##8) DL14_V(p##9)
+
+#define DL14_V_100(p) \
+  DL14_V_10(p##0) DL14_V_10(p##1) DL14_V_10(p##2) DL14_V_10(p##3) \
+  DL14_V_10(p##4) DL14_V_10(p##5) DL14_V_10(p##6) DL14_V_10(p##7) \
+  DL14_V_10(p##8) DL14_V_10(p##9)
+
+#define DL14_V_1000(p) \
+  DL14_V_100(p##0) DL14_V_100(p##1) DL14_V_100(p##2) DL14_V_100(p##3) \
+  DL14_V_100(p##4) DL14_V_100(p##5) DL14_V_100(p##6) DL14_V_100(p##7) \
+  DL14_V_100(p##8) DL14_V_100(p##9)
+
+#define DL14_V_10000(p) \
+  DL14_V_1000(p##0) DL14_V_1000(p##1) DL14_V_1000(p##2) \
+  DL14_V_1000(p##3) DL14_V_1000(p##4) DL14_V_1000(p##5) \
+  DL14_V_1000(p##6) DL14_V_1000(p##7) DL14_V_1000(p##8) \
+  DL14_V_1000(p##9)
+
+/*
+ * The value of an entry is its index written in decimal digits read as a
+ * hexadecimal number.
+ */
+const uint32_t dl14_table[DL14_TABLE_SIZE] = {
+  DL14_V_10000(0)
+  DL14_V_10000(1)
+  DL14_V_10000(2)
+};
+
+uint32_t dl14_table_sum (void)
+{
+  uint32_t sum = 0;
+  int      i;
+  for (i = 0; i < DL14_TABLE_SIZE; ++i)
+    sum += dl14_table[i];
+  return sum;
+}
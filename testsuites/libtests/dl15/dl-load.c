@@ -0,0 +1,183 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/*
+ * Copyright (C) 2026 On-Line Applications Research Corporation (OAR)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <inttypes.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#include <dlfcn.h>
+
+#include <rtems.h>
+
+#include "dl-load.h"
+#include "dl15-o1.h"
+
+#include <rtems/rtl/rtl.h>
+#include <rtems/rtl/rtl-shell.h>
+#include <rtems/rtl/rtl-trace.h>
+
+#define TEST_TRACE 0
+#if TEST_TRACE
+ #define DL_DEBUG_TRACE (RTEMS_RTL_TRACE_DETAIL | \
+                         RTEMS_RTL_TRACE_WARNING | \
+                         RTEMS_RTL_TRACE_LOAD | \
+                         RTEMS_RTL_TRACE_UNLOAD | \
+                         RTEMS_RTL_TRACE_DEPENDENCY)
+ #define DL_RTL_CMDS    1
+#else
+ #define DL_DEBUG_TRACE 0
+ #define DL_RTL_CMDS    0
+#endif
+
+/*
+ * The table the object file's table references. It is in the base image.
+ */
+uint32_t dl15_base[DL15_BASE_SIZE];
+
+static void dl_load_dump (void)
+{
+#if DL_RTL_CMDS
+  char* list[] = { "rtl", "list", "-l", NULL };
+  printf ("RTL List:\n");
+  rtems_rtl_shell_command (3, list);
+#endif
+}
+
+typedef uint32_t (*uint32_call_t)(void);
+
+static int dl_load_object (uint32_t workers, uint64_t* ns)
+{
+  void*            handle;
+  uint32_t* const* table;
+  uint32_call_t    table_sum;
+  uint64_t         start;
+  uint32_t         sum;
+  int              unresolved;
+  int              i;
+
+  printf("load: workers: %" PRIu32 "\n", workers);
+
+  if (!rtems_rtl_set_relocate_workers (workers))
+  {
+    printf("set workers failed\n");
+    return 1;
+  }
+
+  start = rtems_clock_get_uptime_nanoseconds ();
+  handle = dlopen ("/dl15-o1.o", RTLD_NOW | RTLD_GLOBAL);
+  *ns = rtems_clock_get_uptime_nanoseconds () - start;
+  if (!handle)
+  {
+    printf("dlopen failed: %s\n", dlerror());
+    return 1;
+  }
+
+  printf ("dlopen: %" PRIu64 " ns\n", *ns);
+
+  if (dlinfo (handle, RTLD_DI_UNRESOLVED, &unresolved) < 0 || unresolved)
+  {
+    printf("dlinfo failed or unresolved externals\n");
+    return 1;
+  }
+
+  dl_load_dump ();
+
+  table = dlsym (handle, "dl15_table");
+  table_sum = dlsym (handle, "dl15_table_sum");
+  if (table == NULL || table_sum == NULL)
+  {
+    printf("dlsym failed: %s\n", dlerror());
+    return 1;
+  }
+
+  sum = 0;
+  for (i = 0; i < DL15_TABLE_SIZE; ++i)
+  {
+    if (table[i] != &dl15_base[i % DL15_BASE_SIZE])
+    {
+      printf("table: bad relocation at %d\n", i);
+      return 1;
+    }
+    sum += *table[i];
+  }
+
+  if (table_sum () != sum)
+  {
+    printf("dl15_table_sum failed: ret value bad\n");
+    return 1;
+  }
+
+  if (dlclose (handle) < 0)
+  {
+    printf("dlclose failed: %s\n", dlerror());
+    return 1;
+  }
+
+  printf ("handle: %p closed\n", handle);
+
+  return 0;
+}
+
+int dl_load_test(void)
+{
+  uint64_t serial_ns;
+  uint64_t parallel_ns;
+  int      ret;
+  int      i;
+
+#if DL_DEBUG_TRACE
+  rtems_rtl_trace_set_mask (DL_DEBUG_TRACE);
+#endif
+
+  for (i = 0; i < DL15_BASE_SIZE; ++i)
+    dl15_base[i] = i * 3;
+
+  /*
+   * Relocate the object file with the loading task and then with the
+   * relocation workers. The workers are used even if there is a single
+   * processor.
+   */
+  ret = dl_load_object (1, &serial_ns);
+  if (ret != 0)
+    return ret;
+
+  ret = dl_load_object (DL15_WORKERS, &parallel_ns);
+  if (ret != 0)
+    return ret;
+
+  if (!rtems_rtl_set_relocate_workers (1))
+  {
+    printf("delete workers failed\n");
+    return 1;
+  }
+
+  printf ("relocation: serial: %" PRIu64 " ns, parallel: %" PRIu64 " ns\n",
+          serial_ns, parallel_ns);
+
+  return 0;
+}
@@ -0,0 +1,65 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/*
+ * Copyright (C) 2026 On-Line Applications Research Corporation (OAR)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "dl15-o1.h"
+
+/*
+ * Each entry of the table references the base image's table and needs a
+ * relocation record which is resolved using the global symbol table.
+ */
+#define DL15_E1(i)      &dl15_base[(i) % DL15_BASE_SIZE],
+#define DL15_E2(i)      DL15_E1(i) DL15_E1((i) + 1)
+#define DL15_E4(i)      DL15_E2(i) DL15_E2((i) + 2)
+#define DL15_E8(i)      DL15_E4(i) DL15_E4((i) + 4)
+#define DL15_E16(i)     DL15_E8(i) DL15_E8((i) + 8)
+#define DL15_E32(i)     DL15_E16(i) DL15_E16((i) + 16)
+#define DL15_E64(i)     DL15_E32(i) DL15_E32((i) + 32)
+#define DL15_E128(i)    DL15_E64(i) DL15_E64((i) + 64)
+#define DL15_E256(i)    DL15_E128(i) DL15_E128((i) + 128)
+#define DL15_E512(i)    DL15_E256(i) DL15_E256((i) + 256)
+#define DL15_E1024(i)   DL15_E512(i) DL15_E512((i) + 512)
+#define DL15_E2048(i)   DL15_E1024(i) DL15_E1024((i) + 1024)
+#define DL15_E4096(i)   DL15_E2048(i) DL15_E2048((i) + 2048)
+#define DL15_E8192(i)   DL15_E4096(i) DL15_E4096((i) + 4096)
+#define DL15_E16384(i)  DL15_E8192(i) DL15_E8192((i) + 8192)
+#define DL15_E32768(i)  DL15_E16384(i) DL15_E16384((i) + 16384)
+#define DL15_E65536(i)  DL15_E32768(i) DL15_E32768((i) + 32768)
+#define DL15_E131072(i) DL15_E65536(i) DL15_E65536((i) + 65536)
+
+uint32_t* const dl15_table[DL15_TABLE_SIZE] =
+{
+  DL15_E131072(0)
+};
+
+uint32_t dl15_table_sum (void)
+{
+  uint32_t sum = 0;
+  int      i;
+  for (i = 0; i < DL15_TABLE_SIZE; ++i)
+    sum += *dl15_table[i];
+  return sum;
+}
@@ -33,6 +33,7 @@
 
 #include <sys/stat.h>
 #include <errno.h>
+#include <inttypes.h>
 #include <string.h>
 #include <stdint.h>
 #include <unistd.h>
@@ -41,6 +42,7 @@
 #include <rtems/flashdisk.h>
 #include <rtems/libio.h>
 #include <rtems/blkdev.h>
+#include <rtems/counter.h>
 #include <rtems/rtems-rfs-format.h>
 
 #include "test-file-system.h"
@@ -50,7 +52,7 @@ const char rtems_test_name[] = "FLASHDISK 1";
 /* forward declarations to avoid warnings */
 static rtems_task Init(rtems_task_argument argument);
 
-#define FLASHDISK_CONFIG_COUNT 1
+#define FLASHDISK_CONFIG_COUNT 3
 
 #define FLASHDISK_DEVICE_COUNT 1
 
@@ -76,6 +78,46 @@ static const char file [] = "/mnt/file";
 
 static uint8_t flashdisk_data [FLASHDISK_SIZE];
 
+/*
+ * The benchmark disks simulate a flash device with a fixed cost for each
+ * operation, a cost for each page transferred and a slow erase.
+ */
+
+#define BENCH_DISK_COUNT 2
+
+#define BENCH_SEGMENT_COUNT 12U
+
+#define BENCH_SIZE (BENCH_SEGMENT_COUNT * FLASHDISK_SEGMENT_SIZE)
+
+#define BENCH_OP_NS 40000
+
+#define BENCH_PAGE_NS 20000
+
+#define BENCH_ERASE_NS 1000000
+
+#define BENCH_BLOCKS 256U
+
+#define BENCH_REQUEST_BLOCKS 16U
+
+#define BENCH_PASSES 4
+
+static const char * const bench_devices [BENCH_DISK_COUNT] = {
+  "/dev/fddb",
+  "/dev/fddc"
+};
+
+static uint8_t bench_data [BENCH_DISK_COUNT * BENCH_SIZE];
+
+static uint8_t bench_buffer [BENCH_REQUEST_BLOCKS] [FLASHDISK_BLOCK_SIZE];
+
+static union {
+  rtems_blkdev_request req;
+  uint8_t raw [
+    sizeof(rtems_blkdev_request)
+      + BENCH_REQUEST_BLOCKS * sizeof(rtems_blkdev_sg_buffer)
+  ];
+} bench_request;
+
 static void flashdisk_print_status(const char *disk_path)
 {
   int rv;
@@ -89,6 +131,162 @@ static void flashdisk_print_status(const char *disk_path)
   rtems_test_assert(rv == 0);
 }
 
+static void bench_done(rtems_blkdev_request *req, rtems_status_code status)
+{
+  req->status = status;
+}
+
+static void bench_fill(uint32_t block, uint32_t pass, uint8_t *buffer)
+{
+  memset(buffer, (int) (block + pass), FLASHDISK_BLOCK_SIZE);
+  memcpy(buffer, &block, sizeof(block));
+}
+
+static void bench_transfer(
+  rtems_disk_device *dd,
+  rtems_blkdev_request_op op,
+  uint32_t first
+)
+{
+  rtems_blkdev_request *req = &bench_request.req;
+  uint32_t i;
+  int rv;
+
+  req->req = op;
+  req->done = bench_done;
+  req->done_arg = NULL;
+  req->status = RTEMS_NOT_DEFINED;
+  req->bufnum = BENCH_REQUEST_BLOCKS;
+  req->io_task = rtems_task_self();
+
+  for (i = 0; i < BENCH_REQUEST_BLOCKS; ++i) {
+    rtems_blkdev_sg_buffer *sg = &req->bufs [i];
+
+    sg->block = first + i;
+    sg->length = FLASHDISK_BLOCK_SIZE;
+    sg->buffer = &bench_buffer [i] [0];
+    sg->user = NULL;
+  }
+
+  rv = (*dd->ioctl)(dd, RTEMS_BLKIO_REQUEST, req);
+  rtems_test_assert(rv == 0);
+  rtems_test_assert(req->status == RTEMS_SUCCESSFUL);
+}
+
+static void bench_disk(const char *disk_path, bool multi_page)
+{
+  rtems_fdisk_monitor_data data;
+  rtems_fdisk_erase_counts counts;
+  rtems_disk_device *dd;
+  uint64_t write_time = 0;
+  uint64_t read_time;
+  uint64_t start;
+  uint32_t block;
+  uint32_t i;
+  int pass;
+  int fd;
+  int rv;
+
+  fd = open(disk_path, O_RDWR);
+  rtems_test_assert(fd >= 0);
+
+  rv = rtems_disk_fd_get_disk_device(fd, &dd);
+  rtems_test_assert(rv == 0);
+
+  for (pass = 0; pass < BENCH_PASSES; ++pass) {
+    for (block = 0; block < BENCH_BLOCKS; block += BENCH_REQUEST_BLOCKS) {
+      for (i = 0; i < BENCH_REQUEST_BLOCKS; ++i) {
+        bench_fill(block + i, pass, &bench_buffer [i] [0]);
+      }
+
+      start = rtems_clock_get_uptime_nanoseconds();
+      bench_transfer(dd, RTEMS_BLKDEV_REQ_WRITE, block);
+      write_time += rtems_clock_get_uptime_nanoseconds() - start;
+
+      /* Idle time between bursts for the background task */
+      rv = rtems_task_wake_after(1);
+      rtems_test_assert(rv == RTEMS_SUCCESSFUL);
+    }
+  }
+
+  start = rtems_clock_get_uptime_nanoseconds();
+
+  for (block = 0; block < BENCH_BLOCKS; block += BENCH_REQUEST_BLOCKS) {
+    bench_transfer(dd, RTEMS_BLKDEV_REQ_READ, block);
+
+    for (i = 0; i < BENCH_REQUEST_BLOCKS; ++i) {
+      uint8_t expected [FLASHDISK_BLOCK_SIZE];
+
+      bench_fill(block + i, BENCH_PASSES - 1, expected);
+      rtems_test_assert(
+        memcmp(expected, &bench_buffer [i] [0], FLASHDISK_BLOCK_SIZE) == 0
+      );
+    }
+  }
+
+  read_time = rtems_clock_get_uptime_nanoseconds() - start;
+
+  rv = ioctl(fd, RTEMS_FDISK_IOCTL_MONITORING, &data);
+  rtems_test_assert(rv == 0);
+
+  memset(&counts, 0, sizeof(counts));
+  rv = ioctl(fd, RTEMS_FDISK_IOCTL_ERASE_COUNTS, &counts);
+  rtems_test_assert(rv == 0);
+  rtems_test_assert(counts.segment_count == BENCH_SEGMENT_COUNT);
+  rtems_test_assert(counts.total == data.seg_erases);
+  rtems_test_assert(counts.min <= counts.max);
+
+  printf(
+    "  <Disk name=\"%s\">\n"
+    "    <WriteTime unit=\"ns\" blocks=\"%" PRIu32 "\">%" PRIu64
+      "</WriteTime>\n"
+    "    <ReadTime unit=\"ns\" blocks=\"%" PRIu32 "\">%" PRIu64
+      "</ReadTime>\n"
+    "    <CompactStallTime unit=\"ns\">%" PRIu64 "</CompactStallTime>\n"
+    "    <Compactions background=\"%" PRIu32 "\">%" PRIu32
+      "</Compactions>\n"
+    "    <Erases background=\"%" PRIu32 "\" min=\"%" PRIu32
+      "\" max=\"%" PRIu32 "\">%" PRIu32 "</Erases>\n"
+    "    <MultiPage reads=\"%" PRIu32 "\" writes=\"%" PRIu32 "\"/>\n"
+    "  </Disk>\n",
+    disk_path,
+    (uint32_t) (BENCH_BLOCKS * BENCH_PASSES),
+    write_time,
+    (uint32_t) BENCH_BLOCKS,
+    read_time,
+    data.compact_stall_time,
+    data.background_compactions,
+    data.compactions,
+    data.background_erases,
+    counts.min,
+    counts.max,
+    counts.total,
+    data.multi_page_reads,
+    data.multi_page_writes
+  );
+
+  if (multi_page) {
+    rtems_test_assert(data.multi_page_reads > 0);
+    rtems_test_assert(data.multi_page_writes > 0);
+    rtems_test_assert(data.background_erases > 0);
+  } else {
+    rtems_test_assert(data.multi_page_reads == 0);
+    rtems_test_assert(data.multi_page_writes == 0);
+    rtems_test_assert(data.background_erases == 0);
+  }
+
+  rv = close(fd);
+  rtems_test_assert(rv == 0);
+}
+
+static void test_bench(void)
+{
+  printf("<FlashDiskBenchmark>\n");
+  bench_disk(bench_devices [0], false);
+  bench_disk(bench_devices [1], true);
+  printf("</FlashDiskBenchmark>\n");
+}
+
 static int test_rfs_mount_handler(
   const char *disk_path,
   const char *mount_path,
@@ -165,6 +363,7 @@ static void Init(rtems_task_argument arg)
   TEST_BEGIN();
 
   test();
+  test_bench();
 
   TEST_END();
 
@@ -183,6 +382,7 @@ static rtems_device_driver flashdisk_initialize(
 )
 {
   erase_device();
+  memset(&bench_data [0], 0xff, sizeof(bench_data));
 
   return rtems_fdisk_initialize(major, minor, arg);
 }
@@ -299,6 +499,162 @@ static int flashdisk_erase_device(
   return eno;
 }
 
+static uint8_t *bench_get_data_pointer(
+  const rtems_fdisk_segment_desc *sd,
+  uint32_t segment,
+  uint32_t offset
+)
+{
+  offset += sd->offset + (segment - sd->segment) * sd->size;
+
+  return &bench_data [offset];
+}
+
+static void bench_delay(uint32_t pages)
+{
+  rtems_counter_delay_nanoseconds(BENCH_OP_NS + pages * BENCH_PAGE_NS);
+}
+
+static int bench_read(
+  const rtems_fdisk_segment_desc *sd,
+  uint32_t device,
+  uint32_t segment,
+  uint32_t offset,
+  void *buffer,
+  uint32_t size
+)
+{
+  bench_delay(size / FLASHDISK_BLOCK_SIZE);
+  memcpy(buffer, bench_get_data_pointer(sd, segment, offset), size);
+
+  return 0;
+}
+
+static int bench_write(
+  const rtems_fdisk_segment_desc *sd,
+  uint32_t device,
+  uint32_t segment,
+  uint32_t offset,
+  const void *buffer,
+  uint32_t size
+)
+{
+  bench_delay(size / FLASHDISK_BLOCK_SIZE);
+  memcpy(bench_get_data_pointer(sd, segment, offset), buffer, size);
+
+  return 0;
+}
+
+static int bench_blank(
+  const rtems_fdisk_segment_desc *sd,
+  uint32_t device,
+  uint32_t segment,
+  uint32_t offset,
+  uint32_t size
+)
+{
+  const uint8_t *current = bench_get_data_pointer(sd, segment, offset);
+  uint32_t i;
+
+  bench_delay(size / FLASHDISK_BLOCK_SIZE);
+
+  for (i = 0; i < size; ++i) {
+    if (current [i] != 0xff) {
+      return EIO;
+    }
+  }
+
+  return 0;
+}
+
+static int bench_verify(
+  const rtems_fdisk_segment_desc *sd,
+  uint32_t device,
+  uint32_t segment,
+  uint32_t offset,
+  const void *buffer,
+  uint32_t size
+)
+{
+  bench_delay(size / FLASHDISK_BLOCK_SIZE);
+
+  if (memcmp(bench_get_data_pointer(sd, segment, offset), buffer, size) != 0) {
+    return EIO;
+  }
+
+  return 0;
+}
+
+static int bench_erase(
+  const rtems_fdisk_segment_desc *sd,
+  uint32_t device,
+  uint32_t segment
+)
+{
+  rtems_counter_delay_nanoseconds(BENCH_ERASE_NS);
+  memset(bench_get_data_pointer(sd, segment, 0), 0xff, sd->size);
+
+  return 0;
+}
+
+static int bench_erase_device(
+  const rtems_fdisk_device_desc *dd,
+  uint32_t device
+)
+{
+  uint32_t segment;
+
+  for (segment = 0; segment < dd->segments->count; ++segment) {
+    bench_erase(dd->segments, device, segment);
+  }
+
+  return 0;
+}
+
+static int bench_read_pages(
+  const rtems_fdisk_segment_desc *sd,
+  uint32_t device,
+  uint32_t segment,
+  uint32_t offset,
+  void * const *buffers,
+  uint32_t page_size,
+  uint32_t count
+)
+{
+  const uint8_t *data = bench_get_data_pointer(sd, segment, offset);
+  uint32_t i;
+
+  bench_delay(count);
+
+  for (i = 0; i < count; ++i) {
+    memcpy(buffers [i], data + i * page_size, page_size);
+  }
+
+  return 0;
+}
+
+static int bench_write_pages(
+  const rtems_fdisk_segment_desc *sd,
+  uint32_t device,
+  uint32_t segment,
+  uint32_t offset,
+  const void * const *buffers,
+  uint32_t page_size,
+  uint32_t count
+)
+{
+  uint8_t *data = bench_get_data_pointer(sd, segment, offset);
+  uint32_t i;
+
+  bench_delay(count);
+
+  for (i = 0; i < count; ++i) {
+    memcpy(data + i * page_size, buffers [i], page_size);
+  }
+
+  return 0;
+}
+
 static const rtems_fdisk_segment_desc flashdisk_segment_desc = {
   .count = FLASHDISK_SEGMENT_COUNT,
   .segment = 0,
@@ -321,6 +677,52 @@ static const rtems_fdisk_device_desc flashdisk_device = {
   .flash_ops = &flashdisk_ops
 };
 
+static const rtems_fdisk_segment_desc bench_segment_desc [BENCH_DISK_COUNT] = {
+  {
+    .count = BENCH_SEGMENT_COUNT,
+    .segment = 0,
+    .offset = 0,
+    .size = FLASHDISK_SEGMENT_SIZE
+  }, {
+    .count = BENCH_SEGMENT_COUNT,
+    .segment = 0,
+    .offset = BENCH_SIZE,
+    .size = FLASHDISK_SEGMENT_SIZE
+  }
+};
+
+static const rtems_fdisk_driver_handlers bench_page_ops = {
+  .read = bench_read,
+  .write = bench_write,
+  .blank = bench_blank,
+  .verify = bench_verify,
+  .erase = bench_erase,
+  .erase_device = bench_erase_device
+};
+
+static const rtems_fdisk_driver_handlers bench_multi_page_ops = {
+  .read = bench_read,
+  .write = bench_write,
+  .blank = bench_blank,
+  .verify = bench_verify,
+  .erase = bench_erase,
+  .erase_device = bench_erase_device,
+  .read_pages = bench_read_pages,
+  .write_pages = bench_write_pages
+};
+
+static const rtems_fdisk_device_desc bench_device [BENCH_DISK_COUNT] = {
+  {
+    .segment_count = 1,
+    .segments = &bench_segment_desc [0],
+    .flash_ops = &bench_page_ops
+  }, {
+    .segment_count = 1,
+    .segments = &bench_segment_desc [1],
+    .flash_ops = &bench_multi_page_ops
+  }
+};
+
 const rtems_flashdisk_config
 rtems_flashdisk_configuration [FLASHDISK_CONFIG_COUNT] = {
   {
@@ -333,6 +735,26 @@ rtems_flashdisk_configuration [FLASHDISK_CONFIG_COUNT] = {
     .compact_segs = 2,
     .avail_compact_segs = 1,
     .info_level = 0
+  }, {
+    .block_size = FLASHDISK_BLOCK_SIZE,
+    .device_count = 1,
+    .devices = &bench_device [0],
+    .flags = RTEMS_FDISK_CHECK_PAGES,
+    .unavail_blocks = 2 * FLASHDISK_BLOCKS_PER_SEGMENT,
+    .compact_segs = 2,
+    .avail_compact_segs = 2,
+    .info_level = 0
+  }, {
+    .block_size = FLASHDISK_BLOCK_SIZE,
+    .device_count = 1,
+    .devices = &bench_device [1],
+    .flags = RTEMS_FDISK_CHECK_PAGES
+      | RTEMS_FDISK_BACKGROUND_ERASE
+      | RTEMS_FDISK_BACKGROUND_COMPACT,
+    .unavail_blocks = 2 * FLASHDISK_BLOCKS_PER_SEGMENT,
+    .compact_segs = 2,
+    .avail_compact_segs = 2,
+    .info_level = 0
   }
 };
 
@@ -349,7 +771,7 @@ uint32_t rtems_flashdisk_configuration_size = FLASHDISK_CONFIG_COUNT;
 
 #define CONFIGURE_FILESYSTEM_RFS
 
-#define CONFIGURE_MAXIMUM_TASKS 2
+#define CONFIGURE_MAXIMUM_TASKS 3
 #define CONFIGURE_MAXIMUM_SEMAPHORES 1
 
 #define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
@@ -0,0 +1,542 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/*
+ * Copyright (C) 2026 On-Line Applications Research Corporation (OAR)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <netinet/in.h>
+#include <fcntl.h>
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <rtems.h>
+#include <rtems/ftpd.h>
+#include <rtems/imfs.h>
+
+#include <tmacros.h>
+
+const char rtems_test_name[] = "FTPD 1";
+
+/*
+ * The FTP daemon runs on fake sockets.  The control and data connections are
+ * IMFS generic nodes.  The socket functions used by the FTP daemon are
+ * provided by this test and map send() and recv() to write() and read() on
+ * these nodes.
+ */
+
+#define FILE_SIZE 32768
+
+#define TRANSFER_SIZE 8192
+
+#define DATA_CHUNK_SIZE 700
+
+#define OUTPUT_SIZE (2 * FILE_SIZE)
+
+#define REPLY_SIZE 1024
+
+#define TRANSFER_COUNT 3
+
+typedef struct {
+  const char *input;
+  size_t input_size;
+  size_t input_pos;
+  size_t chunk_size;
+  bool line_mode;
+  char *output;
+  size_t output_size;
+  size_t output_pos;
+} fake_stream;
+
+/*
+ * A data connection is opened for each transfer and closed after it, so the
+ * open and close of the data node delimit the transfer.
+ */
+typedef struct {
+  uint64_t begin;
+  uint64_t duration;
+  size_t bytes;
+} transfer_sample;
+
+typedef struct {
+  rtems_id runner;
+  int accept_count;
+  size_t data_pos;
+  size_t transfer_count;
+  transfer_sample transfers[TRANSFER_COUNT];
+  fake_stream control;
+  fake_stream data;
+  char replies[REPLY_SIZE];
+  char data_output[OUTPUT_SIZE];
+  char memfile[FILE_SIZE];
+  char linfile[FILE_SIZE];
+  char stored[FILE_SIZE];
+  char read_buffer[FILE_SIZE];
+} test_context;
+
+static test_context test_instance;
+
+static const char control_path[] = "/ctrl";
+
+static const char data_path[] = "/data";
+
+static const char commands[] =
+  "TYPE I\r\n"
+  "RETR /mem\r\n"
+  "RETR /lin\r\n"
+  "STOR /stored\r\n"
+  "QUIT\r\n";
+
+static const char * const transfer_names[TRANSFER_COUNT] = {
+  "RETR /mem",
+  "RETR /lin",
+  "STOR /stored"
+};
+
+static size_t data_position(const test_context *ctx)
+{
+  return ctx->data.input_pos + ctx->data.output_pos;
+}
+
+static int fake_open(
+  rtems_libio_t *iop,
+  const char *path,
+  int oflag,
+  mode_t mode
+)
+{
+  test_context *ctx;
+
+  (void) path;
+  (void) oflag;
+  (void) mode;
+
+  ctx = &test_instance;
+
+  if (IMFS_generic_get_context_by_iop(iop) == &ctx->data) {
+    rtems_test_assert(ctx->transfer_count < TRANSFER_COUNT);
+    ctx->data_pos = data_position(ctx);
+    ctx->transfers[ctx->transfer_count].begin =
+      rtems_clock_get_uptime_nanoseconds();
+  }
+
+  return 0;
+}
+
+static ssize_t fake_read(rtems_libio_t *iop, void *buffer, size_t count)
+{
+  fake_stream *fs;
+  size_t n;
+
+  fs = IMFS_generic_get_context_by_iop(iop);
+  n = fs->input_size - fs->input_pos;
+
+  if (n > count) {
+    n = count;
+  }
+
+  if (n > fs->chunk_size) {
+    n = fs->chunk_size;
+  }
+
+  /*
+   * Return at most one command line, like a peer which waits for the reply
+   * before it sends the next command.  The control stream discards buffered
+   * input when a reply is written.
+   */
+  if (fs->line_mode) {
+    const char *nl;
+
+    nl = memchr(&fs->input[fs->input_pos], '\n', n);
+    if (nl != NULL) {
+      n = (size_t) (nl - &fs->input[fs->input_pos]) + 1;
+    }
+  }
+
+  memcpy(buffer, &fs->input[fs->input_pos], n);
+  fs->input_pos += n;
+  return (ssize_t) n;
+}
+
+static ssize_t fake_write(rtems_libio_t *iop, const void *buffer, size_t count)
+{
+  fake_stream *fs;
+
+  fs = IMFS_generic_get_context_by_iop(iop);
+  rtems_test_assert(count <= fs->output_size - fs->output_pos);
+  memcpy(&fs->output[fs->output_pos], buffer, count);
+  fs->output_pos += count;
+  return (ssize_t) count;
+}
+
+static int fake_close(rtems_libio_t *iop)
+{
+  test_context *ctx;
+
+  ctx = &test_instance;
+
+  if (IMFS_generic_get_context_by_iop(iop) == &ctx->data) {
+    transfer_sample *sample;
+
+    sample = &ctx->transfers[ctx->transfer_count];
+    sample->duration = rtems_clock_get_uptime_nanoseconds() - sample->begin;
+    sample->bytes = data_position(ctx) - ctx->data_pos;
+    ++ctx->transfer_count;
+  }
+
+  if (IMFS_generic_get_context_by_iop(iop) == &ctx->control) {
+    rtems_status_code sc;
+
+    sc = rtems_event_transient_send(ctx->runner);
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  }
+
+  return 0;
+}
+
+static const rtems_filesystem_file_handlers_r fake_handlers = {
+  .open_h = fake_open,
+  .close_h = fake_close,
+  .read_h = fake_read,
+  .write_h = fake_write,
+  .ioctl_h = rtems_filesystem_default_ioctl,
+  .lseek_h = rtems_filesystem_default_lseek,
+  .fstat_h = IMFS_stat,
+  .ftruncate_h = rtems_filesystem_default_ftruncate,
+  .fsync_h = rtems_filesystem_default_fsync_or_fdatasync,
+  .fdatasync_h = rtems_filesystem_default_fsync_or_fdatasync,
+  .fcntl_h = rtems_filesystem_default_fcntl,
+  .kqfilter_h = rtems_filesystem_default_kqfilter,
+  .mmap_h = rtems_filesystem_default_mmap,
+  .poll_h = rtems_filesystem_default_poll,
+  .readv_h = rtems_filesystem_default_readv,
+  .writev_h = rtems_filesystem_default_writev
+};
+
+static const IMFS_node_control fake_node_control = IMFS_GENERIC_INITIALIZER(
+  &fake_handlers,
+  IMFS_node_initialize_generic,
+  IMFS_node_destroy_default
+);
+
+int socket(int domain, int type, int protocol)
+{
+  (void) domain;
+  (void) type;
+  (void) protocol;
+
+  return open(data_path, O_RDWR);
+}
+
+int bind(int s, const struct sockaddr *addr, socklen_t addrlen)
+{
+  (void) s;
+  (void) addr;
+  (void) addrlen;
+
+  return 0;
+}
+
+int listen(int s, int backlog)
+{
+  (void) s;
+  (void) backlog;
+
+  return 0;
+}
+
+int accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  test_context *ctx;
+
+  (void) s;
+
+  ctx = &test_instance;
+
+  if (ctx->accept_count == 0) {
+    ++ctx->accept_count;
+    memset(addr, 0, *addrlen);
+    addr->sa_family = AF_INET;
+    return open(control_path, O_RDWR);
+  }
+
+  /* There is only one control connection */
+  (void) rtems_task_suspend(RTEMS_SELF);
+  return -1;
+}
+
+int connect(int s, const struct sockaddr *addr, socklen_t addrlen)
+{
+  (void) s;
+  (void) addr;
+  (void) addrlen;
+
+  return 0;
+}
+
+int getsockname(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  (void) s;
+
+  memset(addr, 0, *addrlen);
+  addr->sa_family = AF_INET;
+  return 0;
+}
+
+int setsockopt(
+  int s,
+  int level,
+  int optname,
+  const void *optval,
+  socklen_t optlen
+)
+{
+  (void) s;
+  (void) level;
+  (void) optname;
+  (void) optval;
+  (void) optlen;
+
+  return 0;
+}
+
+int shutdown(int s, int how)
+{
+  (void) s;
+  (void) how;
+
+  return 0;
+}
+
+ssize_t send(int s, const void *buf, size_t len, int flags)
+{
+  (void) flags;
+
+  return write(s, buf, len);
+}
+
+ssize_t recv(int s, void *buf, size_t len, int flags)
+{
+  (void) flags;
+
+  return read(s, buf, len);
+}
+
+static void make_fake_stream(
+  fake_stream *fs,
+  const char *path,
+  const char *input,
+  size_t input_size,
+  size_t chunk_size,
+  char *output,
+  size_t output_size
+)
+{
+  int rv;
+
+  fs->input = input;
+  fs->input_size = input_size;
+  fs->chunk_size = chunk_size;
+  fs->output = output;
+  fs->output_size = output_size;
+
+  rv = IMFS_make_generic_node(
+    path,
+    S_IFCHR | S_IRWXU | S_IRWXG | S_IRWXO,
+    &fake_node_control,
+    fs
+  );
+  rtems_test_assert(rv == 0);
+}
+
+static void make_files(test_context *ctx)
+{
+  ssize_t n;
+  size_t i;
+  int fd;
+  int rv;
+
+  for (i = 0; i < FILE_SIZE; ++i) {
+    ctx->memfile[i] = (char) (i * 7);
+    ctx->linfile[i] = (char) (i * 13 + 1);
+    ctx->stored[i] = (char) (i * 3 + 2);
+  }
+
+  fd = open("/mem", O_WRONLY | O_CREAT | O_TRUNC, S_IRWXU);
+  rtems_test_assert(fd >= 0);
+  n = write(fd, ctx->memfile, FILE_SIZE);
+  rtems_test_assert(n == FILE_SIZE);
+  rv = close(fd);
+  rtems_test_assert(rv == 0);
+
+  rv = IMFS_make_linearfile("/lin", S_IRWXU, ctx->linfile, FILE_SIZE);
+  rtems_test_assert(rv == 0);
+}
+
+static size_t count_replies(const char *replies, const char *reply)
+{
+  size_t count;
+
+  count = 0;
+
+  while ((replies = strstr(replies, reply)) != NULL) {
+    ++count;
+    ++replies;
+  }
+
+  return count;
+}
+
+static void print_transfers(const test_context *ctx)
+{
+  size_t i;
+
+  printf("<Ftpd01 transferSize=\"%d\">\n", TRANSFER_SIZE);
+
+  for (i = 0; i < ctx->transfer_count; ++i) {
+    const transfer_sample *sample;
+
+    sample = &ctx->transfers[i];
+    printf(
+      "  <Transfer command=\"%s\" bytes=\"%zu\" duration=\"%" PRIu64 "\" "
+        "bytesPerSecond=\"%" PRIu64 "\"/>\n",
+      transfer_names[i],
+      sample->bytes,
+      sample->duration,
+      sample->duration > 0 ?
+        (uint64_t) sample->bytes * UINT64_C(1000000000) / sample->duration : 0
+    );
+  }
+
+  printf("</Ftpd01>\n");
+}
+
+static void test_transfer(test_context *ctx)
+{
+  static const struct rtems_ftpd_configuration config = {
+    .priority = 2,
+    .tasks_count = 1,
+    .transfer_size = TRANSFER_SIZE
+  };
+  rtems_status_code sc;
+  ssize_t n;
+  int fd;
+  int rv;
+
+  ctx->runner = rtems_task_self();
+  make_files(ctx);
+  ctx->control.line_mode = true;
+  make_fake_stream(
+    &ctx->control,
+    control_path,
+    commands,
+    sizeof(commands) - 1,
+    sizeof(commands),
+    ctx->replies,
+    sizeof(ctx->replies) - 1
+  );
+  make_fake_stream(
+    &ctx->data,
+    data_path,
+    ctx->stored,
+    FILE_SIZE,
+    DATA_CHUNK_SIZE,
+    ctx->data_output,
+    sizeof(ctx->data_output)
+  );
+
+  sc = rtems_ftpd_start(&config);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_event_transient_receive(RTEMS_WAIT, RTEMS_NO_TIMEOUT);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  rtems_test_assert(count_replies(ctx->replies, "150 ") == 3);
+  rtems_test_assert(count_replies(ctx->replies, "226 ") == 3);
+  rtems_test_assert(count_replies(ctx->replies, "221 ") == 1);
+
+  /* The memory file is sent through the transfer buffers */
+  rtems_test_assert(ctx->data.output_pos == 2 * FILE_SIZE);
+  rtems_test_assert(
+    memcmp(&ctx->data_output[0], ctx->memfile, FILE_SIZE) == 0
+  );
+
+  /* The linear file is sent from its mapping */
+  rtems_test_assert(
+    memcmp(&ctx->data_output[FILE_SIZE], ctx->linfile, FILE_SIZE) == 0
+  );
+
+  /* The received file is written by the transfer I/O task */
+  rtems_test_assert(ctx->data.input_pos == FILE_SIZE);
+  fd = open("/stored", O_RDONLY);
+  rtems_test_assert(fd >= 0);
+  n = read(fd, ctx->read_buffer, sizeof(ctx->read_buffer));
+  rtems_test_assert(n == FILE_SIZE);
+  rtems_test_assert(memcmp(ctx->read_buffer, ctx->stored, FILE_SIZE) == 0);
+  rv = close(fd);
+  rtems_test_assert(rv == 0);
+
+  rtems_test_assert(ctx->transfer_count == TRANSFER_COUNT);
+  rtems_test_assert(ctx->transfers[0].bytes == FILE_SIZE);
+  rtems_test_assert(ctx->transfers[1].bytes == FILE_SIZE);
+  rtems_test_assert(ctx->transfers[2].bytes == FILE_SIZE);
+  print_transfers(ctx);
+}
+
+static void Init(rtems_task_argument arg)
+{
+  TEST_BEGIN();
+
+  test_transfer(&test_instance);
+
+  TEST_END();
+  rtems_test_exit(0);
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+
+/* Init, FTP daemon, session, and transfer I/O task */
+#define CONFIGURE_MAXIMUM_TASKS 4
+
+#define CONFIGURE_EXTRA_TASK_STACKS (2 * FTPD_STACKSIZE)
+
+#define CONFIGURE_MAXIMUM_FILE_DESCRIPTORS 16
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT_TASK_ATTRIBUTES RTEMS_FLOATING_POINT
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
@@ -0,0 +1,285 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/*
+ * Copyright (C) 2026 On-Line Applications Research Corporation (OAR)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <errno.h>
+#include <fcntl.h>
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <sha256.h>
+#include <sha512.h>
+
+#include <rtems.h>
+#include <rtems/hashservice.h>
+
+#include <tmacros.h>
+
+const char rtems_test_name[] = "HASHSERVICE 1";
+
+#define BUFFER_SIZE (64 * 1024)
+
+#define FILE_SIZE (3 * BUFFER_SIZE + 123)
+
+#define CHUNK_SIZE (16 * 1024)
+
+#define BENCHMARK_BYTES (16 * 1024 * 1024)
+
+static unsigned char buffer[BUFFER_SIZE];
+
+static void fill(unsigned char *buf, size_t len)
+{
+  uint32_t seed;
+  size_t i;
+
+  seed = 1;
+  for (i = 0; i < len; ++i) {
+    seed = seed * 1103515245 + 12345;
+    buf[i] = (unsigned char) (seed >> 16);
+  }
+}
+
+static void make_file(const char *path)
+{
+  size_t done;
+  ssize_t n;
+  int fd;
+  int rv;
+
+  fd = open(path, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+  rtems_test_assert(fd >= 0);
+
+  for (done = 0; done < FILE_SIZE; done += (size_t) n) {
+    size_t todo = FILE_SIZE - done;
+
+    n = write(fd, buffer, todo < BUFFER_SIZE ? todo : BUFFER_SIZE);
+    rtems_test_assert(n > 0);
+  }
+
+  rv = close(fd);
+  rtems_test_assert(rv == 0);
+}
+
+static void file_sha256(unsigned char digest[SHA256_DIGEST_LENGTH])
+{
+  SHA256_CTX ctx;
+  size_t done;
+
+  SHA256_Init(&ctx);
+  for (done = 0; done < FILE_SIZE; done += BUFFER_SIZE) {
+    size_t todo = FILE_SIZE - done;
+
+    SHA256_Update(&ctx, buffer, todo < BUFFER_SIZE ? todo : BUFFER_SIZE);
+  }
+  SHA256_Final(digest, &ctx);
+}
+
+static void test_service(void)
+{
+  rtems_hash_service service;
+  rtems_hash_service other;
+  rtems_hash_request reqs[4];
+  unsigned char sha256[SHA256_DIGEST_LENGTH];
+  unsigned char sha512[SHA512_DIGEST_LENGTH];
+  SHA512_CTX ctx512;
+  size_t i;
+  int rv;
+
+  fill(buffer, sizeof(buffer));
+  make_file("/image");
+
+  rv = rtems_hash_service_start(&service, 1,
+    RTEMS_HASH_SERVICE_DEFAULT_STACK_SIZE, 0);
+  rtems_test_assert(rv == EINVAL);
+
+  rv = rtems_hash_service_start(&service, 0,
+    RTEMS_HASH_SERVICE_DEFAULT_STACK_SIZE, CHUNK_SIZE);
+  rtems_test_assert(rv == EINVAL);
+
+  rv = rtems_hash_service_start(&service, 2,
+    RTEMS_HASH_SERVICE_DEFAULT_STACK_SIZE, CHUNK_SIZE);
+  rtems_test_assert(rv == 0);
+
+  /* There is no task object for a second service */
+  rv = rtems_hash_service_start(&other, 2,
+    RTEMS_HASH_SERVICE_DEFAULT_STACK_SIZE, CHUNK_SIZE);
+  rtems_test_assert(rv == EAGAIN);
+
+  rtems_hash_request_initialize_file(&reqs[0], RTEMS_HASH_SHA256, "/image");
+  rtems_hash_request_initialize_buffer(&reqs[1], RTEMS_HASH_SHA512, buffer,
+    sizeof(buffer));
+  rtems_hash_request_initialize_file(&reqs[2], RTEMS_HASH_SHA256, "/nix");
+  rtems_hash_request_initialize_buffer(&reqs[3], RTEMS_HASH_SHA256, buffer,
+    0);
+
+  /* The service task has a lower priority, the requests queue up */
+  for (i = 0; i < RTEMS_ARRAY_SIZE(reqs); ++i) {
+    rtems_hash_service_submit(&service, &reqs[i]);
+  }
+
+  /* Other initialization work may be done here */
+  file_sha256(sha256);
+  SHA512_Init(&ctx512);
+  SHA512_Update(&ctx512, buffer, sizeof(buffer));
+  SHA512_Final(sha512, &ctx512);
+
+  rv = rtems_hash_request_wait(&reqs[0]);
+  rtems_test_assert(rv == 0);
+  rtems_test_assert(reqs[0].digest_size == SHA256_DIGEST_LENGTH);
+  rtems_test_assert(memcmp(reqs[0].digest, sha256, sizeof(sha256)) == 0);
+
+  rv = rtems_hash_request_wait(&reqs[1]);
+  rtems_test_assert(rv == 0);
+  rtems_test_assert(reqs[1].digest_size == SHA512_DIGEST_LENGTH);
+  rtems_test_assert(memcmp(reqs[1].digest, sha512, sizeof(sha512)) == 0);
+
+  rv = rtems_hash_request_wait(&reqs[2]);
+  rtems_test_assert(rv == ENOENT);
+
+  rv = rtems_hash_request_wait(&reqs[3]);
+  rtems_test_assert(rv == 0);
+
+  /* A done request may be submitted again */
+  rtems_hash_service_submit(&service, &reqs[1]);
+  rv = rtems_hash_request_wait(&reqs[1]);
+  rtems_test_assert(rv == 0);
+  rtems_test_assert(memcmp(reqs[1].digest, sha512, sizeof(sha512)) == 0);
+
+  rtems_hash_service_stop(&service);
+
+  for (i = 0; i < RTEMS_ARRAY_SIZE(reqs); ++i) {
+    rtems_hash_request_destroy(&reqs[i]);
+  }
+
+  rv = unlink("/image");
+  rtems_test_assert(rv == 0);
+}
+
+static void report(const char *what, size_t size, uint64_t bytes,
+  uint64_t ns)
+{
+  printf(
+    "%s %8zu bytes: %" PRIu64 " KiB/s\n",
+    what,
+    size,
+    ns > 0 ? (bytes * 1000000000 / 1024) / ns : 0
+  );
+}
+
+static void benchmark(const char *what, bool sha512, size_t size)
+{
+  unsigned char digest[SHA512_DIGEST_LENGTH];
+  SHA256_CTX ctx256;
+  SHA512_CTX ctx512;
+  uint64_t start;
+  uint64_t bytes;
+  size_t rounds;
+  size_t done;
+  size_t todo;
+
+  /* Hash at least 256 KiB in total, larger inputs stream the buffer */
+  rounds = size < 256 * 1024 ? (256 * 1024) / size : 1;
+  bytes = (uint64_t) rounds * size;
+
+  start = rtems_clock_get_uptime_nanoseconds();
+
+  while (rounds-- > 0) {
+    if (sha512) {
+      SHA512_Init(&ctx512);
+    } else {
+      SHA256_Init(&ctx256);
+    }
+
+    for (done = 0; done < size; done += todo) {
+      todo = size - done < BUFFER_SIZE ? size - done : BUFFER_SIZE;
+
+      if (sha512) {
+        SHA512_Update(&ctx512, buffer, todo);
+      } else {
+        SHA256_Update(&ctx256, buffer, todo);
+      }
+    }
+
+    if (sha512) {
+      SHA512_Final(digest, &ctx512);
+    } else {
+      SHA256_Final(digest, &ctx256);
+    }
+  }
+
+  report(what, size, bytes, rtems_clock_get_uptime_nanoseconds() - start);
+}
+
+static void test_benchmark(void)
+{
+  size_t size;
+
+  for (size = 1024; size <= BENCHMARK_BYTES; size *= 4) {
+    benchmark("SHA-256", false, size);
+  }
+
+  for (size = 1024; size <= BENCHMARK_BYTES; size *= 4) {
+    benchmark("SHA-512", true, size);
+  }
+}
+
+static void Init(rtems_task_argument arg)
+{
+  TEST_BEGIN();
+
+  test_service();
+  test_benchmark();
+
+  TEST_END();
+  rtems_test_exit(0);
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+
+#define CONFIGURE_MAXIMUM_TASKS 2
+
+#define CONFIGURE_MAXIMUM_FILE_DESCRIPTORS 5
+
+#define CONFIGURE_IMFS_MEMFILE_BYTES_PER_BLOCK 512
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT_TASK_INITIAL_MODES RTEMS_DEFAULT_MODES
+
+#define CONFIGURE_INIT_TASK_PRIORITY 1
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
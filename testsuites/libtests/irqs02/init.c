@@ -0,0 +1,339 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/*
+ * Copyright (C) 2026 On-Line Applications Research Corporation (OAR)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <inttypes.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <rtems/test.h>
+#include <rtems/test-info.h>
+
+#include <rtems.h>
+#include <rtems/counter.h>
+#include <rtems/irq-extension.h>
+
+#if defined(RTEMS_SMP)
+#define CPU_COUNT 4
+#else
+#define CPU_COUNT 1
+#endif
+
+#define ROUNDS 100
+
+#define VECTOR_SEARCH_LIMIT 1024
+
+typedef struct {
+  rtems_id task;
+  rtems_counter_ticks handled;
+  uint32_t count;
+} test_context;
+
+static test_context test_instance;
+
+static void destroy_server(rtems_interrupt_server_control *s)
+{
+  free(s);
+}
+
+static void create_server(uint32_t *server_index)
+{
+  rtems_interrupt_server_control *s;
+  rtems_interrupt_server_config config;
+  cpu_set_t processors;
+  rtems_status_code sc;
+  uint32_t cpu_index;
+
+  CPU_ZERO(&processors);
+
+  for (
+    cpu_index = 0;
+    cpu_index < rtems_scheduler_get_processor_maximum();
+    ++cpu_index
+  ) {
+    CPU_SET((int) cpu_index, &processors);
+  }
+
+  memset(&config, 0, sizeof(config));
+  config.name = rtems_build_name('W', 'R', 'K', 'S');
+  config.priority = 123;
+  config.storage_size = RTEMS_MINIMUM_STACK_SIZE;
+  config.modes = RTEMS_DEFAULT_MODES;
+  config.attributes = RTEMS_DEFAULT_ATTRIBUTES;
+  config.destroy = destroy_server;
+  config.worker_processors_size = sizeof(processors);
+  config.worker_processors = &processors;
+
+  s = malloc(sizeof(*s));
+  T_assert_not_null(s);
+
+  *server_index = 0x4d3b6a21;
+  sc = rtems_interrupt_server_create(s, &config, server_index);
+  T_assert_rsc_success(sc);
+  T_ne_u32(*server_index, 0x4d3b6a21);
+}
+
+static void delete_server(uint32_t server_index)
+{
+  rtems_status_code sc;
+  rtems_task_priority prio;
+
+  sc = rtems_interrupt_server_delete(server_index);
+  T_rsc_success(sc);
+
+  /* Make sure the interrupt server and its workers terminated */
+  prio = 0;
+  sc = rtems_task_set_priority(RTEMS_SELF, 124, &prio);
+  T_rsc_success(sc);
+  sc = rtems_task_set_priority(RTEMS_SELF, prio, &prio);
+  T_rsc_success(sc);
+  T_eq_u32(prio, 124);
+}
+
+static void handler(void *arg)
+{
+  test_context *ctx;
+  rtems_status_code sc;
+
+  ctx = arg;
+  ctx->handled = rtems_counter_read();
+  ++ctx->count;
+  sc = rtems_event_transient_send(ctx->task);
+  T_quiet_rsc_success(sc);
+}
+
+static void count_handlers(
+  void *arg,
+  const char *info,
+  rtems_option options,
+  rtems_interrupt_handler handler_routine,
+  void *handler_arg
+)
+{
+  uint32_t *count;
+
+  (void) info;
+  (void) options;
+  (void) handler_routine;
+  (void) handler_arg;
+
+  count = arg;
+  ++(*count);
+}
+
+static rtems_vector_number get_raisable_vector(void)
+{
+  rtems_vector_number vector;
+
+  for (vector = 0; vector < VECTOR_SEARCH_LIMIT; ++vector) {
+    rtems_interrupt_attributes attr;
+    rtems_status_code sc;
+    uint32_t count;
+
+    sc = rtems_interrupt_get_attributes(vector, &attr);
+    if (sc != RTEMS_SUCCESSFUL) {
+      continue;
+    }
+
+    if (
+      !attr.is_maskable || !attr.can_raise || !attr.can_enable
+        || !attr.can_disable
+    ) {
+      continue;
+    }
+
+    count = 0;
+    (void) rtems_interrupt_handler_iterate(vector, count_handlers, &count);
+
+    if (count == 0) {
+      return vector;
+    }
+  }
+
+  return VECTOR_SEARCH_LIMIT;
+}
+
+T_TEST_CASE(InterruptServerWorkerRequest)
+{
+  test_context *ctx;
+  rtems_interrupt_server_request req;
+  rtems_status_code sc;
+  uint32_t server_index;
+  uint64_t total;
+  uint32_t i;
+
+  ctx = &test_instance;
+  ctx->task = rtems_task_self();
+  ctx->count = 0;
+  create_server(&server_index);
+
+  sc = rtems_interrupt_server_request_initialize(
+    server_index,
+    &req,
+    handler,
+    ctx
+  );
+  T_rsc_success(sc);
+
+  total = 0;
+
+  for (i = 0; i < ROUNDS; ++i) {
+    rtems_counter_ticks begin;
+
+    begin = rtems_counter_read();
+    rtems_interrupt_server_request_submit(&req);
+    sc = rtems_event_transient_receive(RTEMS_WAIT, RTEMS_NO_TIMEOUT);
+    T_quiet_rsc_success(sc);
+    total += rtems_counter_ticks_to_nanoseconds(
+      rtems_counter_difference(ctx->handled, begin)
+    );
+  }
+
+  T_eq_u32(ctx->count, ROUNDS);
+  T_log(
+    T_NORMAL,
+    "request latency: %" PRIu64 "ns",
+    total / ROUNDS
+  );
+
+  rtems_interrupt_server_request_destroy(&req);
+  delete_server(server_index);
+}
+
+T_TEST_CASE(InterruptServerWorkerInterrupt)
+{
+  test_context *ctx;
+  rtems_interrupt_server_statistics stats;
+  rtems_vector_number vector;
+  rtems_status_code sc;
+  uint32_t server_index;
+  uint64_t total;
+  uint32_t i;
+
+  vector = get_raisable_vector();
+
+  if (vector == VECTOR_SEARCH_LIMIT) {
+    T_log(T_NORMAL, "no raisable interrupt vector available");
+    return;
+  }
+
+  ctx = &test_instance;
+  ctx->task = rtems_task_self();
+  ctx->count = 0;
+  create_server(&server_index);
+
+  sc = rtems_interrupt_server_handler_get_statistics(
+    server_index,
+    vector,
+    &stats
+  );
+  T_rsc(sc, RTEMS_UNSATISFIED);
+
+  sc = rtems_interrupt_server_handler_install(
+    server_index,
+    vector,
+    "Test",
+    RTEMS_INTERRUPT_UNIQUE,
+    handler,
+    ctx
+  );
+  T_assert_rsc_success(sc);
+
+  sc = rtems_interrupt_vector_enable(vector);
+  T_rsc_success(sc);
+
+  total = 0;
+
+  for (i = 0; i < ROUNDS; ++i) {
+    rtems_counter_ticks begin;
+
+    begin = rtems_counter_read();
+    sc = rtems_interrupt_raise(vector);
+    T_quiet_rsc_success(sc);
+    sc = rtems_event_transient_receive(RTEMS_WAIT, RTEMS_NO_TIMEOUT);
+    T_quiet_rsc_success(sc);
+    total += rtems_counter_ticks_to_nanoseconds(
+      rtems_counter_difference(ctx->handled, begin)
+    );
+  }
+
+  T_eq_u32(ctx->count, ROUNDS);
+
+  memset(&stats, 0, sizeof(stats));
+  sc = rtems_interrupt_server_handler_get_statistics(
+    server_index,
+    vector,
+    &stats
+  );
+  T_rsc_success(sc);
+  T_eq_u32(stats.count, ROUNDS);
+  T_ge_u64(stats.latency_total, stats.latency_max);
+  T_ge_u64(stats.run_time_total, stats.run_time_max);
+  T_log(
+    T_NORMAL,
+    "interrupt latency: %" PRIu64 "ns, deferred handler latency: "
+      "%" PRIu64 "ns average, %" PRIu64 "ns maximum",
+    total / ROUNDS,
+    stats.latency_total / ROUNDS,
+    stats.latency_max
+  );
+
+  sc = rtems_interrupt_server_handler_remove(
+    server_index,
+    vector,
+    handler,
+    ctx
+  );
+  T_rsc_success(sc);
+
+  delete_server(server_index);
+}
+
+const char rtems_test_name[] = "IRQS 2";
+
+static void Init(rtems_task_argument argument)
+{
+  rtems_test_run(argument, TEST_STATE);
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+
+#define CONFIGURE_MAXIMUM_TASKS (2 + CPU_COUNT)
+
+#define CONFIGURE_MAXIMUM_PROCESSORS CPU_COUNT
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT_TASK_INITIAL_MODES RTEMS_DEFAULT_MODES
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
@@ -0,0 +1,504 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/*
+ * Copyright (C) 2026 On-Line Applications Research Corporation (OAR)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <sys/select.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <netinet/in.h>
+#include <arpa/inet.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <netdb.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <rtems.h>
+#include <rtems/imfs.h>
+
+#include <mghttpd/mongoose.h>
+
+#include <tmacros.h>
+
+const char rtems_test_name[] = "MGHTTPD 1";
+
+/*
+ * The HTTP server runs on fake sockets.  The listening socket and the
+ * connections are IMFS generic nodes.  The socket functions used by the HTTP
+ * server are provided by this test and map send() and recv() to write() and
+ * read() on these nodes.
+ */
+
+#define FILE_SIZE 5000
+
+#define OUTPUT_SIZE (3 * FILE_SIZE)
+
+#define CONNECTION_COUNT 2
+
+/*
+ * A write larger than this size fails once on the connection with a failing
+ * write.  The response header is smaller, the file data is larger.
+ */
+#define FAIL_SIZE 1000
+
+typedef struct {
+  const char *input;
+  size_t input_size;
+  size_t input_pos;
+  bool fail_once;
+  char output[OUTPUT_SIZE];
+  size_t output_pos;
+} fake_stream;
+
+typedef struct {
+  rtems_id runner;
+  int accept_count;
+  int close_count;
+  fake_stream listener;
+  fake_stream connections[CONNECTION_COUNT];
+  char memfile[FILE_SIZE];
+  char linfile[FILE_SIZE];
+} test_context;
+
+static test_context test_instance;
+
+static const char listener_path[] = "/listener";
+
+static const char *const connection_paths[CONNECTION_COUNT] = {
+  "/conn0",
+  "/conn1"
+};
+
+static const char keep_alive_requests[] =
+  "GET /mem HTTP/1.1\r\n"
+  "Host: test\r\n"
+  "\r\n"
+  "GET /lin HTTP/1.1\r\n"
+  "Host: test\r\n"
+  "\r\n";
+
+static const char failing_request[] =
+  "GET /lin HTTP/1.1\r\n"
+  "Host: test\r\n"
+  "Connection: close\r\n"
+  "\r\n";
+
+static ssize_t fake_read(rtems_libio_t *iop, void *buffer, size_t count)
+{
+  fake_stream *fs;
+  const char *end;
+  size_t n;
+
+  fs = IMFS_generic_get_context_by_iop(iop);
+  n = fs->input_size - fs->input_pos;
+
+  if (n > count) {
+    n = count;
+  }
+
+  /*
+   * Return at most one request, like a client which waits for the response
+   * before it sends the next request.
+   */
+  end = strstr(&fs->input[fs->input_pos], "\r\n\r\n");
+  if (end != NULL && (size_t) (end - &fs->input[fs->input_pos]) + 4 < n) {
+    n = (size_t) (end - &fs->input[fs->input_pos]) + 4;
+  }
+
+  memcpy(buffer, &fs->input[fs->input_pos], n);
+  fs->input_pos += n;
+  return (ssize_t) n;
+}
+
+static ssize_t fake_write(rtems_libio_t *iop, const void *buffer, size_t count)
+{
+  fake_stream *fs;
+
+  fs = IMFS_generic_get_context_by_iop(iop);
+
+  if (fs->fail_once && count > FAIL_SIZE) {
+    fs->fail_once = false;
+    errno = EPIPE;
+    return -1;
+  }
+
+  rtems_test_assert(count <= sizeof(fs->output) - fs->output_pos);
+  memcpy(&fs->output[fs->output_pos], buffer, count);
+  fs->output_pos += count;
+  return (ssize_t) count;
+}
+
+static int fake_close(rtems_libio_t *iop)
+{
+  test_context *ctx;
+
+  ctx = &test_instance;
+
+  if (IMFS_generic_get_context_by_iop(iop) != &ctx->listener) {
+    rtems_status_code sc;
+
+    ++ctx->close_count;
+    sc = rtems_event_transient_send(ctx->runner);
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  }
+
+  return 0;
+}
+
+static const rtems_filesystem_file_handlers_r fake_handlers = {
+  .open_h = rtems_filesystem_default_open,
+  .close_h = fake_close,
+  .read_h = fake_read,
+  .write_h = fake_write,
+  .ioctl_h = rtems_filesystem_default_ioctl,
+  .lseek_h = rtems_filesystem_default_lseek,
+  .fstat_h = IMFS_stat,
+  .ftruncate_h = rtems_filesystem_default_ftruncate,
+  .fsync_h = rtems_filesystem_default_fsync_or_fdatasync,
+  .fdatasync_h = rtems_filesystem_default_fsync_or_fdatasync,
+  .fcntl_h = rtems_filesystem_default_fcntl,
+  .kqfilter_h = rtems_filesystem_default_kqfilter,
+  .mmap_h = rtems_filesystem_default_mmap,
+  .poll_h = rtems_filesystem_default_poll,
+  .readv_h = rtems_filesystem_default_readv,
+  .writev_h = rtems_filesystem_default_writev
+};
+
+static const IMFS_node_control fake_node_control = IMFS_GENERIC_INITIALIZER(
+  &fake_handlers,
+  IMFS_node_initialize_generic,
+  IMFS_node_destroy_default
+);
+
+int socket(int domain, int type, int protocol)
+{
+  (void) domain;
+  (void) type;
+  (void) protocol;
+
+  return open(listener_path, O_RDWR);
+}
+
+int bind(int s, const struct sockaddr *addr, socklen_t addrlen)
+{
+  (void) s;
+  (void) addr;
+  (void) addrlen;
+
+  return 0;
+}
+
+int listen(int s, int backlog)
+{
+  (void) s;
+  (void) backlog;
+
+  return 0;
+}
+
+int accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  test_context *ctx;
+
+  (void) s;
+
+  ctx = &test_instance;
+  rtems_test_assert(ctx->accept_count < CONNECTION_COUNT);
+
+  memset(addr, 0, *addrlen);
+  addr->sa_family = AF_INET;
+  return open(connection_paths[ctx->accept_count++], O_RDWR);
+}
+
+/*
+ * The listening socket is ready until all connections are accepted.
+ */
+int select(
+  int nfds,
+  fd_set *readfds,
+  fd_set *writefds,
+  fd_set *exceptfds,
+  struct timeval *timeout
+)
+{
+  test_context *ctx;
+
+  (void) nfds;
+  (void) readfds;
+  (void) writefds;
+  (void) exceptfds;
+  (void) timeout;
+
+  ctx = &test_instance;
+
+  return ctx->accept_count < CONNECTION_COUNT ? 1 : 0;
+}
+
+int connect(int s, const struct sockaddr *addr, socklen_t addrlen)
+{
+  (void) s;
+  (void) addr;
+  (void) addrlen;
+
+  errno = ENOTSUP;
+  return -1;
+}
+
+int getsockname(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  (void) s;
+
+  memset(addr, 0, *addrlen);
+  addr->sa_family = AF_INET;
+  return 0;
+}
+
+int setsockopt(
+  int s,
+  int level,
+  int optname,
+  const void *optval,
+  socklen_t optlen
+)
+{
+  (void) s;
+  (void) level;
+  (void) optname;
+  (void) optval;
+  (void) optlen;
+
+  return 0;
+}
+
+int shutdown(int s, int how)
+{
+  (void) s;
+  (void) how;
+
+  return 0;
+}
+
+ssize_t send(int s, const void *buf, size_t len, int flags)
+{
+  (void) flags;
+
+  return write(s, buf, len);
+}
+
+ssize_t recv(int s, void *buf, size_t len, int flags)
+{
+  (void) flags;
+
+  return read(s, buf, len);
+}
+
+const char *inet_ntop(int af, const void *src, char *dst, socklen_t size)
+{
+  (void) af;
+  (void) src;
+
+  strlcpy(dst, "0.0.0.0", size);
+  return dst;
+}
+
+struct hostent *gethostbyname(const char *name)
+{
+  (void) name;
+
+  return NULL;
+}
+
+static void make_fake_stream(
+  fake_stream *fs,
+  const char *path,
+  const char *input,
+  size_t input_size
+)
+{
+  int rv;
+
+  fs->input = input;
+  fs->input_size = input_size;
+
+  rv = IMFS_make_generic_node(
+    path,
+    S_IFCHR | S_IRWXU | S_IRWXG | S_IRWXO,
+    &fake_node_control,
+    fs
+  );
+  rtems_test_assert(rv == 0);
+}
+
+static void make_files(test_context *ctx)
+{
+  ssize_t n;
+  size_t i;
+  int fd;
+  int rv;
+
+  for (i = 0; i < FILE_SIZE; ++i) {
+    ctx->memfile[i] = (char) (i * 7);
+    ctx->linfile[i] = (char) (i * 13 + 1);
+  }
+
+  fd = open("/mem", O_WRONLY | O_CREAT | O_TRUNC, S_IRWXU);
+  rtems_test_assert(fd >= 0);
+  n = write(fd, ctx->memfile, FILE_SIZE);
+  rtems_test_assert(n == FILE_SIZE);
+  rv = close(fd);
+  rtems_test_assert(rv == 0);
+
+  rv = IMFS_make_linearfile("/lin", S_IRWXU, ctx->linfile, FILE_SIZE);
+  rtems_test_assert(rv == 0);
+}
+
+/*
+ * Check the response at the position and return the position after its body.
+ */
+static size_t check_response(
+  const fake_stream *fs,
+  size_t pos,
+  const char *body,
+  size_t body_size
+)
+{
+  const char *response;
+  const char *end;
+
+  response = &fs->output[pos];
+  rtems_test_assert(pos < fs->output_pos);
+  rtems_test_assert(strncmp(response, "HTTP/1.1 200 OK\r\n", 17) == 0);
+
+  end = strstr(response, "\r\n\r\n");
+  rtems_test_assert(end != NULL);
+  pos = (size_t) (end - fs->output) + 4;
+
+  rtems_test_assert(body_size <= fs->output_pos - pos);
+  rtems_test_assert(memcmp(&fs->output[pos], body, body_size) == 0);
+
+  return pos + body_size;
+}
+
+static void test_file_send(test_context *ctx)
+{
+  static const char *options[] = {
+    "listening_ports", "80",
+    "document_root", "/",
+    "num_threads", "1",
+    "enable_keep_alive", "yes",
+    "thread_stack_size", "32768",
+    NULL
+  };
+  struct mg_callbacks callbacks;
+  struct mg_context *mg;
+  fake_stream *fs;
+  size_t pos;
+
+  ctx->runner = rtems_task_self();
+  make_files(ctx);
+
+  /* The output buffers are zero-initialized so that strstr() stops */
+  make_fake_stream(&ctx->listener, listener_path, "", 0);
+  make_fake_stream(
+    &ctx->connections[0],
+    connection_paths[0],
+    keep_alive_requests,
+    sizeof(keep_alive_requests) - 1
+  );
+  ctx->connections[1].fail_once = true;
+  make_fake_stream(
+    &ctx->connections[1],
+    connection_paths[1],
+    failing_request,
+    sizeof(failing_request) - 1
+  );
+
+  memset(&callbacks, 0, sizeof(callbacks));
+  mg = mg_start(&callbacks, NULL, options);
+  rtems_test_assert(mg != NULL);
+
+  while (ctx->close_count < CONNECTION_COUNT) {
+    rtems_status_code sc;
+
+    sc = rtems_event_transient_receive(RTEMS_WAIT, RTEMS_NO_TIMEOUT);
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  }
+
+  mg_stop(mg);
+
+  /* The memory file is sent through the file buffer */
+  fs = &ctx->connections[0];
+  rtems_test_assert(fs->input_pos == fs->input_size);
+  pos = check_response(fs, 0, ctx->memfile, FILE_SIZE);
+
+  /* The linear file is sent from its mapping */
+  pos = check_response(fs, pos, ctx->linfile, FILE_SIZE);
+
+  /* The server responds to the closed connection with an error */
+  rtems_test_assert(strncmp(&fs->output[pos], "HTTP/1.1 500 ", 13) == 0);
+
+  /* The failed send from the mapping is not repeated from the file buffer */
+  fs = &ctx->connections[1];
+  rtems_test_assert(!fs->fail_once);
+  pos = check_response(fs, 0, ctx->linfile, 0);
+  rtems_test_assert(pos == fs->output_pos);
+}
+
+static void Init(rtems_task_argument arg)
+{
+  TEST_BEGIN();
+
+  test_file_send(&test_instance);
+
+  TEST_END();
+  rtems_test_exit(0);
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+
+#define CONFIGURE_MAXIMUM_TASKS 1
+
+/* Master and worker thread */
+#define CONFIGURE_MAXIMUM_POSIX_THREADS 2
+
+#define CONFIGURE_UNIFIED_WORK_AREAS
+
+#define CONFIGURE_MAXIMUM_FILE_DESCRIPTORS 16
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT_TASK_ATTRIBUTES RTEMS_FLOATING_POINT
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
@@ -34,6 +34,7 @@
 #include <sha384.h>
 #include <sha512.h>
 #include <sha512t.h>
+#include <stdint.h>
 #include <stdio.h>
 #include <string.h>
 
@@ -382,6 +383,56 @@ static void test_sha512_256(void)
   }
 }
 
+#define UNALIGNED_SIZE 1000
+
+static void test_unaligned(void)
+{
+  static uint64_t storage[(UNALIGNED_SIZE + 2 * sizeof(uint64_t)) /
+    sizeof(uint64_t)];
+  unsigned char *data;
+  unsigned char r256[SHA256_DIGEST_LENGTH];
+  unsigned char r512[SHA512_DIGEST_LENGTH];
+  size_t offset;
+  size_t i;
+
+  printf("test unaligned\n");
+
+  data = (unsigned char *) storage;
+
+  for (offset = 0; offset < sizeof(uint64_t); ++offset) {
+    SHA256_CTX ctx256;
+    SHA512_CTX ctx512;
+    unsigned char r[SHA512_DIGEST_LENGTH];
+
+    /* Move the same message to an input with a different alignment */
+    memset(storage, 0, sizeof(storage));
+    for (i = 0; i < UNALIGNED_SIZE; ++i) {
+      data[offset + i] = (unsigned char) (i * 31 + 7);
+    }
+
+    /* The blocks are transformed directly from the input */
+    SHA256_Init(&ctx256);
+    SHA256_Update(&ctx256, &data[offset], UNALIGNED_SIZE);
+    SHA256_Final(r, &ctx256);
+
+    if (offset == 0) {
+      memcpy(r256, r, sizeof(r256));
+    } else {
+      rtems_test_assert(memcmp(r, r256, sizeof(r256)) == 0);
+    }
+
+    SHA512_Init(&ctx512);
+    SHA512_Update(&ctx512, &data[offset], UNALIGNED_SIZE);
+    SHA512_Final(r, &ctx512);
+
+    if (offset == 0) {
+      memcpy(r512, r, sizeof(r512));
+    } else {
+      rtems_test_assert(memcmp(r, r512, sizeof(r512)) == 0);
+    }
+  }
+}
+
 static void Init(rtems_task_argument arg)
 {
   TEST_BEGIN();
@@ -392,6 +443,7 @@ static void Init(rtems_task_argument arg)
   test_sha512();
   test_sha512_224();
   test_sha512_256();
+  test_unaligned();
   rtems_stack_checker_report_usage();
 
   TEST_END();
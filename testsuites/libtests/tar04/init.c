@@ -0,0 +1,321 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/*
+ * Copyright (C) 2026 On-Line Applications Research Corporation (OAR)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <zlib.h>
+
+#include <rtems.h>
+#include <rtems/untar.h>
+
+#include <tmacros.h>
+
+const char rtems_test_name[] = "TAR 4";
+
+#define FILE_COUNT 8
+
+#define FILE_SIZE (32 * 1024 + 100)
+
+#define TAR_BLOCK_SIZE 512
+
+#define TAR_SIZE \
+  (FILE_COUNT * (TAR_BLOCK_SIZE + RTEMS_ALIGN_UP(FILE_SIZE, TAR_BLOCK_SIZE)) \
+    + 2 * TAR_BLOCK_SIZE)
+
+#define GZ_CHUNK_SIZE 4096
+
+#define INFLATE_BUFFER_SIZE 8192
+
+#define PIPELINE_BUFFER_COUNT 4
+
+#define PIPELINE_BUFFER_SIZE (16 * 1024)
+
+static char tar_image[TAR_SIZE];
+
+static unsigned char gz_image[TAR_SIZE];
+
+static size_t gz_size;
+
+static char inflate_buffer[INFLATE_BUFFER_SIZE];
+
+static char read_buffer[FILE_SIZE];
+
+static uint8_t file_byte(int file, size_t i)
+{
+  return (uint8_t) ((i * 7) + (i >> 9) + (size_t) file);
+}
+
+static void make_header(char *header, const char *name, size_t size)
+{
+  unsigned int sum;
+  size_t i;
+
+  memset(header, 0, TAR_BLOCK_SIZE);
+  strlcpy(header, name, 100);
+  snprintf(&header[100], 8, "%07o", 0644);
+  snprintf(&header[108], 8, "%07o", 0);
+  snprintf(&header[116], 8, "%07o", 0);
+  snprintf(&header[124], 12, "%011zo", size);
+  snprintf(&header[136], 12, "%011o", 0);
+  header[156] = REGTYPE;
+  memcpy(&header[257], "ustar", 6);
+  memcpy(&header[263], "00", 2);
+
+  memset(&header[148], ' ', 8);
+  sum = 0;
+  for (i = 0; i < TAR_BLOCK_SIZE; ++i) {
+    sum += (unsigned char) header[i];
+  }
+  snprintf(&header[148], 8, "%06o", sum);
+}
+
+static void make_tar(const char *dir)
+{
+  char name[100];
+  char *p;
+  int file;
+  size_t i;
+
+  memset(tar_image, 0, sizeof(tar_image));
+  p = tar_image;
+
+  for (file = 0; file < FILE_COUNT; ++file) {
+    snprintf(name, sizeof(name), "%s/sub%d/file%d", dir, file % 2, file);
+    make_header(p, name, FILE_SIZE);
+    p += TAR_BLOCK_SIZE;
+
+    for (i = 0; i < FILE_SIZE; ++i) {
+      p[i] = (char) file_byte(file, i);
+    }
+    p += RTEMS_ALIGN_UP(FILE_SIZE, TAR_BLOCK_SIZE);
+  }
+}
+
+static void make_gz(const char *dir)
+{
+  z_stream strm;
+  int rv;
+
+  make_tar(dir);
+
+  memset(&strm, 0, sizeof(strm));
+  rv = deflateInit2(&strm, 1, Z_DEFLATED, 16 + MAX_WBITS, 8,
+    Z_DEFAULT_STRATEGY);
+  rtems_test_assert(rv == Z_OK);
+  strm.next_in = (Bytef *) tar_image;
+  strm.avail_in = sizeof(tar_image);
+  strm.next_out = gz_image;
+  strm.avail_out = sizeof(gz_image);
+  rv = deflate(&strm, Z_FINISH);
+  rtems_test_assert(rv == Z_STREAM_END);
+  gz_size = sizeof(gz_image) - strm.avail_out;
+  rv = deflateEnd(&strm);
+  rtems_test_assert(rv == Z_OK);
+}
+
+static void check_files(const char *dir)
+{
+  char name[100];
+  struct stat st;
+  int file;
+  size_t i;
+  ssize_t n;
+  int fd;
+  int rv;
+
+  for (file = 0; file < FILE_COUNT; ++file) {
+    snprintf(name, sizeof(name), "%s/sub%d/file%d", dir, file % 2, file);
+    rv = stat(name, &st);
+    rtems_test_assert(rv == 0);
+    rtems_test_assert(S_ISREG(st.st_mode));
+    rtems_test_assert(st.st_size == FILE_SIZE);
+
+    fd = open(name, O_RDONLY);
+    rtems_test_assert(fd >= 0);
+    n = read(fd, read_buffer, sizeof(read_buffer));
+    rtems_test_assert(n == FILE_SIZE);
+    for (i = 0; i < FILE_SIZE; ++i) {
+      rtems_test_assert((uint8_t) read_buffer[i] == file_byte(file, i));
+    }
+    rv = close(fd);
+    rtems_test_assert(rv == 0);
+  }
+}
+
+static void report(const char *what, uint64_t ns)
+{
+  uint64_t bytes = (uint64_t) FILE_COUNT * FILE_SIZE;
+
+  printf(
+    "%s: %" PRIu64 " ns, %" PRIu64 " KiB/s\n",
+    what,
+    ns,
+    ns > 0 ? (bytes * 1000000000 / 1024) / ns : 0
+  );
+}
+
+static void test_memory(const char *dir, int options, const char *what)
+{
+  uint64_t start;
+  int rv;
+
+  make_tar(dir);
+  start = rtems_clock_get_uptime_nanoseconds();
+  rv = Untar_FromMemory_Options(tar_image, sizeof(tar_image), options, NULL);
+  report(what, rtems_clock_get_uptime_nanoseconds() - start);
+  rtems_test_assert(rv == UNTAR_SUCCESSFUL);
+  check_files(dir);
+}
+
+static void test_map_imfs(void)
+{
+  char name[100];
+  void *addr;
+  int fd;
+  int rv;
+
+  test_memory("/map", UNTAR_MAP_IMFS, "memory map");
+
+  /* The data of a mapped file is the file data in the tar image */
+  snprintf(name, sizeof(name), "/map/sub0/file0");
+  fd = open(name, O_RDONLY);
+  rtems_test_assert(fd >= 0);
+  addr = mmap(NULL, FILE_SIZE, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  rtems_test_assert(addr == &tar_image[TAR_BLOCK_SIZE]);
+  rv = munmap(addr, FILE_SIZE);
+  rtems_test_assert(rv == 0);
+  rv = close(fd);
+  rtems_test_assert(rv == 0);
+}
+
+static void test_gz(const char *dir, bool pipeline, const char *what)
+{
+  Untar_GzChunkContext ctx;
+  uint64_t start;
+  size_t done;
+  size_t n;
+  int rv;
+
+  make_gz(dir);
+
+  start = rtems_clock_get_uptime_nanoseconds();
+  rv = Untar_GzChunkContext_Init(&ctx, inflate_buffer,
+    sizeof(inflate_buffer));
+  rtems_test_assert(rv == UNTAR_SUCCESSFUL);
+
+  if (pipeline) {
+    ctx.base.options = UNTAR_PREALLOCATE;
+    rv = Untar_ChunkContext_Start_pipeline(&ctx.base, PIPELINE_BUFFER_COUNT,
+      PIPELINE_BUFFER_SIZE, 1, UNTAR_WRITER_DEFAULT_STACK_SIZE, NULL);
+    rtems_test_assert(rv == UNTAR_SUCCESSFUL);
+  }
+
+  for (done = 0; done < gz_size; done += n) {
+    n = gz_size - done < GZ_CHUNK_SIZE ? gz_size - done : GZ_CHUNK_SIZE;
+    rv = Untar_FromGzChunk_Print(&ctx, &gz_image[done], n, NULL);
+    rtems_test_assert(rv == UNTAR_SUCCESSFUL);
+  }
+
+  rv = Untar_ChunkContext_Finish(&ctx.base);
+  report(what, rtems_clock_get_uptime_nanoseconds() - start);
+  rtems_test_assert(rv == UNTAR_SUCCESSFUL);
+  check_files(dir);
+}
+
+static void test_pipeline_errors(void)
+{
+  Untar_ChunkContext ctx;
+  char header[TAR_BLOCK_SIZE];
+  int rv;
+
+  Untar_ChunkContext_Init(&ctx);
+  rtems_test_assert(Untar_ChunkContext_Finish(&ctx) == UNTAR_SUCCESSFUL);
+  rv = Untar_ChunkContext_Start_pipeline(&ctx, 1, 512, 1,
+    UNTAR_WRITER_DEFAULT_STACK_SIZE, NULL);
+  rtems_test_assert(rv == UNTAR_FAIL);
+  rv = Untar_ChunkContext_Start_pipeline(&ctx, 2, 0, 1,
+    UNTAR_WRITER_DEFAULT_STACK_SIZE, NULL);
+  rtems_test_assert(rv == UNTAR_FAIL);
+
+  /* A header checksum error is reported by Untar_ChunkContext_Finish() */
+  rv = Untar_ChunkContext_Start_pipeline(&ctx, 2, 512, 1,
+    UNTAR_WRITER_DEFAULT_STACK_SIZE, NULL);
+  rtems_test_assert(rv == UNTAR_SUCCESSFUL);
+  make_header(header, "/error/file", 0);
+  header[148] = '7';
+  rv = Untar_FromChunk_Print(&ctx, header, sizeof(header), NULL);
+  rtems_test_assert(rv == UNTAR_SUCCESSFUL);
+  rv = Untar_ChunkContext_Finish(&ctx);
+  rtems_test_assert(rv == UNTAR_INVALID_CHECKSUM);
+  rtems_test_assert(ctx.pipeline == NULL);
+}
+
+static void Init(rtems_task_argument arg)
+{
+  TEST_BEGIN();
+
+  test_memory("/write", 0, "memory write");
+  test_memory("/prealloc", UNTAR_PREALLOCATE, "memory preallocate");
+  test_map_imfs();
+  test_gz("/gz", false, "gz sequential");
+  test_gz("/gzpipe", true, "gz pipeline");
+  test_pipeline_errors();
+
+  TEST_END();
+  rtems_test_exit(0);
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+
+#define CONFIGURE_MAXIMUM_TASKS 2
+
+#define CONFIGURE_MAXIMUM_FILE_DESCRIPTORS 5
+
+#define CONFIGURE_IMFS_MEMFILE_BYTES_PER_BLOCK 512
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT_TASK_ATTRIBUTES RTEMS_FLOATING_POINT
+
+#define CONFIGURE_INIT_TASK_INITIAL_MODES RTEMS_DEFAULT_MODES
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
@@ -0,0 +1,450 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/*
+ * Copyright (C) 2026 On-Line Applications Research Corporation (OAR)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <rtems.h>
+#include <rtems/untar.h>
+
+#include <tmacros.h>
+
+#include "tar05-tar.h"
+#include "tar05-single-tar-xz.h"
+#include "tar05-multi-tar-xz.h"
+
+const char rtems_test_name[] = "TAR 5";
+
+#define TAR_BLOCK_SIZE 512
+
+#define DICT_SIZE (64 * 1024)
+
+#define WORKER_COUNT 4
+
+#define MAX_BLOCK_COUNT 64
+
+#define INFLATE_BUFFER_SIZE 8192
+
+#define CHUNK_SIZE 4096
+
+static char inflate_buffer[INFLATE_BUFFER_SIZE];
+
+static char read_buffer[TAR_BLOCK_SIZE];
+
+static struct xz_block blocks[MAX_BLOCK_COUNT];
+
+static struct xz_dict_pool *pool;
+
+static uint32_t worker_count(void)
+{
+  uint32_t count;
+
+  /* Use one more task than processors to overlap the file writes */
+  count = rtems_scheduler_get_processor_maximum() + 1;
+  if (count > WORKER_COUNT) {
+    count = WORKER_COUNT;
+  }
+
+  return count;
+}
+
+static size_t tar_file_bytes(void)
+{
+  size_t bytes = 0;
+  size_t offset;
+
+  for (offset = 0; offset + TAR_BLOCK_SIZE <= tar05_tar_size;) {
+    const unsigned char *header = &tar05_tar[offset];
+    size_t size;
+
+    if (header[0] == '\0') {
+      break;
+    }
+
+    size = strtoul((const char *) &header[124], NULL, 8);
+    bytes += size;
+    offset += TAR_BLOCK_SIZE + RTEMS_ALIGN_UP(size, TAR_BLOCK_SIZE);
+  }
+
+  return bytes;
+}
+
+/*
+ * Compares the extracted regular files with the files of the tar image.  The
+ * files are removed afterwards to keep the memory demand of the test low.
+ */
+static void check_files(const char *dir)
+{
+  size_t offset;
+
+  for (offset = 0; offset + TAR_BLOCK_SIZE <= tar05_tar_size;) {
+    const unsigned char *header = &tar05_tar[offset];
+    char name[2 * UNTAR_FILE_NAME_SIZE];
+    struct stat st;
+    size_t size;
+    size_t done;
+    ssize_t n;
+    int fd;
+    int rv;
+
+    if (header[0] == '\0') {
+      break;
+    }
+
+    rtems_test_assert(header[156] == '0' || header[156] == '\0');
+    size = strtoul((const char *) &header[124], NULL, 8);
+    snprintf(name, sizeof(name), "%s/%.100s", dir, (const char *) header);
+
+    rv = stat(name, &st);
+    rtems_test_assert(rv == 0);
+    rtems_test_assert(S_ISREG(st.st_mode));
+    rtems_test_assert((size_t) st.st_size == size);
+
+    fd = open(name, O_RDONLY);
+    rtems_test_assert(fd >= 0);
+
+    for (done = 0; done < size; done += (size_t) n) {
+      n = read(fd, read_buffer, sizeof(read_buffer));
+      rtems_test_assert(n > 0);
+      rtems_test_assert(
+        memcmp(read_buffer, &header[TAR_BLOCK_SIZE + done], (size_t) n) == 0
+      );
+    }
+
+    rv = close(fd);
+    rtems_test_assert(rv == 0);
+    rv = unlink(name);
+    rtems_test_assert(rv == 0);
+
+    offset += TAR_BLOCK_SIZE + RTEMS_ALIGN_UP(size, TAR_BLOCK_SIZE);
+  }
+}
+
+static void report(const char *what, uint64_t ns)
+{
+  uint64_t bytes = tar_file_bytes();
+
+  printf(
+    "%s: %" PRIu64 " ns, %" PRIu64 " KiB/s\n",
+    what,
+    ns,
+    ns > 0 ? (bytes * 1000000000 / 1024) / ns : 0
+  );
+}
+
+static void enter_dir(const char *dir)
+{
+  int rv;
+
+  rv = mkdir(dir, S_IRWXU | S_IRWXG | S_IRWXO);
+  rtems_test_assert(rv == 0);
+  rv = chdir(dir);
+  rtems_test_assert(rv == 0);
+}
+
+static void leave_dir(void)
+{
+  int rv;
+
+  rv = chdir("/");
+  rtems_test_assert(rv == 0);
+}
+
+/* All dictionaries of the pool shall be free */
+static void check_pool(void)
+{
+  struct xz_dec *strm[WORKER_COUNT];
+  int i;
+
+  for (i = 0; i < WORKER_COUNT; ++i) {
+    strm[i] = xz_dec_init_pool(pool);
+    rtems_test_assert(strm[i] != NULL);
+  }
+
+  rtems_test_assert(xz_dec_init_pool(pool) == NULL);
+
+  for (i = 0; i < WORKER_COUNT; ++i) {
+    xz_dec_end(strm[i]);
+  }
+}
+
+static void test_index(void)
+{
+  size_t count;
+  size_t in_pos;
+  size_t out_pos;
+  size_t i;
+  enum xz_ret ret;
+
+  xz_crc32_init();
+
+  count = 0;
+  ret = xz_dec_index(tar05_single_tar_xz, tar05_single_tar_xz_size, NULL,
+    &count);
+  rtems_test_assert(ret == XZ_OK);
+  rtems_test_assert(count == 1);
+
+  count = 0;
+  ret = xz_dec_index(tar05_multi_tar_xz, tar05_multi_tar_xz_size, NULL,
+    &count);
+  rtems_test_assert(ret == XZ_OK);
+  rtems_test_assert(count > 2);
+  rtems_test_assert(count <= MAX_BLOCK_COUNT);
+
+  --count;
+  ret = xz_dec_index(tar05_multi_tar_xz, tar05_multi_tar_xz_size, blocks,
+    &count);
+  rtems_test_assert(ret == XZ_BUF_ERROR);
+
+  count = MAX_BLOCK_COUNT;
+  ret = xz_dec_index(tar05_multi_tar_xz, tar05_multi_tar_xz_size, blocks,
+    &count);
+  rtems_test_assert(ret == XZ_OK);
+
+  /* The blocks are contiguous and cover the tar image */
+  in_pos = blocks[0].in_pos;
+  out_pos = 0;
+  for (i = 0; i < count; ++i) {
+    rtems_test_assert(blocks[i].in_pos == in_pos);
+    rtems_test_assert(blocks[i].out_pos == out_pos);
+    rtems_test_assert(blocks[i].uncompressed_size <= DICT_SIZE);
+    in_pos += RTEMS_ALIGN_UP(blocks[i].unpadded_size, 4);
+    out_pos += blocks[i].uncompressed_size;
+  }
+
+  rtems_test_assert(out_pos == tar05_tar_size);
+
+  ret = xz_dec_index(tar05_tar, tar05_tar_size, NULL, &count);
+  rtems_test_assert(ret == XZ_FORMAT_ERROR);
+}
+
+static void test_block(void)
+{
+  struct xz_dec *strm;
+  unsigned char *out;
+  unsigned char *in;
+  enum xz_ret ret;
+
+  strm = xz_dec_init_pool(pool);
+  rtems_test_assert(strm != NULL);
+
+  out = malloc(DICT_SIZE);
+  rtems_test_assert(out != NULL);
+
+  ret = xz_dec_block(strm, tar05_multi_tar_xz, &blocks[1], out);
+  rtems_test_assert(ret == XZ_STREAM_END);
+  rtems_test_assert(memcmp(out, &tar05_tar[blocks[1].out_pos],
+    blocks[1].uncompressed_size) == 0);
+
+  /* The check of the block detects corrupt data */
+  in = malloc(tar05_multi_tar_xz_size);
+  rtems_test_assert(in != NULL);
+  memcpy(in, tar05_multi_tar_xz, tar05_multi_tar_xz_size);
+  in[blocks[1].in_pos + blocks[1].unpadded_size / 2] ^= 0x55;
+  ret = xz_dec_block(strm, in, &blocks[1], out);
+  rtems_test_assert(ret == XZ_DATA_ERROR);
+
+  /* The decoder is reset for each block */
+  ret = xz_dec_block(strm, tar05_multi_tar_xz, &blocks[0], out);
+  rtems_test_assert(ret == XZ_STREAM_END);
+  rtems_test_assert(memcmp(out, tar05_tar, blocks[0].uncompressed_size) == 0);
+
+  free(in);
+  free(out);
+  xz_dec_end(strm);
+}
+
+static void test_sequential(
+  const char *dir,
+  const unsigned char *xz,
+  size_t xz_size,
+  const char *what
+)
+{
+  Untar_XzChunkContext ctx;
+  uint64_t start;
+  size_t done;
+  size_t n;
+  int rv;
+
+  enter_dir(dir);
+
+  start = rtems_clock_get_uptime_nanoseconds();
+  rv = Untar_XzChunkContext_Init_pool(&ctx, pool, inflate_buffer,
+    sizeof(inflate_buffer));
+  rtems_test_assert(rv == UNTAR_SUCCESSFUL);
+
+  for (done = 0; done < xz_size; done += n) {
+    n = xz_size - done < CHUNK_SIZE ? xz_size - done : CHUNK_SIZE;
+    rv = Untar_FromXzChunk_Print(&ctx, &xz[done], n, NULL);
+    rtems_test_assert(rv == UNTAR_SUCCESSFUL);
+  }
+
+  report(what, rtems_clock_get_uptime_nanoseconds() - start);
+
+  /* The decoder gave its dictionary back at the end of the stream */
+  rtems_test_assert(ctx.strm == NULL);
+
+  leave_dir();
+  check_files(dir);
+  check_pool();
+}
+
+static void test_parallel(
+  const char *dir,
+  const unsigned char *xz,
+  size_t xz_size,
+  size_t slot_memory_max,
+  const char *what
+)
+{
+  uint64_t start;
+  int rv;
+
+  enter_dir(dir);
+
+  start = rtems_clock_get_uptime_nanoseconds();
+  rv = Untar_FromXzMemory_Parallel(xz, xz_size, pool, worker_count(), 1,
+    UNTAR_XZ_DECODER_DEFAULT_STACK_SIZE, slot_memory_max, NULL);
+  report(what, rtems_clock_get_uptime_nanoseconds() - start);
+  rtems_test_assert(rv == UNTAR_SUCCESSFUL);
+
+  leave_dir();
+  check_files(dir);
+  check_pool();
+}
+
+static void test_parallel_errors(void)
+{
+  struct xz_dec *strm[WORKER_COUNT];
+  unsigned char *in;
+  int rv;
+  int i;
+
+  enter_dir("/error");
+
+  rv = Untar_FromXzMemory_Parallel(tar05_multi_tar_xz,
+    tar05_multi_tar_xz_size, pool, 0, 1,
+    UNTAR_XZ_DECODER_DEFAULT_STACK_SIZE, SIZE_MAX, NULL);
+  rtems_test_assert(rv == UNTAR_FAIL);
+
+  /* A corrupt block stops the extraction */
+  in = malloc(tar05_multi_tar_xz_size);
+  rtems_test_assert(in != NULL);
+  memcpy(in, tar05_multi_tar_xz, tar05_multi_tar_xz_size);
+  in[blocks[2].in_pos + blocks[2].unpadded_size / 2] ^= 0x55;
+  rv = Untar_FromXzMemory_Parallel(in, tar05_multi_tar_xz_size, pool,
+    worker_count(), 1,
+    UNTAR_XZ_DECODER_DEFAULT_STACK_SIZE, SIZE_MAX, NULL);
+  rtems_test_assert(rv == UNTAR_FAIL);
+  check_pool();
+
+  free(in);
+
+  /* A truncated file is detected */
+  rv = Untar_FromXzMemory_Parallel(tar05_multi_tar_xz,
+    tar05_multi_tar_xz_size / 2, pool, worker_count(), 1,
+    UNTAR_XZ_DECODER_DEFAULT_STACK_SIZE, SIZE_MAX, NULL);
+  rtems_test_assert(rv == UNTAR_FAIL);
+  check_pool();
+
+  /* Without a free dictionary, no decoder is available */
+  for (i = 0; i < WORKER_COUNT; ++i) {
+    strm[i] = xz_dec_init_pool(pool);
+    rtems_test_assert(strm[i] != NULL);
+  }
+
+  rv = Untar_FromXzMemory_Parallel(tar05_multi_tar_xz,
+    tar05_multi_tar_xz_size, pool, worker_count(), 1,
+    UNTAR_XZ_DECODER_DEFAULT_STACK_SIZE, SIZE_MAX, NULL);
+  rtems_test_assert(rv == UNTAR_FAIL);
+
+  for (i = 0; i < WORKER_COUNT; ++i) {
+    xz_dec_end(strm[i]);
+  }
+
+  leave_dir();
+}
+
+static void Init(rtems_task_argument arg)
+{
+  TEST_BEGIN();
+
+  pool = xz_dict_pool_create(DICT_SIZE, WORKER_COUNT);
+  rtems_test_assert(pool != NULL);
+
+  test_index();
+  test_block();
+  test_sequential("/single", tar05_single_tar_xz, tar05_single_tar_xz_size,
+    "xz single block sequential");
+  test_sequential("/multi", tar05_multi_tar_xz, tar05_multi_tar_xz_size,
+    "xz multi block sequential");
+  test_parallel("/single-parallel", tar05_single_tar_xz,
+    tar05_single_tar_xz_size, SIZE_MAX, "xz single block parallel");
+  test_parallel("/multi-parallel", tar05_multi_tar_xz,
+    tar05_multi_tar_xz_size, SIZE_MAX, "xz multi block parallel");
+  test_parallel("/multi-one-slot", tar05_multi_tar_xz,
+    tar05_multi_tar_xz_size, blocks[0].uncompressed_size,
+    "xz multi block parallel one slot");
+  test_parallel("/multi-no-slot", tar05_multi_tar_xz,
+    tar05_multi_tar_xz_size, blocks[0].uncompressed_size - 1,
+    "xz multi block parallel no slot");
+  test_parallel_errors();
+
+  xz_dict_pool_destroy(pool);
+
+  TEST_END();
+  rtems_test_exit(0);
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+
+#define CONFIGURE_MAXIMUM_PROCESSORS 4
+
+#define CONFIGURE_MAXIMUM_TASKS (1 + WORKER_COUNT)
+
+#define CONFIGURE_MAXIMUM_FILE_DESCRIPTORS 5
+
+#define CONFIGURE_IMFS_MEMFILE_BYTES_PER_BLOCK 512
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
@@ -0,0 +1,355 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/*
+ * Copyright (C) 2026 On-Line Applications Research Corporation (OAR)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <fcntl.h>
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+#include <termios.h>
+#include <unistd.h>
+
+#include <rtems/termiostypes.h>
+
+#include "tmacros.h"
+
+const char rtems_test_name[] = "TERMIOS 12";
+
+#define DAEMON_DEVICE_COUNT 4
+
+#define INTERRUPT 0
+
+#define DEDICATED 1
+
+#define SHARED (DEDICATED + DAEMON_DEVICE_COUNT)
+
+#define DEVICE_COUNT (SHARED + DAEMON_DEVICE_COUNT)
+
+#define BUFFER_SIZE 256
+
+#define TOTAL_BYTES (256 * 1024)
+
+#define DAEMON_CHUNK_SIZE 64
+
+#define DAEMON_ROUNDS 1024
+
+typedef struct {
+  rtems_termios_device_context base;
+  rtems_termios_tty *tty;
+  const char *input;
+  size_t input_size;
+  size_t input_index;
+} device_context;
+
+typedef struct {
+  device_context devices[DEVICE_COUNT];
+  int fds[DEVICE_COUNT];
+  char data[BUFFER_SIZE];
+  char buf[BUFFER_SIZE];
+} test_context;
+
+static test_context test_instance;
+
+static const size_t chunk_sizes[] = { 1, 16, 64, 256 };
+
+static bool first_open(
+  rtems_termios_tty *tty,
+  rtems_termios_device_context *base,
+  struct termios *term,
+  rtems_libio_open_close_args_t *args
+)
+{
+  device_context *dev = (device_context *) base;
+
+  dev->tty = tty;
+
+  return true;
+}
+
+static void write_discard(
+  rtems_termios_device_context *base,
+  const char *buf,
+  size_t len
+)
+{
+  /* The tests use no output processing and no echo */
+  rtems_test_assert(0);
+}
+
+/*
+ * Simulates the receive FIFO of a device, the characters are provided by the
+ * test before the receive interrupt is signalled.
+ */
+static int read_fifo(rtems_termios_device_context *base)
+{
+  device_context *dev = (device_context *) base;
+
+  if (dev->input_index < dev->input_size) {
+    return (unsigned char) dev->input[dev->input_index++];
+  }
+
+  return -1;
+}
+
+static const rtems_termios_device_handler interrupt_handler = {
+  .first_open = first_open,
+  .write = write_discard,
+  .mode = TERMIOS_IRQ_DRIVEN
+};
+
+static const rtems_termios_device_handler task_handler = {
+  .first_open = first_open,
+  .write = write_discard,
+  .poll_read = read_fifo,
+  .mode = TERMIOS_TASK_DRIVEN
+};
+
+static void set_raw(test_context *ctx, size_t i, tcflag_t iflag, cc_t vmin)
+{
+  struct termios term;
+  int rv;
+
+  rv = tcgetattr(ctx->fds[i], &term);
+  rtems_test_assert(rv == 0);
+
+  cfmakeraw(&term);
+  term.c_iflag |= iflag;
+  term.c_cc[VMIN] = vmin;
+  term.c_cc[VTIME] = 0;
+
+  rv = tcsetattr(ctx->fds[i], TCSANOW, &term);
+  rtems_test_assert(rv == 0);
+}
+
+static void install_and_open(test_context *ctx, size_t i)
+{
+  rtems_status_code sc;
+  char path[16];
+
+  snprintf(path, sizeof(path), "/dev/tty%zu", i);
+
+  sc = rtems_termios_device_install(
+    path,
+    i == INTERRUPT ? &interrupt_handler : &task_handler,
+    NULL,
+    &ctx->devices[i].base
+  );
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  ctx->fds[i] = open(path, O_RDWR);
+  rtems_test_assert(ctx->fds[i] >= 0);
+}
+
+static void setup(test_context *ctx)
+{
+  rtems_status_code sc;
+  size_t i;
+
+  for (i = 0; i < BUFFER_SIZE; ++i) {
+    ctx->data[i] = (char) ('a' + i % 26);
+  }
+
+  for (i = 0; i < DEVICE_COUNT; ++i) {
+    rtems_termios_device_context_initialize(&ctx->devices[i].base, "Test");
+  }
+
+  sc = rtems_termios_bufsize(1024, 1024, 64);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  for (i = 0; i < SHARED; ++i) {
+    install_and_open(ctx, i);
+  }
+
+  sc = rtems_termios_set_shared_daemon(true);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  for (i = SHARED; i < DEVICE_COUNT; ++i) {
+    install_and_open(ctx, i);
+  }
+
+  sc = rtems_termios_set_shared_daemon(false);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  rtems_test_assert(!ctx->devices[DEDICATED].tty->sharedDaemon);
+  rtems_test_assert(ctx->devices[SHARED].tty->sharedDaemon);
+  rtems_test_assert(
+    ctx->devices[SHARED].tty->rxTaskId ==
+      ctx->devices[DEVICE_COUNT - 1].tty->rxTaskId
+  );
+}
+
+static void print_result(
+  const char *name,
+  size_t chunk_size,
+  size_t bytes,
+  uint64_t duration
+)
+{
+  printf(
+    "    <%s chunkSize=\"%zu\" bytes=\"%zu\" duration=\"%" PRIu64 "\" "
+      "bytesPerSecond=\"%" PRIu64 "\"/>\n",
+    name,
+    chunk_size,
+    bytes,
+    duration,
+    duration > 0 ? (uint64_t) bytes * UINT64_C(1000000000) / duration : 0
+  );
+}
+
+/*
+ * Feed the receive path directly like a receive interrupt handler and read
+ * the characters back.  With ICRNL set, the characters need input processing
+ * and take the character by character path.
+ */
+static void test_enqueue(test_context *ctx, const char *name, tcflag_t iflag)
+{
+  device_context *dev = &ctx->devices[INTERRUPT];
+  size_t i;
+
+  set_raw(ctx, INTERRUPT, iflag, 0);
+
+  for (i = 0; i < RTEMS_ARRAY_SIZE(chunk_sizes); ++i) {
+    size_t chunk_size = chunk_sizes[i];
+    uint64_t t0;
+    size_t done;
+
+    t0 = rtems_clock_get_uptime_nanoseconds();
+
+    for (done = 0; done < TOTAL_BYTES; done += chunk_size) {
+      ssize_t n;
+      int dropped;
+
+      dropped = rtems_termios_enqueue_raw_characters(
+        dev->tty,
+        ctx->data,
+        (int) chunk_size
+      );
+      rtems_test_assert(dropped == 0);
+
+      n = read(ctx->fds[INTERRUPT], ctx->buf, chunk_size);
+      rtems_test_assert(n == (ssize_t) chunk_size);
+    }
+
+    print_result(
+      name,
+      chunk_size,
+      TOTAL_BYTES,
+      rtems_clock_get_uptime_nanoseconds() - t0
+    );
+    rtems_test_assert(memcmp(ctx->buf, ctx->data, chunk_sizes[i]) == 0);
+  }
+}
+
+/*
+ * Signal a receive interrupt on each device of the group and read the
+ * characters back.  The reads block until the daemon task has passed the
+ * characters to Termios.
+ */
+static void test_daemon(test_context *ctx, const char *name, size_t first)
+{
+  uint64_t t0;
+  size_t round;
+  size_t i;
+
+  for (i = first; i < first + DAEMON_DEVICE_COUNT; ++i) {
+    set_raw(ctx, i, 0, DAEMON_CHUNK_SIZE);
+  }
+
+  t0 = rtems_clock_get_uptime_nanoseconds();
+
+  for (round = 0; round < DAEMON_ROUNDS; ++round) {
+    for (i = first; i < first + DAEMON_DEVICE_COUNT; ++i) {
+      device_context *dev = &ctx->devices[i];
+
+      dev->input = ctx->data;
+      dev->input_size = DAEMON_CHUNK_SIZE;
+      dev->input_index = 0;
+      rtems_termios_rxirq_occured(dev->tty);
+    }
+
+    for (i = first; i < first + DAEMON_DEVICE_COUNT; ++i) {
+      ssize_t n;
+
+      n = read(ctx->fds[i], ctx->buf, DAEMON_CHUNK_SIZE);
+      rtems_test_assert(n == DAEMON_CHUNK_SIZE);
+      rtems_test_assert(memcmp(ctx->buf, ctx->data, DAEMON_CHUNK_SIZE) == 0);
+    }
+  }
+
+  print_result(
+    name,
+    DAEMON_CHUNK_SIZE,
+    DAEMON_ROUNDS * DAEMON_DEVICE_COUNT * DAEMON_CHUNK_SIZE,
+    rtems_clock_get_uptime_nanoseconds() - t0
+  );
+}
+
+static void Init(rtems_task_argument arg)
+{
+  test_context *ctx = &test_instance;
+  const char *test = "Termios12";
+
+  TEST_BEGIN();
+
+  setup(ctx);
+
+  printf("<%s>\n", test);
+
+  printf("  <Enqueue>\n");
+  test_enqueue(ctx, "Raw", 0);
+  test_enqueue(ctx, "Processed", ICRNL);
+  printf("  </Enqueue>\n");
+
+  printf("  <Daemon devices=\"%d\">\n", DAEMON_DEVICE_COUNT);
+  test_daemon(ctx, "Dedicated", DEDICATED);
+  test_daemon(ctx, "Shared", SHARED);
+  printf("  </Daemon>\n");
+
+  printf("</%s>\n", test);
+
+  TEST_END();
+  rtems_test_exit(0);
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+
+#define CONFIGURE_MAXIMUM_FILE_DESCRIPTORS (3 + DEVICE_COUNT)
+
+#define CONFIGURE_MAXIMUM_TASKS (2 + 2 * DAEMON_DEVICE_COUNT)
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
@@ -0,0 +1,222 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/*
+ * Copyright (C) 2026 On-Line Applications Research Corporation (OAR)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+#include <zlib.h>
+
+#include <rtems.h>
+
+#include <tmacros.h>
+
+const char rtems_test_name[] = "ZLIB 1";
+
+#define BUFFER_SIZE (64 * 1024)
+
+#define BENCHMARK_ROUNDS 16
+
+static unsigned char source[BUFFER_SIZE + 8];
+
+static unsigned char target[BUFFER_SIZE + 8];
+
+static uint32_t reference_crc32(uint32_t crc, const unsigned char *buf,
+  size_t len)
+{
+  int k;
+
+  crc = ~crc;
+  while (len-- > 0) {
+    crc ^= *buf++;
+    for (k = 0; k < 8; ++k) {
+      crc = (crc & 1) != 0 ? 0xedb88320 ^ (crc >> 1) : crc >> 1;
+    }
+  }
+  return ~crc;
+}
+
+static uint32_t reference_adler32(uint32_t adler, const unsigned char *buf,
+  size_t len)
+{
+  uint32_t a = adler & 0xffff;
+  uint32_t b = adler >> 16;
+
+  while (len-- > 0) {
+    a = (a + *buf++) % 65521;
+    b = (b + a) % 65521;
+  }
+  return (b << 16) | a;
+}
+
+static void fill(unsigned char *buf, size_t len, uint32_t seed)
+{
+  size_t i;
+
+  for (i = 0; i < len; ++i) {
+    seed = seed * 1103515245 + 12345;
+    buf[i] = (unsigned char) (seed >> 16);
+  }
+}
+
+static void test_checksums(void)
+{
+  static const size_t lengths[] = {
+    0, 1, 3, 4, 7, 8, 15, 16, 31, 32, 63, 64, 65, 1000, 5552, 5553, 20000,
+    BUFFER_SIZE
+  };
+  size_t i;
+  size_t off;
+  uLong crc;
+  uLong adler;
+
+  fill(source, sizeof(source), 1);
+
+  for (i = 0; i < RTEMS_ARRAY_SIZE(lengths); ++i) {
+    for (off = 0; off < 8; ++off) {
+      size_t len = lengths[i];
+
+      if (off + len > sizeof(source)) {
+        continue;
+      }
+
+      crc = crc32(0x12345678, &source[off], len);
+      rtems_test_assert(crc == reference_crc32(0x12345678, &source[off], len));
+
+      adler = adler32(0x00010001, &source[off], len);
+      rtems_test_assert(
+        adler == reference_adler32(0x00010001, &source[off], len)
+      );
+
+      memset(target, 0, sizeof(target));
+      crc = crc32_copy(0x12345678, &target[1], &source[off], len);
+      rtems_test_assert(crc == reference_crc32(0x12345678, &source[off], len));
+      rtems_test_assert(memcmp(&target[1], &source[off], len) == 0);
+
+      memset(target, 0, sizeof(target));
+      adler = adler32_copy(0x00010001, &target[1], &source[off], len);
+      rtems_test_assert(
+        adler == reference_adler32(0x00010001, &source[off], len)
+      );
+      rtems_test_assert(memcmp(&target[1], &source[off], len) == 0);
+    }
+  }
+
+  /* Maximum byte values stress the sums of the word-at-a-time Adler-32 */
+  memset(source, 0xff, sizeof(source));
+  adler = adler32(0xfff0fff0, source, BUFFER_SIZE);
+  rtems_test_assert(
+    adler == reference_adler32(0xfff0fff0, source, BUFFER_SIZE)
+  );
+
+  rtems_test_assert(crc32(0, Z_NULL, 0) == 0);
+  rtems_test_assert(crc32_copy(0, target, Z_NULL, 0) == 0);
+  rtems_test_assert(adler32(0, Z_NULL, 0) == 1);
+  rtems_test_assert(adler32_copy(0, target, Z_NULL, 0) == 1);
+}
+
+static void report(const char *what, uint64_t ns)
+{
+  uint64_t bytes = (uint64_t) BENCHMARK_ROUNDS * BUFFER_SIZE;
+
+  printf(
+    "%s: %" PRIu64 " KiB/s\n",
+    what,
+    ns > 0 ? (bytes * 1000000000 / 1024) / ns : 0
+  );
+}
+
+static void test_benchmark(void)
+{
+  uint64_t start;
+  uLong check;
+  int i;
+
+  fill(source, sizeof(source), 2);
+  check = 0;
+
+  start = rtems_clock_get_uptime_nanoseconds();
+  for (i = 0; i < BENCHMARK_ROUNDS; ++i) {
+    check ^= crc32(0, source, BUFFER_SIZE);
+  }
+  report("crc32", rtems_clock_get_uptime_nanoseconds() - start);
+
+  start = rtems_clock_get_uptime_nanoseconds();
+  for (i = 0; i < BENCHMARK_ROUNDS; ++i) {
+    check ^= adler32(1, source, BUFFER_SIZE);
+  }
+  report("adler32", rtems_clock_get_uptime_nanoseconds() - start);
+
+  start = rtems_clock_get_uptime_nanoseconds();
+  for (i = 0; i < BENCHMARK_ROUNDS; ++i) {
+    memcpy(target, source, BUFFER_SIZE);
+    check ^= crc32(0, target, BUFFER_SIZE);
+  }
+  report("memcpy and crc32", rtems_clock_get_uptime_nanoseconds() - start);
+
+  start = rtems_clock_get_uptime_nanoseconds();
+  for (i = 0; i < BENCHMARK_ROUNDS; ++i) {
+    check ^= crc32_copy(0, target, source, BUFFER_SIZE);
+  }
+  report("crc32_copy", rtems_clock_get_uptime_nanoseconds() - start);
+
+  start = rtems_clock_get_uptime_nanoseconds();
+  for (i = 0; i < BENCHMARK_ROUNDS; ++i) {
+    check ^= adler32_copy(1, target, source, BUFFER_SIZE);
+  }
+  report("adler32_copy", rtems_clock_get_uptime_nanoseconds() - start);
+
+  /* Each checksum was combined an even number of times */
+  rtems_test_assert(check == 0);
+}
+
+static void Init(rtems_task_argument arg)
+{
+  TEST_BEGIN();
+
+  test_checksums();
+  test_benchmark();
+
+  TEST_END();
+  rtems_test_exit(0);
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+
+#define CONFIGURE_MAXIMUM_TASKS 1
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
@@ -0,0 +1,248 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/*
+ * Copyright (C) 2026 On-Line Applications Research Corporation (OAR)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "tmacros.h"
+
+#include <fcntl.h>
+#include <inttypes.h>
+#include <stdio.h>
+#include <unistd.h>
+
+#include <rtems/test-info.h>
+
+const char rtems_test_name[] = "PSXFDSCALE 1";
+
+#if defined(RTEMS_SMP)
+#define CPU_COUNT 4
+#else
+#define CPU_COUNT 1
+#endif
+
+#define BUFFER_SIZE 64
+
+typedef struct {
+  rtems_test_parallel_context base;
+  uint32_t open_close_ops[CPU_COUNT][CPU_COUNT];
+  uint32_t read_write_ops[CPU_COUNT][CPU_COUNT];
+} test_context;
+
+static test_context test_instance;
+
+static rtems_interval test_duration(void)
+{
+  return rtems_clock_get_ticks_per_second();
+}
+
+static rtems_interval test_init(
+  rtems_test_parallel_context *base,
+  void *arg,
+  size_t active_workers
+)
+{
+  return test_duration();
+}
+
+static void test_fini(
+  const char *name,
+  uint32_t *counters,
+  size_t active_workers
+)
+{
+  size_t i;
+
+  printf("  <%s activeWorker=\"%zu\">\n", name, active_workers);
+
+  for (i = 0; i < active_workers; ++i) {
+    printf(
+      "    <Counter worker=\"%zu\">%" PRIu32 "</Counter>\n",
+      i,
+      counters[i]
+    );
+  }
+
+  printf("  </%s>\n", name);
+}
+
+static void test_open_close_body(
+  rtems_test_parallel_context *base,
+  void *arg,
+  size_t active_workers,
+  size_t worker_index
+)
+{
+  test_context *ctx = (test_context *) base;
+  uint32_t counter = 0;
+
+  while (!rtems_test_parallel_stop_job(&ctx->base)) {
+    int fd;
+    int rv;
+
+    ++counter;
+
+    fd = open("/dev/null", O_RDWR);
+    rtems_test_assert(fd >= 0);
+
+    rv = close(fd);
+    rtems_test_assert(rv == 0);
+  }
+
+  ctx->open_close_ops[active_workers - 1][worker_index] = counter;
+}
+
+static void test_open_close_fini(
+  rtems_test_parallel_context *base,
+  void *arg,
+  size_t active_workers
+)
+{
+  test_context *ctx = (test_context *) base;
+
+  test_fini(
+    "OpenClose",
+    &ctx->open_close_ops[active_workers - 1][0],
+    active_workers
+  );
+}
+
+static void test_read_write_body(
+  rtems_test_parallel_context *base,
+  void *arg,
+  size_t active_workers,
+  size_t worker_index
+)
+{
+  test_context *ctx = (test_context *) base;
+  char buf[BUFFER_SIZE];
+  uint32_t counter = 0;
+  int fd_zero;
+  int fd_null;
+  int rv;
+
+  fd_zero = open("/dev/zero", O_RDONLY);
+  rtems_test_assert(fd_zero >= 0);
+
+  fd_null = open("/dev/null", O_WRONLY);
+  rtems_test_assert(fd_null >= 0);
+
+  while (!rtems_test_parallel_stop_job(&ctx->base)) {
+    ssize_t n;
+
+    ++counter;
+
+    n = read(fd_zero, buf, sizeof(buf));
+    rtems_test_assert(n == (ssize_t) sizeof(buf));
+
+    n = write(fd_null, buf, sizeof(buf));
+    rtems_test_assert(n == (ssize_t) sizeof(buf));
+  }
+
+  ctx->read_write_ops[active_workers - 1][worker_index] = counter;
+
+  rv = close(fd_null);
+  rtems_test_assert(rv == 0);
+
+  rv = close(fd_zero);
+  rtems_test_assert(rv == 0);
+}
+
+static void test_read_write_fini(
+  rtems_test_parallel_context *base,
+  void *arg,
+  size_t active_workers
+)
+{
+  test_context *ctx = (test_context *) base;
+
+  test_fini(
+    "ReadWrite",
+    &ctx->read_write_ops[active_workers - 1][0],
+    active_workers
+  );
+}
+
+static const rtems_test_parallel_job test_jobs[] = {
+  {
+    .init = test_init,
+    .body = test_open_close_body,
+    .fini = test_open_close_fini,
+    .cascade = true
+  }, {
+    .init = test_init,
+    .body = test_read_write_body,
+    .fini = test_read_write_fini,
+    .cascade = true
+  }
+};
+
+static void Init(rtems_task_argument arg)
+{
+  test_context *ctx = &test_instance;
+  const char *test = "PosixFileDescriptorScale01";
+
+  TEST_BEGIN();
+
+  printf("<%s>\n", test);
+
+  rtems_test_parallel(
+    &ctx->base,
+    NULL,
+    &test_jobs[0],
+    RTEMS_ARRAY_SIZE(test_jobs)
+  );
+
+  printf("</%s>\n", test);
+
+  TEST_END();
+  rtems_test_exit(0);
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_NULL_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_ZERO_DRIVER
+
+#define CONFIGURE_MAXIMUM_FILE_DESCRIPTORS (3 + 2 * CPU_COUNT)
+
+#define CONFIGURE_MAXIMUM_TASKS CPU_COUNT
+
+#define CONFIGURE_MAXIMUM_TIMERS 1
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT_TASK_PRIORITY 2
+
+#define CONFIGURE_MAXIMUM_PROCESSORS CPU_COUNT
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
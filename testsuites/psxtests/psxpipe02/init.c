@@ -0,0 +1,275 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/*
+ * Copyright (C) 2026 On-Line Applications Research Corporation (OAR)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "tmacros.h"
+
+#include <errno.h>
+#include <fcntl.h>
+#include <inttypes.h>
+#include <stdio.h>
+#include <unistd.h>
+
+#include <rtems.h>
+#include <rtems/pipe.h>
+#include <rtems/test-info.h>
+
+const char rtems_test_name[] = "PSXPIPE 2";
+
+#define PIPE_BUFFER_SIZE (64 * 1024)
+
+#define MAX_WRITE_SIZE (64 * 1024)
+
+#define MAX_TOTAL (4 * 1024 * 1024)
+
+#define MAX_WRITE_COUNT 65536
+
+#define EVENT_START RTEMS_EVENT_0
+
+typedef enum {
+  SINK_READ,
+  SINK_SPLICE
+} sink_mode;
+
+typedef struct {
+  int fds[2];
+  int null_fd;
+  rtems_id master;
+  rtems_id sink;
+  sink_mode mode;
+  size_t total;
+  char write_buf[MAX_WRITE_SIZE];
+  char read_buf[MAX_WRITE_SIZE];
+} test_context;
+
+static test_context test_instance;
+
+static const size_t write_sizes[] = { 1, 16, 256, 4096, 65536 };
+
+static void sink_task(rtems_task_argument arg)
+{
+  test_context *ctx = (test_context *) arg;
+
+  while (true) {
+    rtems_status_code sc;
+    rtems_event_set events;
+    size_t done;
+
+    sc = rtems_event_receive(
+      EVENT_START,
+      RTEMS_WAIT | RTEMS_EVENT_ANY,
+      RTEMS_NO_TIMEOUT,
+      &events
+    );
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+    done = 0;
+
+    while (done < ctx->total) {
+      ssize_t n;
+
+      if (ctx->mode == SINK_READ) {
+        n = read(ctx->fds[0], ctx->read_buf, sizeof(ctx->read_buf));
+      } else {
+        n = rtems_pipe_splice(
+          ctx->fds[0],
+          ctx->null_fd,
+          sizeof(ctx->read_buf)
+        );
+      }
+
+      rtems_test_assert(n > 0);
+      done += (size_t) n;
+    }
+
+    rtems_test_assert(done == ctx->total);
+
+    sc = rtems_event_transient_send(ctx->master);
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  }
+}
+
+static void test_splice_errors(test_context *ctx)
+{
+  ssize_t n;
+  int fd;
+
+  /* Both file descriptors are pipes */
+  errno = 0;
+  n = rtems_pipe_splice(ctx->fds[0], ctx->fds[1], 1);
+  rtems_test_assert(n == -1);
+  rtems_test_assert(errno == EINVAL);
+
+  /* No file descriptor is a pipe */
+  errno = 0;
+  n = rtems_pipe_splice(ctx->null_fd, ctx->null_fd, 1);
+  rtems_test_assert(n == -1);
+  rtems_test_assert(errno == EINVAL);
+
+  /* The pipe end has the wrong direction */
+  errno = 0;
+  n = rtems_pipe_splice(ctx->fds[1], ctx->null_fd, 1);
+  rtems_test_assert(n == -1);
+  rtems_test_assert(errno == EBADF);
+
+  errno = 0;
+  n = rtems_pipe_splice(ctx->null_fd, ctx->fds[0], 1);
+  rtems_test_assert(n == -1);
+  rtems_test_assert(errno == EBADF);
+
+  /* Move data from /dev/zero into the pipe and splice it out again */
+  fd = open("/dev/zero", O_RDONLY);
+  rtems_test_assert(fd >= 0);
+
+  n = rtems_pipe_splice(fd, ctx->fds[1], 100);
+  rtems_test_assert(n == 100);
+
+  n = rtems_pipe_splice(ctx->fds[0], ctx->null_fd, 1000);
+  rtems_test_assert(n == 100);
+
+  n = close(fd);
+  rtems_test_assert(n == 0);
+}
+
+static void test_write_size(
+  test_context *ctx,
+  size_t size,
+  sink_mode mode,
+  const char *name
+)
+{
+  rtems_status_code sc;
+  uint64_t t0;
+  uint64_t d;
+  size_t done;
+
+  ctx->mode = mode;
+  ctx->total = size * MAX_WRITE_COUNT;
+
+  if (ctx->total > MAX_TOTAL) {
+    ctx->total = MAX_TOTAL;
+  }
+
+  t0 = rtems_clock_get_uptime_nanoseconds();
+
+  sc = rtems_event_send(ctx->sink, EVENT_START);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  for (done = 0; done < ctx->total; done += size) {
+    ssize_t n;
+
+    n = write(ctx->fds[1], ctx->write_buf, size);
+    rtems_test_assert(n == (ssize_t) size);
+  }
+
+  sc = rtems_event_transient_receive(RTEMS_WAIT, RTEMS_NO_TIMEOUT);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  d = rtems_clock_get_uptime_nanoseconds() - t0;
+
+  printf(
+    "    <%s bytes=\"%zu\" duration=\"%" PRIu64 "\" "
+      "bytesPerSecond=\"%" PRIu64 "\"/>\n",
+    name,
+    ctx->total,
+    d,
+    d > 0 ? (uint64_t) ctx->total * UINT64_C(1000000000) / d : 0
+  );
+}
+
+static void Init(rtems_task_argument arg)
+{
+  test_context *ctx = &test_instance;
+  const char *test = "PosixPipe02";
+  rtems_status_code sc;
+  size_t i;
+  int rv;
+
+  TEST_BEGIN();
+
+  ctx->master = rtems_task_self();
+
+  rv = pipe(ctx->fds);
+  rtems_test_assert(rv == 0);
+
+  ctx->null_fd = open("/dev/null", O_WRONLY);
+  rtems_test_assert(ctx->null_fd >= 0);
+
+  test_splice_errors(ctx);
+
+  sc = rtems_task_create(
+    rtems_build_name('S', 'I', 'N', 'K'),
+    RTEMS_MAXIMUM_PRIORITY - 1,
+    RTEMS_MINIMUM_STACK_SIZE,
+    RTEMS_DEFAULT_MODES,
+    RTEMS_DEFAULT_ATTRIBUTES,
+    &ctx->sink
+  );
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_task_start(ctx->sink, sink_task, (rtems_task_argument) ctx);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  printf("<%s bufferSize=\"%d\">\n", test, PIPE_BUFFER_SIZE);
+
+  for (i = 0; i < RTEMS_ARRAY_SIZE(write_sizes); ++i) {
+    printf("  <WriteSize bytes=\"%zu\">\n", write_sizes[i]);
+    test_write_size(ctx, write_sizes[i], SINK_READ, "Read");
+    test_write_size(ctx, write_sizes[i], SINK_SPLICE, "Splice");
+    printf("  </WriteSize>\n");
+  }
+
+  printf("</%s>\n", test);
+
+  TEST_END();
+  rtems_test_exit(0);
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_NULL_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_ZERO_DRIVER
+
+#define CONFIGURE_MAXIMUM_FILE_DESCRIPTORS 7
+
+#define CONFIGURE_IMFS_ENABLE_MKFIFO
+
+#define CONFIGURE_PIPE_BUFFER_SIZE PIPE_BUFFER_SIZE
+
+#define CONFIGURE_MAXIMUM_TASKS 2
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
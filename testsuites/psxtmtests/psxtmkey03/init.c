@@ -0,0 +1,156 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/*
+ * Copyright (C) 2026 On-Line Applications Research Corporation (OAR)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <timesys.h>
+#include <rtems/btimer.h>
+#include <pthread.h>
+#include "test_support.h"
+
+const char rtems_test_name[] = "PSXTMKEY 03";
+
+#define OPERATION_COUNT 1000
+
+/* forward declarations to avoid warnings */
+void *POSIX_Init(void *argument);
+
+static pthread_key_t Direct_key;
+
+static pthread_key_t Tree_key;
+
+static int Value;
+
+static void benchmark_pthread_setspecific(
+  const char    *message,
+  pthread_key_t  key
+)
+{
+  benchmark_timer_t end_time;
+  int               status;
+  int               i;
+
+  status = 0;
+
+  benchmark_timer_initialize();
+    for ( i = 0 ; i < OPERATION_COUNT ; i++ ) {
+      status |= pthread_setspecific( key, &Value );
+    }
+  end_time = benchmark_timer_read();
+  rtems_test_assert( status == 0 );
+
+  put_time( message, end_time, OPERATION_COUNT, 0, 0 );
+}
+
+static void benchmark_pthread_getspecific(
+  const char    *message,
+  pthread_key_t  key
+)
+{
+  benchmark_timer_t  end_time;
+  void              *value_p;
+  uintptr_t          mismatch;
+  int                i;
+
+  mismatch = 0;
+
+  benchmark_timer_initialize();
+    for ( i = 0 ; i < OPERATION_COUNT ; i++ ) {
+      value_p = pthread_getspecific( key );
+      mismatch |= (uintptr_t) value_p ^ (uintptr_t) &Value;
+    }
+  end_time = benchmark_timer_read();
+  rtems_test_assert( mismatch == 0 );
+
+  put_time( message, end_time, OPERATION_COUNT, 0, 0 );
+}
+
+void *POSIX_Init(
+  void *argument
+)
+{
+  int status;
+
+  TEST_BEGIN();
+
+  /* the first key gets the only direct value slot */
+  status = pthread_key_create( &Direct_key, NULL );
+  rtems_test_assert( status == 0 );
+
+  status = pthread_key_create( &Tree_key, NULL );
+  rtems_test_assert( status == 0 );
+
+  benchmark_pthread_setspecific(
+    "pthread_setspecific: direct key",
+    Direct_key
+  );
+  benchmark_pthread_setspecific(
+    "pthread_setspecific: tree key",
+    Tree_key
+  );
+  benchmark_pthread_getspecific(
+    "pthread_getspecific: direct key",
+    Direct_key
+  );
+  benchmark_pthread_getspecific(
+    "pthread_getspecific: tree key",
+    Tree_key
+  );
+
+  status = pthread_key_delete( Direct_key );
+  rtems_test_assert( status == 0 );
+
+  /* a deleted key must not leave a stale value behind */
+  status = pthread_key_create( &Direct_key, NULL );
+  rtems_test_assert( status == 0 );
+  rtems_test_assert( pthread_getspecific( Direct_key ) == NULL );
+
+  status = pthread_key_delete( Direct_key );
+  rtems_test_assert( status == 0 );
+
+  status = pthread_key_delete( Tree_key );
+  rtems_test_assert( status == 0 );
+
+  TEST_END();
+  rtems_test_exit(0);
+}
+
+/* configuration information */
+
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_TIMER_DRIVER
+
+#define CONFIGURE_MAXIMUM_POSIX_THREADS  2
+#define CONFIGURE_MAXIMUM_POSIX_KEYS     2
+#define CONFIGURE_POSIX_KEYS_DIRECT_MAXIMUM 1
+#define CONFIGURE_POSIX_INIT_THREAD_TABLE
+
+#define CONFIGURE_INIT
+#include <rtems/confdefs.h>
+/* end of file */
@@ -36,6 +36,7 @@
 
 #include <string.h>
 
+#include <rtems/score/apimutex.h>
 #include <rtems/score/wkspace.h>
 
 const char rtems_test_name[] = "SPWKSPACE";
@@ -75,6 +76,34 @@ static void test_workspace_string_duplicate(void)
   _Workspace_Free( dup_e );
 }
 
+static void test_workspace_slab_string_duplicate(void)
+{
+  char a [] = "abcd";
+  char b [] = "abc";
+  char c [] = "";
+  size_t maxlen = 3;
+  char *dup_a;
+  char *dup_b;
+  char *dup_c;
+
+  _RTEMS_Lock_allocator();
+  dup_a = _Workspace_Slab_string_duplicate( a, maxlen );
+  dup_b = _Workspace_Slab_string_duplicate( b, maxlen );
+  dup_c = _Workspace_Slab_string_duplicate( c, maxlen );
+
+  rtems_test_assert( dup_a != NULL );
+  rtems_test_assert( dup_b != NULL );
+  rtems_test_assert( dup_c != NULL );
+  rtems_test_assert( strcmp( dup_a, b ) == 0 );
+  rtems_test_assert( strcmp( dup_b, b ) == 0 );
+  rtems_test_assert( strcmp( dup_c, c ) == 0 );
+
+  _Workspace_Slab_string_free( dup_a );
+  _Workspace_Slab_string_free( dup_b );
+  _Workspace_Slab_string_free( dup_c );
+  _RTEMS_Unlock_allocator();
+}
+
 rtems_task Init(
   rtems_task_argument argument
 )
@@ -121,6 +150,9 @@ rtems_task Init(
   puts( "_Workspace_String_duplicate - samples" );
   test_workspace_string_duplicate();
 
+  puts( "_Workspace_Slab_string_duplicate - samples" );
+  test_workspace_slab_string_duplicate();
+
   TEST_END();
   rtems_test_exit( 0 );
 }
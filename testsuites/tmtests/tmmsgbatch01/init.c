@@ -0,0 +1,439 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/*
+ * Copyright (C) 2026 On-Line Applications Research Corporation (OAR)
+ *
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "tmacros.h"
+
+#include <sys/uio.h>
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+
+#include <rtems.h>
+
+const char rtems_test_name[] = "TMMSGBATCH 1";
+
+#define MSG_COUNT 64
+
+#define BATCH_MAX 64
+
+#define ROUNDS 64
+
+#define EVENT_START RTEMS_EVENT_0
+
+#define EVENT_DONE RTEMS_EVENT_1
+
+typedef struct {
+  uint32_t value[ 4 ];
+} test_msg;
+
+typedef struct {
+  rtems_id mq;
+  rtems_id master;
+  rtems_id consumer;
+  uint32_t batch;
+  uint32_t total;
+  uint32_t received;
+  test_msg out[ BATCH_MAX ];
+  test_msg in[ BATCH_MAX ];
+  struct iovec out_iov[ BATCH_MAX ];
+  struct iovec in_iov[ BATCH_MAX ];
+  test_msg consumer_in[ BATCH_MAX ];
+  struct iovec consumer_iov[ BATCH_MAX ];
+} test_context;
+
+static test_context test_instance;
+
+static const uint32_t test_batches[] = { 1, 8, 64 };
+
+static void setup_iov( struct iovec *iov, test_msg *msg, uint32_t count )
+{
+  uint32_t i;
+
+  for ( i = 0; i < count; ++i ) {
+    iov[ i ].iov_base = &msg[ i ];
+    iov[ i ].iov_len = sizeof( msg[ i ] );
+  }
+}
+
+static void test_batch_semantics( test_context *ctx )
+{
+  rtems_status_code sc;
+  uint32_t          n;
+  uint32_t          i;
+
+  setup_iov( ctx->out_iov, ctx->out, BATCH_MAX );
+
+  for ( i = 0; i < BATCH_MAX; ++i ) {
+    ctx->out[ i ].value[ 0 ] = i;
+  }
+
+  sc = rtems_message_queue_send_many( ctx->mq, NULL, 1, &n );
+  rtems_test_assert( sc == RTEMS_INVALID_ADDRESS );
+
+  n = 1;
+  sc = rtems_message_queue_send_many( ctx->mq, ctx->out_iov, 0, &n );
+  rtems_test_assert( sc == RTEMS_INVALID_NUMBER );
+  rtems_test_assert( n == 0 );
+
+  sc = rtems_message_queue_receive_many(
+    ctx->mq,
+    ctx->in_iov,
+    0,
+    &n,
+    RTEMS_NO_WAIT,
+    0
+  );
+  rtems_test_assert( sc == RTEMS_INVALID_NUMBER );
+
+  sc = rtems_message_queue_receive_many(
+    ctx->mq,
+    ctx->in_iov,
+    1,
+    &n,
+    RTEMS_NO_WAIT,
+    0
+  );
+  rtems_test_assert( sc == RTEMS_UNSATISFIED );
+  rtems_test_assert( n == 0 );
+
+  /* The batch stops at the first message which is too big */
+  ctx->out_iov[ 3 ].iov_len = sizeof( test_msg ) + 1;
+  sc = rtems_message_queue_send_many( ctx->mq, ctx->out_iov, 8, &n );
+  rtems_test_assert( sc == RTEMS_INVALID_SIZE );
+  rtems_test_assert( n == 3 );
+  ctx->out_iov[ 3 ].iov_len = sizeof( test_msg );
+
+  /* The batch stops if the queue is full */
+  sc = rtems_message_queue_send_many(
+    ctx->mq,
+    &ctx->out_iov[ 3 ],
+    MSG_COUNT,
+    &n
+  );
+  rtems_test_assert( sc == RTEMS_TOO_MANY );
+  rtems_test_assert( n == MSG_COUNT - 3 );
+
+  /* The messages are received in order */
+  setup_iov( ctx->in_iov, ctx->in, BATCH_MAX );
+  sc = rtems_message_queue_receive_many(
+    ctx->mq,
+    ctx->in_iov,
+    BATCH_MAX,
+    &n,
+    RTEMS_NO_WAIT,
+    0
+  );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+  rtems_test_assert( n == MSG_COUNT );
+
+  for ( i = 0; i < MSG_COUNT; ++i ) {
+    rtems_test_assert( ctx->in_iov[ i ].iov_len == sizeof( test_msg ) );
+    rtems_test_assert( ctx->in[ i ].value[ 0 ] == i );
+  }
+}
+
+static uint64_t test_self_single( test_context *ctx )
+{
+  uint64_t t0;
+  uint64_t t1;
+  uint32_t round;
+
+  t0 = rtems_clock_get_uptime_nanoseconds();
+
+  for ( round = 0; round < ROUNDS; ++round ) {
+    uint32_t i;
+
+    for ( i = 0; i < MSG_COUNT; ++i ) {
+      rtems_status_code sc;
+
+      sc = rtems_message_queue_send(
+        ctx->mq,
+        &ctx->out[ 0 ],
+        sizeof( test_msg )
+      );
+      rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+    }
+
+    for ( i = 0; i < MSG_COUNT; ++i ) {
+      rtems_status_code sc;
+      size_t            size;
+
+      sc = rtems_message_queue_receive(
+        ctx->mq,
+        &ctx->in[ 0 ],
+        &size,
+        RTEMS_NO_WAIT,
+        0
+      );
+      rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+    }
+  }
+
+  t1 = rtems_clock_get_uptime_nanoseconds();
+  return t1 - t0;
+}
+
+static uint64_t test_self_batch( test_context *ctx, uint32_t batch )
+{
+  uint64_t t0;
+  uint64_t t1;
+  uint32_t round;
+
+  t0 = rtems_clock_get_uptime_nanoseconds();
+
+  for ( round = 0; round < ROUNDS; ++round ) {
+    uint32_t i;
+
+    for ( i = 0; i < MSG_COUNT; i += batch ) {
+      rtems_status_code sc;
+      uint32_t          n;
+
+      sc = rtems_message_queue_send_many( ctx->mq, ctx->out_iov, batch, &n );
+      rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+      rtems_test_assert( n == batch );
+    }
+
+    for ( i = 0; i < MSG_COUNT; i += batch ) {
+      rtems_status_code sc;
+      uint32_t          n;
+
+      sc = rtems_message_queue_receive_many(
+        ctx->mq,
+        ctx->in_iov,
+        batch,
+        &n,
+        RTEMS_NO_WAIT,
+        0
+      );
+      rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+      rtems_test_assert( n == batch );
+    }
+  }
+
+  t1 = rtems_clock_get_uptime_nanoseconds();
+  return t1 - t0;
+}
+
+static void consumer_task( rtems_task_argument arg )
+{
+  test_context *ctx;
+
+  ctx = (test_context *) arg;
+  setup_iov( ctx->consumer_iov, ctx->consumer_in, BATCH_MAX );
+
+  while ( true ) {
+    rtems_status_code sc;
+    rtems_event_set   events;
+
+    sc = rtems_event_receive(
+      EVENT_START,
+      RTEMS_EVENT_ALL | RTEMS_WAIT,
+      RTEMS_NO_TIMEOUT,
+      &events
+    );
+    rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+    while ( ctx->received < ctx->total ) {
+      uint32_t n;
+
+      sc = rtems_message_queue_receive_many(
+        ctx->mq,
+        ctx->consumer_iov,
+        ctx->batch,
+        &n,
+        RTEMS_WAIT,
+        RTEMS_NO_TIMEOUT
+      );
+      rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+      ctx->received += n;
+    }
+
+    sc = rtems_event_send( ctx->master, EVENT_DONE );
+    rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+  }
+}
+
+static uint64_t test_consumer_batch( test_context *ctx, uint32_t batch )
+{
+  rtems_status_code sc;
+  rtems_event_set   events;
+  uint64_t          t0;
+  uint64_t          t1;
+  uint32_t          i;
+
+  ctx->batch = batch;
+  ctx->total = ROUNDS * MSG_COUNT;
+  ctx->received = 0;
+
+  /* The consumer has a higher priority and blocks in the receive */
+  sc = rtems_event_send( ctx->consumer, EVENT_START );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  t0 = rtems_clock_get_uptime_nanoseconds();
+
+  for ( i = 0; i < ctx->total; i += batch ) {
+    uint32_t n;
+
+    sc = rtems_message_queue_send_many( ctx->mq, ctx->out_iov, batch, &n );
+    rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+    rtems_test_assert( n == batch );
+  }
+
+  sc = rtems_event_receive(
+    EVENT_DONE,
+    RTEMS_EVENT_ALL | RTEMS_WAIT,
+    RTEMS_NO_TIMEOUT,
+    &events
+  );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  t1 = rtems_clock_get_uptime_nanoseconds();
+  rtems_test_assert( ctx->received == ctx->total );
+  return t1 - t0;
+}
+
+static void print_cost( const char *name, uint32_t batch, uint64_t duration )
+{
+  uint64_t messages;
+
+  messages = (uint64_t) ROUNDS * MSG_COUNT;
+  printf(
+    "    <%s batch=\"%" PRIu32 "\" messages=\"%" PRIu64 "\""
+      " nanosecondsPerMessage=\"%" PRIu64 "\"/>\n",
+    name,
+    batch,
+    messages,
+    duration / messages
+  );
+}
+
+static void test_throughput( test_context *ctx )
+{
+  rtems_status_code sc;
+  size_t            i;
+
+  setup_iov( ctx->out_iov, ctx->out, BATCH_MAX );
+  setup_iov( ctx->in_iov, ctx->in, BATCH_MAX );
+
+  sc = rtems_task_create(
+    rtems_build_name( 'C', 'O', 'N', 'S' ),
+    1,
+    RTEMS_MINIMUM_STACK_SIZE,
+    RTEMS_DEFAULT_MODES,
+    RTEMS_DEFAULT_ATTRIBUTES,
+    &ctx->consumer
+  );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  sc = rtems_task_start(
+    ctx->consumer,
+    consumer_task,
+    (rtems_task_argument) ctx
+  );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  printf( "<TestTimeMessageBatch01>\n" );
+
+  printf( "  <Self>\n" );
+  (void) test_self_single( ctx );
+  print_cost( "Single", 1, test_self_single( ctx ) );
+
+  for ( i = 0; i < RTEMS_ARRAY_SIZE( test_batches ); ++i ) {
+    uint32_t batch;
+
+    batch = test_batches[ i ];
+    (void) test_self_batch( ctx, batch );
+    print_cost( "Batch", batch, test_self_batch( ctx, batch ) );
+  }
+
+  printf( "  </Self>\n" );
+
+  printf( "  <Consumer>\n" );
+
+  for ( i = 0; i < RTEMS_ARRAY_SIZE( test_batches ); ++i ) {
+    uint32_t batch;
+
+    batch = test_batches[ i ];
+    print_cost( "Batch", batch, test_consumer_batch( ctx, batch ) );
+  }
+
+  printf( "  </Consumer>\n" );
+  printf( "</TestTimeMessageBatch01>\n" );
+}
+
+static void Init( rtems_task_argument arg )
+{
+  test_context     *ctx;
+  rtems_status_code sc;
+
+  (void) arg;
+
+  TEST_BEGIN();
+
+  ctx = &test_instance;
+  ctx->master = rtems_task_self();
+
+  sc = rtems_message_queue_create(
+    rtems_build_name( 'B', 'T', 'C', 'H' ),
+    MSG_COUNT,
+    sizeof( test_msg ),
+    RTEMS_FIFO,
+    &ctx->mq
+  );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  test_batch_semantics( ctx );
+  test_throughput( ctx );
+
+  TEST_END();
+  rtems_test_exit( 0 );
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+
+#define CONFIGURE_MAXIMUM_TASKS 2
+
+#define CONFIGURE_MAXIMUM_MESSAGE_QUEUES 1
+
+#define CONFIGURE_MESSAGE_BUFFER_MEMORY \
+  CONFIGURE_MESSAGE_BUFFERS_FOR_QUEUE( MSG_COUNT, sizeof( test_msg ) )
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT_TASK_PRIORITY 2
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
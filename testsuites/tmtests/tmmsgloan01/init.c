@@ -0,0 +1,615 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/*
+ * Copyright (C) 2026 On-Line Applications Research Corporation (OAR)
+ *
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "tmacros.h"
+
+#include <errno.h>
+#include <fcntl.h>
+#include <inttypes.h>
+#include <mqueue.h>
+#include <stdio.h>
+#include <string.h>
+
+#include <rtems.h>
+
+const char rtems_test_name[] = "TMMSGLOAN 1";
+
+#define MSG_COUNT 8
+
+#define MSG_SIZE_MAX 8192
+
+#define ITERATIONS 64
+
+typedef RTEMS_MESSAGE_QUEUE_BUFFER( MSG_SIZE_MAX ) test_message_buffer;
+
+typedef struct {
+  rtems_id          mq;
+  rtems_id          receiver;
+  rtems_id          obtainer;
+  rtems_status_code receive_status;
+  rtems_status_code obtain_status;
+  void             *received;
+  size_t            received_size;
+  void             *obtained;
+  uint32_t          sink;
+  uint32_t buffer[ MSG_SIZE_MAX / sizeof( uint32_t ) ];
+  test_message_buffer storage[ MSG_COUNT ];
+} test_context;
+
+static test_context test_instance;
+
+static const size_t test_sizes[] = { 64, 1024, 4096, 8192 };
+
+static void fill( void *buffer, size_t size, uint32_t value )
+{
+  memset( buffer, (int) value, size );
+}
+
+static uint32_t consume( const void *buffer, size_t size )
+{
+  const uint8_t *p;
+
+  p = buffer;
+  return p[ 0 ] + p[ size - 1 ];
+}
+
+static void create_queue( test_context *ctx )
+{
+  rtems_message_queue_config config;
+  rtems_status_code          sc;
+
+  memset( &config, 0, sizeof( config ) );
+  config.name = rtems_build_name( 'L', 'O', 'A', 'N' );
+  config.maximum_pending_messages = MSG_COUNT;
+  config.maximum_message_size = MSG_SIZE_MAX;
+  config.storage_area = ctx->storage;
+  config.storage_size = sizeof( ctx->storage );
+  config.attributes = RTEMS_FIFO;
+
+  sc = rtems_message_queue_construct( &config, &ctx->mq );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+}
+
+static void test_loan_semantics( test_context *ctx )
+{
+  rtems_status_code sc;
+  void             *buffers[ MSG_COUNT ];
+  void             *buffer;
+  size_t            size;
+  uint32_t          count;
+  size_t            i;
+
+  for ( i = 0; i < MSG_COUNT; ++i ) {
+    sc = rtems_message_queue_obtain_buffer(
+      ctx->mq,
+      &buffers[ i ],
+      RTEMS_NO_WAIT,
+      0
+    );
+    rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+  }
+
+  /* All message buffers are on loan */
+  sc = rtems_message_queue_obtain_buffer(
+    ctx->mq,
+    &buffer,
+    RTEMS_NO_WAIT,
+    0
+  );
+  rtems_test_assert( sc == RTEMS_TOO_MANY );
+
+  sc = rtems_message_queue_send( ctx->mq, ctx->buffer, sizeof( uint32_t ) );
+  rtems_test_assert( sc == RTEMS_TOO_MANY );
+
+  /* Not a message buffer of the queue */
+  sc = rtems_message_queue_send_buffer( ctx->mq, ctx->buffer, 1 );
+  rtems_test_assert( sc == RTEMS_INVALID_ADDRESS );
+
+  sc = rtems_message_queue_release_buffer(
+    ctx->mq,
+    (char *) buffers[ 0 ] + 1
+  );
+  rtems_test_assert( sc == RTEMS_INVALID_ADDRESS );
+
+  sc = rtems_message_queue_send_buffer(
+    ctx->mq,
+    buffers[ 0 ],
+    MSG_SIZE_MAX + 1
+  );
+  rtems_test_assert( sc == RTEMS_INVALID_SIZE );
+
+  /* Loaned and copied messages keep the FIFO order */
+  fill( buffers[ 0 ], 1, 1 );
+  sc = rtems_message_queue_send_buffer( ctx->mq, buffers[ 0 ], 1 );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  /* A pending message buffer is no longer on loan */
+  sc = rtems_message_queue_send_buffer( ctx->mq, buffers[ 0 ], 1 );
+  rtems_test_assert( sc == RTEMS_INVALID_ADDRESS );
+
+  sc = rtems_message_queue_release_buffer( ctx->mq, buffers[ 0 ] );
+  rtems_test_assert( sc == RTEMS_INVALID_ADDRESS );
+
+  for ( i = 1; i < MSG_COUNT; ++i ) {
+    sc = rtems_message_queue_release_buffer( ctx->mq, buffers[ i ] );
+    rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+  }
+
+  /* A released message buffer is no longer on loan */
+  sc = rtems_message_queue_release_buffer( ctx->mq, buffers[ 1 ] );
+  rtems_test_assert( sc == RTEMS_INVALID_ADDRESS );
+
+  sc = rtems_message_queue_send_buffer( ctx->mq, buffers[ 1 ], 1 );
+  rtems_test_assert( sc == RTEMS_INVALID_ADDRESS );
+
+  fill( ctx->buffer, 2, 2 );
+  sc = rtems_message_queue_send( ctx->mq, ctx->buffer, 2 );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  sc = rtems_message_queue_get_number_pending( ctx->mq, &count );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+  rtems_test_assert( count == 2 );
+
+  sc = rtems_message_queue_receive(
+    ctx->mq,
+    ctx->buffer,
+    &size,
+    RTEMS_NO_WAIT,
+    0
+  );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+  rtems_test_assert( size == 1 );
+  rtems_test_assert( ( (uint8_t *) ctx->buffer )[ 0 ] == 1 );
+
+  sc = rtems_message_queue_receive_buffer(
+    ctx->mq,
+    &buffer,
+    &size,
+    RTEMS_NO_WAIT,
+    0
+  );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+  rtems_test_assert( size == 2 );
+  rtems_test_assert( ( (uint8_t *) buffer )[ 1 ] == 2 );
+
+  sc = rtems_message_queue_release_buffer( ctx->mq, buffer );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  sc = rtems_message_queue_release_buffer( ctx->mq, buffer );
+  rtems_test_assert( sc == RTEMS_INVALID_ADDRESS );
+
+  sc = rtems_message_queue_receive_buffer(
+    ctx->mq,
+    &buffer,
+    &size,
+    RTEMS_NO_WAIT,
+    0
+  );
+  rtems_test_assert( sc == RTEMS_UNSATISFIED );
+}
+
+static void test_posix_loan_semantics( void )
+{
+  struct mq_attr attr;
+  mqd_t          mq;
+  void          *low;
+  void          *high;
+  void          *buffer;
+  unsigned int   prio;
+  ssize_t        n;
+  int            rv;
+
+  memset( &attr, 0, sizeof( attr ) );
+  attr.mq_maxmsg = 2;
+  attr.mq_msgsize = 16;
+
+  mq = mq_open( "/loan", O_CREAT | O_RDWR | O_NONBLOCK, 0666, &attr );
+  rtems_test_assert( mq != (mqd_t) -1 );
+
+  rv = mq_obtain_buffer_np( mq, &low, NULL );
+  rtems_test_assert( rv == 0 );
+
+  rv = mq_obtain_buffer_np( mq, &high, NULL );
+  rtems_test_assert( rv == 0 );
+
+  errno = 0;
+  rv = mq_obtain_buffer_np( mq, &buffer, NULL );
+  rtems_test_assert( rv == -1 );
+  rtems_test_assert( errno == EAGAIN );
+
+  /* Loaned messages are received in priority order */
+  fill( low, 1, 1 );
+  rv = mq_send_buffer_np( mq, low, 1, 1 );
+  rtems_test_assert( rv == 0 );
+
+  fill( high, 2, 2 );
+  rv = mq_send_buffer_np( mq, high, 2, 2 );
+  rtems_test_assert( rv == 0 );
+
+  n = mq_receive_buffer_np( mq, &buffer, &prio, NULL );
+  rtems_test_assert( n == 2 );
+  rtems_test_assert( buffer == high );
+  rtems_test_assert( prio == 2 );
+
+  rv = mq_release_buffer_np( mq, buffer );
+  rtems_test_assert( rv == 0 );
+
+  n = mq_receive_buffer_np( mq, &buffer, &prio, NULL );
+  rtems_test_assert( n == 1 );
+  rtems_test_assert( buffer == low );
+  rtems_test_assert( prio == 1 );
+
+  rv = mq_release_buffer_np( mq, buffer );
+  rtems_test_assert( rv == 0 );
+
+  errno = 0;
+  rv = mq_release_buffer_np( mq, &attr );
+  rtems_test_assert( rv == -1 );
+  rtems_test_assert( errno == EFAULT );
+
+  rv = mq_close( mq );
+  rtems_test_assert( rv == 0 );
+
+  rv = mq_unlink( "/loan" );
+  rtems_test_assert( rv == 0 );
+}
+
+static rtems_id start_task( rtems_task_entry entry, test_context *ctx )
+{
+  rtems_status_code sc;
+  rtems_id          id;
+
+  sc = rtems_task_create(
+    rtems_build_name( 'W', 'O', 'R', 'K' ),
+    1,
+    RTEMS_MINIMUM_STACK_SIZE,
+    RTEMS_DEFAULT_MODES,
+    RTEMS_DEFAULT_ATTRIBUTES,
+    &id
+  );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  sc = rtems_task_start( id, entry, (rtems_task_argument) ctx );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  return id;
+}
+
+static void receiver_task( rtems_task_argument arg )
+{
+  test_context *ctx;
+
+  ctx = (test_context *) arg;
+  ctx->receive_status = rtems_message_queue_receive_buffer(
+    ctx->mq,
+    &ctx->received,
+    &ctx->received_size,
+    RTEMS_WAIT,
+    RTEMS_NO_TIMEOUT
+  );
+  rtems_task_exit();
+}
+
+static void obtainer_task( rtems_task_argument arg )
+{
+  test_context *ctx;
+
+  ctx = (test_context *) arg;
+  ctx->obtain_status = rtems_message_queue_obtain_buffer(
+    ctx->mq,
+    &ctx->obtained,
+    RTEMS_WAIT,
+    1000
+  );
+
+  if ( ctx->obtain_status == RTEMS_SUCCESSFUL ) {
+    fill( ctx->obtained, 3, 3 );
+    (void) rtems_message_queue_send_buffer( ctx->mq, ctx->obtained, 3 );
+  }
+
+  rtems_task_exit();
+}
+
+static void test_retry_waiters( test_context *ctx )
+{
+  rtems_status_code sc;
+  void             *buffers[ MSG_COUNT ];
+  size_t            i;
+
+  for ( i = 0; i < MSG_COUNT; ++i ) {
+    sc = rtems_message_queue_obtain_buffer(
+      ctx->mq,
+      &buffers[ i ],
+      RTEMS_NO_WAIT,
+      0
+    );
+    rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+  }
+
+  /*
+   * The workers have a higher priority than the Init task, so they run until
+   * they block on the message queue.  The queue is empty and all message
+   * buffers are on loan, so the receiver and the obtainer are enqueued
+   * together with the receiver first.
+   */
+  ctx->receive_status = RTEMS_NOT_DEFINED;
+  ctx->obtain_status = RTEMS_NOT_DEFINED;
+  ctx->receiver = start_task( receiver_task, ctx );
+  ctx->obtainer = start_task( obtainer_task, ctx );
+  rtems_test_assert( ctx->receive_status == RTEMS_NOT_DEFINED );
+  rtems_test_assert( ctx->obtain_status == RTEMS_NOT_DEFINED );
+
+  /*
+   * The released message buffer cannot be given to the receiver.  Both
+   * waiters get STATUS_MESSAGE_QUEUE_RETRY.  The receiver blocks again, the
+   * obtainer gets the message buffer and sends it to the receiver.
+   */
+  sc = rtems_message_queue_release_buffer( ctx->mq, buffers[ 0 ] );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  rtems_test_assert( ctx->obtain_status == RTEMS_SUCCESSFUL );
+  rtems_test_assert( ctx->obtained == buffers[ 0 ] );
+  rtems_test_assert( ctx->receive_status == RTEMS_SUCCESSFUL );
+  rtems_test_assert( ctx->received == buffers[ 0 ] );
+  rtems_test_assert( ctx->received_size == 3 );
+  rtems_test_assert( ( (uint8_t *) ctx->received )[ 2 ] == 3 );
+
+  sc = rtems_message_queue_release_buffer( ctx->mq, ctx->received );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  for ( i = 1; i < MSG_COUNT; ++i ) {
+    sc = rtems_message_queue_release_buffer( ctx->mq, buffers[ i ] );
+    rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+  }
+}
+
+static void test_delete_with_loan( test_context *ctx )
+{
+  rtems_status_code sc;
+  void             *buffer;
+  size_t            size;
+
+  sc = rtems_message_queue_obtain_buffer(
+    ctx->mq,
+    &buffer,
+    RTEMS_NO_WAIT,
+    0
+  );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  /* An obtained message buffer is on loan */
+  sc = rtems_message_queue_delete( ctx->mq );
+  rtems_test_assert( sc == RTEMS_RESOURCE_IN_USE );
+
+  sc = rtems_message_queue_send_buffer( ctx->mq, buffer, 1 );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  sc = rtems_message_queue_receive_buffer(
+    ctx->mq,
+    &buffer,
+    &size,
+    RTEMS_NO_WAIT,
+    0
+  );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  /* A received message buffer is on loan */
+  sc = rtems_message_queue_delete( ctx->mq );
+  rtems_test_assert( sc == RTEMS_RESOURCE_IN_USE );
+
+  sc = rtems_message_queue_release_buffer( ctx->mq, buffer );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  sc = rtems_message_queue_delete( ctx->mq );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+}
+
+static uint64_t test_copy( test_context *ctx, size_t size )
+{
+  uint64_t t0;
+  uint64_t t1;
+  size_t   i;
+  size_t   j;
+
+  t0 = rtems_clock_get_uptime_nanoseconds();
+
+  for ( i = 0; i < ITERATIONS; ++i ) {
+    for ( j = 0; j < MSG_COUNT; ++j ) {
+      rtems_status_code sc;
+
+      fill( ctx->buffer, size, (uint32_t) j );
+      sc = rtems_message_queue_send( ctx->mq, ctx->buffer, size );
+      rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+    }
+
+    for ( j = 0; j < MSG_COUNT; ++j ) {
+      rtems_status_code sc;
+      size_t            n;
+
+      sc = rtems_message_queue_receive(
+        ctx->mq,
+        ctx->buffer,
+        &n,
+        RTEMS_NO_WAIT,
+        0
+      );
+      rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+      rtems_test_assert( n == size );
+      ctx->sink += consume( ctx->buffer, n );
+    }
+  }
+
+  t1 = rtems_clock_get_uptime_nanoseconds();
+  return t1 - t0;
+}
+
+static uint64_t test_loan( test_context *ctx, size_t size )
+{
+  uint64_t t0;
+  uint64_t t1;
+  size_t   i;
+  size_t   j;
+
+  t0 = rtems_clock_get_uptime_nanoseconds();
+
+  for ( i = 0; i < ITERATIONS; ++i ) {
+    for ( j = 0; j < MSG_COUNT; ++j ) {
+      rtems_status_code sc;
+      void             *buffer;
+
+      sc = rtems_message_queue_obtain_buffer(
+        ctx->mq,
+        &buffer,
+        RTEMS_NO_WAIT,
+        0
+      );
+      rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+      fill( buffer, size, (uint32_t) j );
+      sc = rtems_message_queue_send_buffer( ctx->mq, buffer, size );
+      rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+    }
+
+    for ( j = 0; j < MSG_COUNT; ++j ) {
+      rtems_status_code sc;
+      void             *buffer;
+      size_t            n;
+
+      sc = rtems_message_queue_receive_buffer(
+        ctx->mq,
+        &buffer,
+        &n,
+        RTEMS_NO_WAIT,
+        0
+      );
+      rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+      rtems_test_assert( n == size );
+      ctx->sink += consume( buffer, n );
+      sc = rtems_message_queue_release_buffer( ctx->mq, buffer );
+      rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+    }
+  }
+
+  t1 = rtems_clock_get_uptime_nanoseconds();
+  return t1 - t0;
+}
+
+static void print_mode( const char *mode, size_t size, uint64_t duration )
+{
+  uint64_t messages;
+
+  messages = (uint64_t) ITERATIONS * MSG_COUNT;
+
+  if ( duration == 0 ) {
+    duration = 1;
+  }
+
+  printf(
+    "    <%s messages=\"%" PRIu64 "\" duration=\"%" PRIu64 "\""
+      " messagesPerSecond=\"%" PRIu64 "\" bytesPerSecond=\"%" PRIu64 "\"/>\n",
+    mode,
+    messages,
+    duration,
+    ( messages * UINT64_C( 1000000000 ) ) / duration,
+    ( messages * size * UINT64_C( 1000000000 ) ) / duration
+  );
+}
+
+static void test_throughput( test_context *ctx )
+{
+  size_t i;
+
+  printf( "<TestTimeMessageLoan01>\n" );
+
+  for ( i = 0; i < RTEMS_ARRAY_SIZE( test_sizes ); ++i ) {
+    size_t   size;
+    uint64_t copy;
+    uint64_t loan;
+
+    size = test_sizes[ i ];
+
+    /* Warm up the caches */
+    (void) test_copy( ctx, size );
+    (void) test_loan( ctx, size );
+
+    copy = test_copy( ctx, size );
+    loan = test_loan( ctx, size );
+
+    printf( "  <MessageSize bytes=\"%zu\">\n", size );
+    print_mode( "Copy", size, copy );
+    print_mode( "Loan", size, loan );
+    printf( "  </MessageSize>\n" );
+  }
+
+  printf( "</TestTimeMessageLoan01>\n" );
+}
+
+static void Init( rtems_task_argument arg )
+{
+  test_context *ctx;
+
+  (void) arg;
+
+  TEST_BEGIN();
+
+  ctx = &test_instance;
+  create_queue( ctx );
+  test_loan_semantics( ctx );
+  test_retry_waiters( ctx );
+  test_posix_loan_semantics();
+  test_throughput( ctx );
+  test_delete_with_loan( ctx );
+
+  TEST_END();
+  rtems_test_exit( 0 );
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+
+#define CONFIGURE_MAXIMUM_TASKS 3
+
+#define CONFIGURE_MAXIMUM_MESSAGE_QUEUES 1
+
+#define CONFIGURE_MAXIMUM_POSIX_MESSAGE_QUEUES 1
+
+#define CONFIGURE_MESSAGE_BUFFER_MEMORY \
+  CONFIGURE_MESSAGE_BUFFERS_FOR_QUEUE( 2, 16 )
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_INIT_TASK_PRIORITY 2
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
@@ -0,0 +1,259 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/*
+ * Copyright (C) 2026 On-Line Applications Research Corporation (OAR)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "tmacros.h"
+
+#include <errno.h>
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+
+#include <rtems.h>
+#include <rtems/printer.h>
+#include <rtems/test-info.h>
+
+const char rtems_test_name[] = "TMPRINTKLOG 1";
+
+#if defined(RTEMS_SMP)
+#define CPU_COUNT 4
+#else
+#define CPU_COUNT 1
+#endif
+
+#define BUFFER_SIZE 32768
+
+#define LOG_COUNT 256
+
+#define CAPTURE_SIZE 64
+
+typedef struct {
+  rtems_test_parallel_context base;
+  uint64_t duration[CPU_COUNT][CPU_COUNT];
+  uint32_t records;
+  uint32_t lost;
+  bool line_start;
+  size_t capture_count;
+  char capture[CAPTURE_SIZE];
+} test_context;
+
+static test_context test_instance;
+
+static void test_output_char(char c)
+{
+  test_context *ctx = &test_instance;
+
+  if (ctx->line_start && c == '[') {
+    ++ctx->records;
+  }
+
+  ctx->line_start = c == '\n';
+
+  if (ctx->capture_count < CAPTURE_SIZE - 1) {
+    ctx->capture[ctx->capture_count] = c;
+    ++ctx->capture_count;
+  }
+}
+
+static uint32_t test_get_lost(void)
+{
+  uint32_t cpu_index;
+  uint32_t lost = 0;
+
+  for (cpu_index = 0; cpu_index < CPU_COUNT; ++cpu_index) {
+    lost += rtems_printk_log_get_lost(cpu_index);
+  }
+
+  return lost;
+}
+
+static void test_start(test_context *ctx)
+{
+  rtems_printk_log_config config;
+  int rv;
+
+  memset(&config, 0, sizeof(config));
+  config.buffer_size = BUFFER_SIZE - 1;
+  config.task_priority = 250;
+  config.output_char = test_output_char;
+
+  rv = rtems_printk_log_start(&config);
+  rtems_test_assert(rv == EINVAL);
+
+  config.buffer_size = BUFFER_SIZE;
+  ctx->line_start = true;
+  rv = rtems_printk_log_start(&config);
+  rtems_test_assert(rv == 0);
+
+  rv = rtems_printk_log_start(&config);
+  rtems_test_assert(rv == EBUSY);
+}
+
+static void test_format(test_context *ctx)
+{
+  rtems_printer printer;
+  int n;
+
+  n = rtems_printk_log("hello %i\n", 42);
+  rtems_test_assert(n == 9);
+
+  rtems_printk_log_drain();
+  rtems_test_assert(ctx->records == 1);
+  rtems_test_assert(ctx->capture[0] == '[');
+  rtems_test_assert(strstr(ctx->capture, "] hello 42\n") != NULL);
+
+  rtems_print_printer_printk_log(&printer);
+  n = rtems_printf(&printer, "world\n");
+  rtems_test_assert(n == 6);
+
+  rtems_printk_log_drain();
+  rtems_test_assert(ctx->records == 2);
+  rtems_test_assert(test_get_lost() == 0);
+}
+
+static rtems_interval test_init(
+  rtems_test_parallel_context *base,
+  void *arg,
+  size_t active_workers
+)
+{
+  test_context *ctx = (test_context *) base;
+
+  ctx->records = 0;
+  ctx->lost = test_get_lost();
+
+  return rtems_clock_get_ticks_per_second();
+}
+
+static void test_log_body(
+  rtems_test_parallel_context *base,
+  void *arg,
+  size_t active_workers,
+  size_t worker_index
+)
+{
+  test_context *ctx = (test_context *) base;
+  uint64_t begin;
+  uint32_t i;
+
+  begin = rtems_clock_get_uptime_nanoseconds();
+
+  for (i = 0; i < LOG_COUNT; ++i) {
+    rtems_printk_log("worker %zu message %" PRIu32 "\n", worker_index, i);
+  }
+
+  ctx->duration[active_workers - 1][worker_index] =
+    rtems_clock_get_uptime_nanoseconds() - begin;
+}
+
+static void test_log_fini(
+  rtems_test_parallel_context *base,
+  void *arg,
+  size_t active_workers
+)
+{
+  test_context *ctx = (test_context *) base;
+  uint32_t lost;
+  size_t i;
+
+  rtems_printk_log_drain();
+  lost = test_get_lost() - ctx->lost;
+  rtems_test_assert(ctx->records + lost == active_workers * LOG_COUNT);
+
+  printf(
+    "  <Log activeWorker=\"%zu\" lost=\"%" PRIu32 "\">\n",
+    active_workers,
+    lost
+  );
+
+  for (i = 0; i < active_workers; ++i) {
+    printf(
+      "    <NanosecondsPerCall worker=\"%zu\">%" PRIu64
+        "</NanosecondsPerCall>\n",
+      i,
+      ctx->duration[active_workers - 1][i] / LOG_COUNT
+    );
+  }
+
+  printf("  </Log>\n");
+}
+
+static const rtems_test_parallel_job test_jobs[] = {
+  {
+    .init = test_init,
+    .body = test_log_body,
+    .fini = test_log_fini,
+    .cascade = true
+  }
+};
+
+static void Init(rtems_task_argument arg)
+{
+  test_context *ctx = &test_instance;
+  const char *test = "TestTimePrintkLog01";
+
+  TEST_BEGIN();
+
+  test_start(ctx);
+  test_format(ctx);
+
+  printf("<%s>\n", test);
+
+  rtems_test_parallel(
+    &ctx->base,
+    NULL,
+    &test_jobs[0],
+    RTEMS_ARRAY_SIZE(test_jobs)
+  );
+
+  printf("</%s>\n", test);
+
+  TEST_END();
+  rtems_test_exit(0);
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+
+#define CONFIGURE_MAXIMUM_TASKS (CPU_COUNT + 1)
+
+#define CONFIGURE_MAXIMUM_TIMERS 1
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT_TASK_PRIORITY 2
+
+#define CONFIGURE_MAXIMUM_PROCESSORS CPU_COUNT
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
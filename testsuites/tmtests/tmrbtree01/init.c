@@ -0,0 +1,266 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/*
+ * Copyright (C) 2026 On-Line Applications Research Corporation (OAR)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "tmacros.h"
+
+#include <inttypes.h>
+#include <stdio.h>
+
+#include <rtems.h>
+#include <rtems/score/rbtreeimpl.h>
+#include <rtems/score/rbtreecompact.h>
+
+const char rtems_test_name[] = "TMRBTREE 1";
+
+#define NODE_COUNT 512
+
+#define ROUNDS 16
+
+typedef struct {
+  int         key;
+  RBTree_Node Node;
+} test_node;
+
+typedef struct {
+  int                 key;
+  RBTree_Counted_node Node;
+} test_counted_node;
+
+typedef struct {
+  test_node         nodes[ NODE_COUNT ];
+  test_counted_node counted_nodes[ NODE_COUNT ];
+  uint64_t          insert;
+  uint64_t          iterate;
+  uint64_t          extract;
+} test_context;
+
+static test_context test_instance;
+
+static bool less( const void *left, const RBTree_Node *right )
+{
+  const int       *the_left;
+  const test_node *the_right;
+
+  the_left = left;
+  the_right = RTEMS_CONTAINER_OF( right, test_node, Node );
+
+  return *the_left < the_right->key;
+}
+
+static bool counted_less( const void *left, const RBTree_Compact_node *right )
+{
+  const int               *the_left;
+  const test_counted_node *the_right;
+
+  the_left = left;
+  the_right = RTEMS_CONTAINER_OF(
+    _RBTree_Counted_Node( right ),
+    test_counted_node,
+    Node
+  );
+
+  return *the_left < the_right->key;
+}
+
+static int get_key( size_t i )
+{
+  /* Use a pseudo-random permutation of the indices as keys */
+  return (int) ( ( i * 317 ) % NODE_COUNT );
+}
+
+static void reset( test_context *ctx )
+{
+  ctx->insert = 0;
+  ctx->iterate = 0;
+  ctx->extract = 0;
+}
+
+static void test_rbtree( test_context *ctx )
+{
+  uint32_t round;
+
+  reset( ctx );
+
+  for ( round = 0; round < ROUNDS; ++round ) {
+    RBTree_Control     tree;
+    const RBTree_Node *node;
+    size_t             i;
+    uint64_t           t0;
+    uint64_t           t1;
+
+    _RBTree_Initialize_empty( &tree );
+
+    for ( i = 0; i < NODE_COUNT; ++i ) {
+      ctx->nodes[ i ].key = get_key( i );
+      _RBTree_Initialize_node( &ctx->nodes[ i ].Node );
+    }
+
+    t0 = rtems_clock_get_uptime_nanoseconds();
+
+    for ( i = 0; i < NODE_COUNT; ++i ) {
+      test_node *tn;
+
+      tn = &ctx->nodes[ i ];
+      _RBTree_Insert_inline( &tree, &tn->Node, &tn->key, less );
+    }
+
+    t1 = rtems_clock_get_uptime_nanoseconds();
+    ctx->insert += t1 - t0;
+    t0 = t1;
+    node = _RBTree_Minimum( &tree );
+
+    while ( node != NULL ) {
+      node = _RBTree_Successor( node );
+    }
+
+    t1 = rtems_clock_get_uptime_nanoseconds();
+    ctx->iterate += t1 - t0;
+    t0 = t1;
+
+    for ( i = 0; i < NODE_COUNT; ++i ) {
+      _RBTree_Extract( &tree, &ctx->nodes[ i ].Node );
+    }
+
+    t1 = rtems_clock_get_uptime_nanoseconds();
+    ctx->extract += t1 - t0;
+    rtems_test_assert( _RBTree_Is_empty( &tree ) );
+  }
+}
+
+static void test_counted_rbtree( test_context *ctx )
+{
+  uint32_t round;
+
+  reset( ctx );
+
+  for ( round = 0; round < ROUNDS; ++round ) {
+    RBTree_Compact_control     tree;
+    const RBTree_Compact_node *node;
+    size_t                     i;
+    uint64_t                   t0;
+    uint64_t                   t1;
+
+    _RBTree_Compact_Initialize_empty( &tree );
+
+    for ( i = 0; i < NODE_COUNT; ++i ) {
+      ctx->counted_nodes[ i ].key = get_key( i );
+    }
+
+    t0 = rtems_clock_get_uptime_nanoseconds();
+
+    for ( i = 0; i < NODE_COUNT; ++i ) {
+      test_counted_node *cn;
+
+      cn = &ctx->counted_nodes[ i ];
+      _RBTree_Counted_Insert_inline(
+        &tree,
+        &cn->Node,
+        &cn->key,
+        counted_less
+      );
+    }
+
+    t1 = rtems_clock_get_uptime_nanoseconds();
+    ctx->insert += t1 - t0;
+    t0 = t1;
+    node = _RBTree_Compact_Minimum( &tree );
+
+    while ( node != NULL ) {
+      node = _RBTree_Compact_Successor( node );
+    }
+
+    t1 = rtems_clock_get_uptime_nanoseconds();
+    ctx->iterate += t1 - t0;
+    t0 = t1;
+
+    for ( i = 0; i < NODE_COUNT; ++i ) {
+      _RBTree_Counted_Extract( &tree, &ctx->counted_nodes[ i ].Node );
+    }
+
+    t1 = rtems_clock_get_uptime_nanoseconds();
+    ctx->extract += t1 - t0;
+    rtems_test_assert( _RBTree_Compact_Is_empty( &tree ) );
+  }
+}
+
+static void print_cost( const test_context *ctx, const char *name )
+{
+  uint64_t count;
+
+  count = (uint64_t) ROUNDS * NODE_COUNT;
+  printf(
+    "  <%s nodes=\"%d\" rounds=\"%d\" insertNanoseconds=\"%" PRIu64
+      "\" iterateNanoseconds=\"%" PRIu64 "\" extractNanoseconds=\"%" PRIu64
+      "\"/>\n",
+    name,
+    NODE_COUNT,
+    ROUNDS,
+    ctx->insert / count,
+    ctx->iterate / count,
+    ctx->extract / count
+  );
+}
+
+static void Init( rtems_task_argument arg )
+{
+  test_context *ctx;
+
+  (void) arg;
+
+  TEST_BEGIN();
+
+  ctx = &test_instance;
+  printf( "<TestTimeRBTree01>\n" );
+
+  test_rbtree( ctx );
+  print_cost( ctx, "RBTree" );
+
+  test_counted_rbtree( ctx );
+  print_cost( ctx, "RBTreeCounted" );
+
+  printf( "</TestTimeRBTree01>\n" );
+
+  TEST_END();
+  rtems_test_exit( 0 );
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+
+#define CONFIGURE_MAXIMUM_TASKS 1
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
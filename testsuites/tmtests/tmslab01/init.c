@@ -0,0 +1,348 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/*
+ * Copyright (C) 2026 On-Line Applications Research Corporation (OAR)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "tmacros.h"
+
+#include <fcntl.h>
+#include <inttypes.h>
+#include <semaphore.h>
+#include <stdio.h>
+#include <string.h>
+
+#include <rtems.h>
+#include <rtems/score/objectimpl.h>
+#include <rtems/score/wkspace.h>
+
+const char rtems_test_name[] = "TMSLAB 1";
+
+#define OBJECT_COUNT 64
+
+#define ROUNDS 32
+
+#define SLAB_OBJECT_SIZE 48
+
+typedef struct {
+  rtems_id  tasks[ OBJECT_COUNT ];
+  rtems_id  semaphores[ OBJECT_COUNT ];
+  rtems_id  message_queues[ OBJECT_COUNT ];
+  sem_t    *named_semaphores[ OBJECT_COUNT ];
+  void     *objects[ OBJECT_COUNT ];
+} test_context;
+
+static test_context test_instance;
+
+static void test_slab_semantics( test_context *ctx )
+{
+  Workspace_Slab_information info[ WORKSPACE_SLAB_CLASS_COUNT ];
+  uint32_t                   reclaimed;
+  size_t                     i;
+
+  _Objects_Allocator_lock();
+
+  for ( i = 0; i < OBJECT_COUNT; ++i ) {
+    ctx->objects[ i ] = _Workspace_Slab_allocate( SLAB_OBJECT_SIZE );
+    rtems_test_assert( ctx->objects[ i ] != NULL );
+    rtems_test_assert(
+      ( (uintptr_t) ctx->objects[ i ] % CPU_HEAP_ALIGNMENT ) == 0
+    );
+    memset( ctx->objects[ i ], 0xff, SLAB_OBJECT_SIZE );
+  }
+
+  _Workspace_Slab_get_information( info );
+  rtems_test_assert( info[ 2 ].object_size >= SLAB_OBJECT_SIZE );
+  rtems_test_assert( info[ 2 ].slab_count > 0 );
+  rtems_test_assert( info[ 2 ].used_object_count >= OBJECT_COUNT );
+
+  for ( i = 0; i < OBJECT_COUNT; ++i ) {
+    _Workspace_Slab_free( ctx->objects[ i ], SLAB_OBJECT_SIZE );
+  }
+
+  reclaimed = _Workspace_Slab_reclaim();
+  _Workspace_Slab_get_information( info );
+  rtems_test_assert( info[ 2 ].empty_slab_count <= 1 );
+  rtems_test_assert( info[ 2 ].reclaimed_slab_count >= reclaimed );
+  rtems_test_assert( info[ 2 ].cached_object_count == 0 );
+
+  /* Sizes above the maximum slab object size use the workspace directly */
+  ctx->objects[ 0 ] = _Workspace_Slab_allocate(
+    WORKSPACE_SLAB_MAXIMUM_OBJECT_SIZE + 1
+  );
+  rtems_test_assert( ctx->objects[ 0 ] != NULL );
+  _Workspace_Slab_free(
+    ctx->objects[ 0 ],
+    WORKSPACE_SLAB_MAXIMUM_OBJECT_SIZE + 1
+  );
+
+  _Workspace_Slab_free( NULL, SLAB_OBJECT_SIZE );
+  _Objects_Allocator_unlock();
+}
+
+static uint64_t test_allocate_free(
+  test_context  *ctx,
+  void        *( *allocate )( size_t ),
+  void         ( *release )( void *, size_t )
+)
+{
+  uint64_t t0;
+  uint64_t t1;
+  uint32_t round;
+
+  _Objects_Allocator_lock();
+  t0 = rtems_clock_get_uptime_nanoseconds();
+
+  for ( round = 0; round < ROUNDS; ++round ) {
+    size_t i;
+
+    for ( i = 0; i < OBJECT_COUNT; ++i ) {
+      ctx->objects[ i ] = ( *allocate )( SLAB_OBJECT_SIZE );
+    }
+
+    for ( i = 0; i < OBJECT_COUNT; ++i ) {
+      ( *release )( ctx->objects[ i ], SLAB_OBJECT_SIZE );
+    }
+  }
+
+  t1 = rtems_clock_get_uptime_nanoseconds();
+  _Objects_Allocator_unlock();
+  return t1 - t0;
+}
+
+static void heap_free( void *object, size_t size )
+{
+  (void) size;
+  _Workspace_Free( object );
+}
+
+static void create_objects( test_context *ctx, size_t begin, size_t step )
+{
+  size_t i;
+
+  for ( i = begin; i < OBJECT_COUNT; i += step ) {
+    rtems_status_code sc;
+    char              name[ 16 ];
+
+    sc = rtems_task_create(
+      rtems_build_name( 'T', 'A', 'S', 'K' ),
+      1,
+      RTEMS_MINIMUM_STACK_SIZE,
+      RTEMS_DEFAULT_MODES,
+      RTEMS_DEFAULT_ATTRIBUTES,
+      &ctx->tasks[ i ]
+    );
+    rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+    sc = rtems_semaphore_create(
+      rtems_build_name( 'S', 'E', 'M', 'A' ),
+      0,
+      RTEMS_COUNTING_SEMAPHORE,
+      0,
+      &ctx->semaphores[ i ]
+    );
+    rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+    sc = rtems_message_queue_create(
+      rtems_build_name( 'M', 'S', 'G', 'Q' ),
+      4,
+      16,
+      RTEMS_DEFAULT_ATTRIBUTES,
+      &ctx->message_queues[ i ]
+    );
+    rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+    snprintf( name, sizeof( name ), "/slab%zu", i );
+    ctx->named_semaphores[ i ] = sem_open( name, O_CREAT | O_EXCL, 0666, 0 );
+    rtems_test_assert( ctx->named_semaphores[ i ] != SEM_FAILED );
+  }
+}
+
+static void delete_objects( test_context *ctx, size_t begin, size_t step )
+{
+  size_t i;
+
+  for ( i = begin; i < OBJECT_COUNT; i += step ) {
+    rtems_status_code sc;
+    char              name[ 16 ];
+    int               rv;
+
+    sc = rtems_task_delete( ctx->tasks[ i ] );
+    rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+    sc = rtems_semaphore_delete( ctx->semaphores[ i ] );
+    rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+    sc = rtems_message_queue_delete( ctx->message_queues[ i ] );
+    rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+    rv = sem_close( ctx->named_semaphores[ i ] );
+    rtems_test_assert( rv == 0 );
+
+    snprintf( name, sizeof( name ), "/slab%zu", i );
+    rv = sem_unlink( name );
+    rtems_test_assert( rv == 0 );
+  }
+}
+
+static uint64_t test_churn( test_context *ctx )
+{
+  uint64_t t0;
+  uint64_t t1;
+  uint32_t round;
+
+  t0 = rtems_clock_get_uptime_nanoseconds();
+
+  for ( round = 0; round < ROUNDS; ++round ) {
+    /* Interleave the create and delete to fragment the workspace */
+    create_objects( ctx, 0, 1 );
+    delete_objects( ctx, 0, 2 );
+    create_objects( ctx, 0, 2 );
+    delete_objects( ctx, 1, 2 );
+    delete_objects( ctx, 0, 2 );
+  }
+
+  t1 = rtems_clock_get_uptime_nanoseconds();
+  return t1 - t0;
+}
+
+static void print_workspace( void )
+{
+  Heap_Information_block     heap_info;
+  Workspace_Slab_information slab_info[ WORKSPACE_SLAB_CLASS_COUNT ];
+  bool                       ok;
+  size_t                     i;
+
+  ok = rtems_workspace_get_information( &heap_info );
+  rtems_test_assert( ok );
+
+  printf(
+    "  <Workspace freeBlocks=\"%" PRIuPTR "\" largestFreeBlock=\"%" PRIuPTR
+      "\" freeBytes=\"%" PRIuPTR "\"/>\n",
+    (uintptr_t) heap_info.Free.number,
+    (uintptr_t) heap_info.Free.largest,
+    (uintptr_t) heap_info.Free.total
+  );
+
+  _Workspace_Slab_get_information( slab_info );
+
+  for ( i = 0; i < WORKSPACE_SLAB_CLASS_COUNT; ++i ) {
+    printf(
+      "  <SlabClass objectSize=\"%" PRIu32 "\" slabs=\"%" PRIu32
+        "\" emptySlabs=\"%" PRIu32 "\" usedObjects=\"%" PRIu32
+        "\" allocations=\"%" PRIu32 "\" reclaimedSlabs=\"%" PRIu32 "\"/>\n",
+      slab_info[ i ].object_size,
+      slab_info[ i ].slab_count,
+      slab_info[ i ].empty_slab_count,
+      slab_info[ i ].used_object_count,
+      slab_info[ i ].allocation_count,
+      slab_info[ i ].reclaimed_slab_count
+    );
+  }
+}
+
+static void print_cost( const char *name, uint64_t duration, uint64_t count )
+{
+  printf(
+    "  <%s operations=\"%" PRIu64 "\" nanosecondsPerOperation=\"%" PRIu64
+      "\"/>\n",
+    name,
+    count,
+    duration / count
+  );
+}
+
+static void test_performance( test_context *ctx )
+{
+  uint64_t pairs;
+
+  pairs = (uint64_t) ROUNDS * OBJECT_COUNT;
+
+  printf( "<TestTimeSlab01>\n" );
+
+  (void) test_allocate_free(
+    ctx,
+    _Workspace_Slab_allocate,
+    _Workspace_Slab_free
+  );
+  print_cost(
+    "SlabAllocateFree",
+    test_allocate_free( ctx, _Workspace_Slab_allocate, _Workspace_Slab_free ),
+    pairs
+  );
+  print_cost(
+    "HeapAllocateFree",
+    test_allocate_free( ctx, _Workspace_Allocate, heap_free ),
+    pairs
+  );
+
+  print_workspace();
+
+  /*
+   * Each round creates and deletes every task, semaphore, message queue, and
+   * named semaphore twice.
+   */
+  print_cost( "CreateDeleteChurn", test_churn( ctx ), 2 * 4 * pairs );
+
+  print_workspace();
+  printf( "</TestTimeSlab01>\n" );
+}
+
+static void Init( rtems_task_argument arg )
+{
+  test_context *ctx;
+
+  (void) arg;
+
+  TEST_BEGIN();
+
+  ctx = &test_instance;
+  test_slab_semantics( ctx );
+  test_performance( ctx );
+
+  TEST_END();
+  rtems_test_exit( 0 );
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+
+#define CONFIGURE_MAXIMUM_TASKS rtems_resource_unlimited( 8 )
+#define CONFIGURE_MAXIMUM_SEMAPHORES rtems_resource_unlimited( 8 )
+#define CONFIGURE_MAXIMUM_MESSAGE_QUEUES rtems_resource_unlimited( 8 )
+#define CONFIGURE_MAXIMUM_POSIX_SEMAPHORES rtems_resource_unlimited( 8 )
+
+#define CONFIGURE_UNIFIED_WORK_AREAS
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
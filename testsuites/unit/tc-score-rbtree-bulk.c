@@ -0,0 +1,398 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/**
+ * @file
+ *
+ * @ingroup TestsuitesUnitNoClock0
+ *
+ * @brief This source file contains test cases for _RBTree_Build_sorted(),
+ *   _RBTree_Extract_range(), and the counted red-black tree.
+ */
+
+/*
+ * Copyright (C) 2026 On-Line Applications Research Corporation (OAR)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <string.h>
+#include <rtems/score/rbtreeimpl.h>
+#include <rtems/score/rbtreecompact.h>
+
+#include <rtems/test.h>
+
+typedef struct {
+  int         id;
+  int         key;
+  RBTree_Node Node;
+} TestNode;
+
+static TestNode node_array[ 100 ];
+
+static int Color( const RBTree_Node *n )
+{
+  return RB_COLOR( n, Node );
+}
+
+static bool Less( const void *left, const RBTree_Node *right )
+{
+  const int       *the_left;
+  const TestNode *the_right;
+
+  the_left = left;
+  the_right = RTEMS_CONTAINER_OF( right, TestNode, Node );
+
+  return *the_left < the_right->key;
+}
+
+/*
+ * recursively checks tree. if the tree is built properly it should only
+ * be a depth of 7 function calls for 100 entries in the tree.
+ */
+static int VerifyTree( RBTree_Node *root )
+{
+  RBTree_Node *ln;
+  RBTree_Node *rn;
+  TestNode    *tn;
+  TestNode    *ltn;
+  TestNode    *rtn;
+  int          lh;
+  int          rh;
+
+  if ( root == NULL ) {
+    return 1;
+  }
+
+  ln = _RBTree_Left( root );
+  rn = _RBTree_Right( root );
+  tn = RTEMS_CONTAINER_OF( root, TestNode, Node );
+  ltn = RTEMS_CONTAINER_OF( ln, TestNode, Node );
+  rtn = RTEMS_CONTAINER_OF( rn, TestNode, Node );
+
+  /* Consecutive red links */
+  if (
+    Color( root ) == RB_RED &&
+    ( ( ln != NULL && Color( ln ) == RB_RED ) ||
+      ( rn != NULL && Color( rn ) == RB_RED ) )
+  ) {
+    return -1;
+  }
+
+  lh = VerifyTree ( ln );
+  rh = VerifyTree ( rn );
+
+  if ( lh == -1 || rh == -1 ) {
+    return -1;
+  }
+
+  /* Black height mismatch */
+  if ( lh != rh ) {
+    return -1;
+  }
+
+  /* Invalid binary search tree */
+  if (
+    ( ln != NULL && tn->key != ltn->key && !Less( &ltn->key, root ) ) ||
+    ( rn != NULL && tn->key != rtn->key && !Less( &tn->key, rn ) )
+  ) {
+    return -1;
+  }
+
+  /* Only count black links */
+  return Color( root ) == RB_BLACK ? lh + 1 : lh;
+}
+
+static uint32_t SimpleRandom( uint32_t v )
+{
+  v *= 1664525;
+  v += 1013904223;
+
+  return v;
+}
+
+static void BuildSorted( RBTree_Control *tree, size_t n )
+{
+  RBTree_Node *nodes[ RTEMS_ARRAY_SIZE( node_array ) ];
+  size_t       i;
+
+  for ( i = 0; i < n; ++i ) {
+    node_array[ i ].id = 1;
+    node_array[ i ].key = (int) i;
+    _RBTree_Initialize_node( &node_array[ i ].Node );
+    nodes[ i ] = &node_array[ i ].Node;
+  }
+
+  _RBTree_Initialize_empty( tree );
+  _RBTree_Build_sorted( tree, nodes, n );
+}
+
+static void CheckOrder( const RBTree_Control *tree, size_t n )
+{
+  const RBTree_Node *node;
+  size_t             count;
+  int                key;
+
+  count = 0;
+  key = -1;
+  node = _RBTree_Minimum( tree );
+
+  while ( node != NULL ) {
+    const TestNode *tn;
+
+    tn = RTEMS_CONTAINER_OF( node, TestNode, Node );
+    T_quiet_lt_int( key, tn->key );
+    T_quiet_eq_int( tn->id, 1 );
+    key = tn->key;
+    ++count;
+    node = _RBTree_Successor( node );
+  }
+
+  T_eq_sz( count, n );
+}
+
+static void MarkExtracted( RBTree_Node *node, void *visitor_arg )
+{
+  TestNode *tn;
+  int      *key;
+
+  tn = RTEMS_CONTAINER_OF( node, TestNode, Node );
+  key = visitor_arg;
+  T_quiet_eq_int( *key, tn->key );
+  T_quiet_true( _RBTree_Is_node_off_tree( node ) );
+  tn->id = 0;
+  ++( *key );
+}
+
+static void ExtractRange( size_t n, size_t first, size_t last )
+{
+  RBTree_Control tree;
+  size_t         count;
+  int            key;
+
+  BuildSorted( &tree, n );
+  key = (int) first;
+  count = _RBTree_Extract_range(
+    &tree,
+    &node_array[ first ].Node,
+    &node_array[ last ].Node,
+    MarkExtracted,
+    &key
+  );
+  T_eq_sz( count, last - first + 1 );
+  T_eq_int( key, (int) last + 1 );
+  T_ne_int( VerifyTree( _RBTree_Root( &tree ) ), -1 );
+  CheckOrder( &tree, n - count );
+}
+
+typedef struct {
+  int                 key;
+  RBTree_Counted_node Node;
+} CountedNode;
+
+static CountedNode counted_array[ 100 ];
+
+static bool CountedLess( const void *left, const RBTree_Compact_node *right )
+{
+  const int         *the_left;
+  const CountedNode *the_right;
+
+  the_left = left;
+  the_right = RTEMS_CONTAINER_OF(
+    _RBTree_Counted_Node( right ),
+    CountedNode,
+    Node
+  );
+
+  return *the_left < the_right->key;
+}
+
+static int VerifyCountedTree( const RBTree_Compact_node *root )
+{
+  const RBTree_Compact_node *ln;
+  const RBTree_Compact_node *rn;
+  int                        lh;
+  int                        rh;
+
+  if ( root == NULL ) {
+    return 1;
+  }
+
+  ln = root->left;
+  rn = root->right;
+
+  /* Consecutive red links */
+  if (
+    _RBTree_Compact_Is_red( root ) &&
+    ( _RBTree_Compact_Is_red( ln ) || _RBTree_Compact_Is_red( rn ) )
+  ) {
+    return -1;
+  }
+
+  /* Invalid parent links */
+  if (
+    ( ln != NULL && _RBTree_Compact_Parent( ln ) != root ) ||
+    ( rn != NULL && _RBTree_Compact_Parent( rn ) != root )
+  ) {
+    return -1;
+  }
+
+  /* Invalid subtree count */
+  if (
+    _RBTree_Counted_Subtree_count( root ) != 1 +
+      _RBTree_Counted_Subtree_count( ln ) +
+      _RBTree_Counted_Subtree_count( rn )
+  ) {
+    return -1;
+  }
+
+  lh = VerifyCountedTree( ln );
+  rh = VerifyCountedTree( rn );
+
+  if ( lh == -1 || rh == -1 ) {
+    return -1;
+  }
+
+  /* Black height mismatch */
+  if ( lh != rh ) {
+    return -1;
+  }
+
+  /* Only count black links */
+  return _RBTree_Compact_Is_red( root ) ? lh : lh + 1;
+}
+
+static void CheckCountedTree(
+  const RBTree_Compact_control *tree,
+  const bool                   *inserted
+)
+{
+  size_t rank;
+  size_t i;
+
+  T_quiet_false( _RBTree_Compact_Is_red( tree->root ) );
+  T_quiet_ne_int( VerifyCountedTree( tree->root ), -1 );
+  rank = 0;
+
+  for ( i = 0; i < RTEMS_ARRAY_SIZE( counted_array ); ++i ) {
+    RBTree_Counted_node *node;
+
+    node = &counted_array[ i ].Node;
+
+    if ( inserted[ i ] ) {
+      T_quiet_eq_sz( _RBTree_Counted_Rank( node ), rank );
+      T_quiet_eq_ptr( _RBTree_Counted_Nth( tree, rank ), node );
+      ++rank;
+    } else {
+      T_quiet_true( _RBTree_Compact_Is_node_off_tree( &node->Node ) );
+    }
+  }
+
+  T_quiet_eq_sz( _RBTree_Counted_Size( tree ), rank );
+  T_quiet_null( _RBTree_Counted_Nth( tree, rank ) );
+}
+
+/*
+ * Call _RBTree_Build_sorted() for trees of all sizes up to 100 nodes and check
+ * the tree properties.
+ */
+T_TEST_CASE( RBTreeBuildSorted )
+{
+  size_t n;
+
+  for ( n = 0; n <= RTEMS_ARRAY_SIZE( node_array ); ++n ) {
+    RBTree_Control tree;
+
+    BuildSorted( &tree, n );
+    T_ne_int( VerifyTree( _RBTree_Root( &tree ) ), -1 );
+    CheckOrder( &tree, n );
+  }
+}
+
+/*
+ * Call _RBTree_Extract_range() for a sample set of ranges.
+ */
+T_TEST_CASE( RBTreeExtractRange )
+{
+  size_t n;
+
+  n = RTEMS_ARRAY_SIZE( node_array );
+
+  /*
+   * Extract small ranges.  The nodes are extracted one by one.
+   */
+  ExtractRange( n, 0, 0 );
+  ExtractRange( n, 50, 52 );
+  ExtractRange( n, n - 1, n - 1 );
+
+  /*
+   * Extract large ranges.  The remaining nodes are rebuilt into a new tree.
+   */
+  ExtractRange( n, 0, n - 1 );
+  ExtractRange( n, 0, 90 );
+  ExtractRange( n, 10, n - 1 );
+  ExtractRange( n, 5, 94 );
+}
+
+/*
+ * Call _RBTree_Counted_Insert_inline() and _RBTree_Counted_Extract() in a
+ * random order and check the tree properties, _RBTree_Counted_Nth(), and
+ * _RBTree_Counted_Rank().
+ */
+T_TEST_CASE( RBTreeCounted )
+{
+  RBTree_Compact_control tree;
+  bool                   inserted[ RTEMS_ARRAY_SIZE( counted_array ) ];
+  uint32_t               v;
+  size_t                 i;
+
+  _RBTree_Compact_Initialize_empty( &tree );
+  memset( inserted, 0, sizeof( inserted ) );
+  v = 0xdeadbeef;
+
+  for ( i = 0; i < RTEMS_ARRAY_SIZE( counted_array ); ++i ) {
+    counted_array[ i ].key = (int) i;
+    _RBTree_Compact_Set_off_tree( &counted_array[ i ].Node.Node );
+  }
+
+  for ( i = 0; i < 10000; ++i ) {
+    size_t       j;
+    CountedNode *cn;
+
+    j = ( v >> 13 ) % RTEMS_ARRAY_SIZE( counted_array );
+    cn = &counted_array[ j ];
+
+    if ( inserted[ j ] ) {
+      inserted[ j ] = false;
+      _RBTree_Counted_Extract( &tree, &cn->Node );
+    } else {
+      inserted[ j ] = true;
+      _RBTree_Counted_Insert_inline( &tree, &cn->Node, &cn->key, CountedLess );
+    }
+
+    CheckCountedTree( &tree, inserted );
+    v = SimpleRandom( v );
+  }
+}